@@ -34,6 +34,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <common_types.h>
+#include <checksum/checksum.h>
 
 /*
  * Verify the ACPI table size, checksum and signature
@@ -47,7 +48,7 @@ int check_acpi_table(const char *signature,
 	{
 		rc = ACPI_ERR_BADINPUT;
 	}
-	else if (!verify_checksum((COMMON_UINT8 *)p_table, p_table->header.length))
+	else if (byte_sum8(p_table, p_table->header.length) != 0)
 	{
 		rc = ACPI_ERR_CHECKSUMFAIL;
 	}
@@ -92,6 +92,64 @@ int nfit_get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit)
 	return result;
 }
 
+/*
+ * Binary search a sorted parsed_nfit index for the entries with a key.
+ * Returns the number found and points pp_entries at the first of them.
+ */
+static int find_nfit_index_entries(const struct nfit_index_entry *p_index, const int count,
+		const unsigned int key, const struct nfit_index_entry **pp_entries)
+{
+	int low = 0;
+	int high = count;
+	while (low < high)
+	{
+		int mid = low + ((high - low) / 2);
+		if (p_index[mid].key < key)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	int found = 0;
+	while ((low + found) < count && p_index[low + found].key == key)
+	{
+		found++;
+	}
+	*pp_entries = found ? &p_index[low] : NULL;
+	return found;
+}
+
+int nfit_find_region_mappings_by_handle(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned int handle, const struct nfit_index_entry **pp_entries)
+{
+	return find_nfit_index_entries(p_parsed_nfit->region_mappings_by_handle,
+			p_parsed_nfit->region_mapping_count, handle, pp_entries);
+}
+
+int nfit_find_region_mappings_by_spa_index(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned short spa_index, const struct nfit_index_entry **pp_entries)
+{
+	return find_nfit_index_entries(p_parsed_nfit->region_mappings_by_spa_index,
+			p_parsed_nfit->region_mapping_count, spa_index, pp_entries);
+}
+
+const struct control_region *nfit_find_control_region(
+		const struct parsed_nfit *p_parsed_nfit, const unsigned short index)
+{
+	const struct control_region *p_control_region = NULL;
+	const struct nfit_index_entry *p_entry = NULL;
+	if (find_nfit_index_entries(p_parsed_nfit->control_regions_by_index,
+			p_parsed_nfit->control_region_count, index, &p_entry))
+	{
+		p_control_region = &p_parsed_nfit->control_region_list[p_entry->position];
+	}
+	return p_control_region;
+}
+
 /*
  * Print a descriptive version of an NFIT error
  */
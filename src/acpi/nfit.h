@@ -112,6 +112,12 @@ int nfit_get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit);
  */
 void free_parsed_nfit(struct parsed_nfit *p_parsed_nfit);
 
+/*
+ * Copy a parsed nfit structure, its lists and indexes into a new allocation.
+ * Returns NULL if out of memory.
+ */
+struct parsed_nfit *nfit_copy_parsed_nfit(const struct parsed_nfit *p_parsed_nfit);
+
 /*
  * Parse raw NFIT data into a parsed_nfit structure.
  * The caller is responsible for freeing the parsed_nfit structure.
@@ -119,6 +125,27 @@ void free_parsed_nfit(struct parsed_nfit *p_parsed_nfit);
 int nfit_parse_raw_nfit(unsigned char *buffer, size_t buffer_size,
 	struct parsed_nfit** pp_parsed_nfit);
 
+/*
+ * Find the region mappings for a DIMM handle in a pre-parsed NFIT.
+ * Returns the number found and points pp_entries at the first of them.
+ */
+int nfit_find_region_mappings_by_handle(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned int handle, const struct nfit_index_entry **pp_entries);
+
+/*
+ * Find the region mappings for an SPA range index in a pre-parsed NFIT.
+ * Returns the number found and points pp_entries at the first of them.
+ */
+int nfit_find_region_mappings_by_spa_index(const struct parsed_nfit *p_parsed_nfit,
+		const unsigned short spa_index, const struct nfit_index_entry **pp_entries);
+
+/*
+ * Find the control region with the given index in a pre-parsed NFIT.
+ * Returns NULL if there isn't one.
+ */
+const struct control_region *nfit_find_control_region(
+		const struct parsed_nfit *p_parsed_nfit, const unsigned short index);
+
 /*
  * Print a parsed_nfit structure
  */
@@ -53,24 +53,23 @@ int populate_interleave_set_dimm_info(struct nfit_interleave_set *p_interleave_s
 		const struct parsed_nfit *p_parsed_nfit)
 {
 	int result = NFIT_SUCCESS;
-	for (int i = 0; i < p_parsed_nfit->region_mapping_count; i++)
+	const struct nfit_index_entry *p_entries = NULL;
+	int mapping_count = nfit_find_region_mappings_by_spa_index(p_parsed_nfit,
+			p_interleave_set->id, &p_entries);
+	for (int i = 0; i < mapping_count; i++)
 	{
-		if (p_parsed_nfit->region_mapping_list[i].spa_index == p_interleave_set->id)
+		const struct region_mapping *p_mapping =
+				&p_parsed_nfit->region_mapping_list[p_entries[i].position];
+		if (!is_dimm_already_added(p_mapping->handle, p_interleave_set))
 		{
-			if (!is_dimm_already_added(
-					p_parsed_nfit->region_mapping_list[i].handle,
-					p_interleave_set))
-			{
-				p_interleave_set->dimms[p_interleave_set->dimm_count] =
-					p_parsed_nfit->region_mapping_list[i].handle;
-				p_interleave_set->dimm_region_pdas[p_interleave_set->dimm_count] =
-					p_parsed_nfit->region_mapping_list[i].physical_address_region_base;
-				p_interleave_set->dimm_region_offsets[p_interleave_set->dimm_count] =
-					p_parsed_nfit->region_mapping_list[i].region_offset;
-				p_interleave_set->dimm_sizes[p_interleave_set->dimm_count] =
-					p_parsed_nfit->region_mapping_list[i].region_size;
-				p_interleave_set->dimm_count++;
-			}
+			p_interleave_set->dimms[p_interleave_set->dimm_count] = p_mapping->handle;
+			p_interleave_set->dimm_region_pdas[p_interleave_set->dimm_count] =
+				p_mapping->physical_address_region_base;
+			p_interleave_set->dimm_region_offsets[p_interleave_set->dimm_count] =
+				p_mapping->region_offset;
+			p_interleave_set->dimm_sizes[p_interleave_set->dimm_count] =
+				p_mapping->region_size;
+			p_interleave_set->dimm_count++;
 		}
 	}
 	return result;
@@ -28,364 +28,452 @@
 #include "nfit.h"
 #include <stdlib.h>
 #include <string.h>
-#include <stdlib.h>
 
 /*
- * Allocate space for and copy the spa table
- * to the parsed_nfit structure.
+ * Alignment of each list within the parsed_nfit allocation
  */
-int add_spa_to_parsed_nfit(
-	struct parsed_nfit *p_nfit,
-	const struct spa *p_spa_table)
+#define	NFIT_ARENA_ALIGN	sizeof (unsigned long long)
+#define	NFIT_ARENA_SIZE(size)	(((size) + NFIT_ARENA_ALIGN - 1) & ~(NFIT_ARENA_ALIGN - 1))
+
+/*
+ * Read the type and length from an extension table header
+ */
+static void get_nfit_table_header(const unsigned char *p_table,
+	unsigned short *p_type, unsigned short *p_length)
+{
+	*p_type = (unsigned short)(p_table[0] | (p_table[1] << 8));
+	*p_length = (unsigned short)(p_table[2] | (p_table[3] << 8));
+}
+
+/*
+ * Walk the NFIT extension tables and count each type,
+ * leaving the lists in p_nfit unallocated.
+ */
+static int count_nfit_tables(const unsigned char *buffer, size_t buffer_size,
+	struct parsed_nfit *p_nfit)
 {
 	int result = NFIT_SUCCESS;
+	size_t offset = sizeof (struct nfit);
 
-	// allocate space for the extension table
-	p_nfit->spa_list =
-		(struct spa *)
-		realloc(p_nfit->spa_list,
-		sizeof (struct spa) *
-		(p_nfit->spa_count + 1));
-	if (!p_nfit->spa_list)
+	while (offset < buffer_size && result == NFIT_SUCCESS)
 	{
-		result = NFIT_ERR_NOMEMORY;
+		unsigned short type;
+		unsigned short length;
+
+		// check the length for validity
+		if ((offset + 4) > buffer_size)
+		{
+			result = NFIT_ERR_BADNFIT;
+			break;
+		}
+		get_nfit_table_header(buffer + offset, &type, &length);
+		if (length == 0 || (length + offset) > buffer_size)
+		{
+			result = NFIT_ERR_BADNFIT;
+			break;
+		}
+
+		switch (type)
+		{
+			case 0: // spa extension table
+				p_nfit->spa_count++;
+				break;
+			case 1: // region_mapping extension table
+				p_nfit->region_mapping_count++;
+				break;
+			case 2: // interleave extension table
+				p_nfit->interleave_count++;
+				break;
+			case 3: // smbios_management_info extension table
+				p_nfit->smbios_management_info_count++;
+				break;
+			case 4: // control_region extension table
+				p_nfit->control_region_count++;
+				break;
+			case 5: // block_data_window_region extension table
+				p_nfit->block_data_window_region_count++;
+				break;
+			case 6: // flush_hint_address extension table
+				p_nfit->flush_hint_address_count++;
+				break;
+			default:
+				break;
+		}
+		offset += length;
 	}
-	else
+
+	return result;
+}
+
+/*
+ * Hand out the next chunk of the parsed_nfit allocation
+ */
+static void *take_from_nfit_arena(unsigned char **pp_next, size_t size)
+{
+	void *p_chunk = NULL;
+	if (size)
 	{
-		// copy the extension table
-		memmove(&p_nfit->spa_list[p_nfit->spa_count],
-			p_spa_table,
-			sizeof (struct spa));
-		p_nfit->spa_count++;
+		p_chunk = *pp_next;
+		*pp_next += NFIT_ARENA_SIZE(size);
 	}
+	return p_chunk;
+}
 
-	return result;
+/*
+ * Copy the spa table into the next preallocated
+ * slot of the parsed_nfit structure.
+ */
+int add_spa_to_parsed_nfit(
+	struct parsed_nfit *p_nfit,
+	const struct spa *p_spa_table,
+	const size_t length)
+{
+	// a short table leaves the remaining fields zeroed
+	memmove(&p_nfit->spa_list[p_nfit->spa_count],
+		p_spa_table,
+		length < sizeof (struct spa) ? length : sizeof (struct spa));
+	p_nfit->spa_count++;
+
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the region_mapping table
- * to the parsed_nfit structure.
+ * Copy the region_mapping table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_region_mapping_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct region_mapping *p_region_mapping_table)
+	const struct region_mapping *p_region_mapping_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
-
-	// allocate space for the extension table
-	p_nfit->region_mapping_list =
-		(struct region_mapping *)
-		realloc(p_nfit->region_mapping_list,
-		sizeof (struct region_mapping) *
-		(p_nfit->region_mapping_count + 1));
-	if (!p_nfit->region_mapping_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->region_mapping_list[p_nfit->region_mapping_count],
-			p_region_mapping_table,
-			sizeof (struct region_mapping));
-		p_nfit->region_mapping_count++;
-	}
+	// a short table leaves the remaining fields zeroed
+	memmove(&p_nfit->region_mapping_list[p_nfit->region_mapping_count],
+		p_region_mapping_table,
+		length < sizeof (struct region_mapping) ? length : sizeof (struct region_mapping));
+	p_nfit->region_mapping_count++;
 
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the interleave table
- * to the parsed_nfit structure.
+ * Copy the interleave table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_interleave_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct interleave *p_interleave_table)
+	const struct interleave *p_interleave_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
+	// a short table leaves the remaining fields zeroed
+	memmove(&p_nfit->interleave_list[p_nfit->interleave_count],
+		p_interleave_table,
+		length < sizeof (struct interleave) ? length : sizeof (struct interleave));
+	p_nfit->interleave_count++;
 
-	// allocate space for the extension table
-	p_nfit->interleave_list =
-		(struct interleave *)
-		realloc(p_nfit->interleave_list,
-		sizeof (struct interleave) *
-		(p_nfit->interleave_count + 1));
-	if (!p_nfit->interleave_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->interleave_list[p_nfit->interleave_count],
-			p_interleave_table,
-			sizeof (struct interleave));
-		p_nfit->interleave_count++;
-	}
-
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the smbios_management_info table
- * to the parsed_nfit structure.
+ * Copy the smbios_management_info table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_smbios_management_info_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct smbios_management_info *p_smbios_management_info_table)
+	const struct smbios_management_info *p_smbios_management_info_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
+	// a short table leaves the remaining fields zeroed
+	memmove(&p_nfit->smbios_management_info_list[p_nfit->smbios_management_info_count],
+		p_smbios_management_info_table,
+		length < sizeof (struct smbios_management_info) ? length : sizeof (struct smbios_management_info));
+	p_nfit->smbios_management_info_count++;
 
-	// allocate space for the extension table
-	p_nfit->smbios_management_info_list =
-		(struct smbios_management_info *)
-		realloc(p_nfit->smbios_management_info_list,
-		sizeof (struct smbios_management_info) *
-		(p_nfit->smbios_management_info_count + 1));
-	if (!p_nfit->smbios_management_info_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->smbios_management_info_list[p_nfit->smbios_management_info_count],
-			p_smbios_management_info_table,
-			sizeof (struct smbios_management_info));
-		p_nfit->smbios_management_info_count++;
-	}
-
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the control_region table
- * to the parsed_nfit structure.
+ * Copy the control_region table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_control_region_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct control_region *p_control_region_table)
+	const struct control_region *p_control_region_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
-
-	// allocate space for the extension table
-	p_nfit->control_region_list =
-		(struct control_region *)
-		realloc(p_nfit->control_region_list,
-		sizeof (struct control_region) *
-		(p_nfit->control_region_count + 1));
-	if (!p_nfit->control_region_list)
-	{
-		result = NFIT_ERR_NOMEMORY;
-	}
-	else
-	{
-		// copy the extension table
-		memmove(&p_nfit->control_region_list[p_nfit->control_region_count],
-			p_control_region_table,
-			sizeof (struct control_region));
-		p_nfit->control_region_count++;
-	}
+	// a short table leaves the remaining fields zeroed
+	memmove(&p_nfit->control_region_list[p_nfit->control_region_count],
+		p_control_region_table,
+		length < sizeof (struct control_region) ? length : sizeof (struct control_region));
+	p_nfit->control_region_count++;
 
-	return result;
+	return NFIT_SUCCESS;
 }
 /*
- * Allocate space for and copy the block_data_window_region table
- * to the parsed_nfit structure.
+ * Copy the block_data_window_region table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_block_data_window_region_to_parsed_nfit(
 	struct parsed_nfit *p_nfit,
-	const struct block_data_window_region *p_block_data_window_region_table)
+	const struct block_data_window_region *p_block_data_window_region_table,
+	const size_t length)
 {
-	int result = NFIT_SUCCESS;
+	// a short table leaves the remaining fields zeroed
+	memmove(&p_nfit->block_data_window_region_list[p_nfit->block_data_window_region_count],
+		p_block_data_window_region_table,
+		length < sizeof (struct block_data_window_region) ? length : sizeof (struct block_data_window_region));
+	p_nfit->block_data_window_region_count++;
 
-	// allocate space for the extension table
-	p_nfit->block_data_window_region_list =
-		(struct block_data_window_region *)
-		realloc(p_nfit->block_data_window_region_list,
-		sizeof (struct block_data_window_region) *
-		(p_nfit->block_data_window_region_count + 1));
-	if (!p_nfit->block_data_window_region_list)
+	return NFIT_SUCCESS;
+}
+/*
+ * Copy the flush_hint_address table into the next preallocated
+ * slot of the parsed_nfit structure.
+ */
+int add_flush_hint_address_to_parsed_nfit(
+	struct parsed_nfit *p_nfit,
+	const struct flush_hint_address *p_flush_hint_address_table,
+	const size_t length)
+{
+	// a short table leaves the remaining fields zeroed
+	memmove(&p_nfit->flush_hint_address_list[p_nfit->flush_hint_address_count],
+		p_flush_hint_address_table,
+		length < sizeof (struct flush_hint_address) ? length : sizeof (struct flush_hint_address));
+	p_nfit->flush_hint_address_count++;
+
+	return NFIT_SUCCESS;
+}
+
+/*
+ * Order index entries by key, then by list position so
+ * entries sharing a key stay in table order.
+ */
+static int compare_nfit_index_entries(const void *p_a, const void *p_b)
+{
+	const struct nfit_index_entry *p_entry_a = (const struct nfit_index_entry *)p_a;
+	const struct nfit_index_entry *p_entry_b = (const struct nfit_index_entry *)p_b;
+	int diff;
+	if (p_entry_a->key != p_entry_b->key)
 	{
-		result = NFIT_ERR_NOMEMORY;
+		diff = (p_entry_a->key < p_entry_b->key) ? -1 : 1;
 	}
 	else
 	{
-		// copy the extension table
-		memmove(&p_nfit->block_data_window_region_list[p_nfit->block_data_window_region_count],
-			p_block_data_window_region_table,
-			sizeof (struct block_data_window_region));
-		p_nfit->block_data_window_region_count++;
+		diff = p_entry_a->position - p_entry_b->position;
 	}
-
-	return result;
+	return diff;
 }
+
 /*
- * Allocate space for and copy the flush_hint_address table
- * to the parsed_nfit structure.
+ * Build the lookup indexes over the parsed lists
  */
-int add_flush_hint_address_to_parsed_nfit(
-	struct parsed_nfit *p_nfit,
-	const struct flush_hint_address *p_flush_hint_address_table)
+static void index_parsed_nfit(struct parsed_nfit *p_nfit)
 {
-	int result = NFIT_SUCCESS;
-
-	// allocate space for the extension table
-	p_nfit->flush_hint_address_list =
-		(struct flush_hint_address *)
-		realloc(p_nfit->flush_hint_address_list,
-		sizeof (struct flush_hint_address) *
-		(p_nfit->flush_hint_address_count + 1));
-	if (!p_nfit->flush_hint_address_list)
+	for (int i = 0; i < p_nfit->region_mapping_count; i++)
 	{
-		result = NFIT_ERR_NOMEMORY;
+		p_nfit->region_mappings_by_handle[i].key = p_nfit->region_mapping_list[i].handle;
+		p_nfit->region_mappings_by_handle[i].position = i;
+		p_nfit->region_mappings_by_spa_index[i].key = p_nfit->region_mapping_list[i].spa_index;
+		p_nfit->region_mappings_by_spa_index[i].position = i;
 	}
-	else
+	for (int i = 0; i < p_nfit->control_region_count; i++)
 	{
-		// copy the extension table
-		memmove(&p_nfit->flush_hint_address_list[p_nfit->flush_hint_address_count],
-			p_flush_hint_address_table,
-			sizeof (struct flush_hint_address));
-		p_nfit->flush_hint_address_count++;
+		p_nfit->control_regions_by_index[i].key = p_nfit->control_region_list[i].index;
+		p_nfit->control_regions_by_index[i].position = i;
 	}
 
-	return result;
+	qsort(p_nfit->region_mappings_by_handle, p_nfit->region_mapping_count,
+		sizeof (struct nfit_index_entry), compare_nfit_index_entries);
+	qsort(p_nfit->region_mappings_by_spa_index, p_nfit->region_mapping_count,
+		sizeof (struct nfit_index_entry), compare_nfit_index_entries);
+	qsort(p_nfit->control_regions_by_index, p_nfit->control_region_count,
+		sizeof (struct nfit_index_entry), compare_nfit_index_entries);
 }
+
 /*
  * Parse raw NFIT data into a parsed_nfit structure.
+ * The tables are counted first so the structure, its lists and
+ * indexes are a single allocation.
  * The caller is responsible for freeing the parsed_nfit structure.
  */
 int nfit_parse_raw_nfit(unsigned char *buffer, size_t buffer_size,
 	struct parsed_nfit ** pp_parsed_nfit)
 {
 	int result = NFIT_SUCCESS;
+	struct parsed_nfit counts;
 
-	if (buffer_size == 0 || buffer == NULL)
+	if (buffer_size < sizeof (struct nfit) || buffer == NULL)
 	{
 		return NFIT_ERR_BADINPUT;
 	}
 
-	*pp_parsed_nfit = calloc(1, sizeof (struct parsed_nfit));
-	if (!(*pp_parsed_nfit))
+	memset(&counts, 0, sizeof (counts));
+	result = count_nfit_tables(buffer, buffer_size, &counts);
+	if (result != NFIT_SUCCESS)
+	{
+		return result;
+	}
+
+	size_t arena_size = NFIT_ARENA_SIZE(sizeof (struct parsed_nfit))
+		+ NFIT_ARENA_SIZE(sizeof (struct spa) * counts.spa_count)
+		+ NFIT_ARENA_SIZE(sizeof (struct region_mapping) * counts.region_mapping_count)
+		+ NFIT_ARENA_SIZE(sizeof (struct interleave) * counts.interleave_count)
+		+ NFIT_ARENA_SIZE(sizeof (struct smbios_management_info) * counts.smbios_management_info_count)
+		+ NFIT_ARENA_SIZE(sizeof (struct control_region) * counts.control_region_count)
+		+ NFIT_ARENA_SIZE(sizeof (struct block_data_window_region) * counts.block_data_window_region_count)
+		+ NFIT_ARENA_SIZE(sizeof (struct flush_hint_address) * counts.flush_hint_address_count)
+		+ (2 * NFIT_ARENA_SIZE(sizeof (struct nfit_index_entry) * counts.region_mapping_count))
+		+ NFIT_ARENA_SIZE(sizeof (struct nfit_index_entry) * counts.control_region_count);
+
+	unsigned char *p_arena = calloc(1, arena_size);
+	if (!p_arena)
 	{
 		return NFIT_ERR_NOMEMORY;
 	}
+	unsigned char *p_next = p_arena;
+	*pp_parsed_nfit = take_from_nfit_arena(&p_next, sizeof (struct parsed_nfit));
+	(*pp_parsed_nfit)->size = arena_size;
+	(*pp_parsed_nfit)->spa_list = take_from_nfit_arena(&p_next,
+		sizeof (struct spa) * counts.spa_count);
+	(*pp_parsed_nfit)->region_mapping_list = take_from_nfit_arena(&p_next,
+		sizeof (struct region_mapping) * counts.region_mapping_count);
+	(*pp_parsed_nfit)->interleave_list = take_from_nfit_arena(&p_next,
+		sizeof (struct interleave) * counts.interleave_count);
+	(*pp_parsed_nfit)->smbios_management_info_list = take_from_nfit_arena(&p_next,
+		sizeof (struct smbios_management_info) * counts.smbios_management_info_count);
+	(*pp_parsed_nfit)->control_region_list = take_from_nfit_arena(&p_next,
+		sizeof (struct control_region) * counts.control_region_count);
+	(*pp_parsed_nfit)->block_data_window_region_list = take_from_nfit_arena(&p_next,
+		sizeof (struct block_data_window_region) * counts.block_data_window_region_count);
+	(*pp_parsed_nfit)->flush_hint_address_list = take_from_nfit_arena(&p_next,
+		sizeof (struct flush_hint_address) * counts.flush_hint_address_count);
+	(*pp_parsed_nfit)->region_mappings_by_handle = take_from_nfit_arena(&p_next,
+		sizeof (struct nfit_index_entry) * counts.region_mapping_count);
+	(*pp_parsed_nfit)->region_mappings_by_spa_index = take_from_nfit_arena(&p_next,
+		sizeof (struct nfit_index_entry) * counts.region_mapping_count);
+	(*pp_parsed_nfit)->control_regions_by_index = take_from_nfit_arena(&p_next,
+		sizeof (struct nfit_index_entry) * counts.control_region_count);
 
 	// copy the NFIT header
 	memmove(&(*pp_parsed_nfit)->nfit, buffer, sizeof (struct nfit));
 	size_t offset = sizeof (struct nfit);
 
-	// copy the NFIT extension tables
+	// copy the NFIT extension tables, already validated by the count
 	while (offset < buffer_size && result == NFIT_SUCCESS)
 	{
-		unsigned short type = *(buffer + offset);
-		unsigned short length = *(buffer + offset + 2);
-
-		// check the length for validity
-		if (length == 0 || (length + offset) > buffer_size)
-		{
-			result = NFIT_ERR_BADNFIT;
-			break;
-		}
+		unsigned short type;
+		unsigned short length;
+		get_nfit_table_header(buffer + offset, &type, &length);
 
-		// create the extension table
 		switch (type)
 		{
 			case 0: // spa extension table
 			{
 				result = add_spa_to_parsed_nfit(
-					*pp_parsed_nfit, (struct spa *)(buffer + offset));
+					*pp_parsed_nfit, (struct spa *)(buffer + offset), length);
 				break;
 			}
 			case 1: // region_mapping extension table
 			{
 				result = add_region_mapping_to_parsed_nfit(
-					*pp_parsed_nfit, (struct region_mapping *)(buffer + offset));
+					*pp_parsed_nfit, (struct region_mapping *)(buffer + offset), length);
 				break;
 			}
 			case 2: // interleave extension table
 			{
 				result = add_interleave_to_parsed_nfit(
-					*pp_parsed_nfit, (struct interleave *)(buffer + offset));
+					*pp_parsed_nfit, (struct interleave *)(buffer + offset), length);
 				break;
 			}
 			case 3: // smbios_management_info extension table
 			{
 				result = add_smbios_management_info_to_parsed_nfit(
-					*pp_parsed_nfit, (struct smbios_management_info *)(buffer + offset));
+					*pp_parsed_nfit, (struct smbios_management_info *)(buffer + offset), length);
 				break;
 			}
 			case 4: // control_region extension table
 			{
 				result = add_control_region_to_parsed_nfit(
-					*pp_parsed_nfit, (struct control_region *)(buffer + offset));
+					*pp_parsed_nfit, (struct control_region *)(buffer + offset), length);
 				break;
 			}
 			case 5: // block_data_window_region extension table
 			{
 				result = add_block_data_window_region_to_parsed_nfit(
-					*pp_parsed_nfit, (struct block_data_window_region *)(buffer + offset));
+					*pp_parsed_nfit, (struct block_data_window_region *)(buffer + offset), length);
 				break;
 			}
 			case 6: // flush_hint_address extension table
 			{
 				result = add_flush_hint_address_to_parsed_nfit(
-					*pp_parsed_nfit, (struct flush_hint_address *)(buffer + offset));
+					*pp_parsed_nfit, (struct flush_hint_address *)(buffer + offset), length);
 				break;
 			}
+
 			default:
 				break;
 		}
 		offset += length;
 	} // end while extension tables
 
-	// on error, free the parsed_nfit struct
-	if (result != NFIT_SUCCESS && *pp_parsed_nfit)
-	{
-		free_parsed_nfit(*pp_parsed_nfit);
-	}
+	index_parsed_nfit(*pp_parsed_nfit);
 
 	return result;
 }
 
 /*
- * Clean up a parsed nfit structure
+ * Clean up a parsed nfit structure.
+ * The lists and indexes share its allocation.
  */
 void free_parsed_nfit(struct parsed_nfit *p_parsed_nfit)
 {
-	if (p_parsed_nfit)
+	free(p_parsed_nfit);
+}
+
+/*
+ * Point a list of a copied parsed_nfit at the same offset in the copy's allocation
+ */
+static void *rebase_nfit_list(const struct parsed_nfit *p_original,
+	struct parsed_nfit *p_copy, const void *p_list)
+{
+	void *p_rebased = NULL;
+	if (p_list)
 	{
-		if (p_parsed_nfit->spa_count &&
-			p_parsed_nfit->spa_list)
-		{
-			free(p_parsed_nfit->spa_list);
-		}
-		if (p_parsed_nfit->region_mapping_count &&
-			p_parsed_nfit->region_mapping_list)
-		{
-			free(p_parsed_nfit->region_mapping_list);
-		}
-		if (p_parsed_nfit->interleave_count &&
-			p_parsed_nfit->interleave_list)
-		{
-			free(p_parsed_nfit->interleave_list);
-		}
-		if (p_parsed_nfit->smbios_management_info_count &&
-			p_parsed_nfit->smbios_management_info_list)
-		{
-			free(p_parsed_nfit->smbios_management_info_list);
-		}
-		if (p_parsed_nfit->control_region_count &&
-			p_parsed_nfit->control_region_list)
-		{
-			free(p_parsed_nfit->control_region_list);
-		}
-		if (p_parsed_nfit->block_data_window_region_count &&
-			p_parsed_nfit->block_data_window_region_list)
-		{
-			free(p_parsed_nfit->block_data_window_region_list);
-		}
-		if (p_parsed_nfit->flush_hint_address_count &&
-			p_parsed_nfit->flush_hint_address_list)
+		p_rebased = (unsigned char *)p_copy +
+			((const unsigned char *)p_list - (const unsigned char *)p_original);
+	}
+	return p_rebased;
+}
+
+/*
+ * Copy a parsed nfit structure into a new allocation.
+ * The caller is responsible for freeing the copy.
+ */
+struct parsed_nfit *nfit_copy_parsed_nfit(const struct parsed_nfit *p_parsed_nfit)
+{
+	struct parsed_nfit *p_copy = NULL;
+	if (p_parsed_nfit && p_parsed_nfit->size >= sizeof (struct parsed_nfit))
+	{
+		p_copy = malloc(p_parsed_nfit->size);
+		if (p_copy)
 		{
-			free(p_parsed_nfit->flush_hint_address_list);
+			memmove(p_copy, p_parsed_nfit, p_parsed_nfit->size);
+			p_copy->spa_list = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->spa_list);
+			p_copy->region_mapping_list = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->region_mapping_list);
+			p_copy->interleave_list = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->interleave_list);
+			p_copy->smbios_management_info_list = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->smbios_management_info_list);
+			p_copy->control_region_list = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->control_region_list);
+			p_copy->block_data_window_region_list = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->block_data_window_region_list);
+			p_copy->flush_hint_address_list = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->flush_hint_address_list);
+			p_copy->region_mappings_by_handle = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->region_mappings_by_handle);
+			p_copy->region_mappings_by_spa_index = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->region_mappings_by_spa_index);
+			p_copy->control_regions_by_index = rebase_nfit_list(p_parsed_nfit, p_copy,
+				p_parsed_nfit->control_regions_by_index);
 		}
 	}
-	free(p_parsed_nfit);
-}
\ No newline at end of file
+	return p_copy;
+}
@@ -35,54 +35,61 @@ extern "C"
 #endif
 
 /*
- * Allocate space for and copy the spa table
- * to the parsed_nfit structure.
+ * Copy the spa table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_spa_to_parsed_nfit(
 	struct parsed_nfit* p_nfit, 
-	const struct spa *p_spa_table);
+	const struct spa *p_spa_table,
+	const size_t length);
 /*
- * Allocate space for and copy the region_mapping table
- * to the parsed_nfit structure.
+ * Copy the region_mapping table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_region_mapping_to_parsed_nfit(
 	struct parsed_nfit* p_nfit, 
-	const struct region_mapping *p_region_mapping_table);
+	const struct region_mapping *p_region_mapping_table,
+	const size_t length);
 /*
- * Allocate space for and copy the interleave table
- * to the parsed_nfit structure.
+ * Copy the interleave table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_interleave_to_parsed_nfit(
 	struct parsed_nfit* p_nfit, 
-	const struct interleave *p_interleave_table);
+	const struct interleave *p_interleave_table,
+	const size_t length);
 /*
- * Allocate space for and copy the smbios_management_info table
- * to the parsed_nfit structure.
+ * Copy the smbios_management_info table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_smbios_management_info_to_parsed_nfit(
 	struct parsed_nfit* p_nfit, 
-	const struct smbios_management_info *p_smbios_management_info_table);
+	const struct smbios_management_info *p_smbios_management_info_table,
+	const size_t length);
 /*
- * Allocate space for and copy the control_region table
- * to the parsed_nfit structure.
+ * Copy the control_region table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_control_region_to_parsed_nfit(
 	struct parsed_nfit* p_nfit, 
-	const struct control_region *p_control_region_table);
+	const struct control_region *p_control_region_table,
+	const size_t length);
 /*
- * Allocate space for and copy the block_data_window_region table
- * to the parsed_nfit structure.
+ * Copy the block_data_window_region table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_block_data_window_region_to_parsed_nfit(
 	struct parsed_nfit* p_nfit, 
-	const struct block_data_window_region *p_block_data_window_region_table);
+	const struct block_data_window_region *p_block_data_window_region_table,
+	const size_t length);
 /*
- * Allocate space for and copy the flush_hint_address table
- * to the parsed_nfit structure.
+ * Copy the flush_hint_address table into the next preallocated
+ * slot of the parsed_nfit structure.
  */
 int add_flush_hint_address_to_parsed_nfit(
 	struct parsed_nfit* p_nfit, 
-	const struct flush_hint_address *p_flush_hint_address_table);
+	const struct flush_hint_address *p_flush_hint_address_table,
+	const size_t length);
 #ifdef __cplusplus
 }
 #endif
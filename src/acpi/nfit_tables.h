@@ -29,6 +29,7 @@
 #define _NFIT_INTERFACE_NFIT_TABLES_H_
 
 #include "common.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -166,6 +167,15 @@ struct flush_hint_address
 	unsigned char reserved[6];
 } )
 
+/*
+ * A lookup index entry for a parsed_nfit list
+ */
+struct nfit_index_entry
+{
+	unsigned int key;
+	int position; // position of the table in the indexed list
+};
+
 struct parsed_nfit
 {
 	struct nfit nfit;
@@ -183,6 +193,11 @@ struct parsed_nfit
 	struct block_data_window_region *block_data_window_region_list;
 	int flush_hint_address_count;
 	struct flush_hint_address *flush_hint_address_list;
+	size_t size; // bytes in the allocation holding the structure, its lists and indexes
+	// sorted lookup indexes, entries with the same key are in table order
+	struct nfit_index_entry *region_mappings_by_handle;
+	struct nfit_index_entry *region_mappings_by_spa_index;
+	struct nfit_index_entry *control_regions_by_index;
 };
 
 #ifdef __cplusplus
@@ -33,6 +33,7 @@
 #include <persistence/lib_persistence.h>
 #include <cli/features/core/framework/CliHelper.h>
 #include <iomanip>
+#include <algorithm>
 #include <libinvm-cli/SyntaxErrorMissingValueResult.h>
 #include "ShowDeviceCommand.h"
 #include "ShowCommandPropertyUtilities.h"
@@ -77,6 +78,32 @@ static const IXP_PROP_KEY show_dimm_ixp_props[] =
 
 #define LEN_SHOW_DIMM_IXP_PROPS sizeof(show_dimm_ixp_props)/sizeof(IXP_PROP_KEY)
 
+// Releases the ixp context and properties of one DIMM however its scope is left
+struct IxpDimmScope
+{
+	struct ixp_context *ctx;
+	struct ixp_prop_info *props;
+	unsigned int numProps;
+
+	IxpDimmScope() : ctx(NULL), props(NULL), numProps(0) {}
+	~IxpDimmScope()
+	{
+		if (props)
+		{
+			ixp_free_props(props, numProps);
+			free(props);
+		}
+		if (ctx)
+		{
+			ixp_free_ctx(ctx);
+		}
+	}
+
+private:
+	IxpDimmScope(const IxpDimmScope &);
+	IxpDimmScope &operator=(const IxpDimmScope &);
+};
+
 ShowDeviceCommand::ShowDeviceCommand(core::device::DeviceService &service)
 	: m_service(service), m_pResult(NULL)
 {
@@ -443,6 +470,16 @@ void ShowDeviceCommand::createResults()
 	pList->setRoot(ROOT);
 	m_pResult = pList;
 
+	// read the status of all DIMMs in one batch rather than through each DIMM's details
+	for (size_t j = 0; j < m_props.size(); j++)
+	{
+		if (m_props[j].getName() == HEALTHSTATE && isPropertyDisplayed(m_props[j]))
+		{
+			m_service.loadDeviceStatuses(m_devices);
+			break;
+		}
+	}
+
 	for (size_t i = 0; i < m_devices.size(); i++)
 	{
 		framework::PropertyListResult value;
@@ -462,16 +499,18 @@ void ShowDeviceCommand::createResults()
 		// It's not using the properties array above as it's a little tricky to
 		// make these calls look like the C++ calls
 
-		struct ixp_context * ctx;
+		IxpDimmScope scope;
 		NVM_NFIT_DEVICE_HANDLE handle;
-		unsigned int numProps = 0;
+		unsigned int &numProps = scope.numProps;
 		handle.handle = m_devices[i].getDeviceHandle();
-		ixp_create_ctx_nfit_handle(&ctx, handle, (void *) NULL);
+		ixp_create_ctx_nfit_handle(&scope.ctx, handle, (void *) NULL);
+		struct ixp_context *ctx = scope.ctx;
 
 		// Malloc space for all properties that we might gather from ixp
 		// Not strictly necessary but it's simpler this way
-		struct ixp_prop_info * props = (struct ixp_prop_info *)malloc(sizeof(struct ixp_prop_info)
+		scope.props = (struct ixp_prop_info *)malloc(sizeof(struct ixp_prop_info)
 			*LEN_SHOW_DIMM_IXP_PROPS);
+		struct ixp_prop_info *props = scope.props;
 		if (props == NULL)
 		{
 			throw wbem::exception::NvmExceptionLibError(NVM_ERR_NOMEMORY);
@@ -486,8 +525,12 @@ void ShowDeviceCommand::createResults()
 			for (size_t i = 0; i < displayNames.size(); i++)
 			{
 				char * name = const_cast<char*>(displayNames[i].c_str());
+				// The lookup covers every ixp property, only display the ones
+				// show -dimm knows how to format
 				if (IXP_SUCCESS == ixp_get_prop_key_by_name(name,
-						(unsigned int)displayNames[i].size(), &key))
+						(unsigned int)displayNames[i].size(), &key) &&
+					std::find(show_dimm_ixp_props, show_dimm_ixp_props + LEN_SHOW_DIMM_IXP_PROPS,
+						key) != show_dimm_ixp_props + LEN_SHOW_DIMM_IXP_PROPS)
 				{
 					ixp_init_prop(&props[numProps], key);
 					numProps++;
@@ -495,19 +538,19 @@ void ShowDeviceCommand::createResults()
 
 				// Improperly named properties have already been handled
 			}
-			ixp_get_props(ctx, props, numProps);
+			ixp_get_props_batched(ctx, props, numProps);
 		}
 		// Process list of ixp-implemented properties, they are only shown
 		// in the "-a" case or if they're user specified
 		else if (m_displayOptions.isAll())
 		{
 			// Print out all ixp properties
-			numProps = LEN_SHOW_DIMM_IXP_PROPS;
 			for (unsigned int j = 0; j < LEN_SHOW_DIMM_IXP_PROPS; j++)
 			{
 				ixp_init_prop(&props[j], show_dimm_ixp_props[j]);
 			}
-			if (IXP_SUCCESS != ixp_get_props(ctx, props, LEN_SHOW_DIMM_IXP_PROPS))
+			numProps = LEN_SHOW_DIMM_IXP_PROPS;
+			if (IXP_SUCCESS != ixp_get_props_batched(ctx, props, LEN_SHOW_DIMM_IXP_PROPS))
 			{
 				throw wbem::exception::NvmExceptionLibError(NVM_ERR_UNKNOWN);
 			}
@@ -536,8 +579,6 @@ void ShowDeviceCommand::createResults()
 			}
 		}
 
-		ixp_free_props(props, numProps);
-		free(props);
 		////////////////////////////
 
 		pList->insert(ROOT, value);
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file contains the implementation of the checksum helpers. The SIMD kernels
+ * are selected at runtime based on the CPU, with a portable scalar fallback.
+ */
+
+#include <string.h>
+#include "checksum.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define	CHECKSUM_SSE2	1
+#include <emmintrin.h>
+#endif
+
+#if defined(CHECKSUM_SSE2) && (defined(_MSC_VER) || \
+		(defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define	CHECKSUM_AVX2	1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define	AVX2_TARGET
+#else
+#define	AVX2_TARGET	__attribute__((target("avx2")))
+#endif
+#endif
+
+/*
+ * Fold count 32-bit words into the running fletcher 64 sums
+ */
+typedef void (*fletcher64_kernel)(const COMMON_UINT8 *p_words, COMMON_UINT32 count,
+		COMMON_UINT32 *p_lo, COMMON_UINT32 *p_hi);
+
+static fletcher64_kernel g_fletcher64_kernel = NULL;
+
+static void fletcher64_scalar(const COMMON_UINT8 *p_words, COMMON_UINT32 count,
+		COMMON_UINT32 *p_lo, COMMON_UINT32 *p_hi)
+{
+	COMMON_UINT32 lo = *p_lo;
+	COMMON_UINT32 hi = *p_hi;
+	for (COMMON_UINT32 i = 0; i < count; i++)
+	{
+		COMMON_UINT32 word;
+		memcpy(&word, p_words + (i * sizeof (word)), sizeof (word));
+		lo += word;
+		hi += lo;
+	}
+	*p_lo = lo;
+	*p_hi = hi;
+}
+
+/*
+ * Combine per-lane sums from a SIMD kernel that ran over lanes * blocks words.
+ * Lane j saw words j, j + lanes, ... so lo = sum(a) and
+ * hi = lanes * sum(b) - sum(j * a[j]), all modulo 2^32.
+ */
+static void fletcher64_fold_lanes(const COMMON_UINT32 *p_a, const COMMON_UINT32 *p_b,
+		COMMON_UINT32 lanes, COMMON_UINT32 blocks, COMMON_UINT32 *p_lo, COMMON_UINT32 *p_hi)
+{
+	COMMON_UINT32 seg_lo = 0;
+	COMMON_UINT32 seg_hi = 0;
+	for (COMMON_UINT32 j = 0; j < lanes; j++)
+	{
+		seg_lo += p_a[j];
+		seg_hi += lanes * p_b[j] - j * p_a[j];
+	}
+	*p_hi += (lanes * blocks) * *p_lo + seg_hi;
+	*p_lo += seg_lo;
+}
+
+#ifdef CHECKSUM_SSE2
+static void fletcher64_sse2(const COMMON_UINT8 *p_words, COMMON_UINT32 count,
+		COMMON_UINT32 *p_lo, COMMON_UINT32 *p_hi)
+{
+	COMMON_UINT32 blocks = count / 4;
+	__m128i a = _mm_setzero_si128();
+	__m128i b = _mm_setzero_si128();
+	for (COMMON_UINT32 i = 0; i < blocks; i++)
+	{
+		a = _mm_add_epi32(a, _mm_loadu_si128((const __m128i *)(p_words + (i * 16))));
+		b = _mm_add_epi32(b, a);
+	}
+
+	COMMON_UINT32 lanes_a[4];
+	COMMON_UINT32 lanes_b[4];
+	_mm_storeu_si128((__m128i *)lanes_a, a);
+	_mm_storeu_si128((__m128i *)lanes_b, b);
+	fletcher64_fold_lanes(lanes_a, lanes_b, 4, blocks, p_lo, p_hi);
+	fletcher64_scalar(p_words + (blocks * 16), count % 4, p_lo, p_hi);
+}
+#endif
+
+#ifdef CHECKSUM_AVX2
+static AVX2_TARGET void fletcher64_avx2(const COMMON_UINT8 *p_words, COMMON_UINT32 count,
+		COMMON_UINT32 *p_lo, COMMON_UINT32 *p_hi)
+{
+	COMMON_UINT32 blocks = count / 8;
+	__m256i a = _mm256_setzero_si256();
+	__m256i b = _mm256_setzero_si256();
+	for (COMMON_UINT32 i = 0; i < blocks; i++)
+	{
+		a = _mm256_add_epi32(a, _mm256_loadu_si256((const __m256i *)(p_words + (i * 32))));
+		b = _mm256_add_epi32(b, a);
+	}
+
+	COMMON_UINT32 lanes_a[8];
+	COMMON_UINT32 lanes_b[8];
+	_mm256_storeu_si256((__m256i *)lanes_a, a);
+	_mm256_storeu_si256((__m256i *)lanes_b, b);
+	fletcher64_fold_lanes(lanes_a, lanes_b, 8, blocks, p_lo, p_hi);
+	fletcher64_scalar(p_words + (blocks * 32), count % 8, p_lo, p_hi);
+}
+
+/*
+ * Check the CPU and OS both support AVX2
+ */
+static int cpu_has_avx2()
+{
+	int has_avx2 = 0;
+#ifdef _MSC_VER
+	int regs[4];
+	__cpuid(regs, 0);
+	if (regs[0] >= 7)
+	{
+		__cpuid(regs, 1);
+		// OSXSAVE and AVX, then the OS must save the YMM state
+		if ((regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) &&
+				((_xgetbv(0) & 0x6) == 0x6))
+		{
+			__cpuidex(regs, 7, 0);
+			has_avx2 = (regs[1] & (1 << 5)) != 0;
+		}
+	}
+#else
+	__builtin_cpu_init();
+	has_avx2 = __builtin_cpu_supports("avx2");
+#endif
+	return has_avx2;
+}
+#endif
+
+/*
+ * Pick the fastest kernel the CPU supports. Racing callers pick the same one.
+ */
+static fletcher64_kernel get_fletcher64_kernel()
+{
+	fletcher64_kernel kernel = g_fletcher64_kernel;
+	if (kernel == NULL)
+	{
+		kernel = fletcher64_scalar;
+#ifdef CHECKSUM_SSE2
+		kernel = fletcher64_sse2;
+#endif
+#ifdef CHECKSUM_AVX2
+		if (cpu_has_avx2())
+		{
+			kernel = fletcher64_avx2;
+		}
+#endif
+		g_fletcher64_kernel = kernel;
+	}
+	return kernel;
+}
+
+COMMON_UINT64 fletcher64(const void *p_data,
+		const COMMON_UINT32 length, const COMMON_UINT32 skip_offset)
+{
+	const COMMON_UINT8 *p_bytes = (const COMMON_UINT8 *)p_data;
+	fletcher64_kernel kernel = get_fletcher64_kernel();
+	COMMON_UINT32 lo = 0;
+	COMMON_UINT32 hi = 0;
+	COMMON_UINT32 words = length / sizeof (COMMON_UINT32);
+
+	if (skip_offset < length)
+	{
+		COMMON_UINT32 skip_word = skip_offset / sizeof (COMMON_UINT32);
+		// the checksum field is two words unless it runs off the end
+		COMMON_UINT32 skip_words = (words - skip_word) < 2 ? (words - skip_word) : 2;
+
+		kernel(p_bytes, skip_word, &lo, &hi);
+		// lo += 0 for each zeroed word
+		hi += skip_words * lo;
+		kernel(p_bytes + ((skip_word + skip_words) * sizeof (COMMON_UINT32)),
+				words - skip_word - skip_words, &lo, &hi);
+	}
+	else
+	{
+		kernel(p_bytes, words, &lo, &hi);
+	}
+
+	return (COMMON_UINT64)hi << 32 | lo;
+}
+
+COMMON_UINT8 byte_sum8(const void *p_data, const COMMON_UINT32 length)
+{
+	const COMMON_UINT8 *p_bytes = (const COMMON_UINT8 *)p_data;
+	COMMON_UINT8 sum = 0;
+	COMMON_UINT32 i = 0;
+
+#ifdef CHECKSUM_SSE2
+	// sum of absolute differences against zero adds up 8 bytes per 64-bit lane
+	__m128i zero = _mm_setzero_si128();
+	__m128i acc = _mm_setzero_si128();
+	for (; (i + 16) <= length; i += 16)
+	{
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(p_bytes + i));
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(bytes, zero));
+	}
+	sum = (COMMON_UINT8)(_mm_cvtsi128_si32(acc) +
+			_mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+#endif
+
+	for (; i < length; i++)
+	{
+		sum += p_bytes[i];
+	}
+	return sum;
+}
+
+void set_byte_sum8(void *p_data, const COMMON_UINT32 length,
+		const COMMON_UINT32 checksum_offset)
+{
+	COMMON_UINT8 *p_bytes = (COMMON_UINT8 *)p_data;
+	p_bytes[checksum_offset] = 0;
+	p_bytes[checksum_offset] = (COMMON_UINT8)(0x100 - byte_sum8(p_bytes, length));
+}
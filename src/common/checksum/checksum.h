@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file contains the definitions of the checksum helpers shared by
+ * the namespace label and platform configuration data code.
+ */
+
+#ifndef CHECKSUM_H_
+#define	CHECKSUM_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <common_types.h>
+
+/*!
+ * Calculate a fletcher 64 checksum over 32-bit words, treating the 64-bit
+ * checksum field at skip_offset as zero.
+ * @param[in] p_data
+ * 		The data to checksum, length bytes long
+ * @param[in] length
+ * 		The number of bytes, must be a multiple of 4
+ * @param[in] skip_offset
+ * 		Byte offset of the embedded checksum, must be a multiple of 4.
+ * 		Pass a value >= length to checksum everything.
+ * @return
+ * 		The checksum, hi32 in the upper half and lo32 in the lower
+ */
+NVM_COMMON_API COMMON_UINT64 fletcher64(const void *p_data,
+		const COMMON_UINT32 length, const COMMON_UINT32 skip_offset);
+
+/*!
+ * Sum every byte of the data modulo 256
+ * @param[in] p_data
+ * 		The data to sum
+ * @param[in] length
+ * 		The number of bytes
+ * @return
+ * 		The 8-bit sum, 0 for a table with a valid checksum
+ */
+NVM_COMMON_API COMMON_UINT8 byte_sum8(const void *p_data, const COMMON_UINT32 length);
+
+/*!
+ * Set the byte at checksum_offset so the 8-bit sum of the data is zero
+ * @param[in,out] p_data
+ * 		The data to update
+ * @param[in] length
+ * 		The number of bytes
+ * @param[in] checksum_offset
+ * 		Byte offset of the checksum, must be less than length
+ */
+NVM_COMMON_API void set_byte_sum8(void *p_data, const COMMON_UINT32 length,
+		const COMMON_UINT32 checksum_offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_H_ */
@@ -33,6 +33,8 @@
 #include <openssl/pem.h>
 #include <openssl/bio.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <zlib.h>
 #include <string.h>
 #include <assert.h>
@@ -596,3 +598,507 @@ int rsa_decrypt(const COMMON_PATH rsaKeyFile, const COMMON_PATH encryptedFile,
 
 	return retval;
 }
+
+/*
+ * Encrypt len bytes and append them to the output file
+ */
+static int seal_write(int ofd, EVP_CIPHER_CTX *p_ctx, const COMMON_UINT8 *p_data, int len,
+		COMMON_UINT8 *p_cipher)
+{
+	int rc = NVM_SUCCESS;
+	int cipher_len = 0;
+	if (len > 0)
+	{
+		if (!EVP_EncryptUpdate(p_ctx, p_cipher, &cipher_len, p_data, len))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		else if (write(ofd, p_cipher, cipher_len) != cipher_len)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+	}
+	return rc;
+}
+
+/*
+ * Deflate the source file and encrypt the compressed stream as it is produced
+ */
+static int seal_stream(int sfd, int ofd, EVP_CIPHER_CTX *p_ctx)
+{
+	int rc = NVM_SUCCESS;
+	z_stream zvar;
+	memset(&zvar, 0, sizeof (zvar));
+	COMMON_UINT8 *p_input = malloc(COMPRESSION_PROCESS_BYTES);
+	COMMON_UINT8 *p_compressed = malloc(COMPRESSION_PROCESS_BYTES);
+	// GCM is a stream mode so ciphertext is never longer than its input
+	COMMON_UINT8 *p_cipher = malloc(COMPRESSION_PROCESS_BYTES);
+	if (!p_input || !p_compressed || !p_cipher)
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else if (deflateInit(&zvar, DFLT_COMPRESSION_LEVEL) != Z_OK)
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else
+	{
+		int flush = Z_NO_FLUSH;
+		while (rc == NVM_SUCCESS && flush != Z_FINISH)
+		{
+			ssize_t num_read = read(sfd, p_input, COMPRESSION_PROCESS_BYTES);
+			if (num_read < 0)
+			{
+				rc = NVM_ERR_BADFILE;
+				break;
+			}
+			flush = (num_read == 0) ? Z_FINISH : Z_NO_FLUSH;
+			zvar.avail_in = (uInt)num_read;
+			zvar.next_in = p_input;
+			do
+			{
+				zvar.avail_out = COMPRESSION_PROCESS_BYTES;
+				zvar.next_out = p_compressed;
+				if (deflate(&zvar, flush) == Z_STREAM_ERROR)
+				{
+					rc = NVM_ERR_UNKNOWN;
+				}
+				else
+				{
+					rc = seal_write(ofd, p_ctx, p_compressed,
+							COMPRESSION_PROCESS_BYTES - zvar.avail_out, p_cipher);
+				}
+			}
+			while (rc == NVM_SUCCESS && zvar.avail_out == 0);
+		}
+		deflateEnd(&zvar);
+	}
+	free(p_input);
+	free(p_compressed);
+	free(p_cipher);
+	return rc;
+}
+
+/*
+ * Wrap the session key with the RSA public key using OAEP padding
+ */
+static int wrap_session_key(EVP_PKEY *p_key, const COMMON_UINT8 *p_session_key,
+		COMMON_UINT8 *p_wrapped, int *p_wrapped_len)
+{
+	int rc = NVM_ERR_UNKNOWN;
+	size_t wrapped_len = (size_t)EVP_PKEY_size(p_key);
+	EVP_PKEY_CTX *p_pkey_ctx = EVP_PKEY_CTX_new(p_key, NULL);
+	if (p_pkey_ctx != NULL &&
+			EVP_PKEY_encrypt_init(p_pkey_ctx) > 0 &&
+			EVP_PKEY_CTX_set_rsa_padding(p_pkey_ctx, RSA_PKCS1_OAEP_PADDING) > 0 &&
+			EVP_PKEY_encrypt(p_pkey_ctx, p_wrapped, &wrapped_len,
+				p_session_key, SEALED_KEY_LEN) > 0)
+	{
+		*p_wrapped_len = (int)wrapped_len;
+		rc = NVM_SUCCESS;
+	}
+	EVP_PKEY_CTX_free(p_pkey_ctx);
+	return rc;
+}
+
+/*
+ * Unwrap a session key written by wrap_session_key with the RSA private key
+ */
+static int unwrap_session_key(EVP_PKEY *p_key, const COMMON_UINT8 *p_wrapped, int wrapped_len,
+		COMMON_UINT8 *p_session_key)
+{
+	int rc = NVM_ERR_BADFILE;
+	// the provider wants room for a full modulus even though only the key comes back
+	size_t key_len = (size_t)EVP_PKEY_size(p_key);
+	COMMON_UINT8 *p_plain = malloc(key_len);
+	EVP_PKEY_CTX *p_pkey_ctx = EVP_PKEY_CTX_new(p_key, NULL);
+	if (p_plain == NULL || p_pkey_ctx == NULL)
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else if (EVP_PKEY_decrypt_init(p_pkey_ctx) > 0 &&
+			EVP_PKEY_CTX_set_rsa_padding(p_pkey_ctx, RSA_PKCS1_OAEP_PADDING) > 0 &&
+			EVP_PKEY_decrypt(p_pkey_ctx, p_plain, &key_len, p_wrapped, wrapped_len) > 0 &&
+			key_len == SEALED_KEY_LEN)
+	{
+		memcpy(p_session_key, p_plain, SEALED_KEY_LEN);
+		rc = NVM_SUCCESS;
+	}
+	if (p_plain)
+	{
+		OPENSSL_cleanse(p_plain, EVP_PKEY_size(p_key));
+		free(p_plain);
+	}
+	EVP_PKEY_CTX_free(p_pkey_ctx);
+	return rc;
+}
+
+/*
+ * Compress and encrypt 'src_file'(INPUT) in a single pass, adds a CRYPTO_FILE_EXT file extension
+ */
+int compress_encrypt_file(const COMMON_PATH src_file, COMMON_PATH out_file)
+{
+	int sfd = -1;		// src_file
+	int efd = -1;		// encrypted file
+	int rc = NVM_SUCCESS;
+	EVP_PKEY *p_key = NULL;
+	BIO *bio = NULL;
+	EVP_CIPHER_CTX *p_ctx = NULL;
+	char temp_file[COMMON_PATH_LEN];
+#ifdef __WINDOWS__
+	int OS_flags = O_BINARY;
+#else
+	int OS_flags = 0;
+#endif
+	COMMON_UINT8 key[SEALED_KEY_LEN];
+	// magic, wrapped key length, wrapped key, IV; authenticated along with the data
+	COMMON_UINT8 *p_header = NULL;
+	int header_len = 0;
+
+	// Create a new file, verify the resulting name is within our max allowed length
+	s_strncpy(temp_file, COMMON_PATH_LEN, src_file, COMMON_PATH_LEN);
+	s_strncat(temp_file, COMMON_PATH_LEN, CRYPTO_FILE_EXT, sizeof (CRYPTO_FILE_EXT));
+	if (s_strnlen(temp_file, COMMON_PATH_LEN) > COMMON_PATH_LEN)
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else
+	{
+		s_strncpy(out_file, COMMON_PATH_LEN, temp_file, COMMON_PATH_LEN);
+
+		COMMON_PATH key_file;
+		if ((rc = get_key_file_path(key_file)) != COMMON_SUCCESS)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+		else if ((bio = BIO_new_file(key_file, "r")) == NULL ||
+				PEM_read_bio_PUBKEY(bio, &p_key, NULL, NULL) == NULL)
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		else if ((p_header = malloc(SEALED_FILE_MAGIC_LEN + 2 +
+				EVP_PKEY_size(p_key) + SEALED_IV_LEN)) == NULL)
+		{
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
+		{
+			// a fresh session key, wrapped once with the RSA public key
+			memcpy(p_header, SEALED_FILE_MAGIC, SEALED_FILE_MAGIC_LEN);
+			COMMON_UINT8 *p_wrapped = p_header + SEALED_FILE_MAGIC_LEN + 2;
+			int wrapped_len = 0;
+			if (RAND_bytes(key, SEALED_KEY_LEN) != 1 ||
+					wrap_session_key(p_key, key, p_wrapped, &wrapped_len) != NVM_SUCCESS ||
+					RAND_bytes(p_wrapped + wrapped_len, SEALED_IV_LEN) != 1)
+			{
+				rc = NVM_ERR_UNKNOWN;
+			}
+			else
+			{
+				p_header[SEALED_FILE_MAGIC_LEN] = (COMMON_UINT8)(wrapped_len >> 8);
+				p_header[SEALED_FILE_MAGIC_LEN + 1] = (COMMON_UINT8)wrapped_len;
+				header_len = SEALED_FILE_MAGIC_LEN + 2 + wrapped_len + SEALED_IV_LEN;
+			}
+		}
+
+		if (rc == NVM_SUCCESS)
+		{
+			struct stat statbuf;
+			if (stat(out_file, &statbuf) != -1)
+			{
+				unlink(out_file);
+			}
+
+			int aad_len = 0;
+			if ((sfd = open(src_file, O_RDONLY | OS_flags, 0)) == -1)
+			{
+				rc = NVM_ERR_BADFILE;
+			}
+			else if ((efd = open(out_file, O_RDWR | O_TRUNC | O_CREAT | O_EXCL | OS_flags,
+					GENERIC_NEW_FILE_PERMISSION)) == -1)
+			{
+				rc = NVM_ERR_BADFILE;
+			}
+			else if ((p_ctx = EVP_CIPHER_CTX_new()) == NULL)
+			{
+				rc = NVM_ERR_NOMEMORY;
+			}
+			else if (!EVP_EncryptInit_ex(p_ctx, EVP_aes_256_gcm(), NULL, NULL, NULL) ||
+					!EVP_CIPHER_CTX_ctrl(p_ctx, EVP_CTRL_GCM_SET_IVLEN, SEALED_IV_LEN, NULL) ||
+					!EVP_EncryptInit_ex(p_ctx, NULL, NULL, key,
+						p_header + header_len - SEALED_IV_LEN) ||
+					!EVP_EncryptUpdate(p_ctx, NULL, &aad_len, p_header, header_len))
+			{
+				rc = NVM_ERR_UNKNOWN;
+			}
+			else if (write(efd, p_header, header_len) != header_len)
+			{
+				rc = NVM_ERR_BADFILE;
+			}
+			else if ((rc = seal_stream(sfd, efd, p_ctx)) == NVM_SUCCESS)
+			{
+				COMMON_UINT8 tag[SEALED_TAG_LEN];
+				int final_len = 0;
+				if (!EVP_EncryptFinal_ex(p_ctx, tag, &final_len) ||
+						!EVP_CIPHER_CTX_ctrl(p_ctx, EVP_CTRL_GCM_GET_TAG, SEALED_TAG_LEN, tag))
+				{
+					rc = NVM_ERR_UNKNOWN;
+				}
+				else if (write(efd, tag, SEALED_TAG_LEN) != SEALED_TAG_LEN)
+				{
+					rc = NVM_ERR_BADFILE;
+				}
+			}
+		}
+	}
+
+	OPENSSL_cleanse(key, sizeof (key));
+	if (p_ctx)
+	{
+		EVP_CIPHER_CTX_free(p_ctx);
+	}
+	if (p_header)
+	{
+		free(p_header);
+	}
+	if (p_key != NULL)
+	{
+		EVP_PKEY_free(p_key);
+	}
+	if (bio != NULL)
+	{
+		BIO_free(bio);
+	}
+	if (efd != -1)
+	{
+		close(efd);
+
+		// Delete the corrupted output if we detect a failure
+		if (rc != NVM_SUCCESS)
+		{
+			delete_file(out_file, COMMON_PATH_LEN);
+		}
+	}
+	if (sfd != -1)
+	{
+		// src file is being replaced with an encrypted version
+		close(sfd);
+		sfd = -1;
+		if (rc == NVM_SUCCESS)
+		{
+			delete_file(src_file, COMMON_PATH_LEN);
+		}
+	}
+
+	return rc;
+}
+
+/*
+ * Decrypt len bytes, inflate them and append the result to the output file
+ */
+static int unseal_write(int dfd, EVP_CIPHER_CTX *p_ctx, z_stream *p_zvar,
+		const COMMON_UINT8 *p_data, int len, COMMON_UINT8 *p_plain, COMMON_UINT8 *p_output)
+{
+	int rc = NVM_SUCCESS;
+	int plain_len = 0;
+	if (len > 0)
+	{
+		if (!EVP_DecryptUpdate(p_ctx, p_plain, &plain_len, p_data, len))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		else
+		{
+			p_zvar->avail_in = (uInt)plain_len;
+			p_zvar->next_in = p_plain;
+			do
+			{
+				p_zvar->avail_out = COMPRESSION_PROCESS_BYTES;
+				p_zvar->next_out = p_output;
+				int zrc = inflate(p_zvar, Z_NO_FLUSH);
+				ssize_t num_done = COMPRESSION_PROCESS_BYTES - p_zvar->avail_out;
+				if (zrc != Z_OK && zrc != Z_STREAM_END && zrc != Z_BUF_ERROR)
+				{
+					rc = NVM_ERR_BADFILE;
+				}
+				else if (write(dfd, p_output, num_done) != num_done)
+				{
+					rc = NVM_ERR_BADFILE;
+				}
+			}
+			while (rc == NVM_SUCCESS && p_zvar->avail_out == 0);
+		}
+	}
+	return rc;
+}
+
+/*
+ * Decrypt and inflate everything after the header, holding back the trailing tag
+ */
+static int unseal_stream(int efd, int dfd, EVP_CIPHER_CTX *p_ctx)
+{
+	int rc = NVM_SUCCESS;
+	z_stream zvar;
+	memset(&zvar, 0, sizeof (zvar));
+	COMMON_UINT8 *p_input = malloc(COMPRESSION_PROCESS_BYTES + SEALED_TAG_LEN);
+	COMMON_UINT8 *p_plain = malloc(COMPRESSION_PROCESS_BYTES + SEALED_TAG_LEN);
+	COMMON_UINT8 *p_output = malloc(COMPRESSION_PROCESS_BYTES);
+	if (!p_input || !p_plain || !p_output)
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else if (inflateInit(&zvar) != Z_OK)
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else
+	{
+		int held = 0;
+		ssize_t num_read;
+		while (rc == NVM_SUCCESS &&
+				(num_read = read(efd, p_input + held, COMPRESSION_PROCESS_BYTES)) > 0)
+		{
+			int available = held + (int)num_read;
+			int process = available > SEALED_TAG_LEN ? available - SEALED_TAG_LEN : 0;
+			rc = unseal_write(dfd, p_ctx, &zvar, p_input, process, p_plain, p_output);
+			held = available - process;
+			memmove(p_input, p_input + process, held);
+		}
+		if (rc == NVM_SUCCESS && held != SEALED_TAG_LEN)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+		else if (rc == NVM_SUCCESS)
+		{
+			int final_len = 0;
+			if (!EVP_CIPHER_CTX_ctrl(p_ctx, EVP_CTRL_GCM_SET_TAG, SEALED_TAG_LEN, p_input) ||
+					EVP_DecryptFinal_ex(p_ctx, p_plain, &final_len) <= 0)
+			{
+				// the file was modified or the wrong key was used
+				rc = NVM_ERR_BADFILE;
+			}
+			else if (inflate(&zvar, Z_FINISH) != Z_STREAM_END)
+			{
+				rc = NVM_ERR_BADFILE;
+			}
+		}
+		inflateEnd(&zvar);
+	}
+	free(p_input);
+	free(p_plain);
+	free(p_output);
+	return rc;
+}
+
+/*
+ * Decrypt a file written by compress_encrypt_file into 'decryptedFile'
+ */
+int decrypt_decompress_file(const COMMON_PATH rsaKeyFile, const COMMON_PATH encryptedFile,
+		const COMMON_PATH decryptedFile)
+{
+	int efd = -1;		// encrypted file
+	int dfd = -1;		// decrypted file
+	EVP_PKEY *p_key = NULL;
+	BIO *bio = NULL;
+	EVP_CIPHER_CTX *p_ctx = NULL;
+	int rc = NVM_SUCCESS;
+#ifdef __WINDOWS__
+	int OS_flags = O_BINARY;
+#else
+	int OS_flags = 0;
+#endif
+	COMMON_UINT8 key[SEALED_KEY_LEN];
+	COMMON_UINT8 *p_header = NULL;
+	int header_len = 0;
+
+	// Read the private RSA key into a openssl data structure
+	if ((bio = BIO_new_file(rsaKeyFile, "r")) == NULL ||
+			PEM_read_bio_PrivateKey(bio, &p_key, NULL, NULL) == NULL)
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else if ((efd = open(encryptedFile, O_RDONLY|OS_flags, 0)) == -1)
+	{
+		rc = NVM_ERR_BADFILE;
+	}
+	else if ((p_header = malloc(SEALED_FILE_MAGIC_LEN + 2 +
+			EVP_PKEY_size(p_key) + SEALED_IV_LEN)) == NULL)
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else if (read(efd, p_header, SEALED_FILE_MAGIC_LEN + 2) != SEALED_FILE_MAGIC_LEN + 2 ||
+			memcmp(p_header, SEALED_FILE_MAGIC, SEALED_FILE_MAGIC_LEN) != 0)
+	{
+		// not written by compress_encrypt_file
+		rc = NVM_ERR_BADFILE;
+	}
+	else
+	{
+		int wrapped_len = (p_header[SEALED_FILE_MAGIC_LEN] << 8) |
+				p_header[SEALED_FILE_MAGIC_LEN + 1];
+		COMMON_UINT8 *p_wrapped = p_header + SEALED_FILE_MAGIC_LEN + 2;
+		header_len = SEALED_FILE_MAGIC_LEN + 2 + wrapped_len + SEALED_IV_LEN;
+		int aad_len = 0;
+		if (wrapped_len != EVP_PKEY_size(p_key) ||
+				read(efd, p_wrapped, wrapped_len + SEALED_IV_LEN) !=
+					wrapped_len + SEALED_IV_LEN ||
+				unwrap_session_key(p_key, p_wrapped, wrapped_len, key) != NVM_SUCCESS)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+		else if ((dfd = open(decryptedFile, O_RDWR|O_TRUNC|O_CREAT|O_EXCL|OS_flags,
+				GENERIC_NEW_FILE_PERMISSION)) == -1)
+		{
+			rc = NVM_ERR_BADFILE;
+		}
+		else if ((p_ctx = EVP_CIPHER_CTX_new()) == NULL)
+		{
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else if (!EVP_DecryptInit_ex(p_ctx, EVP_aes_256_gcm(), NULL, NULL, NULL) ||
+				!EVP_CIPHER_CTX_ctrl(p_ctx, EVP_CTRL_GCM_SET_IVLEN, SEALED_IV_LEN, NULL) ||
+				!EVP_DecryptInit_ex(p_ctx, NULL, NULL, key, p_wrapped + wrapped_len) ||
+				!EVP_DecryptUpdate(p_ctx, NULL, &aad_len, p_header, header_len))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		else
+		{
+			rc = unseal_stream(efd, dfd, p_ctx);
+		}
+	}
+
+	OPENSSL_cleanse(key, sizeof (key));
+	if (p_ctx)
+	{
+		EVP_CIPHER_CTX_free(p_ctx);
+	}
+	if (p_header)
+	{
+		free(p_header);
+	}
+	if (p_key != NULL)
+	{
+		EVP_PKEY_free(p_key);
+	}
+	if (bio != NULL)
+	{
+		BIO_free(bio);
+	}
+	if (efd != -1)
+	{
+		close(efd);
+	}
+	if (dfd != -1)
+	{
+		close(dfd);
+
+		// never leave unauthenticated plaintext behind
+		if (rc != NVM_SUCCESS)
+		{
+			unlink(decryptedFile);
+		}
+	}
+
+	return rc;
+}
@@ -85,6 +85,29 @@ extern "C"
  */
 #define	RSA_PKCS1_OAEP_PADDING_OFFSET		42
 
+/*!
+ * First bytes of a file written by @ref compress_encrypt_file. It is followed by the
+ * 2 byte big endian length of the RSA wrapped session key, the wrapped key, the IV,
+ * the AES-256-GCM encrypted zlib stream and the GCM tag.
+ */
+#define	SEALED_FILE_MAGIC					"NVMSEAL1"
+#define	SEALED_FILE_MAGIC_LEN				8
+
+/*!
+ * AES-256 session key length
+ */
+#define	SEALED_KEY_LEN						32
+
+/*!
+ * GCM initialization vector length
+ */
+#define	SEALED_IV_LEN						12
+
+/*!
+ * GCM authentication tag length
+ */
+#define	SEALED_TAG_LEN						16
+
 #ifdef __WINDOWS__
 /*!
  * The set of file permissions allowed for newly created files
@@ -158,6 +181,37 @@ NVM_COMMON_API extern int rsa_encrypt(const COMMON_PATH src_file, COMMON_PATH ou
 NVM_COMMON_API extern int rsa_decrypt(const COMMON_PATH rsaKeyFile, const COMMON_PATH encryptedFile,
 		const COMMON_PATH decryptedFile);
 
+/*!
+ * Compress and encrypt a file in a single streaming pass. The data is encrypted with
+ * AES-256-GCM under a random session key that is wrapped once with the RSA public key.
+ * Adds a CRYPTO_FILE_EXT file extension and deletes the input file on success.
+ * @param[in] src_file
+ * The input filepath
+ * @param[out] out_file
+ * The (compressed and encrypted) output filepath
+ * @return
+ * @c NVM_SUCCESS @n
+ * @c NVM_ERR_BADFILE @n
+ * @c NVM_ERR_UNKNOWN @n
+ * @c NVM_ERR_NOMEMORY
+ */
+NVM_COMMON_API extern int compress_encrypt_file(const COMMON_PATH src_file, COMMON_PATH out_file);
+
+/*!
+ * Decrypt and decompress a file written by @ref compress_encrypt_file.
+ * The output is removed if the file fails authentication.
+ * @param[in] rsaKeyFile
+ * The filepath of the RSA private key file
+ * @param[in] encryptedFile
+ * The (encrypted) input filepath
+ * @param[in] decryptedFile
+ * The (decrypted) output filepath
+ * @return
+ * 0 if success, NVM_ERR_XXX if failed
+ */
+NVM_COMMON_API extern int decrypt_decompress_file(const COMMON_PATH rsaKeyFile,
+		const COMMON_PATH encryptedFile, const COMMON_PATH decryptedFile);
+
 
 #ifdef __cplusplus
 }
@@ -45,7 +45,15 @@
 #include <sys/shm.h>
 #include <sys/types.h>
 #include <sys/ipc.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <fcntl.h>
 #include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <errno.h>
 
 #include <string/s_str.h>
 #include <string/unicode_utilities.h>
@@ -178,11 +186,36 @@ int stop_process(unsigned int process_id)
  */
 void create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *), void *callback_arg)
 {
-	pthread_create(
+	if (pthread_create(
 			(pthread_t *)p_thread_id,
 			NULL, // default attributes
 			callback,
-			callback_arg);
+			callback_arg) != 0)
+	{
+		*p_thread_id = 0;
+	}
+}
+
+/*
+ * Wait for a thread to exit
+ */
+void join_thread(COMMON_UINT64 thread_id)
+{
+	if (thread_id)
+	{
+		pthread_join((pthread_t)thread_id, NULL);
+	}
+}
+
+/*
+ * Let a thread that won't be joined release its resources when it exits
+ */
+void detach_thread(COMMON_UINT64 thread_id)
+{
+	if (thread_id)
+	{
+		pthread_detach((pthread_t)thread_id);
+	}
 }
 
 /*
@@ -343,6 +376,195 @@ int rwlock_delete(OS_RWLOCK *p_rwlock)
 	return (pthread_rwlock_destroy(p_handle) == 0);
 }
 
+/*
+ * A notifier is an eventfd for signals from this process
+ * and an inotify watch for signals from other processes
+ */
+struct lnx_notifier
+{
+	int event_fd;
+	int inotify_fd;
+};
+
+// the file signaled last stays open so storing an event is a single futimens
+static pthread_mutex_t g_signal_file_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_signal_fd = -1;
+static char g_signal_path[PATH_MAX];
+
+/*
+ * Creates the watched file and its directory with the permissions of another file
+ */
+int notifier_init_file(const char *watch_path, const char *like_path)
+{
+	int rc = 0;
+	struct stat like;
+	if (watch_path && like_path && stat(like_path, &like) == 0)
+	{
+		rc = 1;
+		mode_t file_mode = like.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO);
+		// whoever can read the file can also search its directory
+		mode_t dir_mode = file_mode | ((file_mode & (S_IRUSR | S_IRGRP | S_IROTH)) >> 2);
+		int is_root = (geteuid() == 0);
+
+		// chmod after creating because mkdir and open are limited by the umask
+		char dir[PATH_MAX];
+		s_strcpy(dir, watch_path, PATH_MAX);
+		char *p_sep = strrchr(dir, '/');
+		if (p_sep)
+		{
+			*p_sep = '\0';
+			if (mkdir(dir, dir_mode) == 0)
+			{
+				rc = (chmod(dir, dir_mode) == 0 &&
+					(!is_root || chown(dir, like.st_uid, like.st_gid) == 0));
+			}
+		}
+
+		int fd = open(watch_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, file_mode);
+		if (fd >= 0)
+		{
+			rc = rc && (fchmod(fd, file_mode) == 0 &&
+				(!is_root || fchown(fd, like.st_uid, like.st_gid) == 0));
+			close(fd);
+		}
+		else if (errno != EEXIST)
+		{
+			rc = 0;
+		}
+	}
+	return rc;
+}
+
+/*
+ * Creates a notifier
+ */
+OS_NOTIFIER *notifier_create(const char *watch_path)
+{
+	struct lnx_notifier *p_notifier =
+			(struct lnx_notifier *)malloc(sizeof (struct lnx_notifier));
+	if (p_notifier)
+	{
+		p_notifier->inotify_fd = -1;
+		p_notifier->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (p_notifier->event_fd < 0)
+		{
+			free(p_notifier);
+			p_notifier = NULL;
+		}
+		else if (watch_path)
+		{
+			p_notifier->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			if (p_notifier->inotify_fd >= 0 &&
+				inotify_add_watch(p_notifier->inotify_fd, watch_path,
+					IN_ATTRIB | IN_CLOSE_WRITE) < 0)
+			{
+				// still usable for signals within this process
+				close(p_notifier->inotify_fd);
+				p_notifier->inotify_fd = -1;
+			}
+		}
+	}
+	return p_notifier;
+}
+
+/*
+ * Signals a notifier
+ */
+int notifier_signal(OS_NOTIFIER *p_notifier)
+{
+	int rc = 0;
+	if (p_notifier)
+	{
+		uint64_t value = 1;
+		rc = (write(((struct lnx_notifier *)p_notifier)->event_fd,
+				&value, sizeof (value)) == sizeof (value));
+	}
+	return rc;
+}
+
+/*
+ * Signals the notifiers watching a file by touching it
+ */
+int notifier_signal_file(const char *watch_path)
+{
+	int rc = 0;
+	if (watch_path && pthread_mutex_lock(&g_signal_file_lock) == 0)
+	{
+		if (g_signal_fd >= 0 && strncmp(g_signal_path, watch_path, PATH_MAX) != 0)
+		{
+			close(g_signal_fd);
+			g_signal_fd = -1;
+		}
+		if (g_signal_fd < 0)
+		{
+			g_signal_fd = open(watch_path, O_WRONLY | O_CLOEXEC);
+			s_strcpy(g_signal_path, watch_path, PATH_MAX);
+		}
+		if (g_signal_fd >= 0)
+		{
+			// the timestamp change wakes IN_ATTRIB watchers
+			rc = (futimens(g_signal_fd, NULL) == 0);
+		}
+		pthread_mutex_unlock(&g_signal_file_lock);
+	}
+	return rc;
+}
+
+/*
+ * Waits for a notifier to be signaled
+ */
+int notifier_wait(OS_NOTIFIER *p_notifier, unsigned long timeout_ms)
+{
+	int rc = 0;
+	if (p_notifier)
+	{
+		struct lnx_notifier *p_lnx = (struct lnx_notifier *)p_notifier;
+		struct pollfd fds[2];
+		nfds_t nfds = 0;
+		fds[nfds].fd = p_lnx->event_fd;
+		fds[nfds++].events = POLLIN;
+		if (p_lnx->inotify_fd >= 0)
+		{
+			fds[nfds].fd = p_lnx->inotify_fd;
+			fds[nfds++].events = POLLIN;
+		}
+		int timeout = timeout_ms > INT_MAX ? INT_MAX : (int)timeout_ms;
+		if (poll(fds, nfds, timeout) > 0)
+		{
+			rc = 1;
+			// drain so the next wait blocks again
+			char buf[sizeof (struct inotify_event) + NAME_MAX + 1];
+			for (nfds_t i = 0; i < nfds; i++)
+			{
+				if (fds[i].revents & POLLIN)
+				{
+					while (read(fds[i].fd, buf, sizeof (buf)) > 0)
+					{
+					}
+				}
+			}
+		}
+	}
+	return rc;
+}
+
+/*
+ * Deletes a notifier
+ */
+void notifier_delete(OS_NOTIFIER *p_notifier)
+{
+	if (p_notifier)
+	{
+		struct lnx_notifier *p_lnx = (struct lnx_notifier *)p_notifier;
+		close(p_lnx->event_fd);
+		if (p_lnx->inotify_fd >= 0)
+		{
+			close(p_lnx->inotify_fd);
+		}
+		free(p_lnx);
+	}
+}
+
 /*
  * Retrieve the name of the host server.
  */
@@ -85,6 +85,15 @@ typedef void OS_MUTEX;
  */
 typedef void OS_RWLOCK;
 
+/*!
+ * The OS-specific type-definition of a notifier, a wakeup that can be signaled from
+ * this process or, by writing to a watched file, from another process.
+ * @remarks
+ * 		in Windows, it waits on an auto-reset event and a change notification @n
+ * 		in Linux, it polls an eventfd and an inotify watch
+ */
+typedef void OS_NOTIFIER;
+
 /*
  * ****************************************************************************
  * ENUMS
@@ -175,11 +184,29 @@ NVM_COMMON_API extern int stop_process(unsigned int process_id);
 NVM_COMMON_API extern void nvm_sleep(unsigned long time);
 
 /*!
- * Create a thread on the current process
+ * Create a thread on the current process. Every thread must be passed to either
+ * join_thread or detach_thread so its OS resources are released.
+ * @param[out] p_thread_id
+ * 		Identifies the thread to join_thread. This is not the OS thread ID.
+ * 		Set to 0 if the thread couldn't be created.
  */
 NVM_COMMON_API extern void create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *),
 	void *callback_arg);
 
+/*!
+ * Wait for a thread created with create_thread to exit
+ * @param[in] thread_id
+ * 		The thread ID returned by create_thread. An ID of 0 is ignored.
+ */
+NVM_COMMON_API extern void join_thread(COMMON_UINT64 thread_id);
+
+/*!
+ * Release a thread created with create_thread that will never be joined
+ * @param[in] thread_id
+ * 		The thread ID returned by create_thread. An ID of 0 is ignored.
+ */
+NVM_COMMON_API extern void detach_thread(COMMON_UINT64 thread_id);
+
 /*!
  * Gets the current threads ID.  Useful in logging.
  * @return
@@ -284,6 +311,65 @@ NVM_COMMON_API extern int rwlock_w_unlock(OS_RWLOCK *p_rwlock);
  */
 NVM_COMMON_API extern int rwlock_delete(OS_RWLOCK *p_rwlock);
 
+/*!
+ * Create the file watched by notifiers, and its directory, if they don't exist.
+ * The file should be the only one in the directory because, in Windows, any change
+ * in the directory wakes the notifiers.
+ * @param watch_path
+ * 		The file to create
+ * @param like_path
+ * 		An existing file whose permissions are copied
+ * @return
+ * 		1 for success, 0 for failure
+ */
+NVM_COMMON_API extern int notifier_init_file(const char *watch_path, const char *like_path);
+
+/*!
+ * Create a notifier.
+ * @param watch_path
+ * 		If not NULL, writes to this file through #notifier_signal_file also wake the
+ * 		notifier. The file must have been created by #notifier_init_file.
+ * @return
+ * 		The notifier, or NULL on failure
+ */
+NVM_COMMON_API extern OS_NOTIFIER *notifier_create(const char *watch_path);
+
+/*!
+ * Wake a waiter on the notifier. Signals before the wait are not lost.
+ * @param p_notifier
+ * 		A pointer to the notifier
+ * @return
+ * 		1 for success, 0 for failure
+ */
+NVM_COMMON_API extern int notifier_signal(OS_NOTIFIER *p_notifier);
+
+/*!
+ * Wake the notifiers in any process that watch a file
+ * @param watch_path
+ * 		The watched file
+ * @return
+ * 		1 for success, 0 for failure
+ */
+NVM_COMMON_API extern int notifier_signal_file(const char *watch_path);
+
+/*!
+ * Block until the notifier is signaled or the timeout expires
+ * @param p_notifier
+ * 		A pointer to the notifier
+ * @param timeout_ms
+ * 		The maximum time to wait, in milliseconds
+ * @return
+ * 		1 if signaled, 0 on timeout or failure
+ */
+NVM_COMMON_API extern int notifier_wait(OS_NOTIFIER *p_notifier, unsigned long timeout_ms);
+
+/*!
+ * Release the notifier
+ * @param p_notifier
+ * 		A pointer to the notifier
+ */
+NVM_COMMON_API extern void notifier_delete(OS_NOTIFIER *p_notifier);
+
 
 /*
  * ***************************************************************
@@ -36,7 +36,11 @@
 #include <sys/stat.h>
 #include <windows.h>
 #include <winnt.h>
+#include <aclapi.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <tchar.h> // todo: remove this header and replace associated functions
 #include <direct.h> // for _getcwd
 
@@ -153,13 +157,39 @@ void nvm_sleep(unsigned long time)
  */
 void create_thread(COMMON_UINT64 *p_thread_id, void *(*callback)(void *), void * callback_arg)
 {
-	CreateThread(
+	// the thread handle identifies the thread so join_thread can wait on it
+	HANDLE h_thread = CreateThread(
 			NULL, // default security
 			0,  // default stack size
 			(LPTHREAD_START_ROUTINE)callback,
 			(LPVOID)callback_arg,
 			0, // Immediately run thread
-			(LPDWORD)p_thread_id);
+			NULL);
+	*p_thread_id = (COMMON_UINT64)(uintptr_t)h_thread;
+}
+
+/*
+ * Wait for a thread to exit
+ */
+void join_thread(COMMON_UINT64 thread_id)
+{
+	if (thread_id)
+	{
+		HANDLE h_thread = (HANDLE)(uintptr_t)thread_id;
+		WaitForSingleObject(h_thread, INFINITE);
+		CloseHandle(h_thread);
+	}
+}
+
+/*
+ * Close the handle of a thread that won't be joined, the thread keeps running
+ */
+void detach_thread(COMMON_UINT64 thread_id)
+{
+	if (thread_id)
+	{
+		CloseHandle((HANDLE)(uintptr_t)thread_id);
+	}
 }
 
 /*
@@ -322,6 +352,192 @@ int rwlock_delete(OS_RWLOCK *p_rwlock)
 	return 1;
 }
 
+/*
+ * A notifier is an auto-reset event for signals from this process and
+ * a change notification on the watched file's directory for other processes,
+ * so the file should be alone in its directory
+ */
+struct win_notifier
+{
+	HANDLE event;
+	HANDLE change;
+};
+
+// the file signaled last stays open so storing an event is a single SetFileTime
+static SRWLOCK g_signal_file_lock = SRWLOCK_INIT;
+static HANDLE g_signal_file = INVALID_HANDLE_VALUE;
+static char g_signal_path[MAX_PATH];
+
+/*
+ * Creates the watched file and its directory with the permissions of another file
+ */
+int notifier_init_file(const char *watch_path, const char *like_path)
+{
+	int rc = 0;
+	PACL p_dacl = NULL;
+	PSECURITY_DESCRIPTOR p_descriptor = NULL;
+	if (watch_path && like_path &&
+		GetNamedSecurityInfo(like_path, SE_FILE_OBJECT, DACL_SECURITY_INFORMATION,
+			NULL, NULL, &p_dacl, NULL, &p_descriptor) == ERROR_SUCCESS)
+	{
+		rc = 1;
+		char dir[MAX_PATH];
+		s_strcpy(dir, watch_path, MAX_PATH);
+		char *p_sep = strrchr(dir, '\\');
+		if (p_sep)
+		{
+			*p_sep = '\0';
+			if (CreateDirectory(dir, NULL))
+			{
+				rc = (SetNamedSecurityInfo(dir, SE_FILE_OBJECT, DACL_SECURITY_INFORMATION,
+					NULL, NULL, p_dacl, NULL) == ERROR_SUCCESS);
+			}
+		}
+
+		HANDLE file = CreateFile(watch_path, GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+				NULL, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(file);
+			rc = rc && (SetNamedSecurityInfo((LPSTR)watch_path, SE_FILE_OBJECT,
+				DACL_SECURITY_INFORMATION, NULL, NULL, p_dacl, NULL) == ERROR_SUCCESS);
+		}
+		else if (GetLastError() != ERROR_FILE_EXISTS)
+		{
+			rc = 0;
+		}
+		LocalFree(p_descriptor);
+	}
+	return rc;
+}
+
+/*
+ * Creates a notifier
+ */
+OS_NOTIFIER *notifier_create(const char *watch_path)
+{
+	struct win_notifier *p_notifier =
+			(struct win_notifier *)malloc(sizeof (struct win_notifier));
+	if (p_notifier)
+	{
+		p_notifier->change = INVALID_HANDLE_VALUE;
+		p_notifier->event = CreateEvent(NULL, FALSE, FALSE, NULL);
+		if (p_notifier->event == NULL)
+		{
+			free(p_notifier);
+			p_notifier = NULL;
+		}
+		else if (watch_path)
+		{
+			// change notifications are only available on a directory
+			char dir[MAX_PATH];
+			s_strcpy(dir, watch_path, MAX_PATH);
+			char *p_sep = strrchr(dir, '\\');
+			if (p_sep)
+			{
+				*p_sep = '\0';
+				p_notifier->change = FindFirstChangeNotification(dir, FALSE,
+						FILE_NOTIFY_CHANGE_LAST_WRITE);
+			}
+		}
+	}
+	return p_notifier;
+}
+
+/*
+ * Signals a notifier
+ */
+int notifier_signal(OS_NOTIFIER *p_notifier)
+{
+	int rc = 0;
+	if (p_notifier)
+	{
+		rc = (SetEvent(((struct win_notifier *)p_notifier)->event) != 0);
+	}
+	return rc;
+}
+
+/*
+ * Signals the notifiers watching a file by updating its write time
+ */
+int notifier_signal_file(const char *watch_path)
+{
+	int rc = 0;
+	if (watch_path)
+	{
+		AcquireSRWLockExclusive(&g_signal_file_lock);
+		if (g_signal_file != INVALID_HANDLE_VALUE &&
+			strncmp(g_signal_path, watch_path, MAX_PATH) != 0)
+		{
+			CloseHandle(g_signal_file);
+			g_signal_file = INVALID_HANDLE_VALUE;
+		}
+		if (g_signal_file == INVALID_HANDLE_VALUE)
+		{
+			g_signal_file = CreateFile(watch_path, FILE_WRITE_ATTRIBUTES,
+					FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING,
+					FILE_ATTRIBUTE_NORMAL, NULL);
+			s_strcpy(g_signal_path, watch_path, MAX_PATH);
+		}
+		if (g_signal_file != INVALID_HANDLE_VALUE)
+		{
+			FILETIME now;
+			GetSystemTimeAsFileTime(&now);
+			rc = (SetFileTime(g_signal_file, NULL, NULL, &now) != 0);
+		}
+		ReleaseSRWLockExclusive(&g_signal_file_lock);
+	}
+	return rc;
+}
+
+/*
+ * Waits for a notifier to be signaled
+ */
+int notifier_wait(OS_NOTIFIER *p_notifier, unsigned long timeout_ms)
+{
+	int rc = 0;
+	if (p_notifier)
+	{
+		struct win_notifier *p_win = (struct win_notifier *)p_notifier;
+		HANDLE handles[2];
+		DWORD count = 0;
+		handles[count++] = p_win->event;
+		if (p_win->change != INVALID_HANDLE_VALUE)
+		{
+			handles[count++] = p_win->change;
+		}
+		DWORD w_rc = WaitForMultipleObjects(count, handles, FALSE, timeout_ms);
+		if (w_rc == WAIT_OBJECT_0)
+		{
+			rc = 1;
+		}
+		else if (w_rc == WAIT_OBJECT_0 + 1)
+		{
+			// re-arm the change notification
+			FindNextChangeNotification(p_win->change);
+			rc = 1;
+		}
+	}
+	return rc;
+}
+
+/*
+ * Deletes a notifier
+ */
+void notifier_delete(OS_NOTIFIER *p_notifier)
+{
+	if (p_notifier)
+	{
+		struct win_notifier *p_win = (struct win_notifier *)p_notifier;
+		CloseHandle(p_win->event);
+		if (p_win->change != INVALID_HANDLE_VALUE)
+		{
+			FindCloseChangeNotification(p_win->change);
+		}
+		free(p_win);
+	}
+}
+
 /*
  * Retrieve the name of the host server.
  */
@@ -203,12 +203,27 @@ extern "C"
 //! SQL Key name for performance monitor interval
 #define	SQL_KEY_PERFORMANCE_MONITOR_INTERVAL_MINUTES "PERFORMANCE_MONITOR_INTERVAL_MINUTES"
 
-//! SQL Key name for max performance logs stored
+//! SQL Key name for max performance samples stored, across all DIMMs
 #define	SQL_KEY_PERFORMANCE_LOG_MAX "PERFORMANCE_LOG_MAX"
 
 //! SQL Key name for the % of performance logs to be trimmed if max number of rows is exceeded
+//! No longer used, performance samples are kept in fixed size rings
 #define	SQL_KEY_PERFORMANCE_LOG_TRIM_PERCENT "PERFORMANCE_LOG_TRIM_PERCENT"
 
+// FW RESULT CACHE KEYS
+//! SQL Key name for seconds to cache FW data that only changes across a reset, 0 disables
+#define	SQL_KEY_FW_STATIC_CACHE_TTL_SECONDS "FW_STATIC_CACHE_TTL_SECONDS"
+
+//! SQL Key name for seconds to cache FW settings, 0 disables
+#define	SQL_KEY_FW_SETTING_CACHE_TTL_SECONDS "FW_SETTING_CACHE_TTL_SECONDS"
+
+// DATABASE TUNING KEYS
+//! SQL Key name to use write-ahead logging for the config database, 1 enables
+#define	SQL_KEY_DB_WAL_MODE_ENABLED "DB_WAL_MODE_ENABLED"
+
+//! SQL Key name for the per-connection page cache size in KiB, 0 uses the SQLite default
+#define	SQL_KEY_DB_CACHE_SIZE_KB "DB_CACHE_SIZE_KB"
+
 #ifdef __cplusplus
 }
 #endif
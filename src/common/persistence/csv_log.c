@@ -28,8 +28,10 @@
 /*
  * This file contains the implementation for the csv_log interface.
  *
- * The csv log is used for caching log entries to a csv file
- * for better performance over the SQLite DB.
+ * Log entries are buffered in memory and written to the SQLite DB in batches by
+ * log_gather, on the calling thread, at points where no transaction is open on the
+ * lib store. A full buffer, or a batch that can't be written to the DB, goes to the
+ * csv log file instead and is imported on the next flush.
  */
 
 #include <stdlib.h>
@@ -42,6 +44,7 @@
 #include <file_ops/file_ops_adapter.h>
 
 #include "csv_log.h"
+#include "event.h"
 #include "config_settings.h"
 #include <persistence/lib_persistence.h>
 #include <sys/stat.h>
@@ -59,34 +62,87 @@
 #define	MAX_LOGS	10000
 #define	MAX_CACHE_FILE_SIZE	BYTES_PER_MIB // 1 MiB Max
 
+// in-memory log buffer
+#define	LOG_BUFFER_ENTRIES	128
+
 #define	MUTEX_NAME	"8086_NVM_CSV_LOG_DB_MUTEX"
 #ifdef __WINDOWS__
 #include <windows.h>
 	HANDLE g_db_mutex;
+	HANDLE g_log_buffer_lock;
+	HANDLE g_log_flush_lock;
 #else
 	pthread_mutex_t g_db_mutex;
+	pthread_mutex_t g_log_buffer_lock;
+	pthread_mutex_t g_log_flush_lock;
 #endif
 
+struct log_buffer
+{
+	int count;
+	struct db_log entries[LOG_BUFFER_ENTRIES];
+};
+
+/*
+ * Producers append to the active buffer holding only g_log_buffer_lock. A flush
+ * swaps it with the spare buffer and writes the spare out holding g_log_flush_lock,
+ * so logging never waits on the DB.
+ */
+static struct log_buffer *p_active_buffer = NULL;
+static struct log_buffer *p_spare_buffer = NULL;
+
+// the locks are created once and live until the process exits because other threads
+// may still be logging when the lib store is closed
+static int g_log_initialized = 0;
+static int g_exit_flush_registered = 0;
+
+static int g_logs_since_roll = 0;
+
 /*
- * Initialize the lock
+ * Initialize the locks
  */
 int csv_log_init()
 {
-	int rc = COMMON_ERR_UNKNOWN;
-	if (mutex_init((OS_MUTEX*)&g_db_mutex, MUTEX_NAME))
+	int rc = COMMON_SUCCESS;
+	if (!g_log_initialized)
 	{
-		rc = COMMON_SUCCESS;
+		if (mutex_init((OS_MUTEX*)&g_db_mutex, MUTEX_NAME) &&
+			mutex_init((OS_MUTEX*)&g_log_buffer_lock, NULL) &&
+			mutex_init((OS_MUTEX*)&g_log_flush_lock, NULL))
+		{
+			g_log_initialized = 1;
+		}
+		else
+		{
+			rc = COMMON_ERR_UNKNOWN;
+		}
 	}
 	return rc;
 }
 
 /*
- * Flush the cache and clean up the lock
+ * Flush the buffer and the cache and free the buffers. The locks are kept, logging
+ * after this allocates the buffers again and the entries wait for the next flush.
  */
 void csv_log_close()
 {
 	flush_csv_log_to_db(get_lib_store());
-	mutex_delete((OS_MUTEX*)&g_db_mutex, MUTEX_NAME);
+
+	if (g_log_initialized)
+	{
+		mutex_lock(&g_log_flush_lock);
+		mutex_lock(&g_log_buffer_lock);
+		// entries logged while closing stay buffered for the exit flush
+		if (p_active_buffer && p_active_buffer->count == 0)
+		{
+			free(p_active_buffer);
+			free(p_spare_buffer);
+			p_active_buffer = NULL;
+			p_spare_buffer = NULL;
+		}
+		mutex_unlock(&g_log_buffer_lock);
+		mutex_unlock(&g_log_flush_lock);
+	}
 }
 
 /*
@@ -122,6 +178,101 @@ int roll_db_log(PersistentStore *p_db)
 	return rc;
 }
 
+/*
+ * Append log entries to the csv log cache
+ */
+static int append_logs_to_csv(const struct db_log *p_logs, const int log_count)
+{
+	int rc = COMMON_ERR_UNKNOWN;
+	if (mutex_lock(&g_db_mutex))
+	{
+		COMMON_PATH logfile_path;
+		get_log_file_path(logfile_path);
+		FILE *p_file = NULL;
+		if ((p_file = open_file(logfile_path, COMMON_PATH_LEN, "a+")) != NULL)
+		{
+			for (int i = 0; i < log_count; i++)
+			{
+				fprintf(p_file, CSV_WRITE_FORMAT,
+						p_logs[i].thread_id, p_logs[i].time, p_logs[i].level,
+						p_logs[i].file_name, p_logs[i].line_number, p_logs[i].message);
+			}
+			fclose(p_file);
+			rc = COMMON_SUCCESS;
+		}
+
+		mutex_unlock(&g_db_mutex);
+	}
+	return rc;
+}
+
+/*
+ * Write the buffered log entries to the database in one transaction on the lib
+ * store connection. The entries go to the csv log cache instead when to_db is not
+ * set, or when the connection is in the middle of another caller's transaction.
+ */
+static int flush_log_buffer(const int to_db)
+{
+	int rc = COMMON_SUCCESS;
+	if (g_log_initialized && mutex_lock(&g_log_flush_lock))
+	{
+		// only the flush lock holder touches the spare buffer
+		if (mutex_lock(&g_log_buffer_lock))
+		{
+			struct log_buffer *p_tmp = p_active_buffer;
+			p_active_buffer = p_spare_buffer;
+			p_spare_buffer = p_tmp;
+			mutex_unlock(&g_log_buffer_lock);
+		}
+
+		if (p_spare_buffer && p_spare_buffer->count > 0)
+		{
+			rc = COMMON_ERR_UNKNOWN;
+			PersistentStore *p_store = to_db ? get_lib_store() : NULL;
+			if (p_store && !db_in_transaction(p_store) &&
+					db_begin_transaction(p_store) == DB_SUCCESS)
+			{
+				if (db_add_logs(p_store, p_spare_buffer->entries,
+						p_spare_buffer->count) == DB_SUCCESS)
+				{
+					g_logs_since_roll += p_spare_buffer->count;
+					if (g_logs_since_roll >= MAX_LOGS / 10)
+					{
+						roll_db_log(p_store);
+						g_logs_since_roll = 0;
+					}
+					if (db_end_transaction(p_store) == DB_SUCCESS)
+					{
+						rc = COMMON_SUCCESS;
+						notify_pending_events();
+					}
+				}
+				else
+				{
+					db_rollback_transaction(p_store);
+				}
+			}
+
+			// don't lose the logs if the DB is unavailable
+			if (rc != COMMON_SUCCESS)
+			{
+				rc = append_logs_to_csv(p_spare_buffer->entries, p_spare_buffer->count);
+			}
+			p_spare_buffer->count = 0;
+		}
+		mutex_unlock(&g_log_flush_lock);
+	}
+	return rc;
+}
+
+/*
+ * Keep what is still buffered when the process exits without csv_log_close
+ */
+static void flush_log_buffer_at_exit()
+{
+	flush_log_buffer(0);
+}
+
 /*
  * Flush the CSV log cache to the database
  */
@@ -129,7 +280,12 @@ int flush_csv_log_to_db(PersistentStore *p_db)
 {
 	int rc = COMMON_ERR_UNKNOWN;
 	int flush_complete = 1;
-	if (p_db)
+
+	// anything still in memory goes first
+	flush_log_buffer(1);
+
+	// leave the cache for the next flush rather than join another caller's transaction
+	if (p_db && !db_in_transaction(p_db))
 	{
 		if (mutex_lock(&g_db_mutex))
 		{
@@ -189,6 +345,7 @@ int flush_csv_log_to_db(PersistentStore *p_db)
 				{
 					delete_file(logfile_path, COMMON_PATH_LEN);
 					db_end_transaction(p_db);
+					notify_pending_events();
 				}
 				else
 				{
@@ -203,28 +360,72 @@ int flush_csv_log_to_db(PersistentStore *p_db)
 }
 
 /*
- * Write a log to the csv log cache
+ * Add a log to the active buffer, returns 0 if it is full
  */
-int csv_write_log(int level, const char *file_name,
+static int buffer_log(int level, const char *file_name,
 		const int line_number, const char *message)
 {
-	int rc = COMMON_ERR_UNKNOWN;
-	if (mutex_lock(&g_db_mutex))
+	int buffered = 0;
+	if (mutex_lock(&g_log_buffer_lock))
 	{
-		COMMON_PATH logfile_path;
-		get_log_file_path(logfile_path);
-		FILE *p_file = NULL;
-		if ((p_file = open_file(logfile_path, COMMON_PATH_LEN, "a+")) != NULL)
+		// allocated on first use so processes that don't log don't pay for it
+		if (!p_active_buffer)
 		{
-			fprintf(p_file, CSV_WRITE_FORMAT,
-					(COMMON_UINT64)get_thread_id(), (COMMON_UINT64)time(NULL), level,
-					file_name, line_number, message);
-			fclose(p_file);
-			rc = COMMON_SUCCESS;
+			p_active_buffer = calloc(1, sizeof (struct log_buffer));
+			p_spare_buffer = calloc(1, sizeof (struct log_buffer));
+			if (!p_active_buffer || !p_spare_buffer)
+			{
+				free(p_active_buffer);
+				free(p_spare_buffer);
+				p_active_buffer = NULL;
+				p_spare_buffer = NULL;
+			}
+			else if (!g_exit_flush_registered)
+			{
+				g_exit_flush_registered = 1;
+				atexit(flush_log_buffer_at_exit);
+			}
 		}
 
-		mutex_unlock(&g_db_mutex);
+		if (p_active_buffer && p_active_buffer->count < LOG_BUFFER_ENTRIES)
+		{
+			struct db_log *p_entry = &p_active_buffer->entries[p_active_buffer->count++];
+			p_entry->thread_id = get_thread_id();
+			p_entry->time = time(NULL);
+			p_entry->level = level;
+			s_strcpy(p_entry->file_name, file_name, LOG_FILE_NAME_LEN);
+			p_entry->line_number = line_number;
+			s_strcpy(p_entry->message, message, LOG_MESSAGE_LEN);
+			buffered = 1;
+		}
+		mutex_unlock(&g_log_buffer_lock);
 	}
+	return buffered;
+}
 
+/*
+ * Write a log to the in-memory log buffer
+ */
+int csv_write_log(int level, const char *file_name,
+		const int line_number, const char *message)
+{
+	int rc = COMMON_ERR_UNKNOWN;
+	if (g_log_initialized)
+	{
+		rc = COMMON_SUCCESS;
+		// the buffer is full until the next log_gather, fall back to the csv log
+		// rather than flushing from here, the caller may hold the csv log lock
+		if (!buffer_log(level, file_name, line_number, message))
+		{
+			struct db_log entry;
+			entry.thread_id = get_thread_id();
+			entry.time = time(NULL);
+			entry.level = level;
+			s_strcpy(entry.file_name, file_name, LOG_FILE_NAME_LEN);
+			entry.line_number = line_number;
+			s_strcpy(entry.message, message, LOG_MESSAGE_LEN);
+			rc = append_logs_to_csv(&entry, 1);
+		}
+	}
 	return rc;
 }
@@ -28,8 +28,9 @@
 /*
  * This file contains the implementation for the csv_log interface.
  *
- * The csv log is used for caching log entries to a csv file
- * for better performance over the SQLite DB.
+ * Log entries are buffered in memory and written to the SQLite DB in batches by
+ * log_gather. The csv log file is only used when a batch can't be written to the
+ * DB or the buffer overflows, and is imported on the next flush.
  */
 
 #ifndef	_CSV_LOG_H_
@@ -45,17 +46,17 @@ extern "C"
 #include "schema.h"
 
 /*
- * Initialize the lock
+ * Initialize the locks
  */
 NVM_COMMON_API int csv_log_init();
 
 /*
- * Flush the cache and clean up the lock
+ * Flush the buffer and the cache to the database and free the buffers
  */
 NVM_COMMON_API void csv_log_close();
 
 /*
- * Write a log to the csv log cache
+ * Write a log to the in-memory log buffer
  */
 NVM_COMMON_API int csv_write_log(int level, const char *file_name, const int line_number, const char *message);
 
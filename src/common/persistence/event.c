@@ -612,6 +612,71 @@ void params_to_event(const enum event_type type, const enum event_severity sever
 	COMMON_LOG_EXIT();
 }
 
+// called in this process after an event is stored
+static void (*g_event_stored_callback)(void) = NULL;
+
+/*
+ * Register a function to call after an event is stored by this process
+ */
+void set_event_stored_callback(void (*p_callback)(void))
+{
+	g_event_stored_callback = p_callback;
+}
+
+// set when an event is stored inside a transaction, cleared once it is announced
+static int g_event_notify_pending = 0;
+
+/*
+ * Get the path of the file touched whenever an event is stored
+ */
+int get_event_notify_path(COMMON_PATH path)
+{
+	COMMON_PATH store_path;
+	int rc = get_lib_store_path(store_path);
+	if (rc == COMMON_SUCCESS)
+	{
+		s_strcpy(path, store_path, COMMON_PATH_LEN);
+		s_strcat(path, COMMON_PATH_LEN, EVENT_NOTIFY_FILE_SUFFIX);
+		// anyone who can store events must be able to signal them
+		if (!notifier_init_file(path, store_path))
+		{
+			COMMON_LOG_WARN_F("Failed to create the event notify file %s", path);
+		}
+	}
+	return rc;
+}
+
+/*
+ * Wake event subscribers in this process directly and in other
+ * processes through the notify file
+ */
+void notify_event_stored()
+{
+	if (g_event_stored_callback)
+	{
+		g_event_stored_callback();
+	}
+
+	COMMON_PATH notify_path;
+	if (get_event_notify_path(notify_path) == COMMON_SUCCESS)
+	{
+		notifier_signal_file(notify_path);
+	}
+}
+
+/*
+ * Wake event subscribers for events stored in a transaction that has since committed
+ */
+void notify_pending_events()
+{
+	PersistentStore *p_store = get_lib_store();
+	if (g_event_notify_pending && p_store && !db_in_transaction(p_store))
+	{
+		g_event_notify_pending = 0;
+		notify_event_stored();
+	}
+}
+
 /*
  * Store an event log entry in the db
  */
@@ -676,6 +741,16 @@ int store_event(struct event *p_event, COMMON_BOOL syslog)
 					COMMON_LOG_ERROR("Failed to trim the event log");
 				}
 			}
+
+			// subscribers woken before the commit wouldn't find the event
+			if (db_in_transaction(p_store))
+			{
+				g_event_notify_pending = 1;
+			}
+			else
+			{
+				notify_event_stored();
+			}
 		}
 		else
 		{
@@ -739,205 +814,212 @@ NVM_BOOL log_event_in_syslog(const struct event *p_event, const char *source)
 	return result;
 }
 
-NVM_BOOL event_matches_filter(const struct event_filter *p_filter,
-		const struct db_event *p_db_event)
+/*
+ * Translate an event filter into predicates the database evaluates
+ */
+void event_filter_to_db_filter(const struct event_filter *p_filter,
+		struct db_event_filter *p_db_filter)
 {
-	int rc = 1;
 	COMMON_LOG_ENTRY();
 
+	memset(p_db_filter, 0, sizeof (struct db_event_filter));
 	if (p_filter) // no filter is a match
 	{
-		// match type
-		if (p_filter->filter_mask & NVM_FILTER_ON_TYPE)
+		// match type, allow filter all
+		if ((p_filter->filter_mask & NVM_FILTER_ON_TYPE) &&
+				p_filter->type != EVENT_TYPE_ALL)
 		{
-			// allow filter all
-			if (p_filter->type != EVENT_TYPE_ALL)
+			// allow filter all diag
+			if (p_filter->type == EVENT_TYPE_DIAG)
 			{
-				if (p_filter->type != p_db_event->type)
-				{
-					// allow filter all diag
-					if (p_filter->type == EVENT_TYPE_DIAG)
-					{
-						if (p_db_event->type < EVENT_TYPE_DIAG)
-						{
-							rc = 0;
-						}
-					}
-					else // types don't match
-					{
-						rc = 0;
-					}
-				}
+				p_db_filter->filter_mask |= DB_EVENT_FILTER_MIN_TYPE;
 			}
+			else
+			{
+				p_db_filter->filter_mask |= DB_EVENT_FILTER_TYPE;
+			}
+			p_db_filter->type = p_filter->type;
 		}
 		// match severity
-		if (rc && (p_filter->filter_mask & NVM_FILTER_ON_SEVERITY))
+		if (p_filter->filter_mask & NVM_FILTER_ON_SEVERITY)
 		{
-			if (p_db_event->severity < p_filter->severity)
-			{
-				rc = 0;
-			}
+			p_db_filter->filter_mask |= DB_EVENT_FILTER_MIN_SEVERITY;
+			p_db_filter->severity = p_filter->severity;
 		}
 		// match code
-		if (rc && (p_filter->filter_mask & NVM_FILTER_ON_CODE))
+		if (p_filter->filter_mask & NVM_FILTER_ON_CODE)
 		{
-			if (p_db_event->code != p_filter->code)
-			{
-				rc = 0;
-			}
+			p_db_filter->filter_mask |= DB_EVENT_FILTER_CODE;
+			p_db_filter->code = p_filter->code;
 		}
 		// match uid
-		if (rc && (p_filter->filter_mask & NVM_FILTER_ON_UID))
+		if (p_filter->filter_mask & NVM_FILTER_ON_UID)
 		{
-			NVM_UID db_uid;
-			uid_copy(p_db_event->uid, db_uid);
-			if (uid_cmp(db_uid, p_filter->uid) != 1)
-			{
-				rc = 0;
-			}
+			p_db_filter->filter_mask |= DB_EVENT_FILTER_UID;
+			uid_copy(p_filter->uid, p_db_filter->uid);
 		}
 		// match time after
-		if (rc && (p_filter->filter_mask & NVM_FILTER_ON_AFTER))
+		if (p_filter->filter_mask & NVM_FILTER_ON_AFTER)
 		{
-			if (p_db_event->time <= p_filter->after)
-			{
-				rc = 0;
-			}
+			p_db_filter->filter_mask |= DB_EVENT_FILTER_AFTER_TIME;
+			p_db_filter->after_time = p_filter->after;
 		}
 		// match time before
-		if (rc && (p_filter->filter_mask & NVM_FILTER_ON_BEFORE))
+		if (p_filter->filter_mask & NVM_FILTER_ON_BEFORE)
 		{
-			if (p_db_event->time >= p_filter->before)
-			{
-				rc = 0;
-			}
+			p_db_filter->filter_mask |= DB_EVENT_FILTER_BEFORE_TIME;
+			p_db_filter->before_time = p_filter->before;
 		}
-		if (rc && (p_filter->filter_mask & NVM_FILTER_ON_EVENT))
+		if (p_filter->filter_mask & NVM_FILTER_ON_EVENT)
 		{
-			if (p_db_event->id != p_filter->event_id)
-			{
-				rc = 0;
-			}
+			p_db_filter->filter_mask |= DB_EVENT_FILTER_ID;
+			p_db_filter->id = p_filter->event_id;
 		}
 		// match on action_required
-		if (rc && (p_filter->filter_mask & NVM_FILTER_ON_AR))
+		if (p_filter->filter_mask & NVM_FILTER_ON_AR)
 		{
-			if (p_db_event->action_required != p_filter->action_required)
-			{
-				rc = 0;
-			}
+			p_db_filter->filter_mask |= DB_EVENT_FILTER_ACTION_REQUIRED;
+			p_db_filter->action_required = p_filter->action_required;
 		}
 	}
 
-	COMMON_LOG_EXIT_RETURN_I(rc);
-	return rc;
+	COMMON_LOG_EXIT();
 }
 
 /*
- * Retrieve all events from the database and then filter on the specified
- * filter.
- * If purge is 1, delete the matching event from the database
- * Else if p_events is NULL or count = 0, just count the number matching.
- * Else copy to the provided structure.
- * Returns the count of matching events.
+ * Copy an event row into the API structure
  */
-int process_events_matching_filter(const struct event_filter *p_filter,
+void db_event_to_event(const struct db_event *p_db_event, struct event *p_event)
+{
+	p_event->event_id = p_db_event->id;
+	p_event->type = p_db_event->type;
+	p_event->severity = p_db_event->severity;
+	p_event->code = p_db_event->code;
+	p_event->time = p_db_event->time;
+	p_event->action_required = p_db_event->action_required;
+	uid_copy(p_db_event->uid, p_event->uid);
+
+	s_strcpy(p_event->args[0], p_db_event->arg1, NVM_EVENT_ARG_LEN);
+	s_strcpy(p_event->args[1], p_db_event->arg2, NVM_EVENT_ARG_LEN);
+	s_strcpy(p_event->args[2], p_db_event->arg3, NVM_EVENT_ARG_LEN);
+
+	// look up the message
+	populate_event_message(p_event);
+	p_event->diag_result = p_db_event->diag_result;
+}
+
+/*
+ * Purge, count or copy the events matching a database filter.
+ */
+int process_events_matching_db_filter(const struct db_event_filter *p_db_filter,
 		struct event *p_events, const NVM_UINT16 count, const NVM_BOOL purge)
 {
 	int rc = 0;
 	COMMON_LOG_ENTRY();
 
-	PersistentStore *p_store = get_lib_store();
+	// reads don't need to wait behind writers in other processes
+	PersistentStore *p_store = purge ? get_lib_store() : get_lib_read_store();
 	if (!p_store)
 	{
 		rc = NVM_ERR_UNKNOWN;
 	}
-	else
+	else if (purge)
 	{
-		// get all the events
-		int db_event_count = 0;
-		if (db_get_event_count(p_store, &db_event_count) != DB_SUCCESS)
+		if ((rc = db_delete_events_by_filter(p_store, p_db_filter)) < 0)
+		{
+			COMMON_LOG_ERROR("Failed to delete the events from the database");
+			rc = NVM_ERR_UNKNOWN;
+		}
+	}
+	else if (!p_events || count == 0)
+	{
+		if (db_get_event_count_by_filter(p_store, p_db_filter, &rc) != DB_SUCCESS)
 		{
 			COMMON_LOG_ERROR("Unable to retrieve the number of events from the database");
 			rc = NVM_ERR_UNKNOWN;
 		}
-		else if (db_event_count > 0)
+	}
+	else
+	{
+		// fetch one extra to detect a caller array that is too small
+		int db_event_count = count + 1;
+		// have to malloc the memory ... won't fit on stack
+		struct db_event *db_events = malloc(db_event_count * sizeof (struct db_event));
+		if (!db_events)
+		{
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
 		{
-			// have to malloc the memory ... won't fit on stack
-			struct db_event *db_events = malloc(db_event_count * sizeof (struct db_event));
-			if (db_events)
+			db_event_count = db_get_events_by_filter(p_store, p_db_filter,
+					db_events, db_event_count);
+			if (db_event_count < 0)
 			{
-				db_event_count = db_get_events(p_store, db_events, db_event_count);
-				if (db_event_count < 0)
+				COMMON_LOG_ERROR("Unable to retrieve the events from the database");
+				rc = NVM_ERR_UNKNOWN;
+			}
+			else
+			{
+				for (rc = 0; rc < db_event_count && rc < count; rc++)
 				{
-					COMMON_LOG_ERROR("Unable to retrieve the events from the database");
-					rc = NVM_ERR_UNKNOWN;
+					db_event_to_event(&db_events[rc], &p_events[rc]);
 				}
-				else if (db_event_count > 0)
+				if (db_event_count > count)
 				{
-					// only count events that match the filter
-					for (int i = 0; i < db_event_count; i++)
-					{
-						if (event_matches_filter(p_filter, &db_events[i]))
-						{
-							rc++;
-
-							// optionally remove it from the database
-							if (purge)
-							{
-								if (db_delete_event_by_id(p_store, db_events[i].id) != DB_SUCCESS)
-								{
-									COMMON_LOG_ERROR_F("Failed to delete event Id %d",
-											db_events[i].id);
-								}
-							}
-							// optionally copy it
-							else if (p_events && count > 0)
-							{
-								// check if the array is too small
-								if (count < rc)
-								{
-									COMMON_LOG_ERROR(
-											"Caller supplied event array \
-											is too small to hold all matching events");
-									rc = NVM_ERR_ARRAYTOOSMALL;
-									break;
-								}
-
-								p_events[rc-1].event_id = db_events[i].id;
-								p_events[rc-1].type = db_events[i].type;
-								p_events[rc-1].severity = db_events[i].severity;
-								p_events[rc-1].code = db_events[i].code;
-								p_events[rc-1].time = db_events[i].time;
-								p_events[rc-1].action_required = db_events[i].action_required;
-								uid_copy(db_events[i].uid, p_events[rc - 1].uid);
-
-								s_strcpy(p_events[rc-1].args[0], db_events[i].arg1,
-										NVM_EVENT_ARG_LEN);
-								s_strcpy(p_events[rc-1].args[1], db_events[i].arg2,
-										NVM_EVENT_ARG_LEN);
-								s_strcpy(p_events[rc-1].args[2], db_events[i].arg3,
-										NVM_EVENT_ARG_LEN);
-
-								// look up the message
-								populate_event_message(&p_events[rc-1]);
-								p_events[rc-1].diag_result = db_events[i].diag_result;
-							}
-						}
-					}
+					COMMON_LOG_ERROR(
+							"Caller supplied event array \
+							is too small to hold all matching events");
+					rc = NVM_ERR_ARRAYTOOSMALL;
 				}
-				free(db_events);
-			}
-			else
-			{
-				rc = NVM_ERR_NOMEMORY;
 			}
+			free(db_events);
 		}
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
+/*
+ * Filter the events in the database on the specified filter.
+ * If purge is 1, delete the matching event from the database
+ * Else if p_events is NULL or count = 0, just count the number matching.
+ * Else copy to the provided structure.
+ * Returns the count of matching events.
+ */
+int process_events_matching_filter(const struct event_filter *p_filter,
+		struct event *p_events, const NVM_UINT16 count, const NVM_BOOL purge)
+{
+	COMMON_LOG_ENTRY();
+
+	struct db_event_filter db_filter;
+	event_filter_to_db_filter(p_filter, &db_filter);
+	int rc = process_events_matching_db_filter(&db_filter, p_events, count, purge);
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Count or copy the events matching the filter with an id after after_id
+ * and up to through_id.
+ */
+int process_events_in_id_range(const struct event_filter *p_filter,
+		const int after_id, const int through_id,
+		struct event *p_events, const NVM_UINT16 count)
+{
+	COMMON_LOG_ENTRY();
+
+	struct db_event_filter db_filter;
+	event_filter_to_db_filter(p_filter, &db_filter);
+	db_filter.filter_mask |= DB_EVENT_FILTER_ID_RANGE;
+	db_filter.after_id = after_id;
+	db_filter.through_id = through_id;
+	int rc = process_events_matching_db_filter(&db_filter, p_events, count, 0);
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*!
  * Acknowledge all events that meet the filter criteria
  */
@@ -953,52 +1035,12 @@ int acknowledge_events(struct event_filter *p_filter)
 	}
 	else
 	{
-		// find events that match the filter
-		int count = process_events_matching_filter(p_filter, NULL, 0, 0);
-		if (count > 0) // at least one event needs acknowledging
+		struct db_event_filter db_filter;
+		event_filter_to_db_filter(p_filter, &db_filter);
+		if (db_acknowledge_events_by_filter(p_store, &db_filter) < 0)
 		{
-			// acknowledge event
-			struct event *events = malloc(count * sizeof(struct event));
-			if (NULL == events)
-			{
-				rc = NVM_ERR_NOMEMORY;
-			}
-			else
-			{
-				memset(events, 0, sizeof(struct event) * count);
-				count = process_events_matching_filter(p_filter, events, count, 0);
-				if (count > 0) // at least one event needs acknowledging
-				{
-					for (int i = 0; i < count; i++)
-					{
-						struct db_event db_event;
-						rc = db_get_event_by_id(p_store, events[i].event_id, &db_event);
-						if (rc != DB_SUCCESS)
-						{
-							COMMON_LOG_ERROR_F(
-								"Failed to acknowledge event %d because it doesn't exist.",
-								events[i].event_id);
-							rc = NVM_ERR_UNKNOWN;
-						}
-						else
-						{
-							if (db_event.action_required)
-							{
-								db_event.action_required = 0;
-								if (db_update_event_by_id(p_store,
-									db_event.id, &db_event) != DB_SUCCESS)
-								{
-									COMMON_LOG_ERROR_F(
-										"Failed to acknowledge event %d because of a database issue.",
-										db_event.id);
-									rc = NVM_ERR_UNKNOWN;
-								}
-							}
-						}
-					}
-				}
-			free(events);
-			}
+			COMMON_LOG_ERROR("Failed to acknowledge events because of a database issue.");
+			rc = NVM_ERR_UNKNOWN;
 		}
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -40,6 +40,12 @@ extern "C" {
 #endif
 
 #define	MAX_EVENT_SUBSCRIBERS	5 //!< Maximum number of event subscribers.
+// Appended to the config DB path for the notify file, which gets a directory of its own
+#ifdef __WINDOWS__
+#define	EVENT_NOTIFY_FILE_SUFFIX	".events\\notify"
+#else
+#define	EVENT_NOTIFY_FILE_SUFFIX	".events/notify"
+#endif
 #define	EVENT_CODE_OFFSET(type)	(type * 100)
 
 #define	EVENT_CODE_OFFSET_MGMT			EVENT_CODE_OFFSET(EVENT_TYPE_MGMT)
@@ -257,8 +263,23 @@ NVM_COMMON_API NVM_BOOL log_event_in_syslog(const struct event *p_event, const c
 NVM_COMMON_API void populate_event_message(struct event *p_event);
 
 /*
- * Retrieve all events from the database and then filter on the specified
- * filter.
+ * Register a function to call after an event is stored by this process
+ */
+NVM_COMMON_API void set_event_stored_callback(void (*p_callback)(void));
+
+/*
+ * Get the path of the file touched whenever an event is stored, so other
+ * processes can watch it
+ */
+NVM_COMMON_API int get_event_notify_path(COMMON_PATH path);
+
+/*
+ * Wake event subscribers for events stored in a transaction that has since committed
+ */
+NVM_COMMON_API void notify_pending_events();
+
+/*
+ * Filter the events in the database on the specified filter.
  * If purge is 1, delete the matching event from the database
  * Else if p_events is NULL or count = 0, just count the number matching.
  * Else copy to the provided structure.
@@ -267,6 +288,16 @@ NVM_COMMON_API void populate_event_message(struct event *p_event);
 NVM_COMMON_API int process_events_matching_filter(const struct event_filter *p_filter,
 		struct event *p_events, const NVM_UINT16 count, const NVM_BOOL purge);
 
+/*
+ * Count or copy the events matching the filter with an id after after_id
+ * and up to through_id, newest first.
+ * If p_events is NULL or count = 0, just count the number matching.
+ * Returns the count of matching events.
+ */
+NVM_COMMON_API int process_events_in_id_range(const struct event_filter *p_filter,
+		const int after_id, const int through_id,
+		struct event *p_events, const NVM_UINT16 count);
+
 /*!
  * Acknowledge all events that meet the filter criteria
  */
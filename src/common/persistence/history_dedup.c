@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file contains the implementation of the deduplicated history tables.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <checksum/checksum.h>
+#include "history_dedup.h"
+#include "schema_sql.h"
+#include "logging.h"
+
+/*
+ * History tables whose rows are stored once per distinct content. Each snapshot only adds
+ * a (history_id, content_id) reference for rows that have not changed since an earlier one.
+ */
+static const char *deduplicated_history_tables[] = {
+	"host",
+	"sw_inventory",
+	"socket",
+	"driver_capabilities",
+	"dimm_topology",
+	"identify_dimm",
+	"device_characteristics",
+	"dimm_partition",
+	"dimm_details",
+	"dimm_security_info",
+	"dimm_fw_image",
+	"dimm_fw_debug_log",
+	"fw_media_low_log_entry",
+	"fw_media_high_log_entry",
+	"fw_thermal_low_log_entry",
+	"fw_thermal_high_log_entry",
+	"dimm_platform_config",
+	"dimm_current_config",
+	"dimm_config_input",
+	"dimm_config_output",
+	"\0"
+};
+
+#define	DEDUP_SQL_LEN	32768
+#define	DEDUP_MAX_COLUMNS	256
+
+/*
+ * SQL function content_hash(...): hash the text form of each argument so a value hashes
+ * the same whether it arrives as a bound parameter or is read back from a column
+ */
+static void sql_content_hash(sqlite3_context *p_context, int argc, sqlite3_value **pp_argv)
+{
+	sqlite3_uint64 hash = 0;
+	for (int i = 0; i < argc; i++)
+	{
+		const unsigned char *p_text = sqlite3_value_text(pp_argv[i]);
+		sqlite3_uint64 value_hash = 0;
+		if (p_text)
+		{
+			int len = sqlite3_value_bytes(pp_argv[i]);
+			int aligned = len & ~3;
+			value_hash = fletcher64(p_text, aligned, aligned);
+			for (int j = aligned; j < len; j++)
+			{
+				value_hash = (value_hash << 8 | value_hash >> 56) ^ p_text[j];
+			}
+			value_hash ^= (sqlite3_uint64)len << 32;
+		}
+		else
+		{
+			value_hash = 0xFFFFFFFFFFFFFFFFULL;
+		}
+		hash = (hash * 0x100000001B3ULL) ^ value_hash;
+	}
+	sqlite3_result_int64(p_context, (sqlite3_int64)hash);
+}
+
+void register_content_hash(sqlite3 *p_db)
+{
+	int sql_rc = sqlite3_create_function(p_db, "content_hash", -1,
+			SQLITE_UTF8 | SQLITE_DETERMINISTIC, NULL, sql_content_hash, NULL, NULL);
+	if (sql_rc != SQLITE_OK)
+	{
+		COMMON_LOG_ERROR_F("Failed to register content_hash, error code %d", sql_rc);
+	}
+}
+
+/*
+ * Append formatted text to a DEDUP_SQL_LEN SQL buffer, returning 0 once it no longer fits
+ */
+static int sql_append(char *sql, int *p_len, const char *format, ...)
+{
+	int ok = (*p_len >= 0);
+	if (ok)
+	{
+		va_list args;
+		va_start(args, format);
+		int n = vsnprintf(sql + *p_len, DEDUP_SQL_LEN - *p_len, format, args);
+		va_end(args);
+		ok = (n >= 0 && n < DEDUP_SQL_LEN - *p_len);
+		*p_len = ok ? *p_len + n : -1;
+	}
+	return ok;
+}
+
+/*
+ * Append "p.a, p.b, ..." for the row prefix p (which may be empty)
+ */
+static int sql_append_columns(char *sql, int *p_len, const char *prefix,
+		char columns[][256], int column_count)
+{
+	int ok = 1;
+	for (int i = 0; ok && i < column_count; i++)
+	{
+		ok = sql_append(sql, p_len, "%s%s%s", i ? ", " : "", prefix, columns[i]);
+	}
+	return ok;
+}
+
+/*
+ * Append a match on the content of the row prefix p (NEW. or OLD.), by hash then by value
+ */
+static int sql_append_content_match(char *sql, int *p_len, const char *table_prefix,
+		const char *row_prefix, char columns[][256], int column_count)
+{
+	int ok = sql_append(sql, p_len, "%scontent_hash = content_hash(", table_prefix) &&
+		sql_append_columns(sql, p_len, row_prefix, columns, column_count) &&
+		sql_append(sql, p_len, ")");
+	for (int i = 0; ok && i < column_count; i++)
+	{
+		ok = sql_append(sql, p_len, " AND %s%s IS %s%s",
+				table_prefix, columns[i], row_prefix, columns[i]);
+	}
+	return ok;
+}
+
+/*
+ * Replace the plain table <table>_history with a <table>_history_content table holding each
+ * distinct row once, a <table>_history_ref table mapping snapshots to content, and a
+ * <table>_history view over both whose triggers keep the existing INSERT and DELETE
+ * statements working. Rows already in the plain table are carried over.
+ */
+static enum db_return_codes deduplicate_history_table(sqlite3 *p_db, const char *t)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	char columns[DEDUP_MAX_COLUMNS][256];
+	char types[DEDUP_MAX_COLUMNS][64];
+	int column_count = 0;
+	char *sql = (char *)malloc(DEDUP_SQL_LEN);
+	if (sql)
+	{
+		sqlite3_stmt *p_stmt;
+		snprintf(sql, DEDUP_SQL_LEN, "PRAGMA table_info(%s_history)", t);
+		if (SQLITE_PREPARE(p_db, sql, p_stmt) == SQLITE_OK)
+		{
+			rc = DB_SUCCESS;
+			while (sqlite3_step(p_stmt) == SQLITE_ROW)
+			{
+				const char *name = (const char *)sqlite3_column_text(p_stmt, 1);
+				const char *type = (const char *)sqlite3_column_text(p_stmt, 2);
+				if (column_count >= DEDUP_MAX_COLUMNS)
+				{
+					rc = DB_ERR_FAILURE;
+				}
+				else if (name && strcmp(name, "history_id") != 0)
+				{
+					snprintf(columns[column_count], sizeof (columns[0]), "%s", name);
+					snprintf(types[column_count], sizeof (types[0]), "%s", type ? type : "");
+					column_count++;
+				}
+			}
+			sqlite3_finalize(p_stmt);
+		}
+	}
+
+	if (rc == DB_SUCCESS && column_count > 0)
+	{
+		int ok = (run_sql_no_results(p_db, "SAVEPOINT deduplicate_history") == DB_SUCCESS);
+		int len;
+
+		// content table, one row per distinct value, found by hash
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE TABLE %s_history_content "
+				"(content_id INTEGER PRIMARY KEY, content_hash INTEGER NOT NULL", t);
+		for (int i = 0; ok && i < column_count; i++)
+		{
+			ok = sql_append(sql, &len, ", %s %s", columns[i], types[i]);
+		}
+		ok = ok && sql_append(sql, &len, ")") &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE INDEX %s_history_content_hash "
+				"ON %s_history_content (content_hash)", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// per snapshot references
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE TABLE %s_history_ref "
+				"(history_id INTEGER NOT NULL, content_id INTEGER NOT NULL)", t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE INDEX %s_history_ref_history "
+				"ON %s_history_ref (history_id)", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE INDEX %s_history_ref_content "
+				"ON %s_history_ref (content_id)", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// move the plain table aside
+		len = 0;
+		ok = ok && sql_append(sql, &len, "ALTER TABLE %s_history "
+				"RENAME TO %s_history_legacy", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// the view readers see, rows come back in the order they were saved
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE VIEW %s_history AS SELECT r.history_id", t);
+		for (int i = 0; ok && i < column_count; i++)
+		{
+			ok = sql_append(sql, &len, ", c.%s AS %s", columns[i], columns[i]);
+		}
+		ok = ok && sql_append(sql, &len, " FROM %s_history_ref r JOIN %s_history_content c "
+				"ON c.content_id = r.content_id ORDER BY r.rowid", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// insert stores the content if it is new, then references it
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE TRIGGER %s_history_insert "
+				"INSTEAD OF INSERT ON %s_history BEGIN "
+				"INSERT INTO %s_history_content (content_hash, ", t, t, t) &&
+			sql_append_columns(sql, &len, "", columns, column_count) &&
+			sql_append(sql, &len, ") SELECT content_hash(") &&
+			sql_append_columns(sql, &len, "NEW.", columns, column_count) &&
+			sql_append(sql, &len, "), ") &&
+			sql_append_columns(sql, &len, "NEW.", columns, column_count) &&
+			sql_append(sql, &len, " WHERE NOT EXISTS "
+				"(SELECT 1 FROM %s_history_content WHERE ", t) &&
+			sql_append_content_match(sql, &len, "", "NEW.", columns, column_count) &&
+			sql_append(sql, &len, "); INSERT INTO %s_history_ref (history_id, content_id) "
+				"SELECT NEW.history_id, content_id FROM %s_history_content WHERE ", t, t) &&
+			sql_append_content_match(sql, &len, "", "NEW.", columns, column_count) &&
+			sql_append(sql, &len, " LIMIT 1; END") &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// delete drops one reference per deleted row, content is pruned separately
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE TRIGGER %s_history_delete "
+				"INSTEAD OF DELETE ON %s_history BEGIN "
+				"DELETE FROM %s_history_ref WHERE rowid = (SELECT r.rowid "
+				"FROM %s_history_ref r JOIN %s_history_content c "
+				"ON c.content_id = r.content_id WHERE r.history_id = OLD.history_id AND ",
+				t, t, t, t, t) &&
+			sql_append_content_match(sql, &len, "c.", "OLD.", columns, column_count) &&
+			sql_append(sql, &len, " LIMIT 1); END") &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// update points the reference at the new content, keeping its position
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE TRIGGER %s_history_update "
+				"INSTEAD OF UPDATE ON %s_history BEGIN "
+				"INSERT INTO %s_history_content (content_hash, ", t, t, t) &&
+			sql_append_columns(sql, &len, "", columns, column_count) &&
+			sql_append(sql, &len, ") SELECT content_hash(") &&
+			sql_append_columns(sql, &len, "NEW.", columns, column_count) &&
+			sql_append(sql, &len, "), ") &&
+			sql_append_columns(sql, &len, "NEW.", columns, column_count) &&
+			sql_append(sql, &len, " WHERE NOT EXISTS "
+				"(SELECT 1 FROM %s_history_content WHERE ", t) &&
+			sql_append_content_match(sql, &len, "", "NEW.", columns, column_count) &&
+			sql_append(sql, &len, "); UPDATE %s_history_ref SET history_id = NEW.history_id, "
+				"content_id = (SELECT content_id FROM %s_history_content WHERE ", t, t) &&
+			sql_append_content_match(sql, &len, "", "NEW.", columns, column_count) &&
+			sql_append(sql, &len, " LIMIT 1) WHERE rowid = (SELECT r.rowid "
+				"FROM %s_history_ref r JOIN %s_history_content c "
+				"ON c.content_id = r.content_id WHERE r.history_id = OLD.history_id AND ",
+				t, t) &&
+			sql_append_content_match(sql, &len, "c.", "OLD.", columns, column_count) &&
+			sql_append(sql, &len, " LIMIT 1); END") &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// carry over existing snapshots
+		len = 0;
+		ok = ok && sql_append(sql, &len, "INSERT INTO %s_history "
+				"SELECT * FROM %s_history_legacy ORDER BY rowid", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "DROP TABLE %s_history_legacy", t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		if (!ok)
+		{
+			COMMON_LOG_ERROR_F("Failed to deduplicate history table '%s'", t);
+			run_sql_no_results(p_db, "ROLLBACK TO deduplicate_history");
+			rc = DB_ERR_FAILURE;
+		}
+		run_sql_no_results(p_db, "RELEASE deduplicate_history");
+	}
+	free(sql);
+	return rc;
+}
+
+/*
+ * Check whether <table>_history is of the sqlite_master type given
+ */
+static int history_table_is(sqlite3 *p_db, const char *table, const char *type)
+{
+	sqlite3_stmt *p_stmt;
+	char sql[1024];
+	int is_type = 0;
+	snprintf(sql, sizeof (sql), "SELECT name FROM sqlite_master "
+			"WHERE type = '%s' AND name = '%s_history'", type, table);
+	if (SQLITE_PREPARE(p_db, sql, p_stmt) == SQLITE_OK)
+	{
+		is_type = (sqlite3_step(p_stmt) == SQLITE_ROW);
+		sqlite3_finalize(p_stmt);
+	}
+	return is_type;
+}
+
+void deduplicate_history_tables(sqlite3 *p_db)
+{
+	for (int i = 0; deduplicated_history_tables[i][0] != '\0'; i++)
+	{
+		if (history_table_is(p_db, deduplicated_history_tables[i], "table"))
+		{
+			deduplicate_history_table(p_db, deduplicated_history_tables[i]);
+		}
+	}
+}
+
+/*
+ * Turn a deduplicated <table>_history view back into the plain table older builds write,
+ * with the same rows in the same order
+ */
+static enum db_return_codes restore_history_table(sqlite3 *p_db, const char *t)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	char *sql = (char *)malloc(DEDUP_SQL_LEN);
+	if (sql)
+	{
+		int ok = (run_sql_no_results(p_db, "SAVEPOINT restore_history") == DB_SUCCESS);
+		int len;
+
+		// the content table keeps the column types of the original table
+		len = 0;
+		ok = ok && sql_append(sql, &len, "CREATE TABLE %s_history_plain "
+				"(history_id INTEGER NOT NULL", t);
+		sqlite3_stmt *p_stmt;
+		char pragma[1024];
+		snprintf(pragma, sizeof (pragma), "PRAGMA table_info(%s_history_content)", t);
+		if (ok && SQLITE_PREPARE(p_db, pragma, p_stmt) == SQLITE_OK)
+		{
+			while (ok && sqlite3_step(p_stmt) == SQLITE_ROW)
+			{
+				const char *name = (const char *)sqlite3_column_text(p_stmt, 1);
+				const char *type = (const char *)sqlite3_column_text(p_stmt, 2);
+				if (name && strcmp(name, "content_id") != 0 &&
+						strcmp(name, "content_hash") != 0)
+				{
+					ok = sql_append(sql, &len, ", %s %s", name, type ? type : "");
+				}
+			}
+			sqlite3_finalize(p_stmt);
+		}
+		else
+		{
+			ok = 0;
+		}
+		ok = ok && sql_append(sql, &len, ")") &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "INSERT INTO %s_history_plain "
+				"SELECT * FROM %s_history", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		// dropping the view drops its triggers
+		len = 0;
+		ok = ok && sql_append(sql, &len, "DROP VIEW %s_history", t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "DROP TABLE %s_history_ref", t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "DROP TABLE %s_history_content", t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		len = 0;
+		ok = ok && sql_append(sql, &len, "ALTER TABLE %s_history_plain "
+				"RENAME TO %s_history", t, t) &&
+			(run_sql_no_results(p_db, sql) == DB_SUCCESS);
+
+		if (!ok)
+		{
+			COMMON_LOG_ERROR_F("Failed to restore history table '%s'", t);
+			run_sql_no_results(p_db, "ROLLBACK TO restore_history");
+		}
+		run_sql_no_results(p_db, "RELEASE restore_history");
+		rc = ok ? DB_SUCCESS : DB_ERR_FAILURE;
+		free(sql);
+	}
+	return rc;
+}
+
+enum db_return_codes db_restore_history_tables(PersistentStore *p_ps)
+{
+	enum db_return_codes rc = DB_SUCCESS;
+	sqlite3 *p_db = get_PersistentStore_db(p_ps);
+	for (int i = 0; deduplicated_history_tables[i][0] != '\0'; i++)
+	{
+		if (history_table_is(p_db, deduplicated_history_tables[i], "view"))
+		{
+			KEEP_DB_ERROR(rc, restore_history_table(p_db, deduplicated_history_tables[i]));
+		}
+	}
+	return rc;
+}
+
+enum db_return_codes db_prune_history_content(PersistentStore *p_ps)
+{
+	enum db_return_codes rc = DB_SUCCESS;
+	sqlite3 *p_db = get_PersistentStore_db(p_ps);
+	for (int i = 0; deduplicated_history_tables[i][0] != '\0'; i++)
+	{
+		const char *table = deduplicated_history_tables[i];
+		char sql[1024];
+		snprintf(sql, sizeof (sql), "%s_history_content", table);
+		if (table_exists(p_db, sql))
+		{
+			snprintf(sql, sizeof (sql),
+					"DELETE FROM %s_history_content WHERE NOT EXISTS "
+					"(SELECT 1 FROM %s_history_ref r "
+					"WHERE r.content_id = %s_history_content.content_id)",
+					table, table, table);
+			KEEP_DB_ERROR(rc, run_sql_no_results(p_db, sql));
+		}
+	}
+	return rc;
+}
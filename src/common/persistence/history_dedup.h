@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file declares the deduplicated history tables. A history table listed in
+ * history_dedup.c stores each distinct row once in <table>_history_content, with a
+ * <table>_history_ref row per snapshot, behind a <table>_history view that keeps the
+ * generated history SQL working.
+ */
+
+#ifndef	_HISTORY_DEDUP_H_
+#define	_HISTORY_DEDUP_H_
+
+#include <sqlite3.h>
+#include "schema.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Register the content_hash() SQL function the view triggers use on a new connection
+ */
+void register_content_hash(sqlite3 *p_db);
+
+/*
+ * Convert the listed history tables that are still plain tables
+ */
+void deduplicate_history_tables(sqlite3 *p_db);
+
+/*!
+ * Delete history content no longer referenced by any snapshot.
+ * Deleting history rows only drops the references to the shared content.
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @ingroup db_schema
+ */
+NVM_COMMON_API enum db_return_codes db_prune_history_content(PersistentStore *p_ps);
+
+/*!
+ * Convert the deduplicated history tables back to plain tables with the same rows in
+ * the same order, for a copy of the store that leaves this build, such as the
+ * gathered support data. The next create_PersistentStore converts them again.
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @ingroup db_schema
+ */
+NVM_COMMON_API enum db_return_codes db_restore_history_tables(PersistentStore *p_ps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HISTORY_DEDUP_H_ */
@@ -60,6 +60,8 @@ struct db_config cache_configs[CONFIG_CACHE_SIZE];
 
 // GLOBAL database pointer for this process
 PersistentStore *p_store;
+// read only connection for this process, only opened in WAL mode
+PersistentStore *p_read_store;
 
 // helper functions
 void add_config_value_to_pstore(const PersistentStore *p_ps, const char *key, const char *value);
@@ -163,6 +165,31 @@ void set_config_cache(const char *key, const char *val)
 	}
 }
 
+/*
+ * Apply the journal mode and cache size settings to the open database and,
+ * in WAL mode, open the read connection which then no longer waits on writers.
+ */
+void configure_lib_store(const char *path)
+{
+	int wal = 0;
+	int cache_size_kb = 0;
+	get_config_value_int(SQL_KEY_DB_WAL_MODE_ENABLED, &wal);
+	get_config_value_int(SQL_KEY_DB_CACHE_SIZE_KB, &cache_size_kb);
+	if (configure_PersistentStore(p_store, wal, cache_size_kb) != DB_SUCCESS)
+	{
+		// another process may hold the database, keep the current journal mode
+		COMMON_LOG_WARN("Failed to apply the config database journal settings");
+	}
+	else if (wal)
+	{
+		p_read_store = open_readonly_PersistentStore(path);
+		if (p_read_store)
+		{
+			configure_PersistentStore(p_read_store, wal, cache_size_kb);
+		}
+	}
+}
+
 /*
  * Set up the connection to the product configuration and support database.
  */
@@ -178,6 +205,7 @@ int open_lib_store(const char *path)
 		else
 		{
 			init_config_cache();
+			log_config_changed(NULL);
 			p_store = open_PersistentStore(path);
 			if (p_store == NULL)
 			{
@@ -185,6 +213,7 @@ int open_lib_store(const char *path)
 			}
 			else
 			{
+				configure_lib_store(path);
 				rc = log_init();
 			}
 		}
@@ -200,6 +229,10 @@ int close_lib_store()
 {
 	int rc = COMMON_SUCCESS;
 	log_close();
+	if (p_read_store)
+	{
+		free_PersistentStore(&p_read_store);
+	}
 	if (free_PersistentStore(&p_store) != DB_SUCCESS)
 	{
 		rc = COMMON_ERR_UNKNOWN;
@@ -216,6 +249,32 @@ PersistentStore *get_lib_store()
 	return p_store;
 }
 
+/*
+ * Return a pointer to the read only connection to the configuration database,
+ * or the read/write connection when there isn't one
+ */
+PersistentStore *get_lib_read_store()
+{
+	return p_read_store ? p_read_store : p_store;
+}
+
+/*
+ * Copy the write-ahead log back into the configuration database
+ */
+int checkpoint_lib_store()
+{
+	int rc = COMMON_SUCCESS;
+	// only the WAL journal mode opens a read connection
+	if (p_store && p_read_store)
+	{
+		if (checkpoint_PersistentStore(p_store, 0) != DB_SUCCESS)
+		{
+			rc = COMMON_ERR_FAILED;
+		}
+	}
+	return rc;
+}
+
 /*
  * Return a pointer to the configuration database
  */
@@ -418,6 +477,7 @@ int add_config_value(const char *key, const char *value)
 
 			//update cache
 			set_config_cache(key, value);
+			log_config_changed(key);
 
 			// add it
 			struct db_config config;
@@ -450,6 +510,7 @@ int rm_config_value(const char *key)
 			{
 				rc = COMMON_SUCCESS;
 			}
+			log_config_changed(key);
 		}
 	}
 	return rc;
@@ -526,6 +587,14 @@ int set_default_config_settings(PersistentStore *p_ps)
 		add_config_value_to_pstore(p_ps, SQL_KEY_EVENT_LOG_TRIM_PERCENT, "10");
 		add_config_value_to_pstore(p_ps, SQL_KEY_TOPOLOGY_STATE_VALID, "0");
 
+		// FW result cache
+		add_config_value_to_pstore(p_ps, SQL_KEY_FW_STATIC_CACHE_TTL_SECONDS, "600");
+		add_config_value_to_pstore(p_ps, SQL_KEY_FW_SETTING_CACHE_TTL_SECONDS, "60");
+
+		// config database tuning
+		add_config_value_to_pstore(p_ps, SQL_KEY_DB_WAL_MODE_ENABLED, "0");
+		add_config_value_to_pstore(p_ps, SQL_KEY_DB_CACHE_SIZE_KB, "2048");
+
 		// CLI default device identifier output - HANDLE (or uid)
 		add_config_value_to_pstore(p_ps, SQL_KEY_CLI_DIMM_ID, "HANDLE");
 		add_config_value_to_pstore(p_ps, SQL_KEY_CLI_SIZE, "AUTO");
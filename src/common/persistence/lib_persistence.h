@@ -80,6 +80,23 @@ NVM_COMMON_API extern int close_lib_store();
  */
 NVM_COMMON_API extern PersistentStore *get_lib_store();
 
+/*!
+ * Return a pointer to a read only connection to the configuration database.
+ * In WAL mode reads through it don't wait on writers in other processes.
+ * @return
+ * 		The read connection, the read/write connection if there is no read
+ * 		connection, or NULL if not open.
+ */
+NVM_COMMON_API extern PersistentStore *get_lib_read_store();
+
+/*!
+ * Checkpoint the configuration database when it is in WAL mode.
+ * @return
+ * 		#COMMON_SUCCESS @n
+ * 		#COMMON_ERR_FAILED
+ */
+NVM_COMMON_API extern int checkpoint_lib_store();
+
 /*!
  * Open the default configuration database and return the pointer to it.
  */
@@ -33,10 +33,12 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdarg.h>
+#include <time.h>
 
 #include <common_types.h>
 #include <os/os_adapter.h>
 #include <file_ops/file_ops_adapter.h>
+#include <string/s_str.h>
 
 #include "logging.h"
 #include "csv_log.h"
@@ -55,8 +57,18 @@
 
 #define	SYSLOG_SOURCE	"IntelNVM"
 
-static volatile int g_log_level = -1;
-static volatile int g_print_mask = -1;
+// Another process (e.g. the CLI) may change the log destination in the config DB,
+// so a long running process re-reads it after this many seconds
+#define	LOG_DESTINATION_TTL_SECONDS	30
+
+// log settings cached from the config DB, -1 means not read yet.
+// They are read on every log call without a lock. This relies on an aligned int being
+// read and written whole on the x86 targets, so a racing reader sees either the old
+// value or -1 and re-reads the config. There is no ordering between the settings.
+static int g_log_level = -1;
+static int g_print_mask = -1;
+static int g_log_destination = -1;
+static time_t g_log_destination_expiration = 0;
 
 void print_buffer_to_file(const char *filename, char *p_buf, size_t buf_size, char *p_prefix)
 {
@@ -119,15 +131,31 @@ void log_close()
 	csv_log_close();
 }
 
+/*
+ * Retrieve the current log destination
+ */
+int get_current_log_destination()
+{
+	int dest = g_log_destination;
+	time_t now = time(NULL);
+	if (dest < 0 || now >= g_log_destination_expiration)
+	{
+		dest = LOG_DEST_DB; // default to DB
+		if (get_config_value_int(SQL_KEY_LOG_DESTINATION, &dest) == COMMON_SUCCESS)
+		{
+			g_log_destination = dest;
+			g_log_destination_expiration = now + LOG_DESTINATION_TTL_SECONDS;
+		}
+	}
+	return dest;
+}
+
 /*
  * log something
  */
 void do_log(int level, const char *file_name, int line_number, const char *message)
 {
-	// get config value to determine where to write the log
-	int dest = LOG_DEST_DB; // default to DB
-	get_config_value_int(SQL_KEY_LOG_DESTINATION, &dest);
-	switch (dest)
+	switch (get_current_log_destination())
 	{
 		case LOG_DEST_DB:
 			// csv file is a buffer to the DB for performance
@@ -144,13 +172,20 @@ void do_log(int level, const char *file_name, int line_number, const char *messa
  */
 void log_trace(int level, int flags, const char *file_name, int line_number, const char *message)
 {
-	if (flags & get_current_print_mask())
+	int print = flags & get_current_print_mask();
+	int log = log_level_check(level);
+	if (!print && !log)
+	{
+		return;
+	}
+
+	if (print)
 	{
 		printf("---file_name: %s, line_number: %d, message: %s---\n",
 			file_name, line_number, message);
 	}
 
-	if (log_level_check(level))
+	if (log)
 	{
 		do_log(level, file_name, line_number, message);
 	}
@@ -162,8 +197,16 @@ void log_trace(int level, int flags, const char *file_name, int line_number, con
 void log_trace_f(int level, int flags, const char *file_name, int line_number,
 			const char *format, ...)
 {
+	// logging is usually off, keep that path to a single branch
+	int print = flags & get_current_print_mask();
+	int log = log_level_check(level);
+	if (!print && !log)
+	{
+		return;
+	}
+
 	va_list args;
-	if (flags & get_current_print_mask())
+	if (print)
 	{
 		va_start(args, format);
 		vprintf(format, args);
@@ -171,7 +214,7 @@ void log_trace_f(int level, int flags, const char *file_name, int line_number,
 		va_end(args);
 	}
 
-	if (log_level_check(level))
+	if (log)
 	{
 		char *message = NULL;
 		int size = 64;
@@ -256,10 +299,18 @@ void log_to_syslog(int level, const char *file_name, int line_number, const char
 
 int get_current_print_mask()
 {
-	int print_mask = 0;
-	if (get_config_value_int(SQL_KEY_PRINT_MASK, &print_mask) != COMMON_SUCCESS)
+	int print_mask = g_print_mask;
+	if (print_mask < 0)
 	{
 		print_mask = 0;
+		if (get_config_value_int(SQL_KEY_PRINT_MASK, &print_mask) == COMMON_SUCCESS)
+		{
+			g_print_mask = print_mask;
+		}
+		else
+		{
+			print_mask = 0;
+		}
 	}
 	return print_mask;
 }
@@ -279,6 +330,7 @@ COMMON_BOOL set_current_print_mask(int mask, int write_thru)
 	else
 	{
 		set_config_cache(SQL_KEY_PRINT_MASK, mask_str);
+		log_config_changed(SQL_KEY_PRINT_MASK);
 	}
 	return 1;
 }
@@ -288,12 +340,20 @@ COMMON_BOOL set_current_print_mask(int mask, int write_thru)
  */
 int get_current_log_level()
 {
-	int log_level = 0;
-	if(COMMON_SUCCESS == get_config_value_int(SQL_KEY_LOG_LEVEL, &log_level))
+	int log_level = g_log_level;
+	if (log_level < 0)
 	{
-		return log_level;
+		log_level = 0;
+		if (COMMON_SUCCESS == get_config_value_int(SQL_KEY_LOG_LEVEL, &log_level))
+		{
+			g_log_level = log_level;
+		}
+		else
+		{
+			log_level = 0;
+		}
 	}
-	return 0;
+	return log_level;
 }
 
 /*
@@ -309,3 +369,22 @@ COMMON_BOOL set_current_log_level(int level)
 	}
 	return 0;
 }
+
+/*
+ * Drop the cached copy of a log setting so the next log call re-reads it
+ */
+void log_config_changed(const char *key)
+{
+	if (!key || s_strncmp(key, SQL_KEY_LOG_LEVEL, CONFIG_KEY_LEN) == 0)
+	{
+		g_log_level = -1;
+	}
+	if (!key || s_strncmp(key, SQL_KEY_PRINT_MASK, CONFIG_KEY_LEN) == 0)
+	{
+		g_print_mask = -1;
+	}
+	if (!key || s_strncmp(key, SQL_KEY_LOG_DESTINATION, CONFIG_KEY_LEN) == 0)
+	{
+		g_log_destination = -1;
+	}
+}
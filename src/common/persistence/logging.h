@@ -210,6 +210,18 @@ NVM_COMMON_API int get_current_log_level();
  */
 NVM_COMMON_API COMMON_BOOL set_current_log_level(int level);
 
+/*
+ * Retrieve the current log destination
+ */
+NVM_COMMON_API int get_current_log_destination();
+
+/*!
+ * Drop the cached value of a log setting after its config value changes
+ * @param[in] key
+ * 		The config key that changed or NULL for all log settings
+ */
+NVM_COMMON_API void log_config_changed(const char *key);
+
 #ifdef __cplusplus
 }
 #endif
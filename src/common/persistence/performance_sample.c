@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file contains the implementation of the performance_sample table.
+ */
+
+#include <string.h>
+#include "performance_sample.h"
+#include "schema_sql.h"
+#include "logging.h"
+
+#define	PERFORMANCE_SAMPLE_CREATE_STATEMENT \
+	"CREATE TABLE IF NOT EXISTS performance_sample (       \
+		 dimm_uid TEXT  NOT NULL  , \
+		 granularity INTEGER  NOT NULL  , \
+		 slot INTEGER  NOT NULL  , \
+		 start_time INTEGER  , \
+		 seconds INTEGER  , \
+		 bytes_read INTEGER  , \
+		 bytes_written INTEGER  , \
+		 read_reqs INTEGER  , \
+		 host_write_cmds INTEGER  , \
+		 block_reads INTEGER  , \
+		 block_writes INTEGER  , \
+		 sample_count INTEGER  , \
+		 PRIMARY KEY (dimm_uid, granularity, slot) \
+		) WITHOUT ROWID;"
+
+enum db_return_codes db_create_performance_sample_table(const PersistentStore *p_ps)
+{
+	sqlite3 *p_db = get_PersistentStore_db(p_ps);
+	// stores created before the table existed get it on first use
+	enum db_return_codes rc = run_sql_no_results(p_db, PERFORMANCE_SAMPLE_CREATE_STATEMENT);
+	sqlite3_stmt *p_stmt;
+	if (rc == DB_SUCCESS && SQLITE_PREPARE(p_db,
+			"SELECT sample_count FROM performance_sample LIMIT 0", p_stmt) == SQLITE_OK)
+	{
+		sqlite3_finalize(p_stmt);
+	}
+	else if (rc == DB_SUCCESS)
+	{
+		// and stores that predate the sample_count column get that
+		rc = run_sql_no_results(p_db,
+				"ALTER TABLE performance_sample ADD COLUMN sample_count INTEGER");
+	}
+
+	// the snapshots table it replaces only lends each DIMM its last reading as the
+	// baseline (granularity -1) so the next sample still has a delta
+	if (rc == DB_SUCCESS && table_exists(p_db, "performance"))
+	{
+		rc = run_sql_no_results(p_db, "SAVEPOINT migrate_performance");
+		if (rc == DB_SUCCESS)
+		{
+			rc = run_sql_no_results(p_db,
+				"INSERT OR IGNORE INTO performance_sample \
+				(dimm_uid, granularity, slot, start_time, seconds, bytes_read, bytes_written, \
+				read_reqs, host_write_cmds, block_reads, block_writes, sample_count) \
+				SELECT dimm_uid, -1, 0, time, 0, bytes_read, bytes_written, \
+				read_reqs, host_write_cmds, block_reads, block_writes, 0 \
+				FROM performance WHERE dimm_uid IS NOT NULL AND id IN \
+				(SELECT MAX(id) FROM performance GROUP BY dimm_uid)");
+			KEEP_DB_ERROR(rc, run_sql_no_results(p_db, "DROP TABLE performance"));
+			if (rc != DB_SUCCESS)
+			{
+				run_sql_no_results(p_db, "ROLLBACK TO migrate_performance");
+			}
+			run_sql_no_results(p_db, "RELEASE migrate_performance");
+		}
+	}
+	return rc;
+}
+
+static void bind_performance_sample(sqlite3_stmt *p_stmt,
+	const struct db_performance_sample *p_sample)
+{
+	BIND_TEXT(p_stmt, "$dimm_uid", (char *)p_sample->dimm_uid);
+	BIND_INTEGER(p_stmt, "$granularity", (int)p_sample->granularity);
+	BIND_INTEGER(p_stmt, "$slot", (int)p_sample->slot);
+	BIND_INTEGER(p_stmt, "$start_time", (unsigned long long)p_sample->start_time);
+	BIND_INTEGER(p_stmt, "$seconds", (unsigned long long)p_sample->seconds);
+	BIND_INTEGER(p_stmt, "$bytes_read", (unsigned long long)p_sample->bytes_read);
+	BIND_INTEGER(p_stmt, "$bytes_written", (unsigned long long)p_sample->bytes_written);
+	BIND_INTEGER(p_stmt, "$read_reqs", (unsigned long long)p_sample->read_reqs);
+	BIND_INTEGER(p_stmt, "$host_write_cmds", (unsigned long long)p_sample->host_write_cmds);
+	BIND_INTEGER(p_stmt, "$block_reads", (unsigned long long)p_sample->block_reads);
+	BIND_INTEGER(p_stmt, "$block_writes", (unsigned long long)p_sample->block_writes);
+	BIND_INTEGER(p_stmt, "$sample_count", (unsigned long long)p_sample->sample_count);
+}
+
+static void row_to_performance_sample(sqlite3_stmt *p_stmt,
+	struct db_performance_sample *p_sample)
+{
+	TEXT_COLUMN(p_stmt, 0, p_sample->dimm_uid, PERFORMANCE_DIMM_UID_LEN);
+	INTEGER_COLUMN(p_stmt, 1, p_sample->granularity);
+	INTEGER_COLUMN(p_stmt, 2, p_sample->slot);
+	INTEGER_COLUMN(p_stmt, 3, p_sample->start_time);
+	INTEGER_COLUMN(p_stmt, 4, p_sample->seconds);
+	INTEGER_COLUMN(p_stmt, 5, p_sample->bytes_read);
+	INTEGER_COLUMN(p_stmt, 6, p_sample->bytes_written);
+	INTEGER_COLUMN(p_stmt, 7, p_sample->read_reqs);
+	INTEGER_COLUMN(p_stmt, 8, p_sample->host_write_cmds);
+	INTEGER_COLUMN(p_stmt, 9, p_sample->block_reads);
+	INTEGER_COLUMN(p_stmt, 10, p_sample->block_writes);
+	INTEGER_COLUMN(p_stmt, 11, p_sample->sample_count);
+}
+
+enum db_return_codes db_save_performance_sample(const PersistentStore *p_ps,
+	const struct db_performance_sample *p_sample)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	const char *sql = "INSERT OR REPLACE INTO performance_sample \
+		(dimm_uid, granularity, slot, start_time, seconds, bytes_read, bytes_written, \
+		read_reqs, host_write_cmds, block_reads, block_writes, sample_count) \
+		VALUES \
+		($dimm_uid, $granularity, $slot, $start_time, $seconds, $bytes_read, $bytes_written, \
+		$read_reqs, $host_write_cmds, $block_reads, $block_writes, $sample_count) ";
+	sqlite3_stmt *p_stmt;
+	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
+	{
+		bind_performance_sample(p_stmt, p_sample);
+		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
+		{
+			rc = DB_SUCCESS;
+		}
+		else
+		{
+			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
+		}
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
+
+enum db_return_codes db_get_performance_sample(const PersistentStore *p_ps,
+	const char *dimm_uid,
+	const int granularity,
+	const int slot,
+	struct db_performance_sample *p_sample)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	memset(p_sample, 0, sizeof (struct db_performance_sample));
+	const char *sql = "SELECT \
+		dimm_uid, granularity, slot, start_time, seconds, bytes_read, bytes_written, \
+		read_reqs, host_write_cmds, block_reads, block_writes, sample_count \
+		FROM performance_sample \
+		WHERE dimm_uid = $dimm_uid AND granularity = $granularity AND slot = $slot";
+	sqlite3_stmt *p_stmt;
+	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
+	{
+		BIND_TEXT(p_stmt, "$dimm_uid", dimm_uid);
+		BIND_INTEGER(p_stmt, "$granularity", granularity);
+		BIND_INTEGER(p_stmt, "$slot", slot);
+		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
+		{
+			row_to_performance_sample(p_stmt, p_sample);
+			rc = DB_SUCCESS;
+		}
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
+
+int db_get_performance_samples_in_range(const PersistentStore *p_ps,
+	const char *dimm_uid,
+	const int granularity,
+	const unsigned long long start_time,
+	const unsigned long long end_time,
+	struct db_performance_sample *p_samples,
+	int sample_count)
+{
+	int rc = DB_ERR_FAILURE;
+	memset(p_samples, 0, sizeof (struct db_performance_sample) * sample_count);
+	const char *sql = "SELECT \
+		dimm_uid, granularity, slot, start_time, seconds, bytes_read, bytes_written, \
+		read_reqs, host_write_cmds, block_reads, block_writes, sample_count \
+		FROM performance_sample \
+		WHERE dimm_uid = $dimm_uid AND granularity = $granularity \
+		AND start_time >= $start_time AND start_time < $end_time \
+		ORDER BY start_time LIMIT $limit";
+	sqlite3_stmt *p_stmt;
+	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
+	{
+		BIND_TEXT(p_stmt, "$dimm_uid", dimm_uid);
+		BIND_INTEGER(p_stmt, "$granularity", granularity);
+		BIND_INTEGER(p_stmt, "$start_time", start_time);
+		BIND_INTEGER(p_stmt, "$end_time", end_time);
+		BIND_INTEGER(p_stmt, "$limit", sample_count);
+		int index = 0;
+		while (index < sample_count && (sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
+		{
+			row_to_performance_sample(p_stmt, &p_samples[index]);
+			index++;
+		}
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
+		// a full buffer stops the loop before the last step
+		if (index < sample_count && sql_rc != SQLITE_DONE)
+		{
+			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
+		}
+		else
+		{
+			rc = index;
+		}
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
+
+enum db_return_codes db_delete_performance_samples_from_slot(const PersistentStore *p_ps,
+	const char *dimm_uid,
+	const int granularity,
+	const int first_slot)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	const char *sql = "DELETE FROM performance_sample \
+		WHERE dimm_uid = $dimm_uid AND granularity = $granularity AND slot >= $slot";
+	sqlite3_stmt *p_stmt;
+	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
+	{
+		BIND_TEXT(p_stmt, "$dimm_uid", dimm_uid);
+		BIND_INTEGER(p_stmt, "$granularity", granularity);
+		BIND_INTEGER(p_stmt, "$slot", first_slot);
+		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
+		{
+			rc = DB_SUCCESS;
+		}
+		else
+		{
+			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
+		}
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file declares the performance_sample table behind the performance metrics
+ * store, see performance_store.h.
+ */
+
+#ifndef	_PERFORMANCE_SAMPLE_H_
+#define	_PERFORMANCE_SAMPLE_H_
+
+#include "schema.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define	PERFORMANCE_DIMM_UID_LEN 37 //!< Max length for dimm_uid
+/*!
+ * One ring buffer slot of performance counter deltas for a DIMM.
+ * Each granularity is a separate ring. The counters are the sum of the deltas
+ * observed over seconds, starting at start_time. sample_count is only used by the
+ * baseline slot, for the number of samples stored so far.
+ */
+struct db_performance_sample
+{
+	char   dimm_uid[PERFORMANCE_DIMM_UID_LEN];
+	int granularity;
+	int slot;
+	unsigned long long start_time;
+	unsigned long long seconds;
+	unsigned long long bytes_read;
+	unsigned long long bytes_written;
+	unsigned long long read_reqs;
+	unsigned long long host_write_cmds;
+	unsigned long long block_reads;
+	unsigned long long block_writes;
+	unsigned long long sample_count;
+};
+/*!
+ * Create the performance_sample table if the store predates it, and replace the
+ * performance table of older stores with a baseline slot per DIMM
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @return return_code whether or not it was successful
+ */
+NVM_COMMON_API enum db_return_codes db_create_performance_sample_table(const PersistentStore *p_ps);
+/*!
+ * Create or overwrite a performance_sample slot
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] p_sample
+ *		The slot to save, identified by dimm_uid, granularity and slot
+ * @return return_code whether or not it was successful
+ */
+NVM_COMMON_API enum db_return_codes db_save_performance_sample(const PersistentStore *p_ps,
+	const struct db_performance_sample *p_sample);
+/*!
+ * Retrieve a performance_sample slot
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] dimm_uid
+ * @param[in] granularity
+ * @param[in] slot
+ * @param[out] p_sample
+ *		Structure to hold the slot
+ * @return DB_SUCCESS if found, DB_ERR_FAILURE otherwise
+ */
+NVM_COMMON_API enum db_return_codes db_get_performance_sample(const PersistentStore *p_ps,
+	const char *dimm_uid,
+	const int granularity,
+	const int slot,
+	struct db_performance_sample *p_sample);
+/*!
+ * Retrieve the performance_sample slots of a granularity starting in a time range,
+ * oldest first
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] dimm_uid
+ * @param[in] granularity
+ * @param[in] start_time
+ *		Earliest start_time to return
+ * @param[in] end_time
+ *		Return slots starting before this time
+ * @param[out] p_samples
+ *		Pointer to memory to hold row results
+ * @param[in] sample_count
+ *		Maximum number of rows to return
+ * @return The number of rows (to max of sample_count) on success.  DB_FAILURE on failure.
+ */
+NVM_COMMON_API int db_get_performance_samples_in_range(const PersistentStore *p_ps,
+	const char *dimm_uid,
+	const int granularity,
+	const unsigned long long start_time,
+	const unsigned long long end_time,
+	struct db_performance_sample *p_samples,
+	int sample_count);
+/*!
+ * Delete the performance_sample slots at or after a slot, used when a ring shrinks
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] dimm_uid
+ * @param[in] granularity
+ * @param[in] first_slot
+ * @return return_code whether or not it was successful
+ */
+NVM_COMMON_API enum db_return_codes db_delete_performance_samples_from_slot(const PersistentStore *p_ps,
+	const char *dimm_uid,
+	const int granularity,
+	const int first_slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PERFORMANCE_SAMPLE_H_ */
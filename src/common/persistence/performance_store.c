@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file contains the implementation of the performance metrics store.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "performance_store.h"
+#include "performance_sample.h"
+#include "lib_persistence.h"
+#include "config_settings.h"
+#include "logging.h"
+#include <string/s_str.h>
+
+static const enum performance_granularity ROLLUPS[] =
+{
+	PERFORMANCE_GRANULARITY_MINUTE,
+	PERFORMANCE_GRANULARITY_HOUR,
+	PERFORMANCE_GRANULARITY_DAY
+};
+
+static const int ROLLUP_SLOTS[] =
+{
+	PERFORMANCE_MINUTE_SLOTS,
+	PERFORMANCE_HOUR_SLOTS,
+	PERFORMANCE_DAY_SLOTS
+};
+
+static int g_sample_table_checked = 0;
+
+/*
+ * Difference between two readings of a cumulative counter. A lower reading
+ * means the counter restarted, so everything counted since is the difference.
+ */
+static unsigned long long counter_delta(const unsigned long long current,
+		const unsigned long long previous)
+{
+	return current >= previous ? current - previous : current;
+}
+
+/*
+ * The share of a delta observed over total seconds that falls in the first part
+ * seconds, split so the product can't overflow
+ */
+static unsigned long long prorate(const unsigned long long value,
+		const unsigned long long part, const unsigned long long total)
+{
+	return total ? (value / total) * part + ((value % total) * part) / total : value;
+}
+
+/*
+ * The share of a delta that falls between seconds from and to of the total. The
+ * shares of adjacent ranges always add up to the whole delta.
+ */
+static unsigned long long share(const unsigned long long value,
+		const unsigned long long from, const unsigned long long to,
+		const unsigned long long total)
+{
+	return prorate(value, to, total) - prorate(value, from, total);
+}
+
+/*
+ * Add the deltas of one sample into the rollup slots of the intervals it covers,
+ * split in proportion to the seconds it spent in each. A slot that still holds an
+ * older interval is started over.
+ */
+static int add_to_rollup(const PersistentStore *p_ps,
+		const struct db_performance_sample *p_delta,
+		const enum performance_granularity granularity, const int slots)
+{
+	int rc = NVM_SUCCESS;
+	unsigned long long start = p_delta->start_time;
+	unsigned long long end = p_delta->start_time + p_delta->seconds;
+	unsigned long long first_bucket = start / granularity;
+	unsigned long long last_bucket = (end - 1) / granularity;
+	// older intervals would be overwritten by the newer ones anyway
+	if (last_bucket - first_bucket >= (unsigned long long)slots)
+	{
+		first_bucket = last_bucket - slots + 1;
+	}
+
+	for (unsigned long long bucket = first_bucket;
+			rc == NVM_SUCCESS && bucket <= last_bucket; bucket++)
+	{
+		unsigned long long bucket_start = bucket * granularity;
+		unsigned long long from = (bucket_start > start ? bucket_start : start) - start;
+		unsigned long long to = (bucket_start + granularity < end ?
+				bucket_start + granularity : end) - start;
+
+		struct db_performance_sample rollup;
+		int slot = (int)(bucket % slots);
+		if (db_get_performance_sample(p_ps, p_delta->dimm_uid, granularity, slot, &rollup)
+				!= DB_SUCCESS || rollup.start_time != bucket_start)
+		{
+			memset(&rollup, 0, sizeof (rollup));
+			s_strcpy(rollup.dimm_uid, p_delta->dimm_uid, PERFORMANCE_DIMM_UID_LEN);
+			rollup.granularity = granularity;
+			rollup.slot = slot;
+			rollup.start_time = bucket_start;
+		}
+		rollup.seconds += to - from;
+		const unsigned long long seconds = p_delta->seconds;
+		rollup.bytes_read += share(p_delta->bytes_read, from, to, seconds);
+		rollup.bytes_written += share(p_delta->bytes_written, from, to, seconds);
+		rollup.read_reqs += share(p_delta->read_reqs, from, to, seconds);
+		rollup.host_write_cmds += share(p_delta->host_write_cmds, from, to, seconds);
+		rollup.block_reads += share(p_delta->block_reads, from, to, seconds);
+		rollup.block_writes += share(p_delta->block_writes, from, to, seconds);
+		if (db_save_performance_sample(p_ps, &rollup) != DB_SUCCESS)
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+	}
+	return rc;
+}
+
+/*
+ * Store a snapshot of a DIMM's cumulative counters
+ */
+int store_device_performance(const PersistentStore *p_ps,
+		const char *dimm_uid, const int dimm_count,
+		const struct device_performance *p_performance)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (!p_ps || !dimm_uid || !p_performance)
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		if (!g_sample_table_checked)
+		{
+			g_sample_table_checked =
+					(db_create_performance_sample_table(p_ps) == DB_SUCCESS);
+		}
+
+		struct db_performance_sample last;
+		int have_last = (db_get_performance_sample(p_ps, dimm_uid,
+				PERFORMANCE_GRANULARITY_LAST, 0, &last) == DB_SUCCESS);
+		unsigned long long sample_number = have_last ? last.sample_count : 0;
+
+		// need an earlier reading to compute a delta
+		if (have_last && (unsigned long long)p_performance->time > last.start_time)
+		{
+			// the limit is on the samples of all DIMMs together
+			int sample_slots = PERFORMANCE_LOG_MAX_BOUND;
+			get_bounded_config_value_int(SQL_KEY_PERFORMANCE_LOG_MAX, &sample_slots);
+			if (dimm_count > 1)
+			{
+				sample_slots /= dimm_count;
+			}
+			if (sample_slots <= 0)
+			{
+				sample_slots = 1;
+			}
+
+			struct db_performance_sample delta;
+			memset(&delta, 0, sizeof (delta));
+			s_strcpy(delta.dimm_uid, dimm_uid, PERFORMANCE_DIMM_UID_LEN);
+			delta.granularity = PERFORMANCE_GRANULARITY_SAMPLE;
+			delta.slot = (int)(sample_number % sample_slots);
+			delta.start_time = last.start_time;
+			delta.seconds = p_performance->time - last.start_time;
+			delta.bytes_read = counter_delta(p_performance->bytes_read, last.bytes_read);
+			delta.bytes_written = counter_delta(p_performance->bytes_written, last.bytes_written);
+			delta.read_reqs = counter_delta(p_performance->host_reads, last.read_reqs);
+			delta.host_write_cmds = counter_delta(p_performance->host_writes, last.host_write_cmds);
+			delta.block_reads = counter_delta(p_performance->block_reads, last.block_reads);
+			delta.block_writes = counter_delta(p_performance->block_writes, last.block_writes);
+
+			// overwrite the oldest sample in place
+			if (db_save_performance_sample(p_ps, &delta) != DB_SUCCESS)
+			{
+				rc = NVM_ERR_UNKNOWN;
+			}
+			// drop slots left over from a longer ring
+			else if (delta.slot == 0 && db_delete_performance_samples_from_slot(p_ps,
+					dimm_uid, PERFORMANCE_GRANULARITY_SAMPLE, sample_slots) != DB_SUCCESS)
+			{
+				rc = NVM_ERR_UNKNOWN;
+			}
+
+			for (size_t i = 0; rc == NVM_SUCCESS && i < sizeof (ROLLUPS) / sizeof (ROLLUPS[0]); i++)
+			{
+				rc = add_to_rollup(p_ps, &delta, ROLLUPS[i], ROLLUP_SLOTS[i]);
+			}
+			sample_number++;
+		}
+
+		if (rc == NVM_SUCCESS)
+		{
+			// the new baseline
+			memset(&last, 0, sizeof (last));
+			s_strcpy(last.dimm_uid, dimm_uid, PERFORMANCE_DIMM_UID_LEN);
+			last.granularity = PERFORMANCE_GRANULARITY_LAST;
+			last.slot = 0;
+			last.start_time = p_performance->time;
+			last.sample_count = sample_number;
+			last.bytes_read = p_performance->bytes_read;
+			last.bytes_written = p_performance->bytes_written;
+			last.read_reqs = p_performance->host_reads;
+			last.host_write_cmds = p_performance->host_writes;
+			last.block_reads = p_performance->block_reads;
+			last.block_writes = p_performance->block_writes;
+			if (db_save_performance_sample(p_ps, &last) != DB_SUCCESS)
+			{
+				rc = NVM_ERR_UNKNOWN;
+			}
+		}
+
+		if (rc != NVM_SUCCESS)
+		{
+			COMMON_LOG_ERROR_F("Failed to store performance metrics for " NVM_DIMM_NAME " %s",
+					dimm_uid);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Get the average rates of the slots in a time range
+ */
+int get_device_performance_rates(const PersistentStore *p_ps,
+		const char *dimm_uid, const enum performance_granularity granularity,
+		const time_t start_time, const time_t end_time,
+		struct performance_rate *p_rates, const int count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = 0;
+
+	if (!p_ps || !dimm_uid || !p_rates || count <= 0 || start_time < 0)
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		struct db_performance_sample *p_samples = (struct db_performance_sample *)
+				malloc(count * sizeof (struct db_performance_sample));
+		if (!p_samples)
+		{
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
+		{
+			rc = db_get_performance_samples_in_range(p_ps, dimm_uid, granularity,
+					start_time, end_time, p_samples, count);
+			if (rc < 0)
+			{
+				COMMON_LOG_ERROR("Unable to retrieve the performance samples from the database");
+				rc = NVM_ERR_UNKNOWN;
+			}
+			for (int i = 0; i < rc; i++)
+			{
+				double seconds = p_samples[i].seconds ? (double)p_samples[i].seconds : 1.0;
+				memset(&p_rates[i], 0, sizeof (struct performance_rate));
+				p_rates[i].start_time = (time_t)p_samples[i].start_time;
+				p_rates[i].seconds = p_samples[i].seconds;
+				p_rates[i].bytes_read_per_sec = p_samples[i].bytes_read / seconds;
+				p_rates[i].bytes_written_per_sec = p_samples[i].bytes_written / seconds;
+				p_rates[i].host_reads_per_sec = p_samples[i].read_reqs / seconds;
+				p_rates[i].host_writes_per_sec = p_samples[i].host_write_cmds / seconds;
+				p_rates[i].block_reads_per_sec = p_samples[i].block_reads / seconds;
+				p_rates[i].block_writes_per_sec = p_samples[i].block_writes / seconds;
+			}
+			free(p_samples);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
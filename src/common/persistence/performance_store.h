@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file declares the performance metrics store. Each NVM-DIMM has fixed size
+ * ring buffers of counter deltas, one per sample and one each per minute, hour and
+ * day, so the cost of storing a sample doesn't depend on the history kept.
+ */
+
+#ifndef	_PERFORMANCE_STORE_H_
+#define	_PERFORMANCE_STORE_H_
+
+#include <common_types.h>
+#include <nvm_management.h>
+#include "schema.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Granularity of the ring holding a DIMM's last cumulative counters. Its one slot
+ * uses start_time for the time they were read and sample_count for the number of
+ * samples stored so far.
+ */
+#define	PERFORMANCE_GRANULARITY_LAST	-1
+
+#define	PERFORMANCE_MINUTE_SLOTS	1440 //!< One day of minute rollups
+#define	PERFORMANCE_HOUR_SLOTS	720 //!< 30 days of hour rollups
+#define	PERFORMANCE_DAY_SLOTS	730 //!< Two years of day rollups
+
+/*
+ * Store a snapshot of a DIMM's cumulative counters. The first snapshot only sets
+ * the baseline the next one is compared against. PERFORMANCE_LOG_MAX samples are
+ * kept in total, split evenly between the dimm_count DIMMs.
+ * The caller should wrap a batch of calls in a transaction.
+ */
+NVM_COMMON_API int store_device_performance(const PersistentStore *p_ps,
+		const char *dimm_uid, const int dimm_count,
+		const struct device_performance *p_performance);
+
+/*
+ * Get the rates of the slots of a granularity that start in [start_time, end_time),
+ * oldest first.
+ * Returns the number of rates or an NVM error code.
+ */
+NVM_COMMON_API int get_device_performance_rates(const PersistentStore *p_ps,
+		const char *dimm_uid, const enum performance_granularity granularity,
+		const time_t start_time, const time_t end_time,
+		struct performance_rate *p_rates, const int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PERFORMANCE_STORE_H_ */
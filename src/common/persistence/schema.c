@@ -37,6 +37,8 @@
 #include <time.h>
 #include "logging.h"
 #include <sqlite3.h>
+#include "history_dedup.h"
+#include "performance_sample.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -124,10 +126,147 @@ char *db_strcpy(char *dst, const char *src, size_t dst_size)
 /*
  *	SQL API
  */
+/*!
+ * Number of slots in a PersistentStore's prepared statement cache, must be a power of 2
+ */
+#define	STMT_CACHE_SIZE	1024
+/*!
+ * A prepared statement kept for reuse. The SQL literal identifies the statement.
+ */
+struct cached_stmt
+{
+	const char *sql;
+	sqlite3_stmt *p_stmt;
+	int in_use;
+};
 struct persistentStore
 {
 	sqlite3 *db;
+	struct cached_stmt *p_stmt_cache;
 };
+/*!
+ * Prepare a statement whose SQL is a string literal, reusing the one cached by an earlier
+ * call when it is not already in use. Must be paired with @ref SQLITE_RELEASE.
+ */
+#define	SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt) \
+		prepare_cached_stmt((p_ps), (sql), &(p_stmt))
+/*!
+ * Reset and unbind a statement from @ref SQLITE_PREPARE_CACHED so it can be reused
+ */
+#define	SQLITE_RELEASE(p_ps, sql, p_stmt) \
+		release_cached_stmt((p_ps), (sql), (p_stmt))
+/*
+ * Find the cache slot for the SQL, or the empty slot it would go in.
+ * NOTE: caller must hold the connection mutex
+ */
+struct cached_stmt *find_cached_stmt(const PersistentStore *p_ps, const char *sql)
+{
+	struct cached_stmt *p_entry = NULL;
+	size_t slot = ((size_t)sql >> 3) & (STMT_CACHE_SIZE - 1);
+	for (int probe = 0; probe < STMT_CACHE_SIZE && !p_entry; probe++)
+	{
+		struct cached_stmt *p_slot =
+			&p_ps->p_stmt_cache[(slot + probe) & (STMT_CACHE_SIZE - 1)];
+		if (p_slot->sql == sql || p_slot->sql == NULL)
+		{
+			p_entry = p_slot;
+		}
+	}
+	return p_entry;
+}
+/*
+ * Check out the cached statement for the SQL, preparing it on first use
+ */
+int prepare_cached_stmt(const PersistentStore *p_ps, const char *sql, sqlite3_stmt **pp_stmt)
+{
+	int sql_rc = SQLITE_OK;
+	struct cached_stmt *p_entry = NULL;
+	if (p_ps->p_stmt_cache)
+	{
+		sqlite3_mutex *p_mutex = sqlite3_db_mutex(p_ps->db);
+		sqlite3_mutex_enter(p_mutex);
+		p_entry = find_cached_stmt(p_ps, sql);
+		if (p_entry && !p_entry->in_use)
+		{
+			p_entry->sql = sql;
+			p_entry->in_use = 1;
+		}
+		else
+		{
+			// the statement is busy (nested or another thread), use a private one
+			p_entry = NULL;
+		}
+		sqlite3_mutex_leave(p_mutex);
+	}
+
+	if (p_entry && p_entry->p_stmt)
+	{
+		*pp_stmt = p_entry->p_stmt;
+	}
+	else
+	{
+		sql_rc = SQLITE_PREPARE(p_ps->db, sql, *pp_stmt);
+		if (p_entry)
+		{
+			p_entry->p_stmt = (sql_rc == SQLITE_OK) ? *pp_stmt : NULL;
+			if (sql_rc != SQLITE_OK)
+			{
+				p_entry->in_use = 0;
+			}
+		}
+	}
+	return sql_rc;
+}
+/*
+ * Return a statement to the cache, or finalize it if it isn't the cached one
+ */
+void release_cached_stmt(const PersistentStore *p_ps, const char *sql, sqlite3_stmt *p_stmt)
+{
+	int cached = 0;
+	if (p_ps->p_stmt_cache)
+	{
+		sqlite3_mutex *p_mutex = sqlite3_db_mutex(p_ps->db);
+		sqlite3_mutex_enter(p_mutex);
+		struct cached_stmt *p_entry = find_cached_stmt(p_ps, sql);
+		if (p_entry && p_entry->in_use && p_entry->p_stmt == p_stmt)
+		{
+			sqlite3_reset(p_stmt);
+			sqlite3_clear_bindings(p_stmt);
+			p_entry->in_use = 0;
+			cached = 1;
+		}
+		sqlite3_mutex_leave(p_mutex);
+	}
+	if (!cached)
+	{
+		sqlite3_finalize(p_stmt);
+	}
+}
+/*
+ * The connection behind a PersistentStore, for the hand-written tables in schema_sql.h
+ */
+sqlite3 *get_PersistentStore_db(const PersistentStore *p_ps)
+{
+	return p_ps->db;
+}
+/*
+ * Finalize every cached statement, required before the connection can be closed
+ */
+void free_stmt_cache(PersistentStore *p_ps)
+{
+	if (p_ps->p_stmt_cache)
+	{
+		for (int i = 0; i < STMT_CACHE_SIZE; i++)
+		{
+			if (p_ps->p_stmt_cache[i].p_stmt)
+			{
+				sqlite3_finalize(p_ps->p_stmt_cache[i].p_stmt);
+			}
+		}
+		free(p_ps->p_stmt_cache);
+		p_ps->p_stmt_cache = NULL;
+	}
+}
 /*!
  * Returns the number of rows in the table name provided.  If there is an issue with the
  * query (or the table doesn't exist) will return 0.
@@ -293,6 +432,8 @@ PersistentStore *open_PersistentStore(const char *path)
 	PersistentStore *result = (PersistentStore *)malloc(sizeof (PersistentStore));
 	if (result != NULL)
 	{
+		result->p_stmt_cache = (struct cached_stmt *)calloc(STMT_CACHE_SIZE,
+			sizeof (struct cached_stmt));
 		int sql_rc;
 		if ((sql_rc = sqlite3_open_v2(path, &(result->db),
 			SQLITE_OPEN_READWRITE|SQLITE_OPEN_CREATE|SQLITE_OPEN_FULLMUTEX, NULL)) != SQLITE_OK)
@@ -305,16 +446,172 @@ PersistentStore *open_PersistentStore(const char *path)
 		{
 			// set a busy timeout to avoid file locking issues
 			sqlite3_busy_timeout(result->db, 30000);
+			register_content_hash(result->db);
+		}
+	}
+	return result;
+}
+/*
+ * Open an existing PersistentStore for reading only
+ */
+PersistentStore *open_readonly_PersistentStore(const char *path)
+{
+	PersistentStore *result = (PersistentStore *)malloc(sizeof (PersistentStore));
+	if (result != NULL)
+	{
+		result->p_stmt_cache = (struct cached_stmt *)calloc(STMT_CACHE_SIZE,
+			sizeof (struct cached_stmt));
+		int sql_rc;
+		if ((sql_rc = sqlite3_open_v2(path, &(result->db),
+			SQLITE_OPEN_READONLY|SQLITE_OPEN_FULLMUTEX, NULL)) != SQLITE_OK)
+		{
+			free_PersistentStore(&result);
+			COMMON_LOG_ERROR_F("Failed to open PersistentStore with path '%s' for reading, error code %d",
+					path, sql_rc);
+		}
+		else
+		{
+			// set a busy timeout to avoid file locking issues
+			sqlite3_busy_timeout(result->db, 30000);
+			register_content_hash(result->db);
 		}
 	}
 	return result;
 }
+/*
+ * Set the journal mode and cache size of an open PersistentStore
+ */
+enum db_return_codes configure_PersistentStore(PersistentStore *p_ps, int wal, int cache_size_kb)
+{
+	enum db_return_codes rc = DB_SUCCESS;
+	char current_mode[16] = {0};
+	sqlite3_stmt *p_stmt;
+	if (SQLITE_PREPARE(p_ps->db, "PRAGMA journal_mode", p_stmt) == SQLITE_OK)
+	{
+		if (sqlite3_step(p_stmt) == SQLITE_ROW)
+		{
+			snprintf(current_mode, sizeof (current_mode), "%s",
+					(const char *)sqlite3_column_text(p_stmt, 0));
+		}
+		sqlite3_finalize(p_stmt);
+	}
+
+	// the journal mode is stored in the file, only change it when it differs
+	int is_wal = (strcmp(current_mode, "wal") == 0);
+	if (wal && !is_wal)
+	{
+		rc = run_sql_no_results(p_ps->db, "PRAGMA journal_mode=WAL");
+	}
+	else if (!wal && is_wal)
+	{
+		rc = run_sql_no_results(p_ps->db, "PRAGMA journal_mode=DELETE");
+	}
+
+	if (rc == DB_SUCCESS && wal)
+	{
+		// in WAL mode only a checkpoint syncs. The database can't be corrupted, but a
+		// power loss may roll back the most recent commits. A process crash loses nothing.
+		rc = run_sql_no_results(p_ps->db, "PRAGMA synchronous=NORMAL");
+	}
+
+	if (rc == DB_SUCCESS && cache_size_kb > 0)
+	{
+		char sql[64];
+		// a negative cache size is in KiB rather than pages
+		snprintf(sql, sizeof (sql), "PRAGMA cache_size=-%d", cache_size_kb);
+		rc = run_sql_no_results(p_ps->db, sql);
+	}
+	return rc;
+}
+/*
+ * Copy committed WAL content back into the database file
+ */
+enum db_return_codes checkpoint_PersistentStore(PersistentStore *p_ps, int truncate)
+{
+	enum db_return_codes rc = DB_SUCCESS;
+	int log_frames = 0;
+	int checkpointed_frames = 0;
+	int sql_rc = sqlite3_wal_checkpoint_v2(p_ps->db, NULL,
+			truncate ? SQLITE_CHECKPOINT_TRUNCATE : SQLITE_CHECKPOINT_PASSIVE,
+			&log_frames, &checkpointed_frames);
+	if (sql_rc == SQLITE_BUSY)
+	{
+		// readers or writers are active, the rest will be copied next time
+		COMMON_LOG_DEBUG_F("Checkpoint copied %d of %d WAL frames",
+				checkpointed_frames, log_frames);
+	}
+	else if (sql_rc != SQLITE_OK)
+	{
+		COMMON_LOG_ERROR_F("Checkpoint failed, error code %d", sql_rc);
+		rc = DB_ERR_FAILURE;
+	}
+	return rc;
+}
+/*
+ * A backup waits up to the store's 30 second busy timeout for writers to finish
+ */
+#define	BACKUP_RETRY_MS	100
+#define	BACKUP_MAX_RETRIES	(30000 / BACKUP_RETRY_MS)
+/*
+ * Copy a consistent image of the database, including WAL content, to a new file
+ */
+enum db_return_codes backup_PersistentStore(PersistentStore *p_ps, const char *path)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	sqlite3 *p_dest = NULL;
+	int sql_rc = sqlite3_open_v2(path, &p_dest,
+			SQLITE_OPEN_READWRITE|SQLITE_OPEN_CREATE|SQLITE_OPEN_FULLMUTEX, NULL);
+	if (sql_rc == SQLITE_OK)
+	{
+		sqlite3_backup *p_backup = sqlite3_backup_init(p_dest, "main", p_ps->db, "main");
+		if (p_backup)
+		{
+			// copy everything in one step, retrying for a while if a writer holds the source
+			int retries = 0;
+			while ((sql_rc = sqlite3_backup_step(p_backup, -1)) == SQLITE_OK ||
+					((sql_rc == SQLITE_BUSY || sql_rc == SQLITE_LOCKED) &&
+					retries++ < BACKUP_MAX_RETRIES))
+			{
+				if (sql_rc != SQLITE_OK)
+				{
+					sqlite3_sleep(BACKUP_RETRY_MS);
+				}
+			}
+
+			// finish only reports errors, a busy source still leaves the copy incomplete
+			int finish_rc = sqlite3_backup_finish(p_backup);
+			if (sql_rc == SQLITE_DONE && finish_rc == SQLITE_OK)
+			{
+				rc = DB_SUCCESS;
+			}
+			else if (sql_rc == SQLITE_DONE)
+			{
+				sql_rc = finish_rc;
+			}
+		}
+		else
+		{
+			sql_rc = sqlite3_errcode(p_dest);
+		}
+	}
+	if (rc != DB_SUCCESS)
+	{
+		COMMON_LOG_ERROR_F("Failed to back up PersistentStore to '%s', error code %d",
+				path, sql_rc);
+	}
+	sqlite3_close(p_dest);
+	return rc;
+}
 /*
  * Close the DB and release the memory for a PersistentStore object
  */
 int free_PersistentStore(PersistentStore **pp_persistentStore)
 {
 	int rc = DB_SUCCESS;
+	if (*pp_persistentStore != NULL)
+	{
+		free_stmt_cache(*pp_persistentStore);
+	}
 	if (*pp_persistentStore != NULL && (*pp_persistentStore)->db != NULL)
 	{
 		int sql_rc;
@@ -349,12 +646,12 @@ enum db_return_codes db_add_history(PersistentStore *p_ps,
 			( history_id,  timestamp,  history_name) VALUES \
 			($history_id, datetime('now'), $history_name);";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", *p_history_id);
 			BIND_TEXT(p_stmt, "$history_name", history_name);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc == SQLITE_DONE)
 			{
 				rc = DB_SUCCESS;
@@ -381,6 +678,10 @@ enum db_return_codes  db_end_transaction(PersistentStore *p_ps)
 {
 	return run_sql_no_results(p_ps->db, "END TRANSACTION");
 }
+int db_in_transaction(PersistentStore *p_ps)
+{
+	return !sqlite3_get_autocommit(p_ps->db);
+}
 enum db_return_codes  db_rollback_transaction(PersistentStore *p_ps)
 {
 	return run_sql_no_results(p_ps->db, "ROLLBACK TRANSACTION");
@@ -408,7 +709,7 @@ int db_get_history_ids(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < count)
@@ -418,7 +719,7 @@ int db_get_history_ids(const PersistentStore *p_ps,
 					p_history_ids[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -434,7 +735,7 @@ int db_get_history_ids(const PersistentStore *p_ps,
 	return rc;
 }
 // Table count is calculated in CrudSchemaGenerator
-#define	TABLE_COUNT (121)
+#define	TABLE_COUNT (120)
 /*
  * Create a PersistentStore object
  */
@@ -443,6 +744,8 @@ PersistentStore *create_PersistentStore(const char *path, int force)
 	PersistentStore *result = (PersistentStore *)malloc(sizeof (PersistentStore));
 	if (result != NULL)
 	{
+		result->p_stmt_cache = (struct cached_stmt *)calloc(STMT_CACHE_SIZE,
+			sizeof (struct cached_stmt));
 		// check if the file exists - delete it if force
 		FILE *file;
 		if (force && (file = fopen(path, "r")))
@@ -1947,36 +2250,6 @@ tables[populate_index++] = ((struct table){"software_trigger_info",
 					 spare_block_percentage_trigger INTEGER , \
 					 unsafe_shutdown_trigger INTEGER  \
 					);"});
-tables[populate_index++] = ((struct table){"performance",
-				"CREATE TABLE performance (       \
-					 id INTEGER  PRIMARY KEY  AUTOINCREMENT  NOT NULL UNIQUE  , \
-					 dimm_uid TEXT  , \
-					 time INTEGER  , \
-					 bytes_read INTEGER  , \
-					 bytes_written INTEGER  , \
-					 read_reqs INTEGER  , \
-					 host_write_cmds INTEGER  , \
-					 block_reads INTEGER  , \
-					 block_writes INTEGER   \
-					);"}
-#if 0
-//NON-HISTORY TABLE
-);
-			tables[populate_index++] = ((struct table){"performance_history",
-				"CREATE TABLE performance_history (       \
-					history_id INTEGER NOT NULL, \
-					 id INTEGER , \
-					 dimm_uid TEXT , \
-					 time INTEGER , \
-					 bytes_read INTEGER , \
-					 bytes_written INTEGER , \
-					 read_reqs INTEGER , \
-					 host_write_cmds INTEGER , \
-					 block_reads INTEGER , \
-					 block_writes INTEGER  \
-					);"}
-#endif
-);
 tables[populate_index++] = ((struct table){"driver_metadata_check_diag_result",
 				"CREATE TABLE driver_metadata_check_diag_result (       \
 					 id INTEGER  PRIMARY KEY  AUTOINCREMENT  NOT NULL UNIQUE  , \
@@ -2261,6 +2534,9 @@ tables[populate_index++] = ((struct table){"interleave_set",
 						run_sql_no_results(result->db, tables[i].create_statement);
 					}
 				}
+				register_content_hash(result->db);
+				deduplicate_history_tables(result->db);
+				db_create_performance_sample_table(result);
 			}
 			else
 			{
@@ -2427,13 +2703,6 @@ NVM_COMMON_API char* history_table_names[] = {
 
 	"software_trigger_info_history",
 
-#if 0
-//NON-HISTORY TABLE
-
-	"performance_history",
-
-#endif
-
 #if 0
 //NON-HISTORY TABLE
 
@@ -2512,7 +2781,7 @@ enum db_return_codes db_add_config(const PersistentStore *p_ps,
 		($key, \
 		$value) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_config(p_stmt, p_config);
 		sql_rc = sqlite3_step(p_stmt);
@@ -2520,7 +2789,7 @@ enum db_return_codes db_add_config(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -2553,7 +2822,7 @@ int db_get_configs(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < config_count)
@@ -2562,7 +2831,7 @@ int db_get_configs(const PersistentStore *p_ps,
 			local_get_config_relationships(p_ps, p_stmt, &p_config[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -2608,11 +2877,11 @@ enum db_return_codes db_save_config_state(const PersistentStore *p_ps,
 			($key, \
 			$value) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_config(p_stmt, p_config);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -2638,7 +2907,7 @@ enum db_return_codes db_save_config_state(const PersistentStore *p_ps,
 				 $key , \
 				 $value )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_config(p_stmt, p_config);
@@ -2647,7 +2916,7 @@ enum db_return_codes db_save_config_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -2678,7 +2947,7 @@ enum db_return_codes db_get_config_by_key(const PersistentStore *p_ps,
 		FROM config \
 		WHERE  key = $key";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$key", (char *)key);
 		sql_rc = sqlite3_step(p_stmt);
@@ -2688,7 +2957,7 @@ enum db_return_codes db_get_config_by_key(const PersistentStore *p_ps,
 			local_get_config_relationships(p_ps, p_stmt, p_config);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -2716,12 +2985,12 @@ enum db_return_codes db_update_config_by_key(const PersistentStore *p_ps,
 		  \
 	WHERE key=$key ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$key", (char *)key);
 		local_bind_config(p_stmt, p_config);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -2743,14 +3012,14 @@ enum db_return_codes db_delete_config_by_key(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM config \
 				 WHERE key = $key";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$key", (char *)key);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -2843,7 +3112,7 @@ int db_get_config_history_by_history_id(const PersistentStore *p_ps,
 		key,  value  \
 		FROM config_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -2854,7 +3123,7 @@ int db_get_config_history_by_history_id(const PersistentStore *p_ps,
 			local_get_config_relationships_history(p_ps, p_stmt, &p_config[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -2960,7 +3229,7 @@ enum db_return_codes db_add_log(const PersistentStore *p_ps,
 		$line_number, \
 		$message) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_log(p_stmt, p_log);
 		sql_rc = sqlite3_step(p_stmt);
@@ -2968,7 +3237,7 @@ enum db_return_codes db_add_log(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -2981,6 +3250,49 @@ enum db_return_codes db_add_log(const PersistentStore *p_ps,
 	}
 	return rc;
 }
+/*
+ * Add a batch of logs reusing a single prepared statement
+ */
+enum db_return_codes db_add_logs(const PersistentStore *p_ps,
+	struct db_log *p_logs, const int log_count)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	sqlite3_stmt *p_stmt;
+	char *sql = 	"INSERT INTO log \
+		(thread_id, time, level, file_name, line_number, message)  \
+		VALUES 		\
+		(\
+		$thread_id, \
+		$time, \
+		$level, \
+		$file_name, \
+		$line_number, \
+		$message) ";
+	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
+	{
+		rc = DB_SUCCESS;
+		for (int i = 0; i < log_count; i++)
+		{
+			local_bind_log(p_stmt, &p_logs[i]);
+			sql_rc = sqlite3_step(p_stmt);
+			sqlite3_reset(p_stmt);
+			if (sql_rc != SQLITE_DONE)
+			{
+				rc = DB_ERR_FAILURE;
+				COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
+						sql_rc);
+				break;
+			}
+		}
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
 enum db_return_codes db_get_log_count(const PersistentStore *p_ps, int *p_count)
 {
 	return table_row_count(p_ps, "log", p_count);
@@ -3006,7 +3318,7 @@ int db_get_logs(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < log_count)
@@ -3015,7 +3327,7 @@ int db_get_logs(const PersistentStore *p_ps,
 			local_get_log_relationships(p_ps, p_stmt, &p_log[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -3066,11 +3378,11 @@ enum db_return_codes db_save_log_state(const PersistentStore *p_ps,
 			$line_number, \
 			$message) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_log(p_stmt, p_log);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -3101,7 +3413,7 @@ enum db_return_codes db_save_log_state(const PersistentStore *p_ps,
 				 $line_number , \
 				 $message )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_log(p_stmt, p_log);
@@ -3110,7 +3422,7 @@ enum db_return_codes db_save_log_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -3141,7 +3453,7 @@ enum db_return_codes db_get_log_by_id(const PersistentStore *p_ps,
 		FROM log \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -3151,7 +3463,7 @@ enum db_return_codes db_get_log_by_id(const PersistentStore *p_ps,
 			local_get_log_relationships(p_ps, p_stmt, p_log);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3184,12 +3496,12 @@ enum db_return_codes db_update_log_by_id(const PersistentStore *p_ps,
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_log(p_stmt, p_log);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3211,14 +3523,14 @@ enum db_return_codes db_delete_log_by_id(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM log \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3311,7 +3623,7 @@ int db_get_log_history_by_history_id(const PersistentStore *p_ps,
 		id,  thread_id,  time,  level,  file_name,  line_number,  message  \
 		FROM log_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -3322,7 +3634,7 @@ int db_get_log_history_by_history_id(const PersistentStore *p_ps,
 			local_get_log_relationships_history(p_ps, p_stmt, &p_log[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -3454,7 +3766,7 @@ enum db_return_codes db_add_event(const PersistentStore *p_ps,
 		$arg3, \
 		$diag_result) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_event(p_stmt, p_event);
 		sql_rc = sqlite3_step(p_stmt);
@@ -3462,7 +3774,7 @@ enum db_return_codes db_add_event(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -3504,8 +3816,176 @@ int db_get_events(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
+	{
+		int index = 0;
+		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < event_count)
+		{
+			local_row_to_event(p_ps, p_stmt, &p_event[index]);
+			local_get_event_relationships(p_ps, p_stmt, &p_event[index]);
+			index++;
+		}
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
+		if (sql_rc != SQLITE_DONE)
+		{
+			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
+					sql_rc);
+		}
+		rc = index;
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
+enum db_return_codes db_delete_all_events(const PersistentStore *p_ps)
+{
+	return run_sql_no_results(p_ps->db, "DELETE FROM event");
+}
+/*
+ * Append the WHERE clause for an event filter. Parameters are numbered in the same
+ * order local_bind_event_filter binds them.
+ */
+void local_event_filter_where(const struct db_event_filter *p_filter,
+	char *sql, size_t sql_len)
+{
+	size_t len = strlen(sql);
+	snprintf(sql + len, sql_len - len, " WHERE 1 ");
+	if (p_filter)
+	{
+		unsigned int mask = p_filter->filter_mask;
+		const char *clauses[] = {
+			(mask & DB_EVENT_FILTER_TYPE) ? " AND type = ? " : "",
+			(mask & DB_EVENT_FILTER_MIN_TYPE) ? " AND type >= ? " : "",
+			(mask & DB_EVENT_FILTER_MIN_SEVERITY) ? " AND severity >= ? " : "",
+			(mask & DB_EVENT_FILTER_CODE) ? " AND code = ? " : "",
+			(mask & DB_EVENT_FILTER_UID) ? " AND uid = ? " : "",
+			(mask & DB_EVENT_FILTER_AFTER_TIME) ? " AND time > ? " : "",
+			(mask & DB_EVENT_FILTER_BEFORE_TIME) ? " AND time < ? " : "",
+			(mask & DB_EVENT_FILTER_ID) ? " AND id = ? " : "",
+			(mask & DB_EVENT_FILTER_ACTION_REQUIRED) ? " AND action_required = ? " : "",
+			(mask & DB_EVENT_FILTER_ID_RANGE) ? " AND id > ? AND id <= ? " : ""
+		};
+		for (size_t i = 0; i < sizeof (clauses) / sizeof (clauses[0]); i++)
+		{
+			len = strlen(sql);
+			snprintf(sql + len, sql_len - len, "%s", clauses[i]);
+		}
+	}
+}
+/*
+ * Bind the parameters of the WHERE clause from local_event_filter_where
+ * Returns the index of the next parameter
+ */
+int local_bind_event_filter(sqlite3_stmt *p_stmt, const struct db_event_filter *p_filter)
+{
+	int index = 1;
+	if (p_filter)
+	{
+		unsigned int mask = p_filter->filter_mask;
+		if (mask & DB_EVENT_FILTER_TYPE)
+		{
+			sqlite3_bind_int64(p_stmt, index++, (long long)p_filter->type);
+		}
+		if (mask & DB_EVENT_FILTER_MIN_TYPE)
+		{
+			sqlite3_bind_int64(p_stmt, index++, (long long)p_filter->type);
+		}
+		if (mask & DB_EVENT_FILTER_MIN_SEVERITY)
+		{
+			sqlite3_bind_int64(p_stmt, index++, (long long)p_filter->severity);
+		}
+		if (mask & DB_EVENT_FILTER_CODE)
+		{
+			sqlite3_bind_int64(p_stmt, index++, (long long)p_filter->code);
+		}
+		if (mask & DB_EVENT_FILTER_UID)
+		{
+			sqlite3_bind_text(p_stmt, index++, p_filter->uid, -1, SQLITE_STATIC);
+		}
+		if (mask & DB_EVENT_FILTER_AFTER_TIME)
+		{
+			sqlite3_bind_int64(p_stmt, index++, (long long)p_filter->after_time);
+		}
+		if (mask & DB_EVENT_FILTER_BEFORE_TIME)
+		{
+			sqlite3_bind_int64(p_stmt, index++, (long long)p_filter->before_time);
+		}
+		if (mask & DB_EVENT_FILTER_ID)
+		{
+			sqlite3_bind_int(p_stmt, index++, p_filter->id);
+		}
+		if (mask & DB_EVENT_FILTER_ACTION_REQUIRED)
+		{
+			sqlite3_bind_int64(p_stmt, index++, (long long)p_filter->action_required);
+		}
+		if (mask & DB_EVENT_FILTER_ID_RANGE)
+		{
+			sqlite3_bind_int(p_stmt, index++, p_filter->after_id);
+			sqlite3_bind_int(p_stmt, index++, p_filter->through_id);
+		}
+	}
+	return index;
+}
+enum db_return_codes db_get_event_count_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter,
+	int *p_count)
+{
+	enum db_return_codes rc = DB_ERR_FAILURE;
+	char sql[1024] = "SELECT COUNT(*) FROM event";
+	local_event_filter_where(p_filter, sql, sizeof (sql));
+	sqlite3_stmt *p_stmt;
+	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	{
+		local_bind_event_filter(p_stmt, p_filter);
+		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
+		{
+			*p_count = sqlite3_column_int(p_stmt, 0);
+			rc = DB_SUCCESS;
+		}
+		else
+		{
+			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
+		}
+		sqlite3_finalize(p_stmt);
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
+int db_get_events_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter,
+	struct db_event *p_event,
+	int event_count)
+{
+	int rc = DB_ERR_FAILURE;
+	memset(p_event, 0, sizeof (struct db_event) * event_count);
+	char sql[1024] = "SELECT \
+		id \
+		,  type \
+		,  severity \
+		,  code \
+		,  action_required \
+		,  uid \
+		,  time \
+		,  arg1 \
+		,  arg2 \
+		,  arg3 \
+		,  diag_result \
+		FROM event";
+	local_event_filter_where(p_filter, sql, sizeof (sql));
+	size_t len = strlen(sql);
+	snprintf(sql + len, sizeof (sql) - len, " ORDER BY id DESC LIMIT ? ");
+	sqlite3_stmt *p_stmt;
+	int sql_rc;
 	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
 	{
+		int limit_index = local_bind_event_filter(p_stmt, p_filter);
+		sqlite3_bind_int(p_stmt, limit_index, event_count);
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < event_count)
 		{
@@ -3527,9 +4007,57 @@ int db_get_events(const PersistentStore *p_ps,
 	}
 	return rc;
 }
-enum db_return_codes db_delete_all_events(const PersistentStore *p_ps)
+/*
+ * Run an UPDATE or DELETE on the events matching a filter
+ * Returns the number of rows changed or DB_ERR_FAILURE
+ */
+int local_change_events_by_filter(const PersistentStore *p_ps,
+	const char *statement, const struct db_event_filter *p_filter)
 {
-	return run_sql_no_results(p_ps->db, "DELETE FROM event");
+	int rc = DB_ERR_FAILURE;
+	char sql[1024];
+	snprintf(sql, sizeof (sql), "%s", statement);
+	local_event_filter_where(p_filter, sql, sizeof (sql));
+	sqlite3_stmt *p_stmt;
+	int sql_rc;
+	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	{
+		local_bind_event_filter(p_stmt, p_filter);
+		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
+		{
+			rc = sqlite3_changes(p_ps->db);
+		}
+		else
+		{
+			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
+		}
+		sqlite3_finalize(p_stmt);
+	}
+	else
+	{
+		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
+	}
+	return rc;
+}
+int db_delete_events_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter)
+{
+	return local_change_events_by_filter(p_ps, "DELETE FROM event", p_filter);
+}
+int db_acknowledge_events_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter)
+{
+	struct db_event_filter filter;
+	memset(&filter, 0, sizeof (filter));
+	if (p_filter)
+	{
+		filter = *p_filter;
+	}
+	// only touch the rows that still need acknowledging
+	filter.filter_mask |= DB_EVENT_FILTER_ACTION_REQUIRED;
+	filter.action_required = 1;
+	return local_change_events_by_filter(p_ps,
+			"UPDATE event SET action_required = 0", &filter);
 }
 
 #if 0
@@ -3568,11 +4096,11 @@ enum db_return_codes db_save_event_state(const PersistentStore *p_ps,
 			$arg3, \
 			$diag_result) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_event(p_stmt, p_event);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -3607,7 +4135,7 @@ enum db_return_codes db_save_event_state(const PersistentStore *p_ps,
 				 $arg3 , \
 				 $diag_result )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_event(p_stmt, p_event);
@@ -3616,7 +4144,7 @@ enum db_return_codes db_save_event_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -3647,7 +4175,7 @@ enum db_return_codes db_get_event_by_id(const PersistentStore *p_ps,
 		FROM event \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -3657,7 +4185,7 @@ enum db_return_codes db_get_event_by_id(const PersistentStore *p_ps,
 			local_get_event_relationships(p_ps, p_stmt, p_event);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3694,12 +4222,12 @@ enum db_return_codes db_update_event_by_id(const PersistentStore *p_ps,
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_event(p_stmt, p_event);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3721,14 +4249,14 @@ enum db_return_codes db_delete_event_by_id(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM event \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3821,7 +4349,7 @@ int db_get_event_history_by_history_id(const PersistentStore *p_ps,
 		id,  type,  severity,  code,  action_required,  uid,  time,  arg1,  arg2,  arg3,  diag_result  \
 		FROM event_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -3832,7 +4360,7 @@ int db_get_event_history_by_history_id(const PersistentStore *p_ps,
 			local_get_event_relationships_history(p_ps, p_stmt, &p_event[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -3863,7 +4391,7 @@ enum db_return_codes db_get_event_count_by_event_type_type(
 	const char *sql = "SELECT COUNT (*) FROM event WHERE type = $type";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$type", (unsigned int)type);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -3871,7 +4399,7 @@ enum db_return_codes db_get_event_count_by_event_type_type(
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3898,7 +4426,7 @@ enum db_return_codes db_get_event_count_by_event_type_type_history(
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$type", (unsigned int)type);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -3907,7 +4435,7 @@ enum db_return_codes db_get_event_count_by_event_type_type_history(
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -3934,7 +4462,7 @@ enum db_return_codes db_get_events_by_event_type_type(const PersistentStore *p_p
 		FROM event \
 		WHERE  type = $type";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$type", (unsigned int)type);
@@ -3945,7 +4473,7 @@ enum db_return_codes db_get_events_by_event_type_type(const PersistentStore *p_p
 			local_get_event_relationships(p_ps, p_stmt, &p_event[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -3970,7 +4498,7 @@ enum db_return_codes db_get_events_by_event_type_type_history(const PersistentSt
 		FROM event_history \
 		WHERE  type = $type AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$type", (unsigned int)type);
@@ -3982,7 +4510,7 @@ enum db_return_codes db_get_events_by_event_type_type_history(const PersistentSt
 			local_get_event_relationships(p_ps, p_stmt, &p_event[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -4003,14 +4531,14 @@ enum db_return_codes db_delete_event_by_event_type_type(const PersistentStore *p
 	char *sql = "DELETE FROM event \
 				 WHERE type = $type";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$type", (unsigned int)type);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -4108,7 +4636,7 @@ enum db_return_codes db_add_topology_state(const PersistentStore *p_ps,
 		$current_config_status, \
 		$config_goal_status) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_topology_state(p_stmt, p_topology_state);
 		sql_rc = sqlite3_step(p_stmt);
@@ -4116,7 +4644,7 @@ enum db_return_codes db_add_topology_state(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -4154,7 +4682,7 @@ int db_get_topology_states(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < topology_state_count)
@@ -4163,7 +4691,7 @@ int db_get_topology_states(const PersistentStore *p_ps,
 			local_get_topology_state_relationships(p_ps, p_stmt, &p_topology_state[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -4214,11 +4742,11 @@ enum db_return_codes db_save_topology_state_state(const PersistentStore *p_ps,
 			$current_config_status, \
 			$config_goal_status) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_topology_state(p_stmt, p_topology_state);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -4249,7 +4777,7 @@ enum db_return_codes db_save_topology_state_state(const PersistentStore *p_ps,
 				 $current_config_status , \
 				 $config_goal_status )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_topology_state(p_stmt, p_topology_state);
@@ -4258,7 +4786,7 @@ enum db_return_codes db_save_topology_state_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -4289,7 +4817,7 @@ enum db_return_codes db_get_topology_state_by_device_handle(const PersistentStor
 		FROM topology_state \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -4299,7 +4827,7 @@ enum db_return_codes db_get_topology_state_by_device_handle(const PersistentStor
 			local_get_topology_state_relationships(p_ps, p_stmt, p_topology_state);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -4332,12 +4860,12 @@ enum db_return_codes db_update_topology_state_by_device_handle(const PersistentS
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_topology_state(p_stmt, p_topology_state);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -4359,14 +4887,14 @@ enum db_return_codes db_delete_topology_state_by_device_handle(const PersistentS
 	char *sql = "DELETE FROM topology_state \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -4459,7 +4987,7 @@ int db_get_topology_state_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  uid,  manufacturer,  serial_num,  part_num,  current_config_status,  config_goal_status  \
 		FROM topology_state_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -4470,7 +4998,7 @@ int db_get_topology_state_history_by_history_id(const PersistentStore *p_ps,
 			local_get_topology_state_relationships_history(p_ps, p_stmt, &p_topology_state[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -4554,7 +5082,7 @@ enum db_return_codes db_add_host(const PersistentStore *p_ps,
 		$os_name, \
 		$os_version) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_host(p_stmt, p_host);
 		sql_rc = sqlite3_step(p_stmt);
@@ -4562,7 +5090,7 @@ enum db_return_codes db_add_host(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -4597,7 +5125,7 @@ int db_get_hosts(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < host_count)
@@ -4606,7 +5134,7 @@ int db_get_hosts(const PersistentStore *p_ps,
 			local_get_host_relationships(p_ps, p_stmt, &p_host[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -4651,11 +5179,11 @@ enum db_return_codes db_save_host_state(const PersistentStore *p_ps,
 			$os_name, \
 			$os_version) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_host(p_stmt, p_host);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -4683,7 +5211,7 @@ enum db_return_codes db_save_host_state(const PersistentStore *p_ps,
 				 $os_name , \
 				 $os_version )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_host(p_stmt, p_host);
@@ -4692,7 +5220,7 @@ enum db_return_codes db_save_host_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -4721,7 +5249,7 @@ enum db_return_codes db_get_host_by_name(const PersistentStore *p_ps,
 		FROM host \
 		WHERE  name = $name";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$name", (char *)name);
 		sql_rc = sqlite3_step(p_stmt);
@@ -4731,7 +5259,7 @@ enum db_return_codes db_get_host_by_name(const PersistentStore *p_ps,
 			local_get_host_relationships(p_ps, p_stmt, p_host);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -4761,12 +5289,12 @@ enum db_return_codes db_update_host_by_name(const PersistentStore *p_ps,
 		  \
 	WHERE name=$name ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$name", (char *)name);
 		local_bind_host(p_stmt, p_host);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -4788,14 +5316,14 @@ enum db_return_codes db_delete_host_by_name(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM host \
 				 WHERE name = $name";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$name", (char *)name);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -4885,7 +5413,7 @@ int db_get_host_history_by_history_id(const PersistentStore *p_ps,
 		name,  os_type,  os_name,  os_version  \
 		FROM host_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -4896,7 +5424,7 @@ int db_get_host_history_by_history_id(const PersistentStore *p_ps,
 			local_get_host_relationships_history(p_ps, p_stmt, &p_host[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -4978,7 +5506,7 @@ enum db_return_codes db_add_sw_inventory(const PersistentStore *p_ps,
 		$vendor_driver_rev, \
 		$supported_driver_available) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_sw_inventory(p_stmt, p_sw_inventory);
 		sql_rc = sqlite3_step(p_stmt);
@@ -4986,7 +5514,7 @@ enum db_return_codes db_add_sw_inventory(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -5021,7 +5549,7 @@ int db_get_sw_inventorys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < sw_inventory_count)
@@ -5030,7 +5558,7 @@ int db_get_sw_inventorys(const PersistentStore *p_ps,
 			local_get_sw_inventory_relationships(p_ps, p_stmt, &p_sw_inventory[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -5075,11 +5603,11 @@ enum db_return_codes db_save_sw_inventory_state(const PersistentStore *p_ps,
 			$vendor_driver_rev, \
 			$supported_driver_available) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_sw_inventory(p_stmt, p_sw_inventory);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -5107,7 +5635,7 @@ enum db_return_codes db_save_sw_inventory_state(const PersistentStore *p_ps,
 				 $vendor_driver_rev , \
 				 $supported_driver_available )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_sw_inventory(p_stmt, p_sw_inventory);
@@ -5116,7 +5644,7 @@ enum db_return_codes db_save_sw_inventory_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -5145,7 +5673,7 @@ enum db_return_codes db_get_sw_inventory_by_name(const PersistentStore *p_ps,
 		FROM sw_inventory \
 		WHERE  name = $name";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$name", (char *)name);
 		sql_rc = sqlite3_step(p_stmt);
@@ -5155,7 +5683,7 @@ enum db_return_codes db_get_sw_inventory_by_name(const PersistentStore *p_ps,
 			local_get_sw_inventory_relationships(p_ps, p_stmt, p_sw_inventory);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -5185,12 +5713,12 @@ enum db_return_codes db_update_sw_inventory_by_name(const PersistentStore *p_ps,
 		  \
 	WHERE name=$name ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$name", (char *)name);
 		local_bind_sw_inventory(p_stmt, p_sw_inventory);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -5212,14 +5740,14 @@ enum db_return_codes db_delete_sw_inventory_by_name(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM sw_inventory \
 				 WHERE name = $name";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$name", (char *)name);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -5309,7 +5837,7 @@ int db_get_sw_inventory_history_by_history_id(const PersistentStore *p_ps,
 		name,  mgmt_sw_rev,  vendor_driver_rev,  supported_driver_available  \
 		FROM sw_inventory_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -5320,7 +5848,7 @@ int db_get_sw_inventory_history_by_history_id(const PersistentStore *p_ps,
 			local_get_sw_inventory_relationships_history(p_ps, p_stmt, &p_sw_inventory[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -5424,7 +5952,7 @@ enum db_return_codes db_add_socket(const PersistentStore *p_ps,
 		$manufacturer, \
 		$logical_processor_count) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_socket(p_stmt, p_socket);
 		sql_rc = sqlite3_step(p_stmt);
@@ -5432,7 +5960,7 @@ enum db_return_codes db_add_socket(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -5471,7 +5999,7 @@ int db_get_sockets(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < socket_count)
@@ -5480,7 +6008,7 @@ int db_get_sockets(const PersistentStore *p_ps,
 			local_get_socket_relationships(p_ps, p_stmt, &p_socket[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -5529,11 +6057,11 @@ enum db_return_codes db_save_socket_state(const PersistentStore *p_ps,
 			$manufacturer, \
 			$logical_processor_count) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_socket(p_stmt, p_socket);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -5565,7 +6093,7 @@ enum db_return_codes db_save_socket_state(const PersistentStore *p_ps,
 				 $manufacturer , \
 				 $logical_processor_count )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_socket(p_stmt, p_socket);
@@ -5574,7 +6102,7 @@ enum db_return_codes db_save_socket_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -5603,7 +6131,7 @@ enum db_return_codes db_get_socket_by_id(const PersistentStore *p_ps,
 		FROM socket \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (unsigned short)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -5613,7 +6141,7 @@ enum db_return_codes db_get_socket_by_id(const PersistentStore *p_ps,
 			local_get_socket_relationships(p_ps, p_stmt, p_socket);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -5647,12 +6175,12 @@ enum db_return_codes db_update_socket_by_id(const PersistentStore *p_ps,
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (unsigned short)id);
 		local_bind_socket(p_stmt, p_socket);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -5674,14 +6202,14 @@ enum db_return_codes db_delete_socket_by_id(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM socket \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (unsigned short)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -5771,7 +6299,7 @@ int db_get_socket_history_by_history_id(const PersistentStore *p_ps,
 		id,  type,  model,  brand,  family,  stepping,  manufacturer,  logical_processor_count  \
 		FROM socket_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -5782,7 +6310,7 @@ int db_get_socket_history_by_history_id(const PersistentStore *p_ps,
 			local_get_socket_relationships_history(p_ps, p_stmt, &p_socket[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -5987,7 +6515,7 @@ enum db_return_codes db_add_runtime_config_validation(const PersistentStore *p_p
 		$operation_type_2, \
 		$mask_2) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_runtime_config_validation(p_stmt, p_runtime_config_validation);
 		sql_rc = sqlite3_step(p_stmt);
@@ -5995,7 +6523,7 @@ enum db_return_codes db_add_runtime_config_validation(const PersistentStore *p_p
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -6051,7 +6579,7 @@ int db_get_runtime_config_validations(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < runtime_config_validation_count)
@@ -6060,7 +6588,7 @@ int db_get_runtime_config_validations(const PersistentStore *p_ps,
 			local_get_runtime_config_validation_relationships(p_ps, p_stmt, &p_runtime_config_validation[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -6126,11 +6654,11 @@ enum db_return_codes db_save_runtime_config_validation_state(const PersistentSto
 			$operation_type_2, \
 			$mask_2) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_runtime_config_validation(p_stmt, p_runtime_config_validation);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -6179,7 +6707,7 @@ enum db_return_codes db_save_runtime_config_validation_state(const PersistentSto
 				 $operation_type_2 , \
 				 $mask_2 )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_runtime_config_validation(p_stmt, p_runtime_config_validation);
@@ -6188,7 +6716,7 @@ enum db_return_codes db_save_runtime_config_validation_state(const PersistentSto
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -6217,7 +6745,7 @@ enum db_return_codes db_get_runtime_config_validation_by_id(const PersistentStor
 		FROM runtime_config_validation \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -6227,7 +6755,7 @@ enum db_return_codes db_get_runtime_config_validation_by_id(const PersistentStor
 			local_get_runtime_config_validation_relationships(p_ps, p_stmt, p_runtime_config_validation);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -6278,12 +6806,12 @@ enum db_return_codes db_update_runtime_config_validation_by_id(const PersistentS
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_runtime_config_validation(p_stmt, p_runtime_config_validation);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -6305,14 +6833,14 @@ enum db_return_codes db_delete_runtime_config_validation_by_id(const PersistentS
 	char *sql = "DELETE FROM runtime_config_validation \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -6402,7 +6930,7 @@ int db_get_runtime_config_validation_history_by_history_id(const PersistentStore
 		id,  type,  length,  address_space_id,  bit_width,  bit_offset,  access_size,  address,  operation_type_1,  value,  mask_1,  gas_structure_0,  gas_structure_1,  gas_structure_2,  gas_structure_3,  gas_structure_4,  gas_structure_5,  gas_structure_6,  gas_structure_7,  gas_structure_8,  gas_structure_9,  gas_structure_10,  gas_structure_11,  operation_type_2,  mask_2  \
 		FROM runtime_config_validation_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -6413,7 +6941,7 @@ int db_get_runtime_config_validation_history_by_history_id(const PersistentStore
 			local_get_runtime_config_validation_relationships_history(p_ps, p_stmt, &p_runtime_config_validation[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -6563,7 +7091,7 @@ enum db_return_codes db_add_socket_sku(const PersistentStore *p_ps,
 		$total_mapped_memory, \
 		$total_2lm_ddr_cache_memory) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_socket_sku(p_stmt, p_socket_sku);
 		sql_rc = sqlite3_step(p_stmt);
@@ -6571,7 +7099,7 @@ enum db_return_codes db_add_socket_sku(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -6609,7 +7137,7 @@ int db_get_socket_skus(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < socket_sku_count)
@@ -6618,7 +7146,7 @@ int db_get_socket_skus(const PersistentStore *p_ps,
 			local_get_socket_sku_relationships(p_ps, p_stmt, &p_socket_sku[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -6666,11 +7194,11 @@ enum db_return_codes db_save_socket_sku_state(const PersistentStore *p_ps,
 			$total_mapped_memory, \
 			$total_2lm_ddr_cache_memory) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_socket_sku(p_stmt, p_socket_sku);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -6701,7 +7229,7 @@ enum db_return_codes db_save_socket_sku_state(const PersistentStore *p_ps,
 				 $total_mapped_memory , \
 				 $total_2lm_ddr_cache_memory )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_socket_sku(p_stmt, p_socket_sku);
@@ -6710,7 +7238,7 @@ enum db_return_codes db_save_socket_sku_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -6739,7 +7267,7 @@ enum db_return_codes db_get_socket_sku_by_node_id(const PersistentStore *p_ps,
 		FROM socket_sku \
 		WHERE  node_id = $node_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$node_id", (unsigned short)node_id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -6749,7 +7277,7 @@ enum db_return_codes db_get_socket_sku_by_node_id(const PersistentStore *p_ps,
 			local_get_socket_sku_relationships(p_ps, p_stmt, p_socket_sku);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -6782,12 +7310,12 @@ enum db_return_codes db_update_socket_sku_by_node_id(const PersistentStore *p_ps
 		  \
 	WHERE node_id=$node_id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$node_id", (unsigned short)node_id);
 		local_bind_socket_sku(p_stmt, p_socket_sku);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -6809,14 +7337,14 @@ enum db_return_codes db_delete_socket_sku_by_node_id(const PersistentStore *p_ps
 	char *sql = "DELETE FROM socket_sku \
 				 WHERE node_id = $node_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$node_id", (unsigned short)node_id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -6906,7 +7434,7 @@ int db_get_socket_sku_history_by_history_id(const PersistentStore *p_ps,
 		type,  length,  node_id,  reserved,  mapped_memory_limit,  total_mapped_memory,  total_2lm_ddr_cache_memory  \
 		FROM socket_sku_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -6917,7 +7445,7 @@ int db_get_socket_sku_history_by_history_id(const PersistentStore *p_ps,
 			local_get_socket_sku_relationships_history(p_ps, p_stmt, &p_socket_sku[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -7200,7 +7728,7 @@ enum db_return_codes db_add_interleave_capability(const PersistentStore *p_ps,
 		$interleave_format_list_30, \
 		$interleave_format_list_31) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_interleave_capability(p_stmt, p_interleave_capability);
 		sql_rc = sqlite3_step(p_stmt);
@@ -7208,7 +7736,7 @@ enum db_return_codes db_add_interleave_capability(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -7277,7 +7805,7 @@ int db_get_interleave_capabilitys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < interleave_capability_count)
@@ -7286,7 +7814,7 @@ int db_get_interleave_capabilitys(const PersistentStore *p_ps,
 			local_get_interleave_capability_relationships(p_ps, p_stmt, &p_interleave_capability[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -7365,11 +7893,11 @@ enum db_return_codes db_save_interleave_capability_state(const PersistentStore *
 			$interleave_format_list_30, \
 			$interleave_format_list_31) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_interleave_capability(p_stmt, p_interleave_capability);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -7431,7 +7959,7 @@ enum db_return_codes db_save_interleave_capability_state(const PersistentStore *
 				 $interleave_format_list_30 , \
 				 $interleave_format_list_31 )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_interleave_capability(p_stmt, p_interleave_capability);
@@ -7440,7 +7968,7 @@ enum db_return_codes db_save_interleave_capability_state(const PersistentStore *
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -7469,7 +7997,7 @@ enum db_return_codes db_get_interleave_capability_by_id(const PersistentStore *p
 		FROM interleave_capability \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -7479,7 +8007,7 @@ enum db_return_codes db_get_interleave_capability_by_id(const PersistentStore *p
 			local_get_interleave_capability_relationships(p_ps, p_stmt, p_interleave_capability);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -7543,12 +8071,12 @@ enum db_return_codes db_update_interleave_capability_by_id(const PersistentStore
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_interleave_capability(p_stmt, p_interleave_capability);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -7570,14 +8098,14 @@ enum db_return_codes db_delete_interleave_capability_by_id(const PersistentStore
 	char *sql = "DELETE FROM interleave_capability \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -7667,7 +8195,7 @@ int db_get_interleave_capability_history_by_history_id(const PersistentStore *p_
 		id,  type,  length,  memory_mode,  interleave_alignment_size,  supported_interleave_count,  interleave_format_list_0,  interleave_format_list_1,  interleave_format_list_2,  interleave_format_list_3,  interleave_format_list_4,  interleave_format_list_5,  interleave_format_list_6,  interleave_format_list_7,  interleave_format_list_8,  interleave_format_list_9,  interleave_format_list_10,  interleave_format_list_11,  interleave_format_list_12,  interleave_format_list_13,  interleave_format_list_14,  interleave_format_list_15,  interleave_format_list_16,  interleave_format_list_17,  interleave_format_list_18,  interleave_format_list_19,  interleave_format_list_20,  interleave_format_list_21,  interleave_format_list_22,  interleave_format_list_23,  interleave_format_list_24,  interleave_format_list_25,  interleave_format_list_26,  interleave_format_list_27,  interleave_format_list_28,  interleave_format_list_29,  interleave_format_list_30,  interleave_format_list_31  \
 		FROM interleave_capability_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -7678,7 +8206,7 @@ int db_get_interleave_capability_history_by_history_id(const PersistentStore *p_
 			local_get_interleave_capability_relationships_history(p_ps, p_stmt, &p_interleave_capability[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -7828,7 +8356,7 @@ enum db_return_codes db_add_platform_info_capability(const PersistentStore *p_ps
 		$current_mem_mode, \
 		$pmem_ras_capabilities) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_platform_info_capability(p_stmt, p_platform_info_capability);
 		sql_rc = sqlite3_step(p_stmt);
@@ -7836,7 +8364,7 @@ enum db_return_codes db_add_platform_info_capability(const PersistentStore *p_ps
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -7874,7 +8402,7 @@ int db_get_platform_info_capabilitys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < platform_info_capability_count)
@@ -7883,7 +8411,7 @@ int db_get_platform_info_capabilitys(const PersistentStore *p_ps,
 			local_get_platform_info_capability_relationships(p_ps, p_stmt, &p_platform_info_capability[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -7931,11 +8459,11 @@ enum db_return_codes db_save_platform_info_capability_state(const PersistentStor
 			$current_mem_mode, \
 			$pmem_ras_capabilities) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_platform_info_capability(p_stmt, p_platform_info_capability);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -7966,7 +8494,7 @@ enum db_return_codes db_save_platform_info_capability_state(const PersistentStor
 				 $current_mem_mode , \
 				 $pmem_ras_capabilities )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_platform_info_capability(p_stmt, p_platform_info_capability);
@@ -7975,7 +8503,7 @@ enum db_return_codes db_save_platform_info_capability_state(const PersistentStor
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -8004,7 +8532,7 @@ enum db_return_codes db_get_platform_info_capability_by_id(const PersistentStore
 		FROM platform_info_capability \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -8014,7 +8542,7 @@ enum db_return_codes db_get_platform_info_capability_by_id(const PersistentStore
 			local_get_platform_info_capability_relationships(p_ps, p_stmt, p_platform_info_capability);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -8047,12 +8575,12 @@ enum db_return_codes db_update_platform_info_capability_by_id(const PersistentSt
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_platform_info_capability(p_stmt, p_platform_info_capability);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -8074,14 +8602,14 @@ enum db_return_codes db_delete_platform_info_capability_by_id(const PersistentSt
 	char *sql = "DELETE FROM platform_info_capability \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -8171,7 +8699,7 @@ int db_get_platform_info_capability_history_by_history_id(const PersistentStore
 		id,  type,  length,  mgmt_sw_config_support,  mem_mode_capabilities,  current_mem_mode,  pmem_ras_capabilities  \
 		FROM platform_info_capability_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -8182,7 +8710,7 @@ int db_get_platform_info_capability_history_by_history_id(const PersistentStore
 			local_get_platform_info_capability_relationships_history(p_ps, p_stmt, &p_platform_info_capability[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -8347,7 +8875,7 @@ enum db_return_codes db_add_platform_capabilities(const PersistentStore *p_ps,
 		$creator_id, \
 		$creator_revision) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_platform_capabilities(p_stmt, p_platform_capabilities);
 		sql_rc = sqlite3_step(p_stmt);
@@ -8355,7 +8883,7 @@ enum db_return_codes db_add_platform_capabilities(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -8395,7 +8923,7 @@ int db_get_platform_capabilitiess(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < platform_capabilities_count)
@@ -8404,7 +8932,7 @@ int db_get_platform_capabilitiess(const PersistentStore *p_ps,
 			local_get_platform_capabilities_relationships(p_ps, p_stmt, &p_platform_capabilities[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -8454,11 +8982,11 @@ enum db_return_codes db_save_platform_capabilities_state(const PersistentStore *
 			$creator_id, \
 			$creator_revision) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_platform_capabilities(p_stmt, p_platform_capabilities);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -8491,7 +9019,7 @@ enum db_return_codes db_save_platform_capabilities_state(const PersistentStore *
 				 $creator_id , \
 				 $creator_revision )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_platform_capabilities(p_stmt, p_platform_capabilities);
@@ -8500,7 +9028,7 @@ enum db_return_codes db_save_platform_capabilities_state(const PersistentStore *
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -8529,7 +9057,7 @@ enum db_return_codes db_get_platform_capabilities_by_signature(const PersistentS
 		FROM platform_capabilities \
 		WHERE  signature = $signature";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$signature", (char *)signature);
 		sql_rc = sqlite3_step(p_stmt);
@@ -8539,7 +9067,7 @@ enum db_return_codes db_get_platform_capabilities_by_signature(const PersistentS
 			local_get_platform_capabilities_relationships(p_ps, p_stmt, p_platform_capabilities);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -8574,12 +9102,12 @@ enum db_return_codes db_update_platform_capabilities_by_signature(const Persiste
 		  \
 	WHERE signature=$signature ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$signature", (char *)signature);
 		local_bind_platform_capabilities(p_stmt, p_platform_capabilities);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -8601,14 +9129,14 @@ enum db_return_codes db_delete_platform_capabilities_by_signature(const Persiste
 	char *sql = "DELETE FROM platform_capabilities \
 				 WHERE signature = $signature";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$signature", (char *)signature);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -8698,7 +9226,7 @@ int db_get_platform_capabilities_history_by_history_id(const PersistentStore *p_
 		signature,  length,  revision,  checksum,  oem_id,  oem_table_id,  oem_revision,  creator_id,  creator_revision  \
 		FROM platform_capabilities_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -8709,7 +9237,7 @@ int db_get_platform_capabilities_history_by_history_id(const PersistentStore *p_
 			local_get_platform_capabilities_relationships_history(p_ps, p_stmt, &p_platform_capabilities[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -8890,7 +9418,7 @@ enum db_return_codes db_add_driver_capabilities(const PersistentStore *p_ps,
 		$num_block_sizes, \
 		$namespace_memory_page_allocation_capable) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_driver_capabilities(p_stmt, p_driver_capabilities);
 		sql_rc = sqlite3_step(p_stmt);
@@ -8898,7 +9426,7 @@ enum db_return_codes db_add_driver_capabilities(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -8950,7 +9478,7 @@ int db_get_driver_capabilitiess(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < driver_capabilities_count)
@@ -8959,7 +9487,7 @@ int db_get_driver_capabilitiess(const PersistentStore *p_ps,
 			local_get_driver_capabilities_relationships(p_ps, p_stmt, &p_driver_capabilities[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -9021,11 +9549,11 @@ enum db_return_codes db_save_driver_capabilities_state(const PersistentStore *p_
 			$num_block_sizes, \
 			$namespace_memory_page_allocation_capable) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_driver_capabilities(p_stmt, p_driver_capabilities);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -9070,7 +9598,7 @@ enum db_return_codes db_save_driver_capabilities_state(const PersistentStore *p_
 				 $num_block_sizes , \
 				 $namespace_memory_page_allocation_capable )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_driver_capabilities(p_stmt, p_driver_capabilities);
@@ -9079,7 +9607,7 @@ enum db_return_codes db_save_driver_capabilities_state(const PersistentStore *p_
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -9108,7 +9636,7 @@ enum db_return_codes db_get_driver_capabilities_by_id(const PersistentStore *p_p
 		FROM driver_capabilities \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -9118,7 +9646,7 @@ enum db_return_codes db_get_driver_capabilities_by_id(const PersistentStore *p_p
 			local_get_driver_capabilities_relationships(p_ps, p_stmt, p_driver_capabilities);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -9165,12 +9693,12 @@ enum db_return_codes db_update_driver_capabilities_by_id(const PersistentStore *
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_driver_capabilities(p_stmt, p_driver_capabilities);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -9192,14 +9720,14 @@ enum db_return_codes db_delete_driver_capabilities_by_id(const PersistentStore *
 	char *sql = "DELETE FROM driver_capabilities \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -9289,7 +9817,7 @@ int db_get_driver_capabilities_history_by_history_id(const PersistentStore *p_ps
 		id,  min_namespace_size,  max_non_continguous_namespaces,  block_sizes_0,  block_sizes_1,  block_sizes_2,  block_sizes_3,  block_sizes_4,  block_sizes_5,  block_sizes_6,  block_sizes_7,  block_sizes_8,  block_sizes_9,  block_sizes_10,  block_sizes_11,  block_sizes_12,  block_sizes_13,  block_sizes_14,  block_sizes_15,  num_block_sizes,  namespace_memory_page_allocation_capable  \
 		FROM driver_capabilities_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -9300,7 +9828,7 @@ int db_get_driver_capabilities_history_by_history_id(const PersistentStore *p_ps
 			local_get_driver_capabilities_relationships_history(p_ps, p_stmt, &p_driver_capabilities[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -9535,7 +10063,7 @@ enum db_return_codes db_add_driver_features(const PersistentStore *p_ps,
 		$app_direct_mode, \
 		$storage_mode) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_driver_features(p_stmt, p_driver_features);
 		sql_rc = sqlite3_step(p_stmt);
@@ -9543,7 +10071,7 @@ enum db_return_codes db_add_driver_features(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -9604,7 +10132,7 @@ int db_get_driver_featuress(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < driver_features_count)
@@ -9613,7 +10141,7 @@ int db_get_driver_featuress(const PersistentStore *p_ps,
 			local_get_driver_features_relationships(p_ps, p_stmt, &p_driver_features[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -9684,11 +10212,11 @@ enum db_return_codes db_save_driver_features_state(const PersistentStore *p_ps,
 			$app_direct_mode, \
 			$storage_mode) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_driver_features(p_stmt, p_driver_features);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -9742,7 +10270,7 @@ enum db_return_codes db_save_driver_features_state(const PersistentStore *p_ps,
 				 $app_direct_mode , \
 				 $storage_mode )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_driver_features(p_stmt, p_driver_features);
@@ -9751,7 +10279,7 @@ enum db_return_codes db_save_driver_features_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -9780,7 +10308,7 @@ enum db_return_codes db_get_driver_features_by_id(const PersistentStore *p_ps,
 		FROM driver_features \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -9790,7 +10318,7 @@ enum db_return_codes db_get_driver_features_by_id(const PersistentStore *p_ps,
 			local_get_driver_features_relationships(p_ps, p_stmt, p_driver_features);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -9846,12 +10374,12 @@ enum db_return_codes db_update_driver_features_by_id(const PersistentStore *p_ps
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_driver_features(p_stmt, p_driver_features);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -9873,14 +10401,14 @@ enum db_return_codes db_delete_driver_features_by_id(const PersistentStore *p_ps
 	char *sql = "DELETE FROM driver_features \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -9970,7 +10498,7 @@ int db_get_driver_features_history_by_history_id(const PersistentStore *p_ps,
 		id,  get_platform_capabilities,  get_topology,  get_interleave,  get_dimm_detail,  get_namespaces,  get_namespace_detail,  get_address_scrub_data,  get_platform_config_data,  get_boot_status,  get_power_data,  get_security_state,  get_log_page,  get_features,  set_features,  create_namespace,  rename_namespace,  grow_namespace,  shrink_namespace,  delete_namespace,  enable_namespace,  disable_namespace,  set_security_state,  enable_logging,  run_diagnostic,  set_platform_config,  passthrough,  start_address_scrub,  app_direct_mode,  storage_mode  \
 		FROM driver_features_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -9981,7 +10509,7 @@ int db_get_driver_features_history_by_history_id(const PersistentStore *p_ps,
 			local_get_driver_features_relationships_history(p_ps, p_stmt, &p_driver_features[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -10186,7 +10714,7 @@ enum db_return_codes db_add_dimm_topology(const PersistentStore *p_ps,
 		$interface_format_codes_8, \
 		$state_flags) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_topology(p_stmt, p_dimm_topology);
 		sql_rc = sqlite3_step(p_stmt);
@@ -10194,7 +10722,7 @@ enum db_return_codes db_add_dimm_topology(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -10250,7 +10778,7 @@ int db_get_dimm_topologys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_topology_count)
@@ -10259,7 +10787,7 @@ int db_get_dimm_topologys(const PersistentStore *p_ps,
 			local_get_dimm_topology_relationships(p_ps, p_stmt, &p_dimm_topology[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -10325,11 +10853,11 @@ enum db_return_codes db_save_dimm_topology_state(const PersistentStore *p_ps,
 			$interface_format_codes_8, \
 			$state_flags) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_topology(p_stmt, p_dimm_topology);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -10378,7 +10906,7 @@ enum db_return_codes db_save_dimm_topology_state(const PersistentStore *p_ps,
 				 $interface_format_codes_8 , \
 				 $state_flags )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_topology(p_stmt, p_dimm_topology);
@@ -10387,7 +10915,7 @@ enum db_return_codes db_save_dimm_topology_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -10416,7 +10944,7 @@ enum db_return_codes db_get_dimm_topology_by_device_handle(const PersistentStore
 		FROM dimm_topology \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -10426,7 +10954,7 @@ enum db_return_codes db_get_dimm_topology_by_device_handle(const PersistentStore
 			local_get_dimm_topology_relationships(p_ps, p_stmt, p_dimm_topology);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -10477,12 +11005,12 @@ enum db_return_codes db_update_dimm_topology_by_device_handle(const PersistentSt
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_topology(p_stmt, p_dimm_topology);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -10504,14 +11032,14 @@ enum db_return_codes db_delete_dimm_topology_by_device_handle(const PersistentSt
 	char *sql = "DELETE FROM dimm_topology \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -10601,7 +11129,7 @@ int db_get_dimm_topology_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  id,  vendor_id,  device_id,  revision_id,  subsystem_vendor_id,  subsystem_device_id,  subsystem_revision_id,  manufacturing_info_valid,  manufacturing_location,  manufacturing_date,  serial_number_0,  serial_number_1,  serial_number_2,  serial_number_3,  interface_format_codes_0,  interface_format_codes_1,  interface_format_codes_2,  interface_format_codes_3,  interface_format_codes_4,  interface_format_codes_5,  interface_format_codes_6,  interface_format_codes_7,  interface_format_codes_8,  state_flags  \
 		FROM dimm_topology_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -10612,7 +11140,7 @@ int db_get_dimm_topology_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_topology_relationships_history(p_ps, p_stmt, &p_dimm_topology[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -10735,7 +11263,7 @@ enum db_return_codes db_add_namespace(const PersistentStore *p_ps,
 		$interleave_set_index, \
 		$memory_page_allocation) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_namespace(p_stmt, p_namespace);
 		sql_rc = sqlite3_step(p_stmt);
@@ -10743,7 +11271,7 @@ enum db_return_codes db_add_namespace(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -10785,7 +11313,7 @@ int db_get_namespaces(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < namespace_count)
@@ -10794,7 +11322,7 @@ int db_get_namespaces(const PersistentStore *p_ps,
 			local_get_namespace_relationships(p_ps, p_stmt, &p_namespace[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -10846,11 +11374,11 @@ enum db_return_codes db_save_namespace_state(const PersistentStore *p_ps,
 			$interleave_set_index, \
 			$memory_page_allocation) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_namespace(p_stmt, p_namespace);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -10885,7 +11413,7 @@ enum db_return_codes db_save_namespace_state(const PersistentStore *p_ps,
 				 $interleave_set_index , \
 				 $memory_page_allocation )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_namespace(p_stmt, p_namespace);
@@ -10894,7 +11422,7 @@ enum db_return_codes db_save_namespace_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -10923,7 +11451,7 @@ enum db_return_codes db_get_namespace_by_namespace_uid(const PersistentStore *p_
 		FROM namespace \
 		WHERE  namespace_uid = $namespace_uid";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$namespace_uid", (char *)namespace_uid);
 		sql_rc = sqlite3_step(p_stmt);
@@ -10933,7 +11461,7 @@ enum db_return_codes db_get_namespace_by_namespace_uid(const PersistentStore *p_
 			local_get_namespace_relationships(p_ps, p_stmt, p_namespace);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -10970,12 +11498,12 @@ enum db_return_codes db_update_namespace_by_namespace_uid(const PersistentStore
 		  \
 	WHERE namespace_uid=$namespace_uid ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$namespace_uid", (char *)namespace_uid);
 		local_bind_namespace(p_stmt, p_namespace);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -10997,14 +11525,14 @@ enum db_return_codes db_delete_namespace_by_namespace_uid(const PersistentStore
 	char *sql = "DELETE FROM namespace \
 				 WHERE namespace_uid = $namespace_uid";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$namespace_uid", (char *)namespace_uid);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11094,7 +11622,7 @@ int db_get_namespace_history_by_history_id(const PersistentStore *p_ps,
 		namespace_uid,  friendly_name,  block_size,  block_count,  type,  health,  enabled,  btt,  device_handle,  interleave_set_index,  memory_page_allocation  \
 		FROM namespace_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -11105,7 +11633,7 @@ int db_get_namespace_history_by_history_id(const PersistentStore *p_ps,
 			local_get_namespace_relationships_history(p_ps, p_stmt, &p_namespace[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -11134,7 +11662,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_topology_device_handle(
 	const char *sql = "SELECT COUNT (*) FROM namespace WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -11142,7 +11670,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_topology_device_handle(
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11169,7 +11697,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_topology_device_handle_histo
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -11178,7 +11706,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_topology_device_handle_histo
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11205,7 +11733,7 @@ enum db_return_codes db_get_namespaces_by_dimm_topology_device_handle(const Pers
 		FROM namespace \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -11216,7 +11744,7 @@ enum db_return_codes db_get_namespaces_by_dimm_topology_device_handle(const Pers
 			local_get_namespace_relationships(p_ps, p_stmt, &p_namespace[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -11241,7 +11769,7 @@ enum db_return_codes db_get_namespaces_by_dimm_topology_device_handle_history(co
 		FROM namespace_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -11253,7 +11781,7 @@ enum db_return_codes db_get_namespaces_by_dimm_topology_device_handle_history(co
 			local_get_namespace_relationships(p_ps, p_stmt, &p_namespace[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -11274,14 +11802,14 @@ enum db_return_codes db_delete_namespace_by_dimm_topology_device_handle(const Pe
 	char *sql = "DELETE FROM namespace \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -11304,7 +11832,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_interleave_set_index_id(
 	const char *sql = "SELECT COUNT (*) FROM namespace WHERE interleave_set_index = $interleave_set_index";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$interleave_set_index", (unsigned int)interleave_set_index);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -11312,7 +11840,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_interleave_set_index_id(
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11339,7 +11867,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_interleave_set_index_id_hist
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$interleave_set_index", (unsigned int)interleave_set_index);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -11348,7 +11876,7 @@ enum db_return_codes db_get_namespace_count_by_dimm_interleave_set_index_id_hist
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11375,7 +11903,7 @@ enum db_return_codes db_get_namespaces_by_dimm_interleave_set_index_id(const Per
 		FROM namespace \
 		WHERE  interleave_set_index = $interleave_set_index";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$interleave_set_index", (unsigned int)interleave_set_index);
@@ -11386,7 +11914,7 @@ enum db_return_codes db_get_namespaces_by_dimm_interleave_set_index_id(const Per
 			local_get_namespace_relationships(p_ps, p_stmt, &p_namespace[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -11411,7 +11939,7 @@ enum db_return_codes db_get_namespaces_by_dimm_interleave_set_index_id_history(c
 		FROM namespace_history \
 		WHERE  interleave_set_index = $interleave_set_index AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$interleave_set_index", (unsigned int)interleave_set_index);
@@ -11423,7 +11951,7 @@ enum db_return_codes db_get_namespaces_by_dimm_interleave_set_index_id_history(c
 			local_get_namespace_relationships(p_ps, p_stmt, &p_namespace[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -11444,14 +11972,14 @@ enum db_return_codes db_delete_namespace_by_dimm_interleave_set_index_id(const P
 	char *sql = "DELETE FROM namespace \
 				 WHERE interleave_set_index = $interleave_set_index";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$interleave_set_index", (unsigned int)interleave_set_index);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -11598,7 +12126,7 @@ enum db_return_codes db_add_identify_dimm(const PersistentStore *p_ps,
 		$serial_num, \
 		$part_num) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_identify_dimm(p_stmt, p_identify_dimm);
 		sql_rc = sqlite3_step(p_stmt);
@@ -11606,7 +12134,7 @@ enum db_return_codes db_add_identify_dimm(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -11653,7 +12181,7 @@ int db_get_identify_dimms(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < identify_dimm_count)
@@ -11662,7 +12190,7 @@ int db_get_identify_dimms(const PersistentStore *p_ps,
 			local_get_identify_dimm_relationships(p_ps, p_stmt, &p_identify_dimm[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -11719,11 +12247,11 @@ enum db_return_codes db_save_identify_dimm_state(const PersistentStore *p_ps,
 			$serial_num, \
 			$part_num) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_identify_dimm(p_stmt, p_identify_dimm);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -11763,7 +12291,7 @@ enum db_return_codes db_save_identify_dimm_state(const PersistentStore *p_ps,
 				 $serial_num , \
 				 $part_num )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_identify_dimm(p_stmt, p_identify_dimm);
@@ -11772,7 +12300,7 @@ enum db_return_codes db_save_identify_dimm_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -11801,7 +12329,7 @@ enum db_return_codes db_get_identify_dimm_by_device_handle(const PersistentStore
 		FROM identify_dimm \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -11811,7 +12339,7 @@ enum db_return_codes db_get_identify_dimm_by_device_handle(const PersistentStore
 			local_get_identify_dimm_relationships(p_ps, p_stmt, p_identify_dimm);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11853,12 +12381,12 @@ enum db_return_codes db_update_identify_dimm_by_device_handle(const PersistentSt
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_identify_dimm(p_stmt, p_identify_dimm);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11880,14 +12408,14 @@ enum db_return_codes db_delete_identify_dimm_by_device_handle(const PersistentSt
 	char *sql = "DELETE FROM identify_dimm \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -11977,7 +12505,7 @@ int db_get_identify_dimm_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  vendor_id,  device_id,  revision_id,  interface_format_code,  interface_format_code_extra,  fw_revision,  fw_api_version,  fw_sw_mask,  dimm_sku,  block_windows,  block_control_region_offset,  raw_cap,  manufacturer,  serial_num,  part_num  \
 		FROM identify_dimm_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -11988,7 +12516,7 @@ int db_get_identify_dimm_history_by_history_id(const PersistentStore *p_ps,
 			local_get_identify_dimm_relationships_history(p_ps, p_stmt, &p_identify_dimm[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -12088,7 +12616,7 @@ enum db_return_codes db_add_device_characteristics(const PersistentStore *p_ps,
 		$throttling_start_threshold, \
 		$throttling_stop_threshold) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_device_characteristics(p_stmt, p_device_characteristics);
 		sql_rc = sqlite3_step(p_stmt);
@@ -12096,7 +12624,7 @@ enum db_return_codes db_add_device_characteristics(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -12132,7 +12660,7 @@ int db_get_device_characteristicss(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < device_characteristics_count)
@@ -12141,7 +12669,7 @@ int db_get_device_characteristicss(const PersistentStore *p_ps,
 			local_get_device_characteristics_relationships(p_ps, p_stmt, &p_device_characteristics[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -12187,11 +12715,11 @@ enum db_return_codes db_save_device_characteristics_state(const PersistentStore
 			$throttling_start_threshold, \
 			$throttling_stop_threshold) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_device_characteristics(p_stmt, p_device_characteristics);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -12220,7 +12748,7 @@ enum db_return_codes db_save_device_characteristics_state(const PersistentStore
 				 $throttling_start_threshold , \
 				 $throttling_stop_threshold )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_device_characteristics(p_stmt, p_device_characteristics);
@@ -12229,7 +12757,7 @@ enum db_return_codes db_save_device_characteristics_state(const PersistentStore
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -12258,7 +12786,7 @@ enum db_return_codes db_get_device_characteristics_by_device_handle(const Persis
 		FROM device_characteristics \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -12268,7 +12796,7 @@ enum db_return_codes db_get_device_characteristics_by_device_handle(const Persis
 			local_get_device_characteristics_relationships(p_ps, p_stmt, p_device_characteristics);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -12299,12 +12827,12 @@ enum db_return_codes db_update_device_characteristics_by_device_handle(const Per
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_device_characteristics(p_stmt, p_device_characteristics);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -12326,14 +12854,14 @@ enum db_return_codes db_delete_device_characteristics_by_device_handle(const Per
 	char *sql = "DELETE FROM device_characteristics \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -12423,7 +12951,7 @@ int db_get_device_characteristics_history_by_history_id(const PersistentStore *p
 		device_handle,  controller_temp_shutdown_threshold,  media_temp_shutdown_threshold,  throttling_start_threshold,  throttling_stop_threshold  \
 		FROM device_characteristics_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -12434,7 +12962,7 @@ int db_get_device_characteristics_history_by_history_id(const PersistentStore *p
 			local_get_device_characteristics_relationships_history(p_ps, p_stmt, &p_device_characteristics[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -12525,7 +13053,7 @@ enum db_return_codes db_add_dimm_partition(const PersistentStore *p_ps,
 		$pm_start, \
 		$raw_capacity) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_partition(p_stmt, p_dimm_partition);
 		sql_rc = sqlite3_step(p_stmt);
@@ -12533,7 +13061,7 @@ enum db_return_codes db_add_dimm_partition(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -12570,7 +13098,7 @@ int db_get_dimm_partitions(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_partition_count)
@@ -12579,7 +13107,7 @@ int db_get_dimm_partitions(const PersistentStore *p_ps,
 			local_get_dimm_partition_relationships(p_ps, p_stmt, &p_dimm_partition[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -12626,11 +13154,11 @@ enum db_return_codes db_save_dimm_partition_state(const PersistentStore *p_ps,
 			$pm_start, \
 			$raw_capacity) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_partition(p_stmt, p_dimm_partition);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -12660,7 +13188,7 @@ enum db_return_codes db_save_dimm_partition_state(const PersistentStore *p_ps,
 				 $pm_start , \
 				 $raw_capacity )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_partition(p_stmt, p_dimm_partition);
@@ -12669,7 +13197,7 @@ enum db_return_codes db_save_dimm_partition_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -12698,7 +13226,7 @@ enum db_return_codes db_get_dimm_partition_by_device_handle(const PersistentStor
 		FROM dimm_partition \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -12708,7 +13236,7 @@ enum db_return_codes db_get_dimm_partition_by_device_handle(const PersistentStor
 			local_get_dimm_partition_relationships(p_ps, p_stmt, p_dimm_partition);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -12740,12 +13268,12 @@ enum db_return_codes db_update_dimm_partition_by_device_handle(const PersistentS
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_partition(p_stmt, p_dimm_partition);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -12767,14 +13295,14 @@ enum db_return_codes db_delete_dimm_partition_by_device_handle(const PersistentS
 	char *sql = "DELETE FROM dimm_partition \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -12864,7 +13392,7 @@ int db_get_dimm_partition_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  volatile_capacity,  volatile_start,  pmem_capacity,  pm_start,  raw_capacity  \
 		FROM dimm_partition_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -12875,7 +13403,7 @@ int db_get_dimm_partition_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_partition_relationships_history(p_ps, p_stmt, &p_dimm_partition[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -13062,7 +13590,7 @@ enum db_return_codes db_add_dimm_smart(const PersistentStore *p_ps,
 		$injected_media_errors, \
 		$injected_non_media_errors) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_smart(p_stmt, p_dimm_smart);
 		sql_rc = sqlite3_step(p_stmt);
@@ -13070,7 +13598,7 @@ enum db_return_codes db_add_dimm_smart(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -13123,7 +13651,7 @@ int db_get_dimm_smarts(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_smart_count)
@@ -13132,7 +13660,7 @@ int db_get_dimm_smarts(const PersistentStore *p_ps,
 			local_get_dimm_smart_relationships(p_ps, p_stmt, &p_dimm_smart[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -13195,11 +13723,11 @@ enum db_return_codes db_save_dimm_smart_state(const PersistentStore *p_ps,
 			$injected_media_errors, \
 			$injected_non_media_errors) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_smart(p_stmt, p_dimm_smart);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -13245,7 +13773,7 @@ enum db_return_codes db_save_dimm_smart_state(const PersistentStore *p_ps,
 				 $injected_media_errors , \
 				 $injected_non_media_errors )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_smart(p_stmt, p_dimm_smart);
@@ -13254,7 +13782,7 @@ enum db_return_codes db_save_dimm_smart_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -13283,7 +13811,7 @@ enum db_return_codes db_get_dimm_smart_by_device_handle(const PersistentStore *p
 		FROM dimm_smart \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -13293,7 +13821,7 @@ enum db_return_codes db_get_dimm_smart_by_device_handle(const PersistentStore *p
 			local_get_dimm_smart_relationships(p_ps, p_stmt, p_dimm_smart);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -13341,12 +13869,12 @@ enum db_return_codes db_update_dimm_smart_by_device_handle(const PersistentStore
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_smart(p_stmt, p_dimm_smart);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -13368,14 +13896,14 @@ enum db_return_codes db_delete_dimm_smart_by_device_handle(const PersistentStore
 	char *sql = "DELETE FROM dimm_smart \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -13465,7 +13993,7 @@ int db_get_dimm_smart_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  validation_flags,  health_status,  media_temperature,  spare,  alarm_trips,  percentage_used,  lss,  vendor_specific_data_size,  power_cycles,  power_on_seconds,  uptime,  unsafe_shutdowns,  lss_details,  last_shutdown_time,  lss_extended_details_0,  lss_extended_details_1,  lss_extended_details_2,  controller_temperature,  ait_dram_status,  injected_media_errors,  injected_non_media_errors  \
 		FROM dimm_smart_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -13476,7 +14004,7 @@ int db_get_dimm_smart_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_smart_relationships_history(p_ps, p_stmt, &p_dimm_smart[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -13560,7 +14088,7 @@ enum db_return_codes db_add_dimm_state(const PersistentStore *p_ps,
 		$sanitize_status, \
 		$fw_log_errors) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_state(p_stmt, p_dimm_state);
 		sql_rc = sqlite3_step(p_stmt);
@@ -13568,7 +14096,7 @@ enum db_return_codes db_add_dimm_state(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -13603,7 +14131,7 @@ int db_get_dimm_states(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_state_count)
@@ -13612,7 +14140,7 @@ int db_get_dimm_states(const PersistentStore *p_ps,
 			local_get_dimm_state_relationships(p_ps, p_stmt, &p_dimm_state[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -13660,11 +14188,11 @@ enum db_return_codes db_save_dimm_state_state(const PersistentStore *p_ps,
 			$sanitize_status, \
 			$fw_log_errors) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_state(p_stmt, p_dimm_state);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -13692,7 +14220,7 @@ enum db_return_codes db_save_dimm_state_state(const PersistentStore *p_ps,
 				 $sanitize_status , \
 				 $fw_log_errors )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_state(p_stmt, p_dimm_state);
@@ -13701,7 +14229,7 @@ enum db_return_codes db_save_dimm_state_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -13732,7 +14260,7 @@ enum db_return_codes db_get_dimm_state_by_device_handle(const PersistentStore *p
 		FROM dimm_state \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -13742,7 +14270,7 @@ enum db_return_codes db_get_dimm_state_by_device_handle(const PersistentStore *p
 			local_get_dimm_state_relationships(p_ps, p_stmt, p_dimm_state);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -13772,12 +14300,12 @@ enum db_return_codes db_update_dimm_state_by_device_handle(const PersistentStore
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_state(p_stmt, p_dimm_state);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -13799,14 +14327,14 @@ enum db_return_codes db_delete_dimm_state_by_device_handle(const PersistentStore
 	char *sql = "DELETE FROM dimm_state \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -13899,7 +14427,7 @@ int db_get_dimm_state_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  health_state,  sanitize_status,  fw_log_errors  \
 		FROM dimm_state_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -13910,7 +14438,7 @@ int db_get_dimm_state_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_state_relationships_history(p_ps, p_stmt, &p_dimm_state[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -13985,7 +14513,7 @@ enum db_return_codes db_add_namespace_state(const PersistentStore *p_ps,
 		($namespace_uid, \
 		$health_state) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_namespace_state(p_stmt, p_namespace_state);
 		sql_rc = sqlite3_step(p_stmt);
@@ -13993,7 +14521,7 @@ enum db_return_codes db_add_namespace_state(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -14026,7 +14554,7 @@ int db_get_namespace_states(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < namespace_state_count)
@@ -14035,7 +14563,7 @@ int db_get_namespace_states(const PersistentStore *p_ps,
 			local_get_namespace_state_relationships(p_ps, p_stmt, &p_namespace_state[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -14081,11 +14609,11 @@ enum db_return_codes db_save_namespace_state_state(const PersistentStore *p_ps,
 			($namespace_uid, \
 			$health_state) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_namespace_state(p_stmt, p_namespace_state);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -14111,7 +14639,7 @@ enum db_return_codes db_save_namespace_state_state(const PersistentStore *p_ps,
 				 $namespace_uid , \
 				 $health_state )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_namespace_state(p_stmt, p_namespace_state);
@@ -14120,7 +14648,7 @@ enum db_return_codes db_save_namespace_state_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -14151,7 +14679,7 @@ enum db_return_codes db_get_namespace_state_by_namespace_uid(const PersistentSto
 		FROM namespace_state \
 		WHERE  namespace_uid = $namespace_uid";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$namespace_uid", (char *)namespace_uid);
 		sql_rc = sqlite3_step(p_stmt);
@@ -14161,7 +14689,7 @@ enum db_return_codes db_get_namespace_state_by_namespace_uid(const PersistentSto
 			local_get_namespace_state_relationships(p_ps, p_stmt, p_namespace_state);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -14189,12 +14717,12 @@ enum db_return_codes db_update_namespace_state_by_namespace_uid(const Persistent
 		  \
 	WHERE namespace_uid=$namespace_uid ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$namespace_uid", (char *)namespace_uid);
 		local_bind_namespace_state(p_stmt, p_namespace_state);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -14216,14 +14744,14 @@ enum db_return_codes db_delete_namespace_state_by_namespace_uid(const Persistent
 	char *sql = "DELETE FROM namespace_state \
 				 WHERE namespace_uid = $namespace_uid";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$namespace_uid", (char *)namespace_uid);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -14316,7 +14844,7 @@ int db_get_namespace_state_history_by_history_id(const PersistentStore *p_ps,
 		namespace_uid,  health_state  \
 		FROM namespace_state_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -14327,7 +14855,7 @@ int db_get_namespace_state_history_by_history_id(const PersistentStore *p_ps,
 			local_get_namespace_state_relationships_history(p_ps, p_stmt, &p_namespace_state[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -14414,7 +14942,7 @@ enum db_return_codes db_add_dimm_alarm_thresholds(const PersistentStore *p_ps,
 		$controller_temperature, \
 		$spare) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_alarm_thresholds(p_stmt, p_dimm_alarm_thresholds);
 		sql_rc = sqlite3_step(p_stmt);
@@ -14422,7 +14950,7 @@ enum db_return_codes db_add_dimm_alarm_thresholds(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -14458,7 +14986,7 @@ int db_get_dimm_alarm_thresholdss(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_alarm_thresholds_count)
@@ -14467,7 +14995,7 @@ int db_get_dimm_alarm_thresholdss(const PersistentStore *p_ps,
 			local_get_dimm_alarm_thresholds_relationships(p_ps, p_stmt, &p_dimm_alarm_thresholds[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -14513,11 +15041,11 @@ enum db_return_codes db_save_dimm_alarm_thresholds_state(const PersistentStore *
 			$controller_temperature, \
 			$spare) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_alarm_thresholds(p_stmt, p_dimm_alarm_thresholds);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -14546,7 +15074,7 @@ enum db_return_codes db_save_dimm_alarm_thresholds_state(const PersistentStore *
 				 $controller_temperature , \
 				 $spare )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_alarm_thresholds(p_stmt, p_dimm_alarm_thresholds);
@@ -14555,7 +15083,7 @@ enum db_return_codes db_save_dimm_alarm_thresholds_state(const PersistentStore *
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -14584,7 +15112,7 @@ enum db_return_codes db_get_dimm_alarm_thresholds_by_device_handle(const Persist
 		FROM dimm_alarm_thresholds \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -14594,7 +15122,7 @@ enum db_return_codes db_get_dimm_alarm_thresholds_by_device_handle(const Persist
 			local_get_dimm_alarm_thresholds_relationships(p_ps, p_stmt, p_dimm_alarm_thresholds);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -14625,12 +15153,12 @@ enum db_return_codes db_update_dimm_alarm_thresholds_by_device_handle(const Pers
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_alarm_thresholds(p_stmt, p_dimm_alarm_thresholds);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -14652,14 +15180,14 @@ enum db_return_codes db_delete_dimm_alarm_thresholds_by_device_handle(const Pers
 	char *sql = "DELETE FROM dimm_alarm_thresholds \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -14749,7 +15277,7 @@ int db_get_dimm_alarm_thresholds_history_by_history_id(const PersistentStore *p_
 		device_handle,  enable,  media_temperature,  controller_temperature,  spare  \
 		FROM dimm_alarm_thresholds_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -14760,7 +15288,7 @@ int db_get_dimm_alarm_thresholds_history_by_history_id(const PersistentStore *p_
 			local_get_dimm_alarm_thresholds_relationships_history(p_ps, p_stmt, &p_dimm_alarm_thresholds[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -14845,7 +15373,7 @@ enum db_return_codes db_add_dimm_power_management(const PersistentStore *p_ps,
 		$peak_power_budget, \
 		$avg_power_budget) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_power_management(p_stmt, p_dimm_power_management);
 		sql_rc = sqlite3_step(p_stmt);
@@ -14853,7 +15381,7 @@ enum db_return_codes db_add_dimm_power_management(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -14889,7 +15417,7 @@ int db_get_dimm_power_managements(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_power_management_count)
@@ -14898,7 +15426,7 @@ int db_get_dimm_power_managements(const PersistentStore *p_ps,
 			local_get_dimm_power_management_relationships(p_ps, p_stmt, &p_dimm_power_management[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -14944,11 +15472,11 @@ enum db_return_codes db_save_dimm_power_management_state(const PersistentStore *
 			$peak_power_budget, \
 			$avg_power_budget) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_power_management(p_stmt, p_dimm_power_management);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -14977,7 +15505,7 @@ enum db_return_codes db_save_dimm_power_management_state(const PersistentStore *
 				 $peak_power_budget , \
 				 $avg_power_budget )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_power_management(p_stmt, p_dimm_power_management);
@@ -14986,7 +15514,7 @@ enum db_return_codes db_save_dimm_power_management_state(const PersistentStore *
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -15015,7 +15543,7 @@ enum db_return_codes db_get_dimm_power_management_by_device_handle(const Persist
 		FROM dimm_power_management \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -15025,7 +15553,7 @@ enum db_return_codes db_get_dimm_power_management_by_device_handle(const Persist
 			local_get_dimm_power_management_relationships(p_ps, p_stmt, p_dimm_power_management);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15056,12 +15584,12 @@ enum db_return_codes db_update_dimm_power_management_by_device_handle(const Pers
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_power_management(p_stmt, p_dimm_power_management);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15083,14 +15611,14 @@ enum db_return_codes db_delete_dimm_power_management_by_device_handle(const Pers
 	char *sql = "DELETE FROM dimm_power_management \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15180,7 +15708,7 @@ int db_get_dimm_power_management_history_by_history_id(const PersistentStore *p_
 		device_handle,  enable,  tdp_power_limit,  peak_power_budget,  avg_power_budget  \
 		FROM dimm_power_management_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -15191,7 +15719,7 @@ int db_get_dimm_power_management_history_by_history_id(const PersistentStore *p_
 			local_get_dimm_power_management_relationships_history(p_ps, p_stmt, &p_dimm_power_management[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -15270,7 +15798,7 @@ enum db_return_codes db_add_dimm_die_sparing(const PersistentStore *p_ps,
 		$aggressiveness, \
 		$supported) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_die_sparing(p_stmt, p_dimm_die_sparing);
 		sql_rc = sqlite3_step(p_stmt);
@@ -15278,7 +15806,7 @@ enum db_return_codes db_add_dimm_die_sparing(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -15313,7 +15841,7 @@ int db_get_dimm_die_sparings(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_die_sparing_count)
@@ -15322,7 +15850,7 @@ int db_get_dimm_die_sparings(const PersistentStore *p_ps,
 			local_get_dimm_die_sparing_relationships(p_ps, p_stmt, &p_dimm_die_sparing[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -15367,11 +15895,11 @@ enum db_return_codes db_save_dimm_die_sparing_state(const PersistentStore *p_ps,
 			$aggressiveness, \
 			$supported) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_die_sparing(p_stmt, p_dimm_die_sparing);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -15399,7 +15927,7 @@ enum db_return_codes db_save_dimm_die_sparing_state(const PersistentStore *p_ps,
 				 $aggressiveness , \
 				 $supported )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_die_sparing(p_stmt, p_dimm_die_sparing);
@@ -15408,7 +15936,7 @@ enum db_return_codes db_save_dimm_die_sparing_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -15437,7 +15965,7 @@ enum db_return_codes db_get_dimm_die_sparing_by_device_handle(const PersistentSt
 		FROM dimm_die_sparing \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -15447,7 +15975,7 @@ enum db_return_codes db_get_dimm_die_sparing_by_device_handle(const PersistentSt
 			local_get_dimm_die_sparing_relationships(p_ps, p_stmt, p_dimm_die_sparing);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15477,12 +16005,12 @@ enum db_return_codes db_update_dimm_die_sparing_by_device_handle(const Persisten
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_die_sparing(p_stmt, p_dimm_die_sparing);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15504,14 +16032,14 @@ enum db_return_codes db_delete_dimm_die_sparing_by_device_handle(const Persisten
 	char *sql = "DELETE FROM dimm_die_sparing \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15601,7 +16129,7 @@ int db_get_dimm_die_sparing_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  enable,  aggressiveness,  supported  \
 		FROM dimm_die_sparing_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -15612,7 +16140,7 @@ int db_get_dimm_die_sparing_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_die_sparing_relationships_history(p_ps, p_stmt, &p_dimm_die_sparing[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -15691,7 +16219,7 @@ enum db_return_codes db_add_dimm_optional_config_data(const PersistentStore *p_p
 		$viral_policy_enable, \
 		$viral_status) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_optional_config_data(p_stmt, p_dimm_optional_config_data);
 		sql_rc = sqlite3_step(p_stmt);
@@ -15699,7 +16227,7 @@ enum db_return_codes db_add_dimm_optional_config_data(const PersistentStore *p_p
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -15734,7 +16262,7 @@ int db_get_dimm_optional_config_datas(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_optional_config_data_count)
@@ -15743,7 +16271,7 @@ int db_get_dimm_optional_config_datas(const PersistentStore *p_ps,
 			local_get_dimm_optional_config_data_relationships(p_ps, p_stmt, &p_dimm_optional_config_data[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -15788,11 +16316,11 @@ enum db_return_codes db_save_dimm_optional_config_data_state(const PersistentSto
 			$viral_policy_enable, \
 			$viral_status) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_optional_config_data(p_stmt, p_dimm_optional_config_data);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -15820,7 +16348,7 @@ enum db_return_codes db_save_dimm_optional_config_data_state(const PersistentSto
 				 $viral_policy_enable , \
 				 $viral_status )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_optional_config_data(p_stmt, p_dimm_optional_config_data);
@@ -15829,7 +16357,7 @@ enum db_return_codes db_save_dimm_optional_config_data_state(const PersistentSto
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -15858,7 +16386,7 @@ enum db_return_codes db_get_dimm_optional_config_data_by_device_handle(const Per
 		FROM dimm_optional_config_data \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -15868,7 +16396,7 @@ enum db_return_codes db_get_dimm_optional_config_data_by_device_handle(const Per
 			local_get_dimm_optional_config_data_relationships(p_ps, p_stmt, p_dimm_optional_config_data);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15898,12 +16426,12 @@ enum db_return_codes db_update_dimm_optional_config_data_by_device_handle(const
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_optional_config_data(p_stmt, p_dimm_optional_config_data);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -15925,14 +16453,14 @@ enum db_return_codes db_delete_dimm_optional_config_data_by_device_handle(const
 	char *sql = "DELETE FROM dimm_optional_config_data \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -16022,7 +16550,7 @@ int db_get_dimm_optional_config_data_history_by_history_id(const PersistentStore
 		device_handle,  first_fast_refresh_enable,  viral_policy_enable,  viral_status  \
 		FROM dimm_optional_config_data_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -16033,7 +16561,7 @@ int db_get_dimm_optional_config_data_history_by_history_id(const PersistentStore
 			local_get_dimm_optional_config_data_relationships_history(p_ps, p_stmt, &p_dimm_optional_config_data[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -16118,7 +16646,7 @@ enum db_return_codes db_add_dimm_err_correction(const PersistentStore *p_ps,
 		$unrefreshed_force_write, \
 		$refreshed_force_write) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_err_correction(p_stmt, p_dimm_err_correction);
 		sql_rc = sqlite3_step(p_stmt);
@@ -16126,7 +16654,7 @@ enum db_return_codes db_add_dimm_err_correction(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -16162,7 +16690,7 @@ int db_get_dimm_err_corrections(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_err_correction_count)
@@ -16171,7 +16699,7 @@ int db_get_dimm_err_corrections(const PersistentStore *p_ps,
 			local_get_dimm_err_correction_relationships(p_ps, p_stmt, &p_dimm_err_correction[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -16217,11 +16745,11 @@ enum db_return_codes db_save_dimm_err_correction_state(const PersistentStore *p_
 			$unrefreshed_force_write, \
 			$refreshed_force_write) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_err_correction(p_stmt, p_dimm_err_correction);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -16250,7 +16778,7 @@ enum db_return_codes db_save_dimm_err_correction_state(const PersistentStore *p_
 				 $unrefreshed_force_write , \
 				 $refreshed_force_write )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_err_correction(p_stmt, p_dimm_err_correction);
@@ -16259,7 +16787,7 @@ enum db_return_codes db_save_dimm_err_correction_state(const PersistentStore *p_
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -16288,7 +16816,7 @@ enum db_return_codes db_get_dimm_err_correction_by_device_handle(const Persisten
 		FROM dimm_err_correction \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -16298,7 +16826,7 @@ enum db_return_codes db_get_dimm_err_correction_by_device_handle(const Persisten
 			local_get_dimm_err_correction_relationships(p_ps, p_stmt, p_dimm_err_correction);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -16329,12 +16857,12 @@ enum db_return_codes db_update_dimm_err_correction_by_device_handle(const Persis
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_err_correction(p_stmt, p_dimm_err_correction);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -16356,14 +16884,14 @@ enum db_return_codes db_delete_dimm_err_correction_by_device_handle(const Persis
 	char *sql = "DELETE FROM dimm_err_correction \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -16453,7 +16981,7 @@ int db_get_dimm_err_correction_history_by_history_id(const PersistentStore *p_ps
 		device_handle,  unrefreshed_enable,  refreshed_enable,  unrefreshed_force_write,  refreshed_force_write  \
 		FROM dimm_err_correction_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -16464,7 +16992,7 @@ int db_get_dimm_err_correction_history_by_history_id(const PersistentStore *p_ps
 			local_get_dimm_err_correction_relationships_history(p_ps, p_stmt, &p_dimm_err_correction[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -16555,7 +17083,7 @@ enum db_return_codes db_add_dimm_erasure_coding(const PersistentStore *p_ps,
 		$unrefreshed_force_write, \
 		$refreshed_force_write) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_erasure_coding(p_stmt, p_dimm_erasure_coding);
 		sql_rc = sqlite3_step(p_stmt);
@@ -16563,7 +17091,7 @@ enum db_return_codes db_add_dimm_erasure_coding(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -16600,7 +17128,7 @@ int db_get_dimm_erasure_codings(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_erasure_coding_count)
@@ -16609,7 +17137,7 @@ int db_get_dimm_erasure_codings(const PersistentStore *p_ps,
 			local_get_dimm_erasure_coding_relationships(p_ps, p_stmt, &p_dimm_erasure_coding[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -16656,11 +17184,11 @@ enum db_return_codes db_save_dimm_erasure_coding_state(const PersistentStore *p_
 			$unrefreshed_force_write, \
 			$refreshed_force_write) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_erasure_coding(p_stmt, p_dimm_erasure_coding);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -16690,7 +17218,7 @@ enum db_return_codes db_save_dimm_erasure_coding_state(const PersistentStore *p_
 				 $unrefreshed_force_write , \
 				 $refreshed_force_write )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_erasure_coding(p_stmt, p_dimm_erasure_coding);
@@ -16699,7 +17227,7 @@ enum db_return_codes db_save_dimm_erasure_coding_state(const PersistentStore *p_
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -16728,7 +17256,7 @@ enum db_return_codes db_get_dimm_erasure_coding_by_device_handle(const Persisten
 		FROM dimm_erasure_coding \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -16738,7 +17266,7 @@ enum db_return_codes db_get_dimm_erasure_coding_by_device_handle(const Persisten
 			local_get_dimm_erasure_coding_relationships(p_ps, p_stmt, p_dimm_erasure_coding);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -16770,12 +17298,12 @@ enum db_return_codes db_update_dimm_erasure_coding_by_device_handle(const Persis
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_erasure_coding(p_stmt, p_dimm_erasure_coding);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -16797,14 +17325,14 @@ enum db_return_codes db_delete_dimm_erasure_coding_by_device_handle(const Persis
 	char *sql = "DELETE FROM dimm_erasure_coding \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -16894,7 +17422,7 @@ int db_get_dimm_erasure_coding_history_by_history_id(const PersistentStore *p_ps
 		device_handle,  verify_erc,  unrefreshed_enable,  refreshed_enable,  unrefreshed_force_write,  refreshed_force_write  \
 		FROM dimm_erasure_coding_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -16905,7 +17433,7 @@ int db_get_dimm_erasure_coding_history_by_history_id(const PersistentStore *p_ps
 			local_get_dimm_erasure_coding_relationships_history(p_ps, p_stmt, &p_dimm_erasure_coding[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -16984,7 +17512,7 @@ enum db_return_codes db_add_dimm_thermal(const PersistentStore *p_ps,
 		$alerting_enable, \
 		$critical_shutdown_enable) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_thermal(p_stmt, p_dimm_thermal);
 		sql_rc = sqlite3_step(p_stmt);
@@ -16992,7 +17520,7 @@ enum db_return_codes db_add_dimm_thermal(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -17027,7 +17555,7 @@ int db_get_dimm_thermals(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_thermal_count)
@@ -17036,7 +17564,7 @@ int db_get_dimm_thermals(const PersistentStore *p_ps,
 			local_get_dimm_thermal_relationships(p_ps, p_stmt, &p_dimm_thermal[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -17081,11 +17609,11 @@ enum db_return_codes db_save_dimm_thermal_state(const PersistentStore *p_ps,
 			$alerting_enable, \
 			$critical_shutdown_enable) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_thermal(p_stmt, p_dimm_thermal);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -17113,7 +17641,7 @@ enum db_return_codes db_save_dimm_thermal_state(const PersistentStore *p_ps,
 				 $alerting_enable , \
 				 $critical_shutdown_enable )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_thermal(p_stmt, p_dimm_thermal);
@@ -17122,7 +17650,7 @@ enum db_return_codes db_save_dimm_thermal_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -17151,7 +17679,7 @@ enum db_return_codes db_get_dimm_thermal_by_device_handle(const PersistentStore
 		FROM dimm_thermal \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -17161,7 +17689,7 @@ enum db_return_codes db_get_dimm_thermal_by_device_handle(const PersistentStore
 			local_get_dimm_thermal_relationships(p_ps, p_stmt, p_dimm_thermal);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -17191,12 +17719,12 @@ enum db_return_codes db_update_dimm_thermal_by_device_handle(const PersistentSto
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_thermal(p_stmt, p_dimm_thermal);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -17218,14 +17746,14 @@ enum db_return_codes db_delete_dimm_thermal_by_device_handle(const PersistentSto
 	char *sql = "DELETE FROM dimm_thermal \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -17315,7 +17843,7 @@ int db_get_dimm_thermal_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  throttling_enable,  alerting_enable,  critical_shutdown_enable  \
 		FROM dimm_thermal_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -17326,7 +17854,7 @@ int db_get_dimm_thermal_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_thermal_relationships_history(p_ps, p_stmt, &p_dimm_thermal[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -17427,7 +17955,7 @@ enum db_return_codes db_add_dimm_fw_image(const PersistentStore *p_ps,
 		$commit_id, \
 		$build_configuration) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_fw_image(p_stmt, p_dimm_fw_image);
 		sql_rc = sqlite3_step(p_stmt);
@@ -17435,7 +17963,7 @@ enum db_return_codes db_add_dimm_fw_image(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -17473,7 +18001,7 @@ int db_get_dimm_fw_images(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_fw_image_count)
@@ -17482,7 +18010,7 @@ int db_get_dimm_fw_images(const PersistentStore *p_ps,
 			local_get_dimm_fw_image_relationships(p_ps, p_stmt, &p_dimm_fw_image[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -17530,11 +18058,11 @@ enum db_return_codes db_save_dimm_fw_image_state(const PersistentStore *p_ps,
 			$commit_id, \
 			$build_configuration) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_fw_image(p_stmt, p_dimm_fw_image);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -17565,7 +18093,7 @@ enum db_return_codes db_save_dimm_fw_image_state(const PersistentStore *p_ps,
 				 $commit_id , \
 				 $build_configuration )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_fw_image(p_stmt, p_dimm_fw_image);
@@ -17574,7 +18102,7 @@ enum db_return_codes db_save_dimm_fw_image_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -17603,7 +18131,7 @@ enum db_return_codes db_get_dimm_fw_image_by_device_handle(const PersistentStore
 		FROM dimm_fw_image \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -17613,7 +18141,7 @@ enum db_return_codes db_get_dimm_fw_image_by_device_handle(const PersistentStore
 			local_get_dimm_fw_image_relationships(p_ps, p_stmt, p_dimm_fw_image);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -17646,12 +18174,12 @@ enum db_return_codes db_update_dimm_fw_image_by_device_handle(const PersistentSt
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_fw_image(p_stmt, p_dimm_fw_image);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -17673,14 +18201,14 @@ enum db_return_codes db_delete_dimm_fw_image_by_device_handle(const PersistentSt
 	char *sql = "DELETE FROM dimm_fw_image \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -17770,7 +18298,7 @@ int db_get_dimm_fw_image_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  fw_rev,  fw_type,  staged_fw_rev,  fw_update_status,  commit_id,  build_configuration  \
 		FROM dimm_fw_image_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -17781,7 +18309,7 @@ int db_get_dimm_fw_image_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_fw_image_relationships_history(p_ps, p_stmt, &p_dimm_fw_image[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -17849,7 +18377,7 @@ enum db_return_codes db_add_dimm_fw_debug_log(const PersistentStore *p_ps,
 		($device_handle, \
 		$fw_log) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_fw_debug_log(p_stmt, p_dimm_fw_debug_log);
 		sql_rc = sqlite3_step(p_stmt);
@@ -17857,7 +18385,7 @@ enum db_return_codes db_add_dimm_fw_debug_log(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -17890,7 +18418,7 @@ int db_get_dimm_fw_debug_logs(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_fw_debug_log_count)
@@ -17899,7 +18427,7 @@ int db_get_dimm_fw_debug_logs(const PersistentStore *p_ps,
 			local_get_dimm_fw_debug_log_relationships(p_ps, p_stmt, &p_dimm_fw_debug_log[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -17942,11 +18470,11 @@ enum db_return_codes db_save_dimm_fw_debug_log_state(const PersistentStore *p_ps
 			($device_handle, \
 			$fw_log) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_fw_debug_log(p_stmt, p_dimm_fw_debug_log);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -17972,7 +18500,7 @@ enum db_return_codes db_save_dimm_fw_debug_log_state(const PersistentStore *p_ps
 				 $device_handle , \
 				 $fw_log )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_fw_debug_log(p_stmt, p_dimm_fw_debug_log);
@@ -17981,7 +18509,7 @@ enum db_return_codes db_save_dimm_fw_debug_log_state(const PersistentStore *p_ps
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -18010,7 +18538,7 @@ enum db_return_codes db_get_dimm_fw_debug_log_by_fw_log(const PersistentStore *p
 		FROM dimm_fw_debug_log \
 		WHERE  fw_log = $fw_log";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$fw_log", (char *)fw_log);
 		sql_rc = sqlite3_step(p_stmt);
@@ -18020,7 +18548,7 @@ enum db_return_codes db_get_dimm_fw_debug_log_by_fw_log(const PersistentStore *p
 			local_get_dimm_fw_debug_log_relationships(p_ps, p_stmt, p_dimm_fw_debug_log);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18048,12 +18576,12 @@ enum db_return_codes db_update_dimm_fw_debug_log_by_fw_log(const PersistentStore
 		  \
 	WHERE fw_log=$fw_log ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$fw_log", (char *)fw_log);
 		local_bind_dimm_fw_debug_log(p_stmt, p_dimm_fw_debug_log);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18075,14 +18603,14 @@ enum db_return_codes db_delete_dimm_fw_debug_log_by_fw_log(const PersistentStore
 	char *sql = "DELETE FROM dimm_fw_debug_log \
 				 WHERE fw_log = $fw_log";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_TEXT(p_stmt, "$fw_log", (char *)fw_log);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18172,7 +18700,7 @@ int db_get_dimm_fw_debug_log_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  fw_log  \
 		FROM dimm_fw_debug_log_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -18183,7 +18711,7 @@ int db_get_dimm_fw_debug_log_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_fw_debug_log_relationships_history(p_ps, p_stmt, &p_dimm_fw_debug_log[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -18212,7 +18740,7 @@ enum db_return_codes db_get_dimm_fw_debug_log_count_by_dimm_topology_device_hand
 	const char *sql = "SELECT COUNT (*) FROM dimm_fw_debug_log WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -18220,7 +18748,7 @@ enum db_return_codes db_get_dimm_fw_debug_log_count_by_dimm_topology_device_hand
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18247,7 +18775,7 @@ enum db_return_codes db_get_dimm_fw_debug_log_count_by_dimm_topology_device_hand
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -18256,7 +18784,7 @@ enum db_return_codes db_get_dimm_fw_debug_log_count_by_dimm_topology_device_hand
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18283,7 +18811,7 @@ enum db_return_codes db_get_dimm_fw_debug_logs_by_dimm_topology_device_handle(co
 		FROM dimm_fw_debug_log \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -18294,7 +18822,7 @@ enum db_return_codes db_get_dimm_fw_debug_logs_by_dimm_topology_device_handle(co
 			local_get_dimm_fw_debug_log_relationships(p_ps, p_stmt, &p_dimm_fw_debug_log[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -18319,7 +18847,7 @@ enum db_return_codes db_get_dimm_fw_debug_logs_by_dimm_topology_device_handle_hi
 		FROM dimm_fw_debug_log_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -18331,7 +18859,7 @@ enum db_return_codes db_get_dimm_fw_debug_logs_by_dimm_topology_device_handle_hi
 			local_get_dimm_fw_debug_log_relationships(p_ps, p_stmt, &p_dimm_fw_debug_log[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -18352,14 +18880,14 @@ enum db_return_codes db_delete_dimm_fw_debug_log_by_dimm_topology_device_handle(
 	char *sql = "DELETE FROM dimm_fw_debug_log \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -18450,7 +18978,7 @@ enum db_return_codes db_add_dimm_memory_info_page0(const PersistentStore *p_ps,
 		$block_read_reqs, \
 		$block_write_reqs) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_memory_info_page0(p_stmt, p_dimm_memory_info_page0);
 		sql_rc = sqlite3_step(p_stmt);
@@ -18458,7 +18986,7 @@ enum db_return_codes db_add_dimm_memory_info_page0(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -18496,7 +19024,7 @@ int db_get_dimm_memory_info_page0s(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_memory_info_page0_count)
@@ -18505,7 +19033,7 @@ int db_get_dimm_memory_info_page0s(const PersistentStore *p_ps,
 			local_get_dimm_memory_info_page0_relationships(p_ps, p_stmt, &p_dimm_memory_info_page0[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -18553,11 +19081,11 @@ enum db_return_codes db_save_dimm_memory_info_page0_state(const PersistentStore
 			$block_read_reqs, \
 			$block_write_reqs) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_memory_info_page0(p_stmt, p_dimm_memory_info_page0);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -18588,7 +19116,7 @@ enum db_return_codes db_save_dimm_memory_info_page0_state(const PersistentStore
 				 $block_read_reqs , \
 				 $block_write_reqs )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_memory_info_page0(p_stmt, p_dimm_memory_info_page0);
@@ -18597,7 +19125,7 @@ enum db_return_codes db_save_dimm_memory_info_page0_state(const PersistentStore
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -18626,7 +19154,7 @@ enum db_return_codes db_get_dimm_memory_info_page0_by_device_handle(const Persis
 		FROM dimm_memory_info_page0 \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -18636,7 +19164,7 @@ enum db_return_codes db_get_dimm_memory_info_page0_by_device_handle(const Persis
 			local_get_dimm_memory_info_page0_relationships(p_ps, p_stmt, p_dimm_memory_info_page0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18669,12 +19197,12 @@ enum db_return_codes db_update_dimm_memory_info_page0_by_device_handle(const Per
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_memory_info_page0(p_stmt, p_dimm_memory_info_page0);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18696,14 +19224,14 @@ enum db_return_codes db_delete_dimm_memory_info_page0_by_device_handle(const Per
 	char *sql = "DELETE FROM dimm_memory_info_page0 \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -18793,7 +19321,7 @@ int db_get_dimm_memory_info_page0_history_by_history_id(const PersistentStore *p
 		device_handle,  bytes_read,  bytes_written,  read_reqs,  write_reqs,  block_read_reqs,  block_write_reqs  \
 		FROM dimm_memory_info_page0_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -18804,7 +19332,7 @@ int db_get_dimm_memory_info_page0_history_by_history_id(const PersistentStore *p
 			local_get_dimm_memory_info_page0_relationships_history(p_ps, p_stmt, &p_dimm_memory_info_page0[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -18901,7 +19429,7 @@ enum db_return_codes db_add_dimm_memory_info_page1(const PersistentStore *p_ps,
 		$total_block_read_reqs, \
 		$total_block_write_reqs) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_memory_info_page1(p_stmt, p_dimm_memory_info_page1);
 		sql_rc = sqlite3_step(p_stmt);
@@ -18909,7 +19437,7 @@ enum db_return_codes db_add_dimm_memory_info_page1(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -18947,7 +19475,7 @@ int db_get_dimm_memory_info_page1s(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_memory_info_page1_count)
@@ -18956,7 +19484,7 @@ int db_get_dimm_memory_info_page1s(const PersistentStore *p_ps,
 			local_get_dimm_memory_info_page1_relationships(p_ps, p_stmt, &p_dimm_memory_info_page1[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -19004,11 +19532,11 @@ enum db_return_codes db_save_dimm_memory_info_page1_state(const PersistentStore
 			$total_block_read_reqs, \
 			$total_block_write_reqs) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_memory_info_page1(p_stmt, p_dimm_memory_info_page1);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -19039,7 +19567,7 @@ enum db_return_codes db_save_dimm_memory_info_page1_state(const PersistentStore
 				 $total_block_read_reqs , \
 				 $total_block_write_reqs )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_memory_info_page1(p_stmt, p_dimm_memory_info_page1);
@@ -19048,7 +19576,7 @@ enum db_return_codes db_save_dimm_memory_info_page1_state(const PersistentStore
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -19077,7 +19605,7 @@ enum db_return_codes db_get_dimm_memory_info_page1_by_device_handle(const Persis
 		FROM dimm_memory_info_page1 \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -19087,7 +19615,7 @@ enum db_return_codes db_get_dimm_memory_info_page1_by_device_handle(const Persis
 			local_get_dimm_memory_info_page1_relationships(p_ps, p_stmt, p_dimm_memory_info_page1);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -19120,12 +19648,12 @@ enum db_return_codes db_update_dimm_memory_info_page1_by_device_handle(const Per
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_memory_info_page1(p_stmt, p_dimm_memory_info_page1);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -19147,14 +19675,14 @@ enum db_return_codes db_delete_dimm_memory_info_page1_by_device_handle(const Per
 	char *sql = "DELETE FROM dimm_memory_info_page1 \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -19244,7 +19772,7 @@ int db_get_dimm_memory_info_page1_history_by_history_id(const PersistentStore *p
 		device_handle,  total_bytes_read,  total_bytes_written,  total_read_reqs,  total_write_reqs,  total_block_read_reqs,  total_block_write_reqs  \
 		FROM dimm_memory_info_page1_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -19255,7 +19783,7 @@ int db_get_dimm_memory_info_page1_history_by_history_id(const PersistentStore *p
 			local_get_dimm_memory_info_page1_relationships_history(p_ps, p_stmt, &p_dimm_memory_info_page1[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -19412,7 +19940,7 @@ enum db_return_codes db_add_dimm_ars_command_specific_data(const PersistentStore
 		$dpa_error_address_12, \
 		$dpa_error_address_13) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_ars_command_specific_data(p_stmt, p_dimm_ars_command_specific_data);
 		sql_rc = sqlite3_step(p_stmt);
@@ -19420,7 +19948,7 @@ enum db_return_codes db_add_dimm_ars_command_specific_data(const PersistentStore
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -19468,7 +19996,7 @@ int db_get_dimm_ars_command_specific_datas(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_ars_command_specific_data_count)
@@ -19477,7 +20005,7 @@ int db_get_dimm_ars_command_specific_datas(const PersistentStore *p_ps,
 			local_get_dimm_ars_command_specific_data_relationships(p_ps, p_stmt, &p_dimm_ars_command_specific_data[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -19535,11 +20063,11 @@ enum db_return_codes db_save_dimm_ars_command_specific_data_state(const Persiste
 			$dpa_error_address_12, \
 			$dpa_error_address_13) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_ars_command_specific_data(p_stmt, p_dimm_ars_command_specific_data);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -19580,7 +20108,7 @@ enum db_return_codes db_save_dimm_ars_command_specific_data_state(const Persiste
 				 $dpa_error_address_12 , \
 				 $dpa_error_address_13 )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_ars_command_specific_data(p_stmt, p_dimm_ars_command_specific_data);
@@ -19589,7 +20117,7 @@ enum db_return_codes db_save_dimm_ars_command_specific_data_state(const Persiste
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -19618,7 +20146,7 @@ enum db_return_codes db_get_dimm_ars_command_specific_data_by_device_handle(cons
 		FROM dimm_ars_command_specific_data \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -19628,7 +20156,7 @@ enum db_return_codes db_get_dimm_ars_command_specific_data_by_device_handle(cons
 			local_get_dimm_ars_command_specific_data_relationships(p_ps, p_stmt, p_dimm_ars_command_specific_data);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -19671,12 +20199,12 @@ enum db_return_codes db_update_dimm_ars_command_specific_data_by_device_handle(c
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_ars_command_specific_data(p_stmt, p_dimm_ars_command_specific_data);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -19698,14 +20226,14 @@ enum db_return_codes db_delete_dimm_ars_command_specific_data_by_device_handle(c
 	char *sql = "DELETE FROM dimm_ars_command_specific_data \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -19795,7 +20323,7 @@ int db_get_dimm_ars_command_specific_data_history_by_history_id(const Persistent
 		device_handle,  num_errors,  ars_state,  dpa_error_address_0,  dpa_error_address_1,  dpa_error_address_2,  dpa_error_address_3,  dpa_error_address_4,  dpa_error_address_5,  dpa_error_address_6,  dpa_error_address_7,  dpa_error_address_8,  dpa_error_address_9,  dpa_error_address_10,  dpa_error_address_11,  dpa_error_address_12,  dpa_error_address_13  \
 		FROM dimm_ars_command_specific_data_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -19806,7 +20334,7 @@ int db_get_dimm_ars_command_specific_data_history_by_history_id(const Persistent
 			local_get_dimm_ars_command_specific_data_relationships_history(p_ps, p_stmt, &p_dimm_ars_command_specific_data[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -19897,7 +20425,7 @@ enum db_return_codes db_add_dimm_long_op_status(const PersistentStore *p_ps,
 		$etc, \
 		$status_code) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_long_op_status(p_stmt, p_dimm_long_op_status);
 		sql_rc = sqlite3_step(p_stmt);
@@ -19905,7 +20433,7 @@ enum db_return_codes db_add_dimm_long_op_status(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -19942,7 +20470,7 @@ int db_get_dimm_long_op_statuss(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_long_op_status_count)
@@ -19951,7 +20479,7 @@ int db_get_dimm_long_op_statuss(const PersistentStore *p_ps,
 			local_get_dimm_long_op_status_relationships(p_ps, p_stmt, &p_dimm_long_op_status[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -19998,11 +20526,11 @@ enum db_return_codes db_save_dimm_long_op_status_state(const PersistentStore *p_
 			$etc, \
 			$status_code) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_long_op_status(p_stmt, p_dimm_long_op_status);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -20032,7 +20560,7 @@ enum db_return_codes db_save_dimm_long_op_status_state(const PersistentStore *p_
 				 $etc , \
 				 $status_code )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_long_op_status(p_stmt, p_dimm_long_op_status);
@@ -20041,7 +20569,7 @@ enum db_return_codes db_save_dimm_long_op_status_state(const PersistentStore *p_
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -20070,7 +20598,7 @@ enum db_return_codes db_get_dimm_long_op_status_by_device_handle(const Persisten
 		FROM dimm_long_op_status \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -20080,7 +20608,7 @@ enum db_return_codes db_get_dimm_long_op_status_by_device_handle(const Persisten
 			local_get_dimm_long_op_status_relationships(p_ps, p_stmt, p_dimm_long_op_status);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -20112,12 +20640,12 @@ enum db_return_codes db_update_dimm_long_op_status_by_device_handle(const Persis
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_long_op_status(p_stmt, p_dimm_long_op_status);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -20139,14 +20667,14 @@ enum db_return_codes db_delete_dimm_long_op_status_by_device_handle(const Persis
 	char *sql = "DELETE FROM dimm_long_op_status \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -20236,7 +20764,7 @@ int db_get_dimm_long_op_status_history_by_history_id(const PersistentStore *p_ps
 		device_handle,  opcode,  subopcode,  percent_complete,  etc,  status_code  \
 		FROM dimm_long_op_status_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -20247,7 +20775,7 @@ int db_get_dimm_long_op_status_history_by_history_id(const PersistentStore *p_ps
 			local_get_dimm_long_op_status_relationships_history(p_ps, p_stmt, &p_dimm_long_op_status[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -20384,7 +20912,7 @@ enum db_return_codes db_add_dimm_details(const PersistentStore *p_ps,
 		$type_detail, \
 		$id) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_details(p_stmt, p_dimm_details);
 		sql_rc = sqlite3_step(p_stmt);
@@ -20392,7 +20920,7 @@ enum db_return_codes db_add_dimm_details(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -20436,7 +20964,7 @@ int db_get_dimm_detailss(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_details_count)
@@ -20445,7 +20973,7 @@ int db_get_dimm_detailss(const PersistentStore *p_ps,
 			local_get_dimm_details_relationships(p_ps, p_stmt, &p_dimm_details[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -20499,11 +21027,11 @@ enum db_return_codes db_save_dimm_details_state(const PersistentStore *p_ps,
 			$type_detail, \
 			$id) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_details(p_stmt, p_dimm_details);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -20540,7 +21068,7 @@ enum db_return_codes db_save_dimm_details_state(const PersistentStore *p_ps,
 				 $type_detail , \
 				 $id )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_details(p_stmt, p_dimm_details);
@@ -20549,7 +21077,7 @@ enum db_return_codes db_save_dimm_details_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -20578,7 +21106,7 @@ enum db_return_codes db_get_dimm_details_by_id(const PersistentStore *p_ps,
 		FROM dimm_details \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (unsigned int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -20588,7 +21116,7 @@ enum db_return_codes db_get_dimm_details_by_id(const PersistentStore *p_ps,
 			local_get_dimm_details_relationships(p_ps, p_stmt, p_dimm_details);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -20627,12 +21155,12 @@ enum db_return_codes db_update_dimm_details_by_id(const PersistentStore *p_ps,
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (unsigned int)id);
 		local_bind_dimm_details(p_stmt, p_dimm_details);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -20654,14 +21182,14 @@ enum db_return_codes db_delete_dimm_details_by_id(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM dimm_details \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (unsigned int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -20751,7 +21279,7 @@ int db_get_dimm_details_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  form_factor,  data_width,  total_width,  size,  speed,  part_number,  device_locator,  bank_label,  manufacturer,  type,  type_detail,  id  \
 		FROM dimm_details_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -20762,7 +21290,7 @@ int db_get_dimm_details_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_details_relationships_history(p_ps, p_stmt, &p_dimm_details[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -20829,7 +21357,7 @@ enum db_return_codes db_add_dimm_security_info(const PersistentStore *p_ps,
 		($device_handle, \
 		$security_state) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_security_info(p_stmt, p_dimm_security_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -20837,7 +21365,7 @@ enum db_return_codes db_add_dimm_security_info(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -20870,7 +21398,7 @@ int db_get_dimm_security_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_security_info_count)
@@ -20879,7 +21407,7 @@ int db_get_dimm_security_infos(const PersistentStore *p_ps,
 			local_get_dimm_security_info_relationships(p_ps, p_stmt, &p_dimm_security_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -20922,11 +21450,11 @@ enum db_return_codes db_save_dimm_security_info_state(const PersistentStore *p_p
 			($device_handle, \
 			$security_state) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_security_info(p_stmt, p_dimm_security_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -20952,7 +21480,7 @@ enum db_return_codes db_save_dimm_security_info_state(const PersistentStore *p_p
 				 $device_handle , \
 				 $security_state )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_security_info(p_stmt, p_dimm_security_info);
@@ -20961,7 +21489,7 @@ enum db_return_codes db_save_dimm_security_info_state(const PersistentStore *p_p
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -20990,7 +21518,7 @@ enum db_return_codes db_get_dimm_security_info_by_device_handle(const Persistent
 		FROM dimm_security_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -21000,7 +21528,7 @@ enum db_return_codes db_get_dimm_security_info_by_device_handle(const Persistent
 			local_get_dimm_security_info_relationships(p_ps, p_stmt, p_dimm_security_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21028,12 +21556,12 @@ enum db_return_codes db_update_dimm_security_info_by_device_handle(const Persist
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_security_info(p_stmt, p_dimm_security_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21055,14 +21583,14 @@ enum db_return_codes db_delete_dimm_security_info_by_device_handle(const Persist
 	char *sql = "DELETE FROM dimm_security_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21152,7 +21680,7 @@ int db_get_dimm_security_info_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  security_state  \
 		FROM dimm_security_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -21163,7 +21691,7 @@ int db_get_dimm_security_info_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_security_info_relationships_history(p_ps, p_stmt, &p_dimm_security_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -21236,7 +21764,7 @@ enum db_return_codes db_add_dimm_sanitize_info(const PersistentStore *p_ps,
 		$sanitize_state, \
 		$sanitize_progress) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_sanitize_info(p_stmt, p_dimm_sanitize_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -21244,7 +21772,7 @@ enum db_return_codes db_add_dimm_sanitize_info(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -21278,7 +21806,7 @@ int db_get_dimm_sanitize_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_sanitize_info_count)
@@ -21287,7 +21815,7 @@ int db_get_dimm_sanitize_infos(const PersistentStore *p_ps,
 			local_get_dimm_sanitize_info_relationships(p_ps, p_stmt, &p_dimm_sanitize_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -21331,11 +21859,11 @@ enum db_return_codes db_save_dimm_sanitize_info_state(const PersistentStore *p_p
 			$sanitize_state, \
 			$sanitize_progress) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_sanitize_info(p_stmt, p_dimm_sanitize_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -21362,7 +21890,7 @@ enum db_return_codes db_save_dimm_sanitize_info_state(const PersistentStore *p_p
 				 $sanitize_state , \
 				 $sanitize_progress )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_sanitize_info(p_stmt, p_dimm_sanitize_info);
@@ -21371,7 +21899,7 @@ enum db_return_codes db_save_dimm_sanitize_info_state(const PersistentStore *p_p
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -21400,7 +21928,7 @@ enum db_return_codes db_get_dimm_sanitize_info_by_device_handle(const Persistent
 		FROM dimm_sanitize_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -21410,7 +21938,7 @@ enum db_return_codes db_get_dimm_sanitize_info_by_device_handle(const Persistent
 			local_get_dimm_sanitize_info_relationships(p_ps, p_stmt, p_dimm_sanitize_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21439,12 +21967,12 @@ enum db_return_codes db_update_dimm_sanitize_info_by_device_handle(const Persist
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_sanitize_info(p_stmt, p_dimm_sanitize_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21466,14 +21994,14 @@ enum db_return_codes db_delete_dimm_sanitize_info_by_device_handle(const Persist
 	char *sql = "DELETE FROM dimm_sanitize_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21563,7 +22091,7 @@ int db_get_dimm_sanitize_info_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  sanitize_state,  sanitize_progress  \
 		FROM dimm_sanitize_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -21574,7 +22102,7 @@ int db_get_dimm_sanitize_info_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_sanitize_info_relationships_history(p_ps, p_stmt, &p_dimm_sanitize_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -21677,7 +22205,7 @@ enum db_return_codes db_add_fw_media_low_log_entry(const PersistentStore *p_ps,
 		$error_flags, \
 		$transaction_type) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_media_low_log_entry(p_stmt, p_fw_media_low_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
@@ -21685,7 +22213,7 @@ enum db_return_codes db_add_fw_media_low_log_entry(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -21724,7 +22252,7 @@ int db_get_fw_media_low_log_entrys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_media_low_log_entry_count)
@@ -21733,7 +22261,7 @@ int db_get_fw_media_low_log_entrys(const PersistentStore *p_ps,
 			local_get_fw_media_low_log_entry_relationships(p_ps, p_stmt, &p_fw_media_low_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -21782,11 +22310,11 @@ enum db_return_codes db_save_fw_media_low_log_entry_state(const PersistentStore
 			$error_flags, \
 			$transaction_type) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_media_low_log_entry(p_stmt, p_fw_media_low_log_entry);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -21818,7 +22346,7 @@ enum db_return_codes db_save_fw_media_low_log_entry_state(const PersistentStore
 				 $error_flags , \
 				 $transaction_type )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_media_low_log_entry(p_stmt, p_fw_media_low_log_entry);
@@ -21827,7 +22355,7 @@ enum db_return_codes db_save_fw_media_low_log_entry_state(const PersistentStore
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -21856,7 +22384,7 @@ enum db_return_codes db_get_fw_media_low_log_entry_by_system_timestamp(const Per
 		FROM fw_media_low_log_entry \
 		WHERE  system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		sql_rc = sqlite3_step(p_stmt);
@@ -21866,7 +22394,7 @@ enum db_return_codes db_get_fw_media_low_log_entry_by_system_timestamp(const Per
 			local_get_fw_media_low_log_entry_relationships(p_ps, p_stmt, p_fw_media_low_log_entry);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21900,12 +22428,12 @@ enum db_return_codes db_update_fw_media_low_log_entry_by_system_timestamp(const
 		  \
 	WHERE system_timestamp=$system_timestamp ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		local_bind_fw_media_low_log_entry(p_stmt, p_fw_media_low_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -21927,14 +22455,14 @@ enum db_return_codes db_delete_fw_media_low_log_entry_by_system_timestamp(const
 	char *sql = "DELETE FROM fw_media_low_log_entry \
 				 WHERE system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22024,7 +22552,7 @@ int db_get_fw_media_low_log_entry_history_by_history_id(const PersistentStore *p
 		device_handle,  system_timestamp,  dpa,  pda,  range,  error_type,  error_flags,  transaction_type  \
 		FROM fw_media_low_log_entry_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -22035,7 +22563,7 @@ int db_get_fw_media_low_log_entry_history_by_history_id(const PersistentStore *p
 			local_get_fw_media_low_log_entry_relationships_history(p_ps, p_stmt, &p_fw_media_low_log_entry[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -22064,7 +22592,7 @@ enum db_return_codes db_get_fw_media_low_log_entry_count_by_dimm_topology_device
 	const char *sql = "SELECT COUNT (*) FROM fw_media_low_log_entry WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -22072,7 +22600,7 @@ enum db_return_codes db_get_fw_media_low_log_entry_count_by_dimm_topology_device
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22099,7 +22627,7 @@ enum db_return_codes db_get_fw_media_low_log_entry_count_by_dimm_topology_device
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -22108,7 +22636,7 @@ enum db_return_codes db_get_fw_media_low_log_entry_count_by_dimm_topology_device
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22135,7 +22663,7 @@ enum db_return_codes db_get_fw_media_low_log_entrys_by_dimm_topology_device_hand
 		FROM fw_media_low_log_entry \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -22146,7 +22674,7 @@ enum db_return_codes db_get_fw_media_low_log_entrys_by_dimm_topology_device_hand
 			local_get_fw_media_low_log_entry_relationships(p_ps, p_stmt, &p_fw_media_low_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -22171,7 +22699,7 @@ enum db_return_codes db_get_fw_media_low_log_entrys_by_dimm_topology_device_hand
 		FROM fw_media_low_log_entry_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -22183,7 +22711,7 @@ enum db_return_codes db_get_fw_media_low_log_entrys_by_dimm_topology_device_hand
 			local_get_fw_media_low_log_entry_relationships(p_ps, p_stmt, &p_fw_media_low_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -22204,14 +22732,14 @@ enum db_return_codes db_delete_fw_media_low_log_entry_by_dimm_topology_device_ha
 	char *sql = "DELETE FROM fw_media_low_log_entry \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -22308,7 +22836,7 @@ enum db_return_codes db_add_fw_media_high_log_entry(const PersistentStore *p_ps,
 		$error_flags, \
 		$transaction_type) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_media_high_log_entry(p_stmt, p_fw_media_high_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
@@ -22316,7 +22844,7 @@ enum db_return_codes db_add_fw_media_high_log_entry(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -22355,7 +22883,7 @@ int db_get_fw_media_high_log_entrys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_media_high_log_entry_count)
@@ -22364,7 +22892,7 @@ int db_get_fw_media_high_log_entrys(const PersistentStore *p_ps,
 			local_get_fw_media_high_log_entry_relationships(p_ps, p_stmt, &p_fw_media_high_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -22413,11 +22941,11 @@ enum db_return_codes db_save_fw_media_high_log_entry_state(const PersistentStore
 			$error_flags, \
 			$transaction_type) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_media_high_log_entry(p_stmt, p_fw_media_high_log_entry);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -22449,7 +22977,7 @@ enum db_return_codes db_save_fw_media_high_log_entry_state(const PersistentStore
 				 $error_flags , \
 				 $transaction_type )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_media_high_log_entry(p_stmt, p_fw_media_high_log_entry);
@@ -22458,7 +22986,7 @@ enum db_return_codes db_save_fw_media_high_log_entry_state(const PersistentStore
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -22487,7 +23015,7 @@ enum db_return_codes db_get_fw_media_high_log_entry_by_system_timestamp(const Pe
 		FROM fw_media_high_log_entry \
 		WHERE  system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		sql_rc = sqlite3_step(p_stmt);
@@ -22497,7 +23025,7 @@ enum db_return_codes db_get_fw_media_high_log_entry_by_system_timestamp(const Pe
 			local_get_fw_media_high_log_entry_relationships(p_ps, p_stmt, p_fw_media_high_log_entry);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22531,12 +23059,12 @@ enum db_return_codes db_update_fw_media_high_log_entry_by_system_timestamp(const
 		  \
 	WHERE system_timestamp=$system_timestamp ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		local_bind_fw_media_high_log_entry(p_stmt, p_fw_media_high_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22558,14 +23086,14 @@ enum db_return_codes db_delete_fw_media_high_log_entry_by_system_timestamp(const
 	char *sql = "DELETE FROM fw_media_high_log_entry \
 				 WHERE system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22655,7 +23183,7 @@ int db_get_fw_media_high_log_entry_history_by_history_id(const PersistentStore *
 		device_handle,  system_timestamp,  dpa,  pda,  range,  error_type,  error_flags,  transaction_type  \
 		FROM fw_media_high_log_entry_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -22666,7 +23194,7 @@ int db_get_fw_media_high_log_entry_history_by_history_id(const PersistentStore *
 			local_get_fw_media_high_log_entry_relationships_history(p_ps, p_stmt, &p_fw_media_high_log_entry[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -22695,7 +23223,7 @@ enum db_return_codes db_get_fw_media_high_log_entry_count_by_dimm_topology_devic
 	const char *sql = "SELECT COUNT (*) FROM fw_media_high_log_entry WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -22703,7 +23231,7 @@ enum db_return_codes db_get_fw_media_high_log_entry_count_by_dimm_topology_devic
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22730,7 +23258,7 @@ enum db_return_codes db_get_fw_media_high_log_entry_count_by_dimm_topology_devic
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -22739,7 +23267,7 @@ enum db_return_codes db_get_fw_media_high_log_entry_count_by_dimm_topology_devic
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -22766,7 +23294,7 @@ enum db_return_codes db_get_fw_media_high_log_entrys_by_dimm_topology_device_han
 		FROM fw_media_high_log_entry \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -22777,7 +23305,7 @@ enum db_return_codes db_get_fw_media_high_log_entrys_by_dimm_topology_device_han
 			local_get_fw_media_high_log_entry_relationships(p_ps, p_stmt, &p_fw_media_high_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -22802,7 +23330,7 @@ enum db_return_codes db_get_fw_media_high_log_entrys_by_dimm_topology_device_han
 		FROM fw_media_high_log_entry_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -22814,7 +23342,7 @@ enum db_return_codes db_get_fw_media_high_log_entrys_by_dimm_topology_device_han
 			local_get_fw_media_high_log_entry_relationships(p_ps, p_stmt, &p_fw_media_high_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -22835,14 +23363,14 @@ enum db_return_codes db_delete_fw_media_high_log_entry_by_dimm_topology_device_h
 	char *sql = "DELETE FROM fw_media_high_log_entry \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -22915,7 +23443,7 @@ enum db_return_codes db_add_fw_thermal_low_log_entry(const PersistentStore *p_ps
 		$host_reported_temp_data, \
 		$seq_num) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_thermal_low_log_entry(p_stmt, p_fw_thermal_low_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
@@ -22923,7 +23451,7 @@ enum db_return_codes db_add_fw_thermal_low_log_entry(const PersistentStore *p_ps
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -22958,7 +23486,7 @@ int db_get_fw_thermal_low_log_entrys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_thermal_low_log_entry_count)
@@ -22967,7 +23495,7 @@ int db_get_fw_thermal_low_log_entrys(const PersistentStore *p_ps,
 			local_get_fw_thermal_low_log_entry_relationships(p_ps, p_stmt, &p_fw_thermal_low_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -23012,11 +23540,11 @@ enum db_return_codes db_save_fw_thermal_low_log_entry_state(const PersistentStor
 			$host_reported_temp_data, \
 			$seq_num) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_thermal_low_log_entry(p_stmt, p_fw_thermal_low_log_entry);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -23044,7 +23572,7 @@ enum db_return_codes db_save_fw_thermal_low_log_entry_state(const PersistentStor
 				 $host_reported_temp_data , \
 				 $seq_num )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_thermal_low_log_entry(p_stmt, p_fw_thermal_low_log_entry);
@@ -23053,7 +23581,7 @@ enum db_return_codes db_save_fw_thermal_low_log_entry_state(const PersistentStor
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -23082,7 +23610,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entry_by_system_timestamp(const P
 		FROM fw_thermal_low_log_entry \
 		WHERE  system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		sql_rc = sqlite3_step(p_stmt);
@@ -23092,7 +23620,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entry_by_system_timestamp(const P
 			local_get_fw_thermal_low_log_entry_relationships(p_ps, p_stmt, p_fw_thermal_low_log_entry);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23122,12 +23650,12 @@ enum db_return_codes db_update_fw_thermal_low_log_entry_by_system_timestamp(cons
 		  \
 	WHERE system_timestamp=$system_timestamp ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		local_bind_fw_thermal_low_log_entry(p_stmt, p_fw_thermal_low_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23149,14 +23677,14 @@ enum db_return_codes db_delete_fw_thermal_low_log_entry_by_system_timestamp(cons
 	char *sql = "DELETE FROM fw_thermal_low_log_entry \
 				 WHERE system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23246,7 +23774,7 @@ int db_get_fw_thermal_low_log_entry_history_by_history_id(const PersistentStore
 		device_handle,  system_timestamp,  host_reported_temp_data,  seq_num  \
 		FROM fw_thermal_low_log_entry_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -23257,7 +23785,7 @@ int db_get_fw_thermal_low_log_entry_history_by_history_id(const PersistentStore
 			local_get_fw_thermal_low_log_entry_relationships_history(p_ps, p_stmt, &p_fw_thermal_low_log_entry[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -23286,7 +23814,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entry_count_by_dimm_topology_devi
 	const char *sql = "SELECT COUNT (*) FROM fw_thermal_low_log_entry WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -23294,7 +23822,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entry_count_by_dimm_topology_devi
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23321,7 +23849,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entry_count_by_dimm_topology_devi
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -23330,7 +23858,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entry_count_by_dimm_topology_devi
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23357,7 +23885,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entrys_by_dimm_topology_device_ha
 		FROM fw_thermal_low_log_entry \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -23368,7 +23896,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entrys_by_dimm_topology_device_ha
 			local_get_fw_thermal_low_log_entry_relationships(p_ps, p_stmt, &p_fw_thermal_low_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -23393,7 +23921,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entrys_by_dimm_topology_device_ha
 		FROM fw_thermal_low_log_entry_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -23405,7 +23933,7 @@ enum db_return_codes db_get_fw_thermal_low_log_entrys_by_dimm_topology_device_ha
 			local_get_fw_thermal_low_log_entry_relationships(p_ps, p_stmt, &p_fw_thermal_low_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -23426,14 +23954,14 @@ enum db_return_codes db_delete_fw_thermal_low_log_entry_by_dimm_topology_device_
 	char *sql = "DELETE FROM fw_thermal_low_log_entry \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -23500,7 +24028,7 @@ enum db_return_codes db_add_fw_thermal_high_log_entry(const PersistentStore *p_p
 		$system_timestamp, \
 		$host_reported_temp_data) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_thermal_high_log_entry(p_stmt, p_fw_thermal_high_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
@@ -23508,7 +24036,7 @@ enum db_return_codes db_add_fw_thermal_high_log_entry(const PersistentStore *p_p
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -23542,7 +24070,7 @@ int db_get_fw_thermal_high_log_entrys(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_thermal_high_log_entry_count)
@@ -23551,7 +24079,7 @@ int db_get_fw_thermal_high_log_entrys(const PersistentStore *p_ps,
 			local_get_fw_thermal_high_log_entry_relationships(p_ps, p_stmt, &p_fw_thermal_high_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -23595,11 +24123,11 @@ enum db_return_codes db_save_fw_thermal_high_log_entry_state(const PersistentSto
 			$system_timestamp, \
 			$host_reported_temp_data) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_thermal_high_log_entry(p_stmt, p_fw_thermal_high_log_entry);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -23626,7 +24154,7 @@ enum db_return_codes db_save_fw_thermal_high_log_entry_state(const PersistentSto
 				 $system_timestamp , \
 				 $host_reported_temp_data )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_thermal_high_log_entry(p_stmt, p_fw_thermal_high_log_entry);
@@ -23635,7 +24163,7 @@ enum db_return_codes db_save_fw_thermal_high_log_entry_state(const PersistentSto
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -23664,7 +24192,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entry_by_system_timestamp(const
 		FROM fw_thermal_high_log_entry \
 		WHERE  system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		sql_rc = sqlite3_step(p_stmt);
@@ -23674,7 +24202,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entry_by_system_timestamp(const
 			local_get_fw_thermal_high_log_entry_relationships(p_ps, p_stmt, p_fw_thermal_high_log_entry);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23703,12 +24231,12 @@ enum db_return_codes db_update_fw_thermal_high_log_entry_by_system_timestamp(con
 		  \
 	WHERE system_timestamp=$system_timestamp ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		local_bind_fw_thermal_high_log_entry(p_stmt, p_fw_thermal_high_log_entry);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23730,14 +24258,14 @@ enum db_return_codes db_delete_fw_thermal_high_log_entry_by_system_timestamp(con
 	char *sql = "DELETE FROM fw_thermal_high_log_entry \
 				 WHERE system_timestamp = $system_timestamp";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$system_timestamp", (unsigned long long)system_timestamp);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23827,7 +24355,7 @@ int db_get_fw_thermal_high_log_entry_history_by_history_id(const PersistentStore
 		device_handle,  system_timestamp,  host_reported_temp_data  \
 		FROM fw_thermal_high_log_entry_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -23838,7 +24366,7 @@ int db_get_fw_thermal_high_log_entry_history_by_history_id(const PersistentStore
 			local_get_fw_thermal_high_log_entry_relationships_history(p_ps, p_stmt, &p_fw_thermal_high_log_entry[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -23867,7 +24395,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entry_count_by_dimm_topology_dev
 	const char *sql = "SELECT COUNT (*) FROM fw_thermal_high_log_entry WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -23875,7 +24403,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entry_count_by_dimm_topology_dev
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23902,7 +24430,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entry_count_by_dimm_topology_dev
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -23911,7 +24439,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entry_count_by_dimm_topology_dev
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -23938,7 +24466,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entrys_by_dimm_topology_device_h
 		FROM fw_thermal_high_log_entry \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -23949,7 +24477,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entrys_by_dimm_topology_device_h
 			local_get_fw_thermal_high_log_entry_relationships(p_ps, p_stmt, &p_fw_thermal_high_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -23974,7 +24502,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entrys_by_dimm_topology_device_h
 		FROM fw_thermal_high_log_entry_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -23986,7 +24514,7 @@ enum db_return_codes db_get_fw_thermal_high_log_entrys_by_dimm_topology_device_h
 			local_get_fw_thermal_high_log_entry_relationships(p_ps, p_stmt, &p_fw_thermal_high_log_entry[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -24007,14 +24535,14 @@ enum db_return_codes db_delete_fw_thermal_high_log_entry_by_dimm_topology_device
 	char *sql = "DELETE FROM fw_thermal_high_log_entry \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -24099,7 +24627,7 @@ enum db_return_codes db_add_fw_media_low_log_info(const PersistentStore *p_ps,
 		$newest_log_entry_timestamp, \
 		$oldest_log_entry_timestamp) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_media_low_log_info(p_stmt, p_fw_media_low_log_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -24107,7 +24635,7 @@ enum db_return_codes db_add_fw_media_low_log_info(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -24144,7 +24672,7 @@ int db_get_fw_media_low_log_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_media_low_log_info_count)
@@ -24153,7 +24681,7 @@ int db_get_fw_media_low_log_infos(const PersistentStore *p_ps,
 			local_get_fw_media_low_log_info_relationships(p_ps, p_stmt, &p_fw_media_low_log_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -24200,11 +24728,11 @@ enum db_return_codes db_save_fw_media_low_log_info_state(const PersistentStore *
 			$newest_log_entry_timestamp, \
 			$oldest_log_entry_timestamp) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_media_low_log_info(p_stmt, p_fw_media_low_log_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -24234,7 +24762,7 @@ enum db_return_codes db_save_fw_media_low_log_info_state(const PersistentStore *
 				 $newest_log_entry_timestamp , \
 				 $oldest_log_entry_timestamp )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_media_low_log_info(p_stmt, p_fw_media_low_log_info);
@@ -24243,7 +24771,7 @@ enum db_return_codes db_save_fw_media_low_log_info_state(const PersistentStore *
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -24272,7 +24800,7 @@ enum db_return_codes db_get_fw_media_low_log_info_by_device_handle(const Persist
 		FROM fw_media_low_log_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -24282,7 +24810,7 @@ enum db_return_codes db_get_fw_media_low_log_info_by_device_handle(const Persist
 			local_get_fw_media_low_log_info_relationships(p_ps, p_stmt, p_fw_media_low_log_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -24314,12 +24842,12 @@ enum db_return_codes db_update_fw_media_low_log_info_by_device_handle(const Pers
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_fw_media_low_log_info(p_stmt, p_fw_media_low_log_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -24341,14 +24869,14 @@ enum db_return_codes db_delete_fw_media_low_log_info_by_device_handle(const Pers
 	char *sql = "DELETE FROM fw_media_low_log_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -24438,7 +24966,7 @@ int db_get_fw_media_low_log_info_history_by_history_id(const PersistentStore *p_
 		device_handle,  max_log_entries,  current_sequence_number,  oldest_sequence_number,  newest_log_entry_timestamp,  oldest_log_entry_timestamp  \
 		FROM fw_media_low_log_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -24449,7 +24977,7 @@ int db_get_fw_media_low_log_info_history_by_history_id(const PersistentStore *p_
 			local_get_fw_media_low_log_info_relationships_history(p_ps, p_stmt, &p_fw_media_low_log_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -24540,7 +25068,7 @@ enum db_return_codes db_add_fw_media_high_log_info(const PersistentStore *p_ps,
 		$newest_log_entry_timestamp, \
 		$oldest_log_entry_timestamp) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_media_high_log_info(p_stmt, p_fw_media_high_log_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -24548,7 +25076,7 @@ enum db_return_codes db_add_fw_media_high_log_info(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -24585,7 +25113,7 @@ int db_get_fw_media_high_log_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_media_high_log_info_count)
@@ -24594,7 +25122,7 @@ int db_get_fw_media_high_log_infos(const PersistentStore *p_ps,
 			local_get_fw_media_high_log_info_relationships(p_ps, p_stmt, &p_fw_media_high_log_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -24641,11 +25169,11 @@ enum db_return_codes db_save_fw_media_high_log_info_state(const PersistentStore
 			$newest_log_entry_timestamp, \
 			$oldest_log_entry_timestamp) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_media_high_log_info(p_stmt, p_fw_media_high_log_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -24675,7 +25203,7 @@ enum db_return_codes db_save_fw_media_high_log_info_state(const PersistentStore
 				 $newest_log_entry_timestamp , \
 				 $oldest_log_entry_timestamp )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_media_high_log_info(p_stmt, p_fw_media_high_log_info);
@@ -24684,7 +25212,7 @@ enum db_return_codes db_save_fw_media_high_log_info_state(const PersistentStore
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -24713,7 +25241,7 @@ enum db_return_codes db_get_fw_media_high_log_info_by_device_handle(const Persis
 		FROM fw_media_high_log_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -24723,7 +25251,7 @@ enum db_return_codes db_get_fw_media_high_log_info_by_device_handle(const Persis
 			local_get_fw_media_high_log_info_relationships(p_ps, p_stmt, p_fw_media_high_log_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -24755,12 +25283,12 @@ enum db_return_codes db_update_fw_media_high_log_info_by_device_handle(const Per
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_fw_media_high_log_info(p_stmt, p_fw_media_high_log_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -24782,14 +25310,14 @@ enum db_return_codes db_delete_fw_media_high_log_info_by_device_handle(const Per
 	char *sql = "DELETE FROM fw_media_high_log_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -24879,7 +25407,7 @@ int db_get_fw_media_high_log_info_history_by_history_id(const PersistentStore *p
 		device_handle,  max_log_entries,  current_sequence_number,  oldest_sequence_number,  newest_log_entry_timestamp,  oldest_log_entry_timestamp  \
 		FROM fw_media_high_log_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -24890,7 +25418,7 @@ int db_get_fw_media_high_log_info_history_by_history_id(const PersistentStore *p
 			local_get_fw_media_high_log_info_relationships_history(p_ps, p_stmt, &p_fw_media_high_log_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -24981,7 +25509,7 @@ enum db_return_codes db_add_fw_thermal_low_log_info(const PersistentStore *p_ps,
 		$newest_log_entry_timestamp, \
 		$oldest_log_entry_timestamp) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_thermal_low_log_info(p_stmt, p_fw_thermal_low_log_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -24989,7 +25517,7 @@ enum db_return_codes db_add_fw_thermal_low_log_info(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -25026,7 +25554,7 @@ int db_get_fw_thermal_low_log_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_thermal_low_log_info_count)
@@ -25035,7 +25563,7 @@ int db_get_fw_thermal_low_log_infos(const PersistentStore *p_ps,
 			local_get_fw_thermal_low_log_info_relationships(p_ps, p_stmt, &p_fw_thermal_low_log_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -25082,11 +25610,11 @@ enum db_return_codes db_save_fw_thermal_low_log_info_state(const PersistentStore
 			$newest_log_entry_timestamp, \
 			$oldest_log_entry_timestamp) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_thermal_low_log_info(p_stmt, p_fw_thermal_low_log_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -25116,7 +25644,7 @@ enum db_return_codes db_save_fw_thermal_low_log_info_state(const PersistentStore
 				 $newest_log_entry_timestamp , \
 				 $oldest_log_entry_timestamp )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_thermal_low_log_info(p_stmt, p_fw_thermal_low_log_info);
@@ -25125,7 +25653,7 @@ enum db_return_codes db_save_fw_thermal_low_log_info_state(const PersistentStore
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -25154,7 +25682,7 @@ enum db_return_codes db_get_fw_thermal_low_log_info_by_device_handle(const Persi
 		FROM fw_thermal_low_log_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -25164,7 +25692,7 @@ enum db_return_codes db_get_fw_thermal_low_log_info_by_device_handle(const Persi
 			local_get_fw_thermal_low_log_info_relationships(p_ps, p_stmt, p_fw_thermal_low_log_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -25196,12 +25724,12 @@ enum db_return_codes db_update_fw_thermal_low_log_info_by_device_handle(const Pe
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_fw_thermal_low_log_info(p_stmt, p_fw_thermal_low_log_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -25223,14 +25751,14 @@ enum db_return_codes db_delete_fw_thermal_low_log_info_by_device_handle(const Pe
 	char *sql = "DELETE FROM fw_thermal_low_log_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -25320,7 +25848,7 @@ int db_get_fw_thermal_low_log_info_history_by_history_id(const PersistentStore *
 		device_handle,  max_log_entries,  current_sequence_number,  oldest_sequence_number,  newest_log_entry_timestamp,  oldest_log_entry_timestamp  \
 		FROM fw_thermal_low_log_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -25331,7 +25859,7 @@ int db_get_fw_thermal_low_log_info_history_by_history_id(const PersistentStore *
 			local_get_fw_thermal_low_log_info_relationships_history(p_ps, p_stmt, &p_fw_thermal_low_log_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -25422,7 +25950,7 @@ enum db_return_codes db_add_fw_thermal_high_log_info(const PersistentStore *p_ps
 		$newest_log_entry_timestamp, \
 		$oldest_log_entry_timestamp) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_fw_thermal_high_log_info(p_stmt, p_fw_thermal_high_log_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -25430,7 +25958,7 @@ enum db_return_codes db_add_fw_thermal_high_log_info(const PersistentStore *p_ps
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -25467,7 +25995,7 @@ int db_get_fw_thermal_high_log_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < fw_thermal_high_log_info_count)
@@ -25476,7 +26004,7 @@ int db_get_fw_thermal_high_log_infos(const PersistentStore *p_ps,
 			local_get_fw_thermal_high_log_info_relationships(p_ps, p_stmt, &p_fw_thermal_high_log_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -25523,11 +26051,11 @@ enum db_return_codes db_save_fw_thermal_high_log_info_state(const PersistentStor
 			$newest_log_entry_timestamp, \
 			$oldest_log_entry_timestamp) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_fw_thermal_high_log_info(p_stmt, p_fw_thermal_high_log_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -25557,7 +26085,7 @@ enum db_return_codes db_save_fw_thermal_high_log_info_state(const PersistentStor
 				 $newest_log_entry_timestamp , \
 				 $oldest_log_entry_timestamp )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_fw_thermal_high_log_info(p_stmt, p_fw_thermal_high_log_info);
@@ -25566,7 +26094,7 @@ enum db_return_codes db_save_fw_thermal_high_log_info_state(const PersistentStor
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -25595,7 +26123,7 @@ enum db_return_codes db_get_fw_thermal_high_log_info_by_device_handle(const Pers
 		FROM fw_thermal_high_log_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -25605,7 +26133,7 @@ enum db_return_codes db_get_fw_thermal_high_log_info_by_device_handle(const Pers
 			local_get_fw_thermal_high_log_info_relationships(p_ps, p_stmt, p_fw_thermal_high_log_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -25637,12 +26165,12 @@ enum db_return_codes db_update_fw_thermal_high_log_info_by_device_handle(const P
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_fw_thermal_high_log_info(p_stmt, p_fw_thermal_high_log_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -25664,14 +26192,14 @@ enum db_return_codes db_delete_fw_thermal_high_log_info_by_device_handle(const P
 	char *sql = "DELETE FROM fw_thermal_high_log_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -25761,7 +26289,7 @@ int db_get_fw_thermal_high_log_info_history_by_history_id(const PersistentStore
 		device_handle,  max_log_entries,  current_sequence_number,  oldest_sequence_number,  newest_log_entry_timestamp,  oldest_log_entry_timestamp  \
 		FROM fw_thermal_high_log_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -25772,7 +26300,7 @@ int db_get_fw_thermal_high_log_info_history_by_history_id(const PersistentStore
 			local_get_fw_thermal_high_log_info_relationships_history(p_ps, p_stmt, &p_fw_thermal_high_log_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -25839,7 +26367,7 @@ enum db_return_codes db_add_dimm_fw_log_level(const PersistentStore *p_ps,
 		($device_handle, \
 		$log_level) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_fw_log_level(p_stmt, p_dimm_fw_log_level);
 		sql_rc = sqlite3_step(p_stmt);
@@ -25847,7 +26375,7 @@ enum db_return_codes db_add_dimm_fw_log_level(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -25880,7 +26408,7 @@ int db_get_dimm_fw_log_levels(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_fw_log_level_count)
@@ -25889,7 +26417,7 @@ int db_get_dimm_fw_log_levels(const PersistentStore *p_ps,
 			local_get_dimm_fw_log_level_relationships(p_ps, p_stmt, &p_dimm_fw_log_level[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -25932,11 +26460,11 @@ enum db_return_codes db_save_dimm_fw_log_level_state(const PersistentStore *p_ps
 			($device_handle, \
 			$log_level) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_fw_log_level(p_stmt, p_dimm_fw_log_level);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -25962,7 +26490,7 @@ enum db_return_codes db_save_dimm_fw_log_level_state(const PersistentStore *p_ps
 				 $device_handle , \
 				 $log_level )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_fw_log_level(p_stmt, p_dimm_fw_log_level);
@@ -25971,7 +26499,7 @@ enum db_return_codes db_save_dimm_fw_log_level_state(const PersistentStore *p_ps
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -26000,7 +26528,7 @@ enum db_return_codes db_get_dimm_fw_log_level_by_device_handle(const PersistentS
 		FROM dimm_fw_log_level \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -26010,7 +26538,7 @@ enum db_return_codes db_get_dimm_fw_log_level_by_device_handle(const PersistentS
 			local_get_dimm_fw_log_level_relationships(p_ps, p_stmt, p_dimm_fw_log_level);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -26038,12 +26566,12 @@ enum db_return_codes db_update_dimm_fw_log_level_by_device_handle(const Persiste
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (int)device_handle);
 		local_bind_dimm_fw_log_level(p_stmt, p_dimm_fw_log_level);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -26065,14 +26593,14 @@ enum db_return_codes db_delete_dimm_fw_log_level_by_device_handle(const Persiste
 	char *sql = "DELETE FROM dimm_fw_log_level \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -26162,7 +26690,7 @@ int db_get_dimm_fw_log_level_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  log_level  \
 		FROM dimm_fw_log_level_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -26173,7 +26701,7 @@ int db_get_dimm_fw_log_level_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_fw_log_level_relationships_history(p_ps, p_stmt, &p_dimm_fw_log_level[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -26240,7 +26768,7 @@ enum db_return_codes db_add_dimm_fw_time(const PersistentStore *p_ps,
 		($device_handle, \
 		$time) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_fw_time(p_stmt, p_dimm_fw_time);
 		sql_rc = sqlite3_step(p_stmt);
@@ -26248,7 +26776,7 @@ enum db_return_codes db_add_dimm_fw_time(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -26281,7 +26809,7 @@ int db_get_dimm_fw_times(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_fw_time_count)
@@ -26290,7 +26818,7 @@ int db_get_dimm_fw_times(const PersistentStore *p_ps,
 			local_get_dimm_fw_time_relationships(p_ps, p_stmt, &p_dimm_fw_time[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -26333,11 +26861,11 @@ enum db_return_codes db_save_dimm_fw_time_state(const PersistentStore *p_ps,
 			($device_handle, \
 			$time) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_fw_time(p_stmt, p_dimm_fw_time);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -26363,7 +26891,7 @@ enum db_return_codes db_save_dimm_fw_time_state(const PersistentStore *p_ps,
 				 $device_handle , \
 				 $time )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_fw_time(p_stmt, p_dimm_fw_time);
@@ -26372,7 +26900,7 @@ enum db_return_codes db_save_dimm_fw_time_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -26401,7 +26929,7 @@ enum db_return_codes db_get_dimm_fw_time_by_device_handle(const PersistentStore
 		FROM dimm_fw_time \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -26411,7 +26939,7 @@ enum db_return_codes db_get_dimm_fw_time_by_device_handle(const PersistentStore
 			local_get_dimm_fw_time_relationships(p_ps, p_stmt, p_dimm_fw_time);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -26439,12 +26967,12 @@ enum db_return_codes db_update_dimm_fw_time_by_device_handle(const PersistentSto
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (int)device_handle);
 		local_bind_dimm_fw_time(p_stmt, p_dimm_fw_time);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -26466,14 +26994,14 @@ enum db_return_codes db_delete_dimm_fw_time_by_device_handle(const PersistentSto
 	char *sql = "DELETE FROM dimm_fw_time \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -26563,7 +27091,7 @@ int db_get_dimm_fw_time_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  time  \
 		FROM dimm_fw_time_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -26574,7 +27102,7 @@ int db_get_dimm_fw_time_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_fw_time_relationships_history(p_ps, p_stmt, &p_dimm_fw_time[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -26728,7 +27256,7 @@ enum db_return_codes db_add_dimm_platform_config(const PersistentStore *p_ps,
 		$config_output_size, \
 		$config_output_offset) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_platform_config(p_stmt, p_dimm_platform_config);
 		sql_rc = sqlite3_step(p_stmt);
@@ -26736,7 +27264,7 @@ enum db_return_codes db_add_dimm_platform_config(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -26783,7 +27311,7 @@ int db_get_dimm_platform_configs(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_platform_config_count)
@@ -26792,7 +27320,7 @@ int db_get_dimm_platform_configs(const PersistentStore *p_ps,
 			local_get_dimm_platform_config_relationships(p_ps, p_stmt, &p_dimm_platform_config[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -26849,11 +27377,11 @@ enum db_return_codes db_save_dimm_platform_config_state(const PersistentStore *p
 			$config_output_size, \
 			$config_output_offset) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_platform_config(p_stmt, p_dimm_platform_config);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -26893,7 +27421,7 @@ enum db_return_codes db_save_dimm_platform_config_state(const PersistentStore *p
 				 $config_output_size , \
 				 $config_output_offset )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_platform_config(p_stmt, p_dimm_platform_config);
@@ -26902,7 +27430,7 @@ enum db_return_codes db_save_dimm_platform_config_state(const PersistentStore *p
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -26931,7 +27459,7 @@ enum db_return_codes db_get_dimm_platform_config_by_device_handle(const Persiste
 		FROM dimm_platform_config \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -26941,7 +27469,7 @@ enum db_return_codes db_get_dimm_platform_config_by_device_handle(const Persiste
 			local_get_dimm_platform_config_relationships(p_ps, p_stmt, p_dimm_platform_config);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -26983,12 +27511,12 @@ enum db_return_codes db_update_dimm_platform_config_by_device_handle(const Persi
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_platform_config(p_stmt, p_dimm_platform_config);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -27010,14 +27538,14 @@ enum db_return_codes db_delete_dimm_platform_config_by_device_handle(const Persi
 	char *sql = "DELETE FROM dimm_platform_config \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -27107,7 +27635,7 @@ int db_get_dimm_platform_config_history_by_history_id(const PersistentStore *p_p
 		device_handle,  signature,  length,  revision,  checksum,  oem_id,  oem_table_id,  oem_revision,  creator_id,  creator_revision,  current_config_size,  current_config_offset,  config_input_size,  config_input_offset,  config_output_size,  config_output_offset  \
 		FROM dimm_platform_config_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -27118,7 +27646,7 @@ int db_get_dimm_platform_config_history_by_history_id(const PersistentStore *p_p
 			local_get_dimm_platform_config_relationships_history(p_ps, p_stmt, &p_dimm_platform_config[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -27254,7 +27782,7 @@ enum db_return_codes db_add_dimm_current_config(const PersistentStore *p_ps,
 		$mapped_memory_capacity, \
 		$mapped_app_direct_capacity) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_current_config(p_stmt, p_dimm_current_config);
 		sql_rc = sqlite3_step(p_stmt);
@@ -27262,7 +27790,7 @@ enum db_return_codes db_add_dimm_current_config(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -27306,7 +27834,7 @@ int db_get_dimm_current_configs(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_current_config_count)
@@ -27315,7 +27843,7 @@ int db_get_dimm_current_configs(const PersistentStore *p_ps,
 			local_get_dimm_current_config_relationships(p_ps, p_stmt, &p_dimm_current_config[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -27369,11 +27897,11 @@ enum db_return_codes db_save_dimm_current_config_state(const PersistentStore *p_
 			$mapped_memory_capacity, \
 			$mapped_app_direct_capacity) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_current_config(p_stmt, p_dimm_current_config);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -27410,7 +27938,7 @@ enum db_return_codes db_save_dimm_current_config_state(const PersistentStore *p_
 				 $mapped_memory_capacity , \
 				 $mapped_app_direct_capacity )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_current_config(p_stmt, p_dimm_current_config);
@@ -27419,7 +27947,7 @@ enum db_return_codes db_save_dimm_current_config_state(const PersistentStore *p_
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -27448,7 +27976,7 @@ enum db_return_codes db_get_dimm_current_config_by_device_handle(const Persisten
 		FROM dimm_current_config \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -27458,7 +27986,7 @@ enum db_return_codes db_get_dimm_current_config_by_device_handle(const Persisten
 			local_get_dimm_current_config_relationships(p_ps, p_stmt, p_dimm_current_config);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -27497,12 +28025,12 @@ enum db_return_codes db_update_dimm_current_config_by_device_handle(const Persis
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_current_config(p_stmt, p_dimm_current_config);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -27524,14 +28052,14 @@ enum db_return_codes db_delete_dimm_current_config_by_device_handle(const Persis
 	char *sql = "DELETE FROM dimm_current_config \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -27621,7 +28149,7 @@ int db_get_dimm_current_config_history_by_history_id(const PersistentStore *p_ps
 		device_handle,  signature,  length,  revision,  checksum,  oem_id,  oem_table_id,  oem_revision,  creator_id,  creator_revision,  config_status,  mapped_memory_capacity,  mapped_app_direct_capacity  \
 		FROM dimm_current_config_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -27632,7 +28160,7 @@ int db_get_dimm_current_config_history_by_history_id(const PersistentStore *p_ps
 			local_get_dimm_current_config_relationships_history(p_ps, p_stmt, &p_dimm_current_config[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -27756,7 +28284,7 @@ enum db_return_codes db_add_dimm_config_input(const PersistentStore *p_ps,
 		$creator_revision, \
 		$sequence_number) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_config_input(p_stmt, p_dimm_config_input);
 		sql_rc = sqlite3_step(p_stmt);
@@ -27764,7 +28292,7 @@ enum db_return_codes db_add_dimm_config_input(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -27806,7 +28334,7 @@ int db_get_dimm_config_inputs(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_config_input_count)
@@ -27815,7 +28343,7 @@ int db_get_dimm_config_inputs(const PersistentStore *p_ps,
 			local_get_dimm_config_input_relationships(p_ps, p_stmt, &p_dimm_config_input[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -27867,11 +28395,11 @@ enum db_return_codes db_save_dimm_config_input_state(const PersistentStore *p_ps
 			$creator_revision, \
 			$sequence_number) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_config_input(p_stmt, p_dimm_config_input);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -27906,7 +28434,7 @@ enum db_return_codes db_save_dimm_config_input_state(const PersistentStore *p_ps
 				 $creator_revision , \
 				 $sequence_number )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_config_input(p_stmt, p_dimm_config_input);
@@ -27915,7 +28443,7 @@ enum db_return_codes db_save_dimm_config_input_state(const PersistentStore *p_ps
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -27944,7 +28472,7 @@ enum db_return_codes db_get_dimm_config_input_by_device_handle(const PersistentS
 		FROM dimm_config_input \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -27954,7 +28482,7 @@ enum db_return_codes db_get_dimm_config_input_by_device_handle(const PersistentS
 			local_get_dimm_config_input_relationships(p_ps, p_stmt, p_dimm_config_input);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -27991,12 +28519,12 @@ enum db_return_codes db_update_dimm_config_input_by_device_handle(const Persiste
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_config_input(p_stmt, p_dimm_config_input);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -28018,14 +28546,14 @@ enum db_return_codes db_delete_dimm_config_input_by_device_handle(const Persiste
 	char *sql = "DELETE FROM dimm_config_input \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -28115,7 +28643,7 @@ int db_get_dimm_config_input_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  signature,  length,  revision,  checksum,  oem_id,  oem_table_id,  oem_revision,  creator_id,  creator_revision,  sequence_number  \
 		FROM dimm_config_input_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -28126,7 +28654,7 @@ int db_get_dimm_config_input_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_config_input_relationships_history(p_ps, p_stmt, &p_dimm_config_input[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -28256,7 +28784,7 @@ enum db_return_codes db_add_dimm_config_output(const PersistentStore *p_ps,
 		$sequence_number, \
 		$validation_status) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_config_output(p_stmt, p_dimm_config_output);
 		sql_rc = sqlite3_step(p_stmt);
@@ -28264,7 +28792,7 @@ enum db_return_codes db_add_dimm_config_output(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -28307,7 +28835,7 @@ int db_get_dimm_config_outputs(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_config_output_count)
@@ -28316,7 +28844,7 @@ int db_get_dimm_config_outputs(const PersistentStore *p_ps,
 			local_get_dimm_config_output_relationships(p_ps, p_stmt, &p_dimm_config_output[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -28369,11 +28897,11 @@ enum db_return_codes db_save_dimm_config_output_state(const PersistentStore *p_p
 			$sequence_number, \
 			$validation_status) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_config_output(p_stmt, p_dimm_config_output);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -28409,7 +28937,7 @@ enum db_return_codes db_save_dimm_config_output_state(const PersistentStore *p_p
 				 $sequence_number , \
 				 $validation_status )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_config_output(p_stmt, p_dimm_config_output);
@@ -28418,7 +28946,7 @@ enum db_return_codes db_save_dimm_config_output_state(const PersistentStore *p_p
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -28447,7 +28975,7 @@ enum db_return_codes db_get_dimm_config_output_by_device_handle(const Persistent
 		FROM dimm_config_output \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -28457,7 +28985,7 @@ enum db_return_codes db_get_dimm_config_output_by_device_handle(const Persistent
 			local_get_dimm_config_output_relationships(p_ps, p_stmt, p_dimm_config_output);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -28495,12 +29023,12 @@ enum db_return_codes db_update_dimm_config_output_by_device_handle(const Persist
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_dimm_config_output(p_stmt, p_dimm_config_output);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -28522,14 +29050,14 @@ enum db_return_codes db_delete_dimm_config_output_by_device_handle(const Persist
 	char *sql = "DELETE FROM dimm_config_output \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -28619,7 +29147,7 @@ int db_get_dimm_config_output_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  signature,  length,  revision,  checksum,  oem_id,  oem_table_id,  oem_revision,  creator_id,  creator_revision,  sequence_number,  validation_status  \
 		FROM dimm_config_output_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -28630,7 +29158,7 @@ int db_get_dimm_config_output_history_by_history_id(const PersistentStore *p_ps,
 			local_get_dimm_config_output_relationships_history(p_ps, p_stmt, &p_dimm_config_output[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -28727,7 +29255,7 @@ enum db_return_codes db_add_dimm_partition_change(const PersistentStore *p_ps,
 		$partition_size, \
 		$status) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_partition_change(p_stmt, p_dimm_partition_change);
 		sql_rc = sqlite3_step(p_stmt);
@@ -28735,7 +29263,7 @@ enum db_return_codes db_add_dimm_partition_change(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -28773,7 +29301,7 @@ int db_get_dimm_partition_changes(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_partition_change_count)
@@ -28782,7 +29310,7 @@ int db_get_dimm_partition_changes(const PersistentStore *p_ps,
 			local_get_dimm_partition_change_relationships(p_ps, p_stmt, &p_dimm_partition_change[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -28830,11 +29358,11 @@ enum db_return_codes db_save_dimm_partition_change_state(const PersistentStore *
 			$partition_size, \
 			$status) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_partition_change(p_stmt, p_dimm_partition_change);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -28865,7 +29393,7 @@ enum db_return_codes db_save_dimm_partition_change_state(const PersistentStore *
 				 $partition_size , \
 				 $status )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_partition_change(p_stmt, p_dimm_partition_change);
@@ -28874,7 +29402,7 @@ enum db_return_codes db_save_dimm_partition_change_state(const PersistentStore *
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -28903,7 +29431,7 @@ enum db_return_codes db_get_dimm_partition_change_by_id(const PersistentStore *p
 		FROM dimm_partition_change \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -28913,7 +29441,7 @@ enum db_return_codes db_get_dimm_partition_change_by_id(const PersistentStore *p
 			local_get_dimm_partition_change_relationships(p_ps, p_stmt, p_dimm_partition_change);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -28946,12 +29474,12 @@ enum db_return_codes db_update_dimm_partition_change_by_id(const PersistentStore
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_dimm_partition_change(p_stmt, p_dimm_partition_change);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -28973,14 +29501,14 @@ enum db_return_codes db_delete_dimm_partition_change_by_id(const PersistentStore
 	char *sql = "DELETE FROM dimm_partition_change \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29070,7 +29598,7 @@ int db_get_dimm_partition_change_history_by_history_id(const PersistentStore *p_
 		device_handle,  id,  config_table_type,  extension_table_type,  length,  partition_size,  status  \
 		FROM dimm_partition_change_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -29081,7 +29609,7 @@ int db_get_dimm_partition_change_history_by_history_id(const PersistentStore *p_
 			local_get_dimm_partition_change_relationships_history(p_ps, p_stmt, &p_dimm_partition_change[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -29110,7 +29638,7 @@ enum db_return_codes db_get_dimm_partition_change_count_by_dimm_topology_device_
 	const char *sql = "SELECT COUNT (*) FROM dimm_partition_change WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -29118,7 +29646,7 @@ enum db_return_codes db_get_dimm_partition_change_count_by_dimm_topology_device_
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29145,7 +29673,7 @@ enum db_return_codes db_get_dimm_partition_change_count_by_dimm_topology_device_
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -29154,7 +29682,7 @@ enum db_return_codes db_get_dimm_partition_change_count_by_dimm_topology_device_
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29181,7 +29709,7 @@ enum db_return_codes db_get_dimm_partition_changes_by_dimm_topology_device_handl
 		FROM dimm_partition_change \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -29192,7 +29720,7 @@ enum db_return_codes db_get_dimm_partition_changes_by_dimm_topology_device_handl
 			local_get_dimm_partition_change_relationships(p_ps, p_stmt, &p_dimm_partition_change[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -29217,7 +29745,7 @@ enum db_return_codes db_get_dimm_partition_changes_by_dimm_topology_device_handl
 		FROM dimm_partition_change_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -29229,7 +29757,7 @@ enum db_return_codes db_get_dimm_partition_changes_by_dimm_topology_device_handl
 			local_get_dimm_partition_change_relationships(p_ps, p_stmt, &p_dimm_partition_change[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -29250,14 +29778,14 @@ enum db_return_codes db_delete_dimm_partition_change_by_dimm_topology_device_han
 	char *sql = "DELETE FROM dimm_partition_change \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -29425,7 +29953,7 @@ enum db_return_codes db_add_dimm_interleave_set(const PersistentStore *p_ps,
 		$mirror_enable, \
 		$status) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_dimm_interleave_set(p_stmt, p_dimm_interleave_set);
 		sql_rc = sqlite3_step(p_stmt);
@@ -29433,7 +29961,7 @@ enum db_return_codes db_add_dimm_interleave_set(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -29475,7 +30003,7 @@ int db_get_dimm_interleave_sets(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < dimm_interleave_set_count)
@@ -29484,7 +30012,7 @@ int db_get_dimm_interleave_sets(const PersistentStore *p_ps,
 			local_get_dimm_interleave_set_relationships(p_ps, p_stmt, &p_dimm_interleave_set[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -29536,11 +30064,11 @@ enum db_return_codes db_save_dimm_interleave_set_state(const PersistentStore *p_
 			$mirror_enable, \
 			$status) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_dimm_interleave_set(p_stmt, p_dimm_interleave_set);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -29575,7 +30103,7 @@ enum db_return_codes db_save_dimm_interleave_set_state(const PersistentStore *p_
 				 $mirror_enable , \
 				 $status )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_dimm_interleave_set(p_stmt, p_dimm_interleave_set);
@@ -29584,7 +30112,7 @@ enum db_return_codes db_save_dimm_interleave_set_state(const PersistentStore *p_
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -29613,7 +30141,7 @@ enum db_return_codes db_get_dimm_interleave_set_by_id(const PersistentStore *p_p
 		FROM dimm_interleave_set \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -29623,7 +30151,7 @@ enum db_return_codes db_get_dimm_interleave_set_by_id(const PersistentStore *p_p
 			local_get_dimm_interleave_set_relationships(p_ps, p_stmt, p_dimm_interleave_set);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29660,12 +30188,12 @@ enum db_return_codes db_update_dimm_interleave_set_by_id(const PersistentStore *
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_dimm_interleave_set(p_stmt, p_dimm_interleave_set);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29687,14 +30215,14 @@ enum db_return_codes db_delete_dimm_interleave_set_by_id(const PersistentStore *
 	char *sql = "DELETE FROM dimm_interleave_set \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29784,7 +30312,7 @@ int db_get_dimm_interleave_set_history_by_history_id(const PersistentStore *p_ps
 		id,  device_handle,  config_table_type,  extension_table_type,  length,  index_id,  dimm_count,  memory_type,  interleave_format,  mirror_enable,  status  \
 		FROM dimm_interleave_set_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -29795,7 +30323,7 @@ int db_get_dimm_interleave_set_history_by_history_id(const PersistentStore *p_ps
 			local_get_dimm_interleave_set_relationships_history(p_ps, p_stmt, &p_dimm_interleave_set[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -29877,7 +30405,7 @@ enum db_return_codes db_get_dimm_interleave_set_count_by_dimm_topology_device_ha
 	const char *sql = "SELECT COUNT (*) FROM dimm_interleave_set WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -29885,7 +30413,7 @@ enum db_return_codes db_get_dimm_interleave_set_count_by_dimm_topology_device_ha
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29912,7 +30440,7 @@ enum db_return_codes db_get_dimm_interleave_set_count_by_dimm_topology_device_ha
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -29921,7 +30449,7 @@ enum db_return_codes db_get_dimm_interleave_set_count_by_dimm_topology_device_ha
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -29948,7 +30476,7 @@ enum db_return_codes db_get_dimm_interleave_sets_by_dimm_topology_device_handle(
 		FROM dimm_interleave_set \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -29959,7 +30487,7 @@ enum db_return_codes db_get_dimm_interleave_sets_by_dimm_topology_device_handle(
 			local_get_dimm_interleave_set_relationships(p_ps, p_stmt, &p_dimm_interleave_set[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -29984,7 +30512,7 @@ enum db_return_codes db_get_dimm_interleave_sets_by_dimm_topology_device_handle_
 		FROM dimm_interleave_set_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -29996,7 +30524,7 @@ enum db_return_codes db_get_dimm_interleave_sets_by_dimm_topology_device_handle_
 			local_get_dimm_interleave_set_relationships(p_ps, p_stmt, &p_dimm_interleave_set[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30017,14 +30545,14 @@ enum db_return_codes db_delete_dimm_interleave_set_by_dimm_topology_device_handl
 	char *sql = "DELETE FROM dimm_interleave_set \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30128,7 +30656,7 @@ enum db_return_codes db_add_interleave_set_dimm_info_v1(const PersistentStore *p
 		$offset, \
 		$size) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_interleave_set_dimm_info_v1(p_stmt, p_interleave_set_dimm_info_v1);
 		sql_rc = sqlite3_step(p_stmt);
@@ -30136,7 +30664,7 @@ enum db_return_codes db_add_interleave_set_dimm_info_v1(const PersistentStore *p
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -30176,7 +30704,7 @@ int db_get_interleave_set_dimm_info_v1s(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < interleave_set_dimm_info_v1_count)
@@ -30185,7 +30713,7 @@ int db_get_interleave_set_dimm_info_v1s(const PersistentStore *p_ps,
 			local_get_interleave_set_dimm_info_v1_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v1[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -30235,11 +30763,11 @@ enum db_return_codes db_save_interleave_set_dimm_info_v1_state(const PersistentS
 			$offset, \
 			$size) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_interleave_set_dimm_info_v1(p_stmt, p_interleave_set_dimm_info_v1);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -30272,7 +30800,7 @@ enum db_return_codes db_save_interleave_set_dimm_info_v1_state(const PersistentS
 				 $offset , \
 				 $size )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_interleave_set_dimm_info_v1(p_stmt, p_interleave_set_dimm_info_v1);
@@ -30281,7 +30809,7 @@ enum db_return_codes db_save_interleave_set_dimm_info_v1_state(const PersistentS
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -30310,7 +30838,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_by_id(const PersistentSt
 		FROM interleave_set_dimm_info_v1 \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -30320,7 +30848,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_by_id(const PersistentSt
 			local_get_interleave_set_dimm_info_v1_relationships(p_ps, p_stmt, p_interleave_set_dimm_info_v1);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -30355,12 +30883,12 @@ enum db_return_codes db_update_interleave_set_dimm_info_v1_by_id(const Persisten
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_interleave_set_dimm_info_v1(p_stmt, p_interleave_set_dimm_info_v1);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -30382,14 +30910,14 @@ enum db_return_codes db_delete_interleave_set_dimm_info_v1_by_id(const Persisten
 	char *sql = "DELETE FROM interleave_set_dimm_info_v1 \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -30479,7 +31007,7 @@ int db_get_interleave_set_dimm_info_v1_history_by_history_id(const PersistentSto
 		id,  config_table_type,  index_id,  device_handle,  manufacturer,  serial_num,  part_num,  offset,  size  \
 		FROM interleave_set_dimm_info_v1_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -30490,7 +31018,7 @@ int db_get_interleave_set_dimm_info_v1_history_by_history_id(const PersistentSto
 			local_get_interleave_set_dimm_info_v1_relationships_history(p_ps, p_stmt, &p_interleave_set_dimm_info_v1[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -30572,7 +31100,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_interleave
 	const char *sql = "SELECT COUNT (*) FROM interleave_set_dimm_info_v1 WHERE index_id = $index_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -30580,7 +31108,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_interleave
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -30607,7 +31135,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_interleave
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -30616,7 +31144,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_interleave
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -30643,7 +31171,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_interleave_set_
 		FROM interleave_set_dimm_info_v1 \
 		WHERE  index_id = $index_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
@@ -30654,7 +31182,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_interleave_set_
 			local_get_interleave_set_dimm_info_v1_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v1[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30679,7 +31207,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_interleave_set_
 		FROM interleave_set_dimm_info_v1_history \
 		WHERE  index_id = $index_id AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
@@ -30691,7 +31219,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_interleave_set_
 			local_get_interleave_set_dimm_info_v1_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v1[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30712,14 +31240,14 @@ enum db_return_codes db_delete_interleave_set_dimm_info_v1_by_dimm_interleave_se
 	char *sql = "DELETE FROM interleave_set_dimm_info_v1 \
 				 WHERE index_id = $index_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30742,7 +31270,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_topology_d
 	const char *sql = "SELECT COUNT (*) FROM interleave_set_dimm_info_v1 WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -30750,7 +31278,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_topology_d
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -30777,7 +31305,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_topology_d
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -30786,7 +31314,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1_count_by_dimm_topology_d
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -30813,7 +31341,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_topology_device
 		FROM interleave_set_dimm_info_v1 \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -30824,7 +31352,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_topology_device
 			local_get_interleave_set_dimm_info_v1_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v1[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30849,7 +31377,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_topology_device
 		FROM interleave_set_dimm_info_v1_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -30861,7 +31389,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v1s_by_dimm_topology_device
 			local_get_interleave_set_dimm_info_v1_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v1[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30882,14 +31410,14 @@ enum db_return_codes db_delete_interleave_set_dimm_info_v1_by_dimm_topology_devi
 	char *sql = "DELETE FROM interleave_set_dimm_info_v1 \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -30996,7 +31524,7 @@ enum db_return_codes db_add_interleave_set_dimm_info_v2(const PersistentStore *p
 		$offset, \
 		$size) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_interleave_set_dimm_info_v2(p_stmt, p_interleave_set_dimm_info_v2);
 		sql_rc = sqlite3_step(p_stmt);
@@ -31004,7 +31532,7 @@ enum db_return_codes db_add_interleave_set_dimm_info_v2(const PersistentStore *p
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -31042,7 +31570,7 @@ int db_get_interleave_set_dimm_info_v2s(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < interleave_set_dimm_info_v2_count)
@@ -31051,7 +31579,7 @@ int db_get_interleave_set_dimm_info_v2s(const PersistentStore *p_ps,
 			local_get_interleave_set_dimm_info_v2_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v2[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -31099,11 +31627,11 @@ enum db_return_codes db_save_interleave_set_dimm_info_v2_state(const PersistentS
 			$offset, \
 			$size) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_interleave_set_dimm_info_v2(p_stmt, p_interleave_set_dimm_info_v2);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -31134,7 +31662,7 @@ enum db_return_codes db_save_interleave_set_dimm_info_v2_state(const PersistentS
 				 $offset , \
 				 $size )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_interleave_set_dimm_info_v2(p_stmt, p_interleave_set_dimm_info_v2);
@@ -31143,7 +31671,7 @@ enum db_return_codes db_save_interleave_set_dimm_info_v2_state(const PersistentS
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -31172,7 +31700,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_by_id(const PersistentSt
 		FROM interleave_set_dimm_info_v2 \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -31182,7 +31710,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_by_id(const PersistentSt
 			local_get_interleave_set_dimm_info_v2_relationships(p_ps, p_stmt, p_interleave_set_dimm_info_v2);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -31215,12 +31743,12 @@ enum db_return_codes db_update_interleave_set_dimm_info_v2_by_id(const Persisten
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_interleave_set_dimm_info_v2(p_stmt, p_interleave_set_dimm_info_v2);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -31242,14 +31770,14 @@ enum db_return_codes db_delete_interleave_set_dimm_info_v2_by_id(const Persisten
 	char *sql = "DELETE FROM interleave_set_dimm_info_v2 \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -31339,7 +31867,7 @@ int db_get_interleave_set_dimm_info_v2_history_by_history_id(const PersistentSto
 		id,  config_table_type,  index_id,  device_handle,  device_uid,  offset,  size  \
 		FROM interleave_set_dimm_info_v2_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -31350,7 +31878,7 @@ int db_get_interleave_set_dimm_info_v2_history_by_history_id(const PersistentSto
 			local_get_interleave_set_dimm_info_v2_relationships_history(p_ps, p_stmt, &p_interleave_set_dimm_info_v2[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -31432,7 +31960,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_interleave
 	const char *sql = "SELECT COUNT (*) FROM interleave_set_dimm_info_v2 WHERE index_id = $index_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -31440,7 +31968,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_interleave
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -31467,7 +31995,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_interleave
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -31476,7 +32004,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_interleave
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -31503,7 +32031,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_interleave_set_
 		FROM interleave_set_dimm_info_v2 \
 		WHERE  index_id = $index_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
@@ -31514,7 +32042,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_interleave_set_
 			local_get_interleave_set_dimm_info_v2_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v2[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -31539,7 +32067,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_interleave_set_
 		FROM interleave_set_dimm_info_v2_history \
 		WHERE  index_id = $index_id AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
@@ -31551,7 +32079,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_interleave_set_
 			local_get_interleave_set_dimm_info_v2_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v2[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -31572,14 +32100,14 @@ enum db_return_codes db_delete_interleave_set_dimm_info_v2_by_dimm_interleave_se
 	char *sql = "DELETE FROM interleave_set_dimm_info_v2 \
 				 WHERE index_id = $index_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$index_id", (unsigned int)index_id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -31602,7 +32130,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_topology_d
 	const char *sql = "SELECT COUNT (*) FROM interleave_set_dimm_info_v2 WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -31610,7 +32138,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_topology_d
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -31637,7 +32165,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_topology_d
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -31646,7 +32174,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2_count_by_dimm_topology_d
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -31673,7 +32201,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_topology_device
 		FROM interleave_set_dimm_info_v2 \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -31684,7 +32212,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_topology_device
 			local_get_interleave_set_dimm_info_v2_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v2[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -31709,7 +32237,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_topology_device
 		FROM interleave_set_dimm_info_v2_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -31721,7 +32249,7 @@ enum db_return_codes db_get_interleave_set_dimm_info_v2s_by_dimm_topology_device
 			local_get_interleave_set_dimm_info_v2_relationships(p_ps, p_stmt, &p_interleave_set_dimm_info_v2[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -31742,14 +32270,14 @@ enum db_return_codes db_delete_interleave_set_dimm_info_v2_by_dimm_topology_devi
 	char *sql = "DELETE FROM interleave_set_dimm_info_v2 \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -31810,7 +32338,7 @@ enum db_return_codes db_add_enable_error_injection_info(const PersistentStore *p
 		($device_handle, \
 		$enable) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_enable_error_injection_info(p_stmt, p_enable_error_injection_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -31818,7 +32346,7 @@ enum db_return_codes db_add_enable_error_injection_info(const PersistentStore *p
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -31851,7 +32379,7 @@ int db_get_enable_error_injection_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < enable_error_injection_info_count)
@@ -31860,7 +32388,7 @@ int db_get_enable_error_injection_infos(const PersistentStore *p_ps,
 			local_get_enable_error_injection_info_relationships(p_ps, p_stmt, &p_enable_error_injection_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -31903,11 +32431,11 @@ enum db_return_codes db_save_enable_error_injection_info_state(const PersistentS
 			($device_handle, \
 			$enable) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_enable_error_injection_info(p_stmt, p_enable_error_injection_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -31933,7 +32461,7 @@ enum db_return_codes db_save_enable_error_injection_info_state(const PersistentS
 				 $device_handle , \
 				 $enable )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_enable_error_injection_info(p_stmt, p_enable_error_injection_info);
@@ -31942,7 +32470,7 @@ enum db_return_codes db_save_enable_error_injection_info_state(const PersistentS
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -31971,7 +32499,7 @@ enum db_return_codes db_get_enable_error_injection_info_by_device_handle(const P
 		FROM enable_error_injection_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -31981,7 +32509,7 @@ enum db_return_codes db_get_enable_error_injection_info_by_device_handle(const P
 			local_get_enable_error_injection_info_relationships(p_ps, p_stmt, p_enable_error_injection_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32009,12 +32537,12 @@ enum db_return_codes db_update_enable_error_injection_info_by_device_handle(cons
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_enable_error_injection_info(p_stmt, p_enable_error_injection_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32036,14 +32564,14 @@ enum db_return_codes db_delete_enable_error_injection_info_by_device_handle(cons
 	char *sql = "DELETE FROM enable_error_injection_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32133,7 +32661,7 @@ int db_get_enable_error_injection_info_history_by_history_id(const PersistentSto
 		device_handle,  enable  \
 		FROM enable_error_injection_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -32144,7 +32672,7 @@ int db_get_enable_error_injection_info_history_by_history_id(const PersistentSto
 			local_get_enable_error_injection_info_relationships_history(p_ps, p_stmt, &p_enable_error_injection_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -32211,7 +32739,7 @@ enum db_return_codes db_add_temperature_error_injection_info(const PersistentSto
 		($device_handle, \
 		$temperature) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_temperature_error_injection_info(p_stmt, p_temperature_error_injection_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -32219,7 +32747,7 @@ enum db_return_codes db_add_temperature_error_injection_info(const PersistentSto
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -32252,7 +32780,7 @@ int db_get_temperature_error_injection_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < temperature_error_injection_info_count)
@@ -32261,7 +32789,7 @@ int db_get_temperature_error_injection_infos(const PersistentStore *p_ps,
 			local_get_temperature_error_injection_info_relationships(p_ps, p_stmt, &p_temperature_error_injection_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -32304,11 +32832,11 @@ enum db_return_codes db_save_temperature_error_injection_info_state(const Persis
 			($device_handle, \
 			$temperature) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_temperature_error_injection_info(p_stmt, p_temperature_error_injection_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -32334,7 +32862,7 @@ enum db_return_codes db_save_temperature_error_injection_info_state(const Persis
 				 $device_handle , \
 				 $temperature )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_temperature_error_injection_info(p_stmt, p_temperature_error_injection_info);
@@ -32343,7 +32871,7 @@ enum db_return_codes db_save_temperature_error_injection_info_state(const Persis
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -32372,7 +32900,7 @@ enum db_return_codes db_get_temperature_error_injection_info_by_device_handle(co
 		FROM temperature_error_injection_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -32382,7 +32910,7 @@ enum db_return_codes db_get_temperature_error_injection_info_by_device_handle(co
 			local_get_temperature_error_injection_info_relationships(p_ps, p_stmt, p_temperature_error_injection_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32410,12 +32938,12 @@ enum db_return_codes db_update_temperature_error_injection_info_by_device_handle
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_temperature_error_injection_info(p_stmt, p_temperature_error_injection_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32437,14 +32965,14 @@ enum db_return_codes db_delete_temperature_error_injection_info_by_device_handle
 	char *sql = "DELETE FROM temperature_error_injection_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32534,7 +33062,7 @@ int db_get_temperature_error_injection_info_history_by_history_id(const Persiste
 		device_handle,  temperature  \
 		FROM temperature_error_injection_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -32545,7 +33073,7 @@ int db_get_temperature_error_injection_info_history_by_history_id(const Persiste
 			local_get_temperature_error_injection_info_relationships_history(p_ps, p_stmt, &p_temperature_error_injection_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -32624,7 +33152,7 @@ enum db_return_codes db_add_poison_error_injection_info(const PersistentStore *p
 		$dpa_address, \
 		$memory) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_poison_error_injection_info(p_stmt, p_poison_error_injection_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -32632,7 +33160,7 @@ enum db_return_codes db_add_poison_error_injection_info(const PersistentStore *p
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -32667,7 +33195,7 @@ int db_get_poison_error_injection_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < poison_error_injection_info_count)
@@ -32676,7 +33204,7 @@ int db_get_poison_error_injection_infos(const PersistentStore *p_ps,
 			local_get_poison_error_injection_info_relationships(p_ps, p_stmt, &p_poison_error_injection_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -32721,11 +33249,11 @@ enum db_return_codes db_save_poison_error_injection_info_state(const PersistentS
 			$dpa_address, \
 			$memory) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_poison_error_injection_info(p_stmt, p_poison_error_injection_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -32753,7 +33281,7 @@ enum db_return_codes db_save_poison_error_injection_info_state(const PersistentS
 				 $dpa_address , \
 				 $memory )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_poison_error_injection_info(p_stmt, p_poison_error_injection_info);
@@ -32762,7 +33290,7 @@ enum db_return_codes db_save_poison_error_injection_info_state(const PersistentS
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -32791,7 +33319,7 @@ enum db_return_codes db_get_poison_error_injection_info_by_id(const PersistentSt
 		FROM poison_error_injection_info \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -32801,7 +33329,7 @@ enum db_return_codes db_get_poison_error_injection_info_by_id(const PersistentSt
 			local_get_poison_error_injection_info_relationships(p_ps, p_stmt, p_poison_error_injection_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32831,12 +33359,12 @@ enum db_return_codes db_update_poison_error_injection_info_by_id(const Persisten
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_poison_error_injection_info(p_stmt, p_poison_error_injection_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32858,14 +33386,14 @@ enum db_return_codes db_delete_poison_error_injection_info_by_id(const Persisten
 	char *sql = "DELETE FROM poison_error_injection_info \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -32955,7 +33483,7 @@ int db_get_poison_error_injection_info_history_by_history_id(const PersistentSto
 		id,  device_handle,  dpa_address,  memory  \
 		FROM poison_error_injection_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -32966,7 +33494,7 @@ int db_get_poison_error_injection_info_history_by_history_id(const PersistentSto
 			local_get_poison_error_injection_info_relationships_history(p_ps, p_stmt, &p_poison_error_injection_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -32995,7 +33523,7 @@ enum db_return_codes db_get_poison_error_injection_info_count_by_dimm_topology_d
 	const char *sql = "SELECT COUNT (*) FROM poison_error_injection_info WHERE device_handle = $device_handle";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -33003,7 +33531,7 @@ enum db_return_codes db_get_poison_error_injection_info_count_by_dimm_topology_d
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -33030,7 +33558,7 @@ enum db_return_codes db_get_poison_error_injection_info_count_by_dimm_topology_d
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -33039,7 +33567,7 @@ enum db_return_codes db_get_poison_error_injection_info_count_by_dimm_topology_d
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -33066,7 +33594,7 @@ enum db_return_codes db_get_poison_error_injection_infos_by_dimm_topology_device
 		FROM poison_error_injection_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -33077,7 +33605,7 @@ enum db_return_codes db_get_poison_error_injection_infos_by_dimm_topology_device
 			local_get_poison_error_injection_info_relationships(p_ps, p_stmt, &p_poison_error_injection_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -33102,7 +33630,7 @@ enum db_return_codes db_get_poison_error_injection_infos_by_dimm_topology_device
 		FROM poison_error_injection_info_history \
 		WHERE  device_handle = $device_handle AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
@@ -33114,7 +33642,7 @@ enum db_return_codes db_get_poison_error_injection_infos_by_dimm_topology_device
 			local_get_poison_error_injection_info_relationships(p_ps, p_stmt, &p_poison_error_injection_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -33135,14 +33663,14 @@ enum db_return_codes db_delete_poison_error_injection_info_by_dimm_topology_devi
 	char *sql = "DELETE FROM poison_error_injection_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -33227,7 +33755,7 @@ enum db_return_codes db_add_software_trigger_info(const PersistentStore *p_ps,
 		$spare_block_percentage_trigger, \
 		$unsafe_shutdown_trigger) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_software_trigger_info(p_stmt, p_software_trigger_info);
 		sql_rc = sqlite3_step(p_stmt);
@@ -33235,7 +33763,7 @@ enum db_return_codes db_add_software_trigger_info(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -33272,7 +33800,7 @@ int db_get_software_trigger_infos(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < software_trigger_info_count)
@@ -33281,7 +33809,7 @@ int db_get_software_trigger_infos(const PersistentStore *p_ps,
 			local_get_software_trigger_info_relationships(p_ps, p_stmt, &p_software_trigger_info[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -33328,11 +33856,11 @@ enum db_return_codes db_save_software_trigger_info_state(const PersistentStore *
 			$spare_block_percentage_trigger, \
 			$unsafe_shutdown_trigger) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_software_trigger_info(p_stmt, p_software_trigger_info);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -33362,7 +33890,7 @@ enum db_return_codes db_save_software_trigger_info_state(const PersistentStore *
 				 $spare_block_percentage_trigger , \
 				 $unsafe_shutdown_trigger )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_software_trigger_info(p_stmt, p_software_trigger_info);
@@ -33371,7 +33899,7 @@ enum db_return_codes db_save_software_trigger_info_state(const PersistentStore *
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -33400,7 +33928,7 @@ enum db_return_codes db_get_software_trigger_info_by_device_handle(const Persist
 		FROM software_trigger_info \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -33410,7 +33938,7 @@ enum db_return_codes db_get_software_trigger_info_by_device_handle(const Persist
 			local_get_software_trigger_info_relationships(p_ps, p_stmt, p_software_trigger_info);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -33442,12 +33970,12 @@ enum db_return_codes db_update_software_trigger_info_by_device_handle(const Pers
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_software_trigger_info(p_stmt, p_software_trigger_info);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -33469,14 +33997,14 @@ enum db_return_codes db_delete_software_trigger_info_by_device_handle(const Pers
 	char *sql = "DELETE FROM software_trigger_info \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -33566,7 +34094,7 @@ int db_get_software_trigger_info_history_by_history_id(const PersistentStore *p_
 		device_handle,  die_sparing_trigger,  user_spare_block_alarm_trip_trigger,  fatal_error_trigger,  spare_block_percentage_trigger,  unsafe_shutdown_trigger  \
 		FROM software_trigger_info_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -33577,7 +34105,7 @@ int db_get_software_trigger_info_history_by_history_id(const PersistentStore *p_
 			local_get_software_trigger_info_relationships_history(p_ps, p_stmt, &p_software_trigger_info[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -33599,493 +34127,6 @@ enum db_return_codes db_delete_software_trigger_info_history(const PersistentSto
 /*
  * --- END software_trigger_info ----------------
  */
-/*
- * --- performance ----------------
- */
-void local_bind_performance(sqlite3_stmt *p_stmt, struct db_performance *p_performance)
-{
-	BIND_INTEGER(p_stmt, "$id", (int)p_performance->id);
-	BIND_TEXT(p_stmt, "$dimm_uid", (char *)p_performance->dimm_uid);
-	BIND_INTEGER(p_stmt, "$time", (unsigned long long)p_performance->time);
-	BIND_INTEGER(p_stmt, "$bytes_read", (unsigned long long)p_performance->bytes_read);
-	BIND_INTEGER(p_stmt, "$bytes_written", (unsigned long long)p_performance->bytes_written);
-	BIND_INTEGER(p_stmt, "$read_reqs", (unsigned long long)p_performance->read_reqs);
-	BIND_INTEGER(p_stmt, "$host_write_cmds", (unsigned long long)p_performance->host_write_cmds);
-	BIND_INTEGER(p_stmt, "$block_reads", (unsigned long long)p_performance->block_reads);
-	BIND_INTEGER(p_stmt, "$block_writes", (unsigned long long)p_performance->block_writes);
-}
-void local_get_performance_relationships(const PersistentStore *p_ps,
-	sqlite3_stmt *p_stmt, struct db_performance *p_performance)
-{
-}
-
-#if 0
-//NON-HISTORY TABLE
-
-void local_get_performance_relationships_history(const PersistentStore *p_ps,
-	sqlite3_stmt *p_stmt, struct db_performance *p_performance,
-	int history_id)
-{
-}
-
-#endif
-
-void local_row_to_performance(const PersistentStore *p_ps,
-	sqlite3_stmt *p_stmt, struct db_performance *p_performance)
-{
-	INTEGER_COLUMN(p_stmt,
-		0,
-		p_performance->id);
-	TEXT_COLUMN(p_stmt,
-		1,
-		p_performance->dimm_uid,
-		PERFORMANCE_DIMM_UID_LEN);
-	INTEGER_COLUMN(p_stmt,
-		2,
-		p_performance->time);
-	INTEGER_COLUMN(p_stmt,
-		3,
-		p_performance->bytes_read);
-	INTEGER_COLUMN(p_stmt,
-		4,
-		p_performance->bytes_written);
-	INTEGER_COLUMN(p_stmt,
-		5,
-		p_performance->read_reqs);
-	INTEGER_COLUMN(p_stmt,
-		6,
-		p_performance->host_write_cmds);
-	INTEGER_COLUMN(p_stmt,
-		7,
-		p_performance->block_reads);
-	INTEGER_COLUMN(p_stmt,
-		8,
-		p_performance->block_writes);
-}
-void db_print_performance(struct db_performance *p_value)
-{
-	printf("performance.id: %i\n", p_value->id);
-	printf("performance.dimm_uid: %s\n", p_value->dimm_uid);
-	printf("performance.time: %llu\n", p_value->time);
-	printf("performance.bytes_read: %llu\n", p_value->bytes_read);
-	printf("performance.bytes_written: %llu\n", p_value->bytes_written);
-	printf("performance.read_reqs: %llu\n", p_value->read_reqs);
-	printf("performance.host_write_cmds: %llu\n", p_value->host_write_cmds);
-	printf("performance.block_reads: %llu\n", p_value->block_reads);
-	printf("performance.block_writes: %llu\n", p_value->block_writes);
-}
-enum db_return_codes db_add_performance(const PersistentStore *p_ps,
-	struct db_performance *p_performance)
-{
-	enum db_return_codes rc = DB_ERR_FAILURE;
-	sqlite3_stmt *p_stmt;
-	char *sql = 	"INSERT INTO performance \
-		(dimm_uid, time, bytes_read, bytes_written, read_reqs, host_write_cmds, block_reads, block_writes)  \
-		VALUES 		\
-		(\
-		$dimm_uid, \
-		$time, \
-		$bytes_read, \
-		$bytes_written, \
-		$read_reqs, \
-		$host_write_cmds, \
-		$block_reads, \
-		$block_writes) ";
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-	{
-		local_bind_performance(p_stmt, p_performance);
-		sql_rc = sqlite3_step(p_stmt);
-		if (sql_rc == SQLITE_DONE)
-		{
-			rc = DB_SUCCESS;
-		}
-		sqlite3_finalize(p_stmt);
-		if (sql_rc != SQLITE_DONE)
-		{
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-					sql_rc);
-		}
-	}
-	else
-	{
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-enum db_return_codes db_get_performance_count(const PersistentStore *p_ps, int *p_count)
-{
-	return table_row_count(p_ps, "performance", p_count);
-}
-int db_get_performances(const PersistentStore *p_ps,
-	struct db_performance *p_performance,
-	int performance_count)
-{
-	int rc = DB_ERR_FAILURE;
-	memset(p_performance, 0, sizeof (struct db_performance) * performance_count);
-	char *sql = "SELECT \
-		id \
-		,  dimm_uid \
-		,  time \
-		,  bytes_read \
-		,  bytes_written \
-		,  read_reqs \
-		,  host_write_cmds \
-		,  block_reads \
-		,  block_writes \
-		  \
-		FROM performance \
-		          \
-		 ORDER BY time DESC  \
-		";
-	sqlite3_stmt *p_stmt;
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-	{
-		int index = 0;
-		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < performance_count)
-		{
-			local_row_to_performance(p_ps, p_stmt, &p_performance[index]);
-			local_get_performance_relationships(p_ps, p_stmt, &p_performance[index]);
-			index++;
-		}
-		sqlite3_finalize(p_stmt);
-		if (sql_rc != SQLITE_DONE)
-		{
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-					sql_rc);
-		}
-		rc = index;
-	}
-	else
-	{
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-enum db_return_codes db_delete_all_performances(const PersistentStore *p_ps)
-{
-	return run_sql_no_results(p_ps->db, "DELETE FROM performance");
-}
-
-#if 0
-//NON-HISTORY TABLE
-
-enum db_return_codes db_save_performance_state(const PersistentStore *p_ps,
-	int history_id,
-	struct db_performance *p_performance)
-{
-	enum db_return_codes rc = DB_SUCCESS;
-	struct db_performance temp;
-	/*
-	 * Main table - Insert new or update existing
-	 */
-	if (db_get_performance_by_id(p_ps, p_performance->id, &temp) == DB_SUCCESS)
-	{
-		rc = db_update_performance_by_id(p_ps,
-				p_performance->id,
-				p_performance);
-	}
-	else
-	{
-		sqlite3_stmt *p_stmt;
-		char *sql = 	"INSERT INTO performance \
-			( id ,  dimm_uid ,  time ,  bytes_read ,  bytes_written ,  read_reqs ,  host_write_cmds ,  block_reads ,  block_writes )  \
-			VALUES 		\
-			($id, \
-			$dimm_uid, \
-			$time, \
-			$bytes_read, \
-			$bytes_written, \
-			$read_reqs, \
-			$host_write_cmds, \
-			$block_reads, \
-			$block_writes) ";
-		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-		{
-			local_bind_performance(p_stmt, p_performance);
-			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
-			if (sql_rc != SQLITE_DONE)
-			{
-				rc = DB_ERR_FAILURE;
-				COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-					sql_rc);
-			}
-		}
-		else
-		{
-			COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-		}
-	}
-	/*
-	 * Insert as a history
-	 */
-	if (rc == DB_SUCCESS)
-	{
-		sqlite3_stmt *p_stmt;
-		char *sql = "INSERT INTO performance_history \
-			(history_id, \
-				 id,  dimm_uid,  time,  bytes_read,  bytes_written,  read_reqs,  host_write_cmds,  block_reads,  block_writes)  \
-			VALUES 		($history_id, \
-				 $id , \
-				 $dimm_uid , \
-				 $time , \
-				 $bytes_read , \
-				 $bytes_written , \
-				 $read_reqs , \
-				 $host_write_cmds , \
-				 $block_reads , \
-				 $block_writes )";
-		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-		{
-			BIND_INTEGER(p_stmt, "$history_id", history_id);
-			local_bind_performance(p_stmt, p_performance);
-			sql_rc = sqlite3_step(p_stmt);
-			if (sql_rc == SQLITE_DONE)
-			{
-				rc = DB_SUCCESS;
-			}
-			sqlite3_finalize(p_stmt);
-			if (sql_rc != SQLITE_DONE)
-			{
-				rc = DB_ERR_FAILURE;
-				COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-					sql_rc);
-			}
-		}
-		else
-		{
-			rc = DB_ERR_FAILURE;
-			COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-		}
-	}
-	return rc;
-}
-
-#endif
-
-enum db_return_codes db_get_performance_by_id(const PersistentStore *p_ps,
-	const int id,
-	struct db_performance *p_performance)
-{
-	memset(p_performance, 0, sizeof (struct db_performance));
-	enum db_return_codes rc = DB_ERR_FAILURE;
-	sqlite3_stmt *p_stmt;
-	char *sql = "SELECT \
-		id,  dimm_uid,  time,  bytes_read,  bytes_written,  read_reqs,  host_write_cmds,  block_reads,  block_writes  \
-		FROM performance \
-		WHERE  id = $id";
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-	{
-		BIND_INTEGER(p_stmt, "$id", (int)id);
-		sql_rc = sqlite3_step(p_stmt);
-		if (sql_rc == SQLITE_ROW)
-		{
-			local_row_to_performance(p_ps, p_stmt, p_performance);
-			local_get_performance_relationships(p_ps, p_stmt, p_performance);
-			rc = DB_SUCCESS;
-		}
-		sqlite3_finalize(p_stmt);
-		if (sql_rc != SQLITE_ROW)
-		{
-			rc = DB_ERR_FAILURE;
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-				sql_rc);
-		}
-	}
-	else
-	{
-		rc = DB_ERR_FAILURE;
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-enum db_return_codes db_update_performance_by_id(const PersistentStore *p_ps,
-	const int id,
-	struct db_performance *p_performance)
-{
-	sqlite3_stmt *p_stmt;
-	enum db_return_codes rc = DB_SUCCESS;
-	char *sql = "UPDATE performance \
-	SET \
-	id=$id \
-		,  dimm_uid=$dimm_uid \
-		,  time=$time \
-		,  bytes_read=$bytes_read \
-		,  bytes_written=$bytes_written \
-		,  read_reqs=$read_reqs \
-		,  host_write_cmds=$host_write_cmds \
-		,  block_reads=$block_reads \
-		,  block_writes=$block_writes \
-		  \
-	WHERE id=$id ";
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-	{
-		BIND_INTEGER(p_stmt, "$id", (int)id);
-		local_bind_performance(p_stmt, p_performance);
-		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
-		if (sql_rc != SQLITE_DONE)
-		{
-			rc = DB_ERR_FAILURE;
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
-		}
-	}
-	else
-	{
-		rc = DB_ERR_FAILURE;
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-enum db_return_codes db_delete_performance_by_id(const PersistentStore *p_ps,
-	const int id)
-{
-	enum db_return_codes rc = DB_ERR_FAILURE;
-	sqlite3_stmt *p_stmt;
-	char *sql = "DELETE FROM performance \
-				 WHERE id = $id";
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-	{
-		BIND_INTEGER(p_stmt, "$id", (int)id);
-		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
-		{
-			rc = DB_SUCCESS;
-		}
-		sqlite3_finalize(p_stmt);
-		if (sql_rc != SQLITE_DONE)
-		{
-			rc = DB_ERR_FAILURE;
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-				sql_rc);
-		}
-	}
-	else
-	{
-		rc = DB_ERR_FAILURE;
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-
-#if 0
-//NON-HISTORY TABLE
-
-enum db_return_codes db_get_performance_history_by_history_id_count(const PersistentStore *p_ps, 
-	int history_id,
-	int *p_count)
-{
-	enum db_return_codes rc = DB_ERR_FAILURE;
-	*p_count = 0;
-	sqlite3_stmt *p_stmt;
-	char buffer[1024];
-	snprintf(buffer, 1024, "select count(*) FROM performance_history WHERE  history_id = '%d'", history_id);
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, buffer, p_stmt)) == SQLITE_OK)
-	{
-		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
-		{
-			*p_count = sqlite3_column_int(p_stmt, 0);
-			rc = DB_SUCCESS;
-		}
-		sqlite3_finalize(p_stmt);
-		if (sql_rc != SQLITE_ROW)
-		{
-			rc = DB_ERR_FAILURE;
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-				sql_rc);
-		}
-	}
-	else
-	{
-		rc = DB_ERR_FAILURE;
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-enum db_return_codes db_get_performance_history_count(const PersistentStore *p_ps, int *p_count)
-{
-	enum db_return_codes rc = DB_ERR_FAILURE;
-	*p_count = 0;
-	sqlite3_stmt *p_stmt;
-	char buffer[1024];
-	snprintf(buffer, 1024, "select count(*) FROM performance_history");
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, buffer, p_stmt)) == SQLITE_OK)
-	{
-		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
-		{
-			*p_count = sqlite3_column_int(p_stmt, 0);
-			rc = DB_SUCCESS;
-		}
-		sqlite3_finalize(p_stmt);
-		if (sql_rc != SQLITE_ROW)
-		{
-			rc = DB_ERR_FAILURE;
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
-				sql_rc);
-		}
-	}
-	else
-	{
-		rc = DB_ERR_FAILURE;
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-int db_get_performance_history_by_history_id(const PersistentStore *p_ps,
-	struct db_performance *p_performance,
-	int history_id,
-	int performance_count)
-{
-	int rc = DB_ERR_FAILURE;
-	memset(p_performance, 0, sizeof (struct db_performance) * performance_count);
-	sqlite3_stmt *p_stmt;
-	char *sql = "SELECT \
-		id,  dimm_uid,  time,  bytes_read,  bytes_written,  read_reqs,  host_write_cmds,  block_reads,  block_writes  \
-		FROM performance_history WHERE history_id = $history_id";
-	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
-	{
-		int index = 0;
-		BIND_INTEGER(p_stmt, "$history_id", history_id);
-		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < performance_count)
-		{
-			rc = DB_SUCCESS;
-			local_row_to_performance(p_ps, p_stmt, &p_performance[index]);
-			local_get_performance_relationships_history(p_ps, p_stmt, &p_performance[index], history_id);
-			index++;
-		}
-		sqlite3_finalize(p_stmt);
-		rc = index;
-		if (sql_rc != SQLITE_DONE)
-		{
-			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
-		}
-	}
-	else
-	{
-		rc = DB_ERR_FAILURE;
-		COMMON_LOG_ERROR_F("Preparing SQL failed, error code %d", sql_rc);
-	}
-	return rc;
-}
-enum db_return_codes db_delete_performance_history(const PersistentStore *p_ps)
-{
-	return run_sql_no_results(p_ps->db, "DELETE FROM performance_history");
-}
-
-#endif
-
-/*
- * --- END performance ----------------
- */
 /*
  * --- driver_metadata_check_diag_result ----------------
  */
@@ -34155,7 +34196,7 @@ enum db_return_codes db_add_driver_metadata_check_diag_result(const PersistentSt
 		$device_handle, \
 		$health_flag) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_driver_metadata_check_diag_result(p_stmt, p_driver_metadata_check_diag_result);
 		sql_rc = sqlite3_step(p_stmt);
@@ -34163,7 +34204,7 @@ enum db_return_codes db_add_driver_metadata_check_diag_result(const PersistentSt
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -34199,7 +34240,7 @@ int db_get_driver_metadata_check_diag_results(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < driver_metadata_check_diag_result_count)
@@ -34208,7 +34249,7 @@ int db_get_driver_metadata_check_diag_results(const PersistentStore *p_ps,
 			local_get_driver_metadata_check_diag_result_relationships(p_ps, p_stmt, &p_driver_metadata_check_diag_result[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -34257,11 +34298,11 @@ enum db_return_codes db_save_driver_metadata_check_diag_result_state(const Persi
 			$device_handle, \
 			$health_flag) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_driver_metadata_check_diag_result(p_stmt, p_driver_metadata_check_diag_result);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -34290,7 +34331,7 @@ enum db_return_codes db_save_driver_metadata_check_diag_result_state(const Persi
 				 $device_handle , \
 				 $health_flag )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_driver_metadata_check_diag_result(p_stmt, p_driver_metadata_check_diag_result);
@@ -34299,7 +34340,7 @@ enum db_return_codes db_save_driver_metadata_check_diag_result_state(const Persi
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -34330,7 +34371,7 @@ enum db_return_codes db_get_driver_metadata_check_diag_result_by_id(const Persis
 		FROM driver_metadata_check_diag_result \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -34340,7 +34381,7 @@ enum db_return_codes db_get_driver_metadata_check_diag_result_by_id(const Persis
 			local_get_driver_metadata_check_diag_result_relationships(p_ps, p_stmt, p_driver_metadata_check_diag_result);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -34371,12 +34412,12 @@ enum db_return_codes db_update_driver_metadata_check_diag_result_by_id(const Per
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_driver_metadata_check_diag_result(p_stmt, p_driver_metadata_check_diag_result);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -34398,14 +34439,14 @@ enum db_return_codes db_delete_driver_metadata_check_diag_result_by_id(const Per
 	char *sql = "DELETE FROM driver_metadata_check_diag_result \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -34498,7 +34539,7 @@ int db_get_driver_metadata_check_diag_result_history_by_history_id(const Persist
 		id,  result_type,  ns_uid,  device_handle,  health_flag  \
 		FROM driver_metadata_check_diag_result_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -34509,7 +34550,7 @@ int db_get_driver_metadata_check_diag_result_history_by_history_id(const Persist
 			local_get_driver_metadata_check_diag_result_relationships_history(p_ps, p_stmt, &p_driver_metadata_check_diag_result[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -34583,7 +34624,7 @@ enum db_return_codes db_add_boot_status_register(const PersistentStore *p_ps,
 		($device_handle, \
 		$bsr) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_boot_status_register(p_stmt, p_boot_status_register);
 		sql_rc = sqlite3_step(p_stmt);
@@ -34591,7 +34632,7 @@ enum db_return_codes db_add_boot_status_register(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -34624,7 +34665,7 @@ int db_get_boot_status_registers(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < boot_status_register_count)
@@ -34633,7 +34674,7 @@ int db_get_boot_status_registers(const PersistentStore *p_ps,
 			local_get_boot_status_register_relationships(p_ps, p_stmt, &p_boot_status_register[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -34679,11 +34720,11 @@ enum db_return_codes db_save_boot_status_register_state(const PersistentStore *p
 			($device_handle, \
 			$bsr) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_boot_status_register(p_stmt, p_boot_status_register);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -34709,7 +34750,7 @@ enum db_return_codes db_save_boot_status_register_state(const PersistentStore *p
 				 $device_handle , \
 				 $bsr )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_boot_status_register(p_stmt, p_boot_status_register);
@@ -34718,7 +34759,7 @@ enum db_return_codes db_save_boot_status_register_state(const PersistentStore *p
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -34749,7 +34790,7 @@ enum db_return_codes db_get_boot_status_register_by_device_handle(const Persiste
 		FROM boot_status_register \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -34759,7 +34800,7 @@ enum db_return_codes db_get_boot_status_register_by_device_handle(const Persiste
 			local_get_boot_status_register_relationships(p_ps, p_stmt, p_boot_status_register);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -34787,12 +34828,12 @@ enum db_return_codes db_update_boot_status_register_by_device_handle(const Persi
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_boot_status_register(p_stmt, p_boot_status_register);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -34814,14 +34855,14 @@ enum db_return_codes db_delete_boot_status_register_by_device_handle(const Persi
 	char *sql = "DELETE FROM boot_status_register \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -34914,7 +34955,7 @@ int db_get_boot_status_register_history_by_history_id(const PersistentStore *p_p
 		device_handle,  bsr  \
 		FROM boot_status_register_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -34925,7 +34966,7 @@ int db_get_boot_status_register_history_by_history_id(const PersistentStore *p_p
 			local_get_boot_status_register_relationships_history(p_ps, p_stmt, &p_boot_status_register[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -35005,7 +35046,7 @@ enum db_return_codes db_add_eafd(const PersistentStore *p_ps,
 		$blob_size, \
 		$max_fa_token_id) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_eafd(p_stmt, p_eafd);
 		sql_rc = sqlite3_step(p_stmt);
@@ -35013,7 +35054,7 @@ enum db_return_codes db_add_eafd(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -35047,7 +35088,7 @@ int db_get_eafds(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < eafd_count)
@@ -35056,7 +35097,7 @@ int db_get_eafds(const PersistentStore *p_ps,
 			local_get_eafd_relationships(p_ps, p_stmt, &p_eafd[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -35103,11 +35144,11 @@ enum db_return_codes db_save_eafd_state(const PersistentStore *p_ps,
 			$blob_size, \
 			$max_fa_token_id) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_eafd(p_stmt, p_eafd);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -35134,7 +35175,7 @@ enum db_return_codes db_save_eafd_state(const PersistentStore *p_ps,
 				 $blob_size , \
 				 $max_fa_token_id )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_eafd(p_stmt, p_eafd);
@@ -35143,7 +35184,7 @@ enum db_return_codes db_save_eafd_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -35174,7 +35215,7 @@ enum db_return_codes db_get_eafd_by_device_handle(const PersistentStore *p_ps,
 		FROM eafd \
 		WHERE  device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		sql_rc = sqlite3_step(p_stmt);
@@ -35184,7 +35225,7 @@ enum db_return_codes db_get_eafd_by_device_handle(const PersistentStore *p_ps,
 			local_get_eafd_relationships(p_ps, p_stmt, p_eafd);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -35213,12 +35254,12 @@ enum db_return_codes db_update_eafd_by_device_handle(const PersistentStore *p_ps
 		  \
 	WHERE device_handle=$device_handle ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		local_bind_eafd(p_stmt, p_eafd);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -35240,14 +35281,14 @@ enum db_return_codes db_delete_eafd_by_device_handle(const PersistentStore *p_ps
 	char *sql = "DELETE FROM eafd \
 				 WHERE device_handle = $device_handle";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$device_handle", (unsigned int)device_handle);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -35340,7 +35381,7 @@ int db_get_eafd_history_by_history_id(const PersistentStore *p_ps,
 		device_handle,  blob_size,  max_fa_token_id  \
 		FROM eafd_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -35351,7 +35392,7 @@ int db_get_eafd_history_by_history_id(const PersistentStore *p_ps,
 			local_get_eafd_relationships_history(p_ps, p_stmt, &p_eafd[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -36038,7 +36079,7 @@ enum db_return_codes db_add_interleave_set(const PersistentStore *p_ps,
 		$cookie_v1_1, \
 		$cookie_v1_2) ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		local_bind_interleave_set(p_stmt, p_interleave_set);
 		sql_rc = sqlite3_step(p_stmt);
@@ -36046,7 +36087,7 @@ enum db_return_codes db_add_interleave_set(const PersistentStore *p_ps,
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -36182,7 +36223,7 @@ int db_get_interleave_sets(const PersistentStore *p_ps,
 		";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		while ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW && index < interleave_set_count)
@@ -36191,7 +36232,7 @@ int db_get_interleave_sets(const PersistentStore *p_ps,
 			local_get_interleave_set_relationships(p_ps, p_stmt, &p_interleave_set[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d",
@@ -36337,11 +36378,11 @@ enum db_return_codes db_save_interleave_set_state(const PersistentStore *p_ps,
 			$cookie_v1_1, \
 			$cookie_v1_2) ";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			local_bind_interleave_set(p_stmt, p_interleave_set);
 			sql_rc = sqlite3_step(p_stmt);
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -36470,7 +36511,7 @@ enum db_return_codes db_save_interleave_set_state(const PersistentStore *p_ps,
 				 $cookie_v1_1 , \
 				 $cookie_v1_2 )";
 		int sql_rc;
-		if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+		if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 		{
 			BIND_INTEGER(p_stmt, "$history_id", history_id);
 			local_bind_interleave_set(p_stmt, p_interleave_set);
@@ -36479,7 +36520,7 @@ enum db_return_codes db_save_interleave_set_state(const PersistentStore *p_ps,
 			{
 				rc = DB_SUCCESS;
 			}
-			sqlite3_finalize(p_stmt);
+			SQLITE_RELEASE(p_ps, sql, p_stmt);
 			if (sql_rc != SQLITE_DONE)
 			{
 				rc = DB_ERR_FAILURE;
@@ -36508,7 +36549,7 @@ enum db_return_codes db_get_interleave_set_by_id(const PersistentStore *p_ps,
 		FROM interleave_set \
 		WHERE  id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		sql_rc = sqlite3_step(p_stmt);
@@ -36518,7 +36559,7 @@ enum db_return_codes db_get_interleave_set_by_id(const PersistentStore *p_ps,
 			local_get_interleave_set_relationships(p_ps, p_stmt, p_interleave_set);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -36649,12 +36690,12 @@ enum db_return_codes db_update_interleave_set_by_id(const PersistentStore *p_ps,
 		  \
 	WHERE id=$id ";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		local_bind_interleave_set(p_stmt, p_interleave_set);
 		sql_rc = sqlite3_step(p_stmt);
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -36676,14 +36717,14 @@ enum db_return_codes db_delete_interleave_set_by_id(const PersistentStore *p_ps,
 	char *sql = "DELETE FROM interleave_set \
 				 WHERE id = $id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$id", (int)id);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -36773,7 +36814,7 @@ int db_get_interleave_set_history_by_history_id(const PersistentStore *p_ps,
 		id,  socket_id,  size,  available_size,  attributes,  dimm_count,  dimm_handles_0,  dimm_handles_1,  dimm_handles_2,  dimm_handles_3,  dimm_handles_4,  dimm_handles_5,  dimm_handles_6,  dimm_handles_7,  dimm_handles_8,  dimm_handles_9,  dimm_handles_10,  dimm_handles_11,  dimm_handles_12,  dimm_handles_13,  dimm_handles_14,  dimm_handles_15,  dimm_handles_16,  dimm_handles_17,  dimm_handles_18,  dimm_handles_19,  dimm_handles_20,  dimm_handles_21,  dimm_handles_22,  dimm_handles_23,  dimm_region_pdas_0,  dimm_region_pdas_1,  dimm_region_pdas_2,  dimm_region_pdas_3,  dimm_region_pdas_4,  dimm_region_pdas_5,  dimm_region_pdas_6,  dimm_region_pdas_7,  dimm_region_pdas_8,  dimm_region_pdas_9,  dimm_region_pdas_10,  dimm_region_pdas_11,  dimm_region_pdas_12,  dimm_region_pdas_13,  dimm_region_pdas_14,  dimm_region_pdas_15,  dimm_region_pdas_16,  dimm_region_pdas_17,  dimm_region_pdas_18,  dimm_region_pdas_19,  dimm_region_pdas_20,  dimm_region_pdas_21,  dimm_region_pdas_22,  dimm_region_pdas_23,  dimm_region_offsets_0,  dimm_region_offsets_1,  dimm_region_offsets_2,  dimm_region_offsets_3,  dimm_region_offsets_4,  dimm_region_offsets_5,  dimm_region_offsets_6,  dimm_region_offsets_7,  dimm_region_offsets_8,  dimm_region_offsets_9,  dimm_region_offsets_10,  dimm_region_offsets_11,  dimm_region_offsets_12,  dimm_region_offsets_13,  dimm_region_offsets_14,  dimm_region_offsets_15,  dimm_region_offsets_16,  dimm_region_offsets_17,  dimm_region_offsets_18,  dimm_region_offsets_19,  dimm_region_offsets_20,  dimm_region_offsets_21,  dimm_region_offsets_22,  dimm_region_offsets_23,  dimm_sizes_0,  dimm_sizes_1,  dimm_sizes_2,  dimm_sizes_3,  dimm_sizes_4,  dimm_sizes_5,  dimm_sizes_6,  dimm_sizes_7,  dimm_sizes_8,  dimm_sizes_9,  dimm_sizes_10,  dimm_sizes_11,  dimm_sizes_12,  dimm_sizes_13,  dimm_sizes_14,  dimm_sizes_15,  dimm_sizes_16,  dimm_sizes_17,  dimm_sizes_18,  dimm_sizes_19,  dimm_sizes_20,  dimm_sizes_21,  dimm_sizes_22,  dimm_sizes_23,  pcd_interleave_index,  cookie_v1_1,  cookie_v1_2  \
 		FROM interleave_set_history WHERE history_id = $history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		int index = 0;
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -36784,7 +36825,7 @@ int db_get_interleave_set_history_by_history_id(const PersistentStore *p_ps,
 			local_get_interleave_set_relationships_history(p_ps, p_stmt, &p_interleave_set[index], history_id);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		rc = index;
 		if (sql_rc != SQLITE_DONE)
 		{
@@ -36866,7 +36907,7 @@ enum db_return_codes db_get_interleave_set_count_by_dimm_interleave_set_index_id
 	const char *sql = "SELECT COUNT (*) FROM interleave_set WHERE pcd_interleave_index = $pcd_interleave_index";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$pcd_interleave_index", (unsigned int)pcd_interleave_index);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_ROW)
@@ -36874,7 +36915,7 @@ enum db_return_codes db_get_interleave_set_count_by_dimm_interleave_set_index_id
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_ROW)
 		{
 			rc = DB_ERR_FAILURE;
@@ -36901,7 +36942,7 @@ enum db_return_codes db_get_interleave_set_count_by_dimm_interleave_set_index_id
 			"AND history_id=$history_id";
 	sqlite3_stmt *p_stmt;
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$pcd_interleave_index", (unsigned int)pcd_interleave_index);
 		BIND_INTEGER(p_stmt, "$history_id", history_id);
@@ -36910,7 +36951,7 @@ enum db_return_codes db_get_interleave_set_count_by_dimm_interleave_set_index_id
 			*p_count = sqlite3_column_int(p_stmt, 0);
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			rc = DB_ERR_FAILURE;
@@ -36937,7 +36978,7 @@ enum db_return_codes db_get_interleave_sets_by_dimm_interleave_set_index_id(cons
 		FROM interleave_set \
 		WHERE  pcd_interleave_index = $pcd_interleave_index";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$pcd_interleave_index", (unsigned int)pcd_interleave_index);
@@ -36948,7 +36989,7 @@ enum db_return_codes db_get_interleave_sets_by_dimm_interleave_set_index_id(cons
 			local_get_interleave_set_relationships(p_ps, p_stmt, &p_interleave_set[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -36973,7 +37014,7 @@ enum db_return_codes db_get_interleave_sets_by_dimm_interleave_set_index_id_hist
 		FROM interleave_set_history \
 		WHERE  pcd_interleave_index = $pcd_interleave_index AND history_id=$history_id";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		rc = DB_SUCCESS;
 		BIND_INTEGER(p_stmt, "$pcd_interleave_index", (unsigned int)pcd_interleave_index);
@@ -36985,7 +37026,7 @@ enum db_return_codes db_get_interleave_sets_by_dimm_interleave_set_index_id_hist
 			local_get_interleave_set_relationships(p_ps, p_stmt, &p_interleave_set[index]);
 			index++;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -37006,14 +37047,14 @@ enum db_return_codes db_delete_interleave_set_by_dimm_interleave_set_index_id(co
 	char *sql = "DELETE FROM interleave_set \
 				 WHERE pcd_interleave_index = $pcd_interleave_index";
 	int sql_rc;
-	if ((sql_rc = SQLITE_PREPARE(p_ps->db, sql, p_stmt)) == SQLITE_OK)
+	if ((sql_rc = SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt)) == SQLITE_OK)
 	{
 		BIND_INTEGER(p_stmt, "$pcd_interleave_index", (unsigned int)pcd_interleave_index);
 		if ((sql_rc = sqlite3_step(p_stmt)) == SQLITE_DONE)
 		{
 			rc = DB_SUCCESS;
 		}
-		sqlite3_finalize(p_stmt);
+		SQLITE_RELEASE(p_ps, sql, p_stmt);
 		if (sql_rc != SQLITE_DONE)
 		{
 			COMMON_LOG_ERROR_F("Running SQL failed, error code %d", sql_rc);
@@ -37186,13 +37227,6 @@ enum db_return_codes db_clear_history(PersistentStore *p_ps)
 	
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM software_trigger_info_history"));
 	
-#if 0
-//NON-HISTORY TABLE
-
-	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM performance_history"));
-	
-#endif
-
 #if 0
 //NON-HISTORY TABLE
 
@@ -37217,6 +37251,7 @@ enum db_return_codes db_clear_history(PersistentStore *p_ps)
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM interleave_set_history"));
 	
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM history"));
+	KEEP_DB_ERROR(rc, db_prune_history_content(p_ps));
 	return rc;
 }
 /*
@@ -37436,14 +37471,6 @@ enum db_return_codes db_clear_state(PersistentStore *p_ps)
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM software_trigger_info_history"));
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM software_trigger_info"));
 	
-#if 0
-//NON-HISTORY TABLE
-
-	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM performance_history"));
-	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM performance"));
-	
-#endif
-
 #if 0
 //NON-HISTORY TABLE
 
@@ -37472,6 +37499,7 @@ enum db_return_codes db_clear_state(PersistentStore *p_ps)
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM interleave_set"));
 	
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, "DELETE FROM history"));
+	KEEP_DB_ERROR(rc, db_prune_history_content(p_ps));
 	return rc;
 }
 /*
@@ -37873,17 +37901,6 @@ enum db_return_codes db_roll_history(PersistentStore *p_ps, int max)
 				"(SELECT history_id FROM history ORDER BY ROWID DESC LIMIT %d)", max); 
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, sql));
 	
-#if 0
-//NON-HISTORY TABLE
-
-	snprintf(sql, 1024,
-				"DELETE FROM performance_history "
-				"WHERE history_id NOT IN "
-				"(SELECT history_id FROM history ORDER BY ROWID DESC LIMIT %d)", max); 
-	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, sql));
-	
-#endif
-
 #if 0
 //NON-HISTORY TABLE
 
@@ -37928,6 +37945,7 @@ enum db_return_codes db_roll_history(PersistentStore *p_ps, int max)
 				"WHERE history_id NOT IN "
 				"(SELECT history_id FROM history ORDER BY ROWID DESC LIMIT %d)", max); 
 	KEEP_DB_ERROR(rc, run_sql_no_results(p_ps->db, sql));
+	KEEP_DB_ERROR(rc, db_prune_history_content(p_ps));
 	db_end_transaction(p_ps);
 	return rc;
 }
@@ -73,6 +73,47 @@ NVM_COMMON_API PersistentStore *create_PersistentStore(const char *path, int for
  * @ingroup db_schema
  */
 NVM_COMMON_API PersistentStore *open_PersistentStore(const char *path);
+/*!
+ * Creates the memory for and instantiates a new read only PersistentStore object.
+ * It assumes the store already exists.
+ * @param path
+ *		Path to the existing PersistentStore file
+ * @return A pointer to the PersistentStore created.  @ref free_PersistentStore should be called on this pointer
+ * to close the file and free memory
+ * @ingroup db_schema
+ */
+NVM_COMMON_API PersistentStore *open_readonly_PersistentStore(const char *path);
+/*!
+ * Set the journal mode and page cache size of a PersistentStore
+ * @param[in] p_ps Pointer to the PersistentStore to act upon
+ * @param[in] wal If non-zero use write-ahead logging with synchronous=NORMAL,
+ *		otherwise use the default rollback journal
+ * @param[in] cache_size_kb Page cache size in KiB, 0 keeps the SQLite default
+ * @return enum db_return_codes
+ * @ingroup db_schema
+ */
+NVM_COMMON_API enum db_return_codes configure_PersistentStore(PersistentStore *p_ps,
+		int wal, int cache_size_kb);
+/*!
+ * Checkpoint the write-ahead log of a PersistentStore in WAL mode
+ * @param[in] p_ps Pointer to the PersistentStore to act upon
+ * @param[in] truncate If non-zero wait for readers and truncate the WAL file,
+ *		otherwise copy only what can be copied without blocking
+ * @return enum db_return_codes
+ * @ingroup db_schema
+ */
+NVM_COMMON_API enum db_return_codes checkpoint_PersistentStore(PersistentStore *p_ps,
+		int truncate);
+/*!
+ * Write a consistent copy of the database to a new file using the online backup API.
+ * Unlike copying the file, this includes changes still in the write-ahead log.
+ * @param[in] p_ps Pointer to the PersistentStore to copy
+ * @param[in] path Path of the file to create
+ * @return enum db_return_codes
+ * @ingroup db_schema
+ */
+NVM_COMMON_API enum db_return_codes backup_PersistentStore(PersistentStore *p_ps,
+		const char *path);
 /*!
  * Close and free the PersistentStore
  * @param Pointer to the PersistentStore created by create_PersistentStore or open_PersistentStore
@@ -106,6 +147,11 @@ NVM_COMMON_API enum db_return_codes db_begin_transaction(PersistentStore *p_ps);
  * @ingroup db_schema
  */
 NVM_COMMON_API enum db_return_codes db_end_transaction(PersistentStore *p_ps);
+/*!
+ * Check whether a transaction is open on the connection
+ * @ingroup db_schema
+ */
+NVM_COMMON_API int db_in_transaction(PersistentStore *p_ps);
 /*!
  * undo any changes made within a transaction
  * @ingroup db_schema
@@ -346,6 +392,19 @@ NVM_COMMON_API void db_print_log(struct db_log *p_value);
  * @return return_code whether or not it was successful
  */
 NVM_COMMON_API enum db_return_codes db_add_log(const PersistentStore *p_ps, struct db_log *p_log);
+/*!
+ * Create a batch of new rows in the log table
+ * @ingroup log
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] p_logs
+ *		Array of objects to be saved to the log table
+ * @param[in] log_count
+ *		Size of p_logs
+ * @return return_code whether or not it was successful
+ */
+NVM_COMMON_API enum db_return_codes db_add_logs(const PersistentStore *p_ps,
+	struct db_log *p_logs, const int log_count);
 /*!
  * Get the total number of logs
  * @param[in] p_ps
@@ -563,6 +622,88 @@ NVM_COMMON_API int db_get_events(const PersistentStore *p_ps,
  */	
 NVM_COMMON_API enum db_return_codes db_delete_all_events(const PersistentStore *p_ps);
 
+#define	DB_EVENT_FILTER_TYPE	0x001 //!< type equals db_event_filter.type
+#define	DB_EVENT_FILTER_MIN_TYPE	0x002 //!< type is at least db_event_filter.type
+#define	DB_EVENT_FILTER_MIN_SEVERITY	0x004 //!< severity is at least db_event_filter.severity
+#define	DB_EVENT_FILTER_CODE	0x008 //!< code equals db_event_filter.code
+#define	DB_EVENT_FILTER_UID	0x010 //!< uid equals db_event_filter.uid
+#define	DB_EVENT_FILTER_AFTER_TIME	0x020 //!< time is after db_event_filter.after_time
+#define	DB_EVENT_FILTER_BEFORE_TIME	0x040 //!< time is before db_event_filter.before_time
+#define	DB_EVENT_FILTER_ID	0x080 //!< id equals db_event_filter.id
+#define	DB_EVENT_FILTER_ACTION_REQUIRED	0x100 //!< action_required equals db_event_filter.action_required
+#define	DB_EVENT_FILTER_ID_RANGE	0x200 //!< id is after db_event_filter.after_id up to through_id
+/*!
+ * Predicates on the event table evaluated by SQLite
+ * @ingroup event
+ */
+struct db_event_filter
+{
+	unsigned int filter_mask; //!< DB_EVENT_FILTER_* flags of the fields used
+	unsigned int type;
+	unsigned int severity;
+	unsigned int code;
+	char uid[EVENT_UID_LEN];
+	unsigned long long after_time;
+	unsigned long long before_time;
+	int id;
+	unsigned int action_required;
+	int after_id;
+	int through_id;
+};
+/*!
+ * Return the number of events matching a filter
+ * @ingroup event
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] p_filter
+ *		Filter to apply, NULL matches all events
+ * @param[out] p_count
+ *		Number of matching events
+ * @return return_code whether or not it was successful
+ */
+NVM_COMMON_API enum db_return_codes db_get_event_count_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter,
+	int *p_count);
+/*!
+ * Get the events matching a filter, newest first
+ * @ingroup event
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] p_filter
+ *		Filter to apply, NULL matches all events
+ * @param[out] p_event
+ *		Pointer to memory to hold row results
+ * @param[in] event_count
+ *		Maximum number of rows to return
+ * @return The number of rows (to max of event_count) on success.  DB_FAILURE on failure.
+ */
+NVM_COMMON_API int db_get_events_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter,
+	struct db_event *p_event,
+	int event_count);
+/*!
+ * Delete the events matching a filter
+ * @ingroup event
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] p_filter
+ *		Filter to apply, NULL matches all events
+ * @return The number of rows deleted on success.  DB_FAILURE on failure.
+ */
+NVM_COMMON_API int db_delete_events_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter);
+/*!
+ * Clear action_required on the events matching a filter
+ * @ingroup event
+ * @param[in] p_ps
+ *		Pointer to the PersistentStore
+ * @param[in] p_filter
+ *		Filter to apply, NULL matches all events
+ * @return The number of rows acknowledged on success.  DB_FAILURE on failure.
+ */
+NVM_COMMON_API int db_acknowledge_events_by_filter(const PersistentStore *p_ps,
+	const struct db_event_filter *p_filter);
+
 #if 0
 //NON-HISTORY TABLE
 
@@ -11265,185 +11406,6 @@ NVM_COMMON_API enum db_return_codes db_delete_software_trigger_info_by_device_ha
 	struct db_software_trigger_info *p_software_trigger_info,
 	int history_id,
 	int software_trigger_info_count);
-/*!
- * @defgroup performance performance 
- * @ingroup db_schema
- */
- // Lengths for strings and arrays
-#define	PERFORMANCE_DIMM_UID_LEN 37 //!< Max length for dimm_uid
-/*!
- * struct representing the performance table
- * @ingroup performance
- */
-struct db_performance
-{
-	int id;
-	char   dimm_uid[PERFORMANCE_DIMM_UID_LEN];
-	unsigned long long time;
-	unsigned long long bytes_read;
-	unsigned long long bytes_written;
-	unsigned long long read_reqs;
-	unsigned long long host_write_cmds;
-	unsigned long long block_reads;
-	unsigned long long block_writes;
-};
-/*!
- * Helper function to print a db_performance to the screen.
- * @ingroup performance
- * @param p_performance
- * 		value to print
- * @return
- *		void
- */
-NVM_COMMON_API void db_print_performance(struct db_performance *p_value);
-/*!
- * Create a new row in the performance table
- * @ingroup performance
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[in] p_performance
- *		Pointer to the object to be saved to the performance table
- * @return return_code whether or not it was successful
- */
-NVM_COMMON_API enum db_return_codes db_add_performance(const PersistentStore *p_ps, struct db_performance *p_performance);
-/*!
- * Get the total number of performances
- * @param[in] p_ps
- *		Pointer to the instance of the PersistentStore
- * @param[out] p_count
- * 		Set to the number of performances
- * @return whether successful or not
- */
-NVM_COMMON_API enum db_return_codes db_get_performance_count(const PersistentStore *p_ps, int *p_count);
-/*!
- * Return all performances
- * @ingroup performance
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[out] p_performance
- *		Pointer to an array of performance objects that will contain all the performances
- * @param[in] performance_count
- *		Size of p_performance
- * @return The number of row (to max of performance_count) on success.  DB_FAILURE on failure.
- */
-NVM_COMMON_API int db_get_performances(const PersistentStore *p_ps,
-	struct db_performance
-	*p_performance,
-	int performance_count);
-/*!
- * Truncate all the data in the performance table
- * @ingroup 
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @return return_code whether or not it was successful
- */	
-NVM_COMMON_API enum db_return_codes db_delete_all_performances(const PersistentStore *p_ps);
-
-#if 0
-//NON-HISTORY TABLE
-
-/*!
- * delete all entries from performance history
- * @ingroup performance
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @return return_code whether or not it was successful
- */
- NVM_COMMON_API enum db_return_codes db_delete_performance_history(const PersistentStore *p_ps);
- 
-#endif
-
-/*!
- * save performance state
- * @ingroup performance
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[in] history_id
- *		ID of the history to add the performance to
- * @param[in] p_performance
- *		performance to save to history
- * @return return_code whether or not it was successful
- */
-NVM_COMMON_API enum db_return_codes db_save_performance_state(const PersistentStore *p_ps,
-	int history_id,
-	struct db_performance *p_performance);
-/*!
- * Return a specific performance for a given id
- * @ingroup performance
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[in] id
- *		id to identify the correct performance
- * @param[out] p_performance
- *		struct to put the performance retrieved
- * @return return_code whether or not it was successful
- */
-NVM_COMMON_API enum db_return_codes db_get_performance_by_id(const PersistentStore *p_ps,
-	const int id,
-	struct db_performance *p_performance);
-/*!
- * Update a specific performance given the original id
- * @ingroup performance
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[in] id
- * 		id points to the performance to update
- * @param[in] *p_updated_performance
- *		structure with new values for the performance
- * @return return_code whether or not it was successful
- */
-NVM_COMMON_API enum db_return_codes db_update_performance_by_id(const PersistentStore *p_ps,
-	const int id,
-	struct db_performance *p_updated_performance);
-/*!
- * Delete a specific performance given the id
- * @ingroup performance
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[in] id
- *		id points to the record to delete
- * @return return_code whether or not it was successful
- */
-NVM_COMMON_API enum db_return_codes db_delete_performance_by_id(const PersistentStore *p_ps,
-	const int id);
-/*!
- * Return number of matching history rows
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[in] history_id
- *		history_id of rows to count
- * @param[out] count
- *		count of rows matching this history_id
- * @return The number of row (to max of performance_count) on success.  DB_FAILURE on failure.
- */
- NVM_COMMON_API enum db_return_codes db_get_performance_history_by_history_id_count(const PersistentStore *p_ps, 
-	int history_id,
-	int *p_count);
-/*!
- * Return number of history rows
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[out] count
- *		count of rows matching this history_id
- * @return The number of row (to max of performance_count) on success.  DB_FAILURE on failure.
- */
- NVM_COMMON_API enum db_return_codes db_get_performance_history_count(const PersistentStore *p_ps, int *p_count);
-/*!
- * Return all rows of matching custom sql
- * @param[in] p_ps
- *		Pointer to the PersistentStore
- * @param[out] struct db_performance
- *		Structure type for row results
- * @param[in] p_performance
- *		Pointer to memory to hold row results
- * @param[in] history_id
- *		history_id of rows to return
- * @return The number of row (to max of performance_count) on success.  DB_FAILURE on failure.
- */
- NVM_COMMON_API int db_get_performance_history_by_history_id(const PersistentStore *p_ps,
-	struct db_performance *p_performance,
-	int history_id,
-	int performance_count);
 /*!
  * @defgroup driver_metadata_check_diag_result driver_metadata_check_diag_result 
  * @ingroup db_schema
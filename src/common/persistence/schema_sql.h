@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file declares the SQL helpers of schema.c for the tables that are written by
+ * hand instead of being generated from schema.txt. It is not part of the public
+ * persistence interface.
+ */
+
+#ifndef	_SCHEMA_SQL_H_
+#define	_SCHEMA_SQL_H_
+
+#include <string.h>
+#include <sqlite3.h>
+#include "schema.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define	SQLITE_PREPARE(db, sql, p_stmt) \
+		sqlite3_prepare_v2((db), (sql), strlen(sql) + 1, (&p_stmt), NULL)
+
+/*
+ * Prepare a statement whose SQL is a string literal, reusing the one cached by an earlier
+ * call. Must be paired with SQLITE_RELEASE.
+ */
+#define	SQLITE_PREPARE_CACHED(p_ps, sql, p_stmt) \
+		prepare_cached_stmt((p_ps), (sql), &(p_stmt))
+
+#define	SQLITE_RELEASE(p_ps, sql, p_stmt) \
+		release_cached_stmt((p_ps), (sql), (p_stmt))
+
+#define	INTEGER_COLUMN(p_stmt, col, dest) \
+	{ \
+		dest = sqlite3_column_int64(p_stmt, col); \
+	}
+
+#define	TEXT_COLUMN(p_stmt, col, dest, len) \
+	{\
+		if (sqlite3_column_bytes(p_stmt, col) > 0) \
+		{ \
+			db_strcpy((char *)dest, (char *)sqlite3_column_text(p_stmt, col), len); \
+		}\
+	}
+
+#define	BIND_TEXT(p_stmt, parameter, text) \
+		sqlite3_bind_text(p_stmt, \
+			sqlite3_bind_parameter_index(p_stmt, parameter), \
+			(char *)(text), -1, SQLITE_STATIC)
+
+#define	BIND_INTEGER(p_stmt, parameter, value) \
+		sqlite3_bind_int64(p_stmt, \
+			sqlite3_bind_parameter_index(p_stmt, parameter), \
+			value)
+
+#define	KEEP_DB_ERROR(rc, rc_new)	rc = (rc < DB_SUCCESS) ? rc : rc_new;
+
+/*
+ * Get the connection behind a PersistentStore
+ */
+sqlite3 *get_PersistentStore_db(const PersistentStore *p_ps);
+
+int prepare_cached_stmt(const PersistentStore *p_ps, const char *sql, sqlite3_stmt **pp_stmt);
+void release_cached_stmt(const PersistentStore *p_ps, const char *sql, sqlite3_stmt *p_stmt);
+
+enum db_return_codes run_sql_no_results(sqlite3 *p_db, const char *sql);
+int table_exists(sqlite3 *p_db, const char *table);
+char *db_strcpy(char *dst, const char *src, size_t dst_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SCHEMA_SQL_H_ */
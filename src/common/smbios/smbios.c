@@ -32,6 +32,7 @@
 
 #include "smbios.h"
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <string/s_str.h>
 
@@ -275,3 +276,149 @@ int smbios_get_structure_count_of_type(const enum smbios_structure_type type,
 
 	return count;
 }
+
+/*
+ * Order index entries by key, then by table order
+ */
+int smbios_compare_index_entries(const void *p_a, const void *p_b)
+{
+	const struct smbios_index_entry *p_entry_a = (const struct smbios_index_entry *)p_a;
+	const struct smbios_index_entry *p_entry_b = (const struct smbios_index_entry *)p_b;
+	int diff = (int)p_entry_a->key - (int)p_entry_b->key;
+	if (diff == 0)
+	{
+		diff = p_entry_a->position - p_entry_b->position;
+	}
+	return diff;
+}
+
+/*
+ * Binary search an index for the entries with a key.
+ * Returns the number found and points pp_entries at the first of them.
+ */
+int smbios_find_index_entries(const struct smbios_index_entry *p_entries, const int count,
+		const COMMON_UINT16 key, const struct smbios_index_entry **pp_entries)
+{
+	int low = 0;
+	int high = count;
+	while (low < high)
+	{
+		int mid = low + ((high - low) / 2);
+		if (p_entries[mid].key < key)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	int found = 0;
+	while ((low + found) < count && p_entries[low + found].key == key)
+	{
+		found++;
+	}
+	*pp_entries = found ? &p_entries[low] : NULL;
+	return found;
+}
+
+int smbios_index_table(const struct smbios_structure_header *p_top,
+		const size_t data_length, struct smbios_table_index *p_index)
+{
+	int rc = COMMON_SUCCESS;
+
+	if (p_index == NULL || p_top == NULL)
+	{
+		rc = COMMON_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		memset(p_index, 0, sizeof (*p_index));
+
+		// count the structures so the indexes are allocated once
+		int count = 0;
+		size_t remaining_length = data_length;
+		const struct smbios_structure_header *p_current = p_top;
+		while (p_current && remaining_length >= sizeof (struct smbios_structure_header))
+		{
+			count++;
+			p_current = smbios_get_next_structure(p_current, &remaining_length);
+		}
+
+		if (count > 0)
+		{
+			p_index->p_structures = calloc(count, sizeof (struct smbios_structure_ref));
+			p_index->p_by_handle = calloc(count, sizeof (struct smbios_index_entry));
+			p_index->p_by_type = calloc(count, sizeof (struct smbios_index_entry));
+			if (!p_index->p_structures || !p_index->p_by_handle || !p_index->p_by_type)
+			{
+				smbios_free_table_index(p_index);
+				rc = COMMON_ERR_NOMEMORY;
+			}
+			else
+			{
+				remaining_length = data_length;
+				p_current = p_top;
+				for (int i = 0; i < count; i++)
+				{
+					p_index->p_structures[i].p_structure = p_current;
+					p_index->p_structures[i].remaining_length = remaining_length;
+					p_index->p_by_handle[i].key = p_current->handle;
+					p_index->p_by_handle[i].position = i;
+					p_index->p_by_type[i].key = p_current->type;
+					p_index->p_by_type[i].position = i;
+					p_current = smbios_get_next_structure(p_current, &remaining_length);
+				}
+				p_index->structure_count = count;
+
+				qsort(p_index->p_by_handle, count, sizeof (struct smbios_index_entry),
+						smbios_compare_index_entries);
+				qsort(p_index->p_by_type, count, sizeof (struct smbios_index_entry),
+						smbios_compare_index_entries);
+			}
+		}
+	}
+
+	return rc;
+}
+
+void smbios_free_table_index(struct smbios_table_index *p_index)
+{
+	if (p_index)
+	{
+		free(p_index->p_structures);
+		free(p_index->p_by_handle);
+		free(p_index->p_by_type);
+		memset(p_index, 0, sizeof (*p_index));
+	}
+}
+
+const struct smbios_structure_ref *smbios_index_get_structure_with_handle(
+		const struct smbios_table_index *p_index, const COMMON_UINT16 handle)
+{
+	const struct smbios_structure_ref *p_ref = NULL;
+	const struct smbios_index_entry *p_entry = NULL;
+
+	if (p_index && smbios_find_index_entries(p_index->p_by_handle,
+			p_index->structure_count, handle, &p_entry))
+	{
+		p_ref = &p_index->p_structures[p_entry->position];
+	}
+
+	return p_ref;
+}
+
+int smbios_index_get_structures_of_type(const struct smbios_table_index *p_index,
+		const enum smbios_structure_type type, const struct smbios_index_entry **pp_entries)
+{
+	int count = 0;
+
+	if (p_index && pp_entries)
+	{
+		count = smbios_find_index_entries(p_index->p_by_type, p_index->structure_count,
+				(COMMON_UINT16)type, pp_entries);
+	}
+
+	return count;
+}
@@ -89,4 +89,59 @@ NVM_COMMON_API void smbios_copy_structure_string_to_buffer(const struct smbios_s
 NVM_COMMON_API int smbios_get_structure_count_of_type(const enum smbios_structure_type type,
 		const struct smbios_structure_header *p_top, const size_t data_length);
 
+/*
+ * A structure in an indexed SMBIOS table
+ */
+struct smbios_structure_ref
+{
+	const struct smbios_structure_header *p_structure;
+	size_t remaining_length; // bytes from the structure to the end of the table
+};
+
+/*
+ * An entry in an SMBIOS table index, entries sharing a key are in table order
+ */
+struct smbios_index_entry
+{
+	COMMON_UINT16 key;
+	int position; // position in smbios_table_index.p_structures
+};
+
+/*
+ * Lookup indexes over an SMBIOS table built by smbios_index_table.
+ * The table must outlive the index.
+ */
+struct smbios_table_index
+{
+	int structure_count;
+	struct smbios_structure_ref *p_structures; // in table order
+	struct smbios_index_entry *p_by_handle;
+	struct smbios_index_entry *p_by_type;
+};
+
+/*
+ * Walk the table once and index its structures by handle and type.
+ * Free with smbios_free_table_index.
+ */
+NVM_COMMON_API int smbios_index_table(const struct smbios_structure_header *p_top,
+		const size_t data_length, struct smbios_table_index *p_index);
+
+/*
+ * Free the indexes built by smbios_index_table
+ */
+NVM_COMMON_API void smbios_free_table_index(struct smbios_table_index *p_index);
+
+/*
+ * Returns the first structure with a given handle in an indexed table, NULL if not found.
+ */
+NVM_COMMON_API const struct smbios_structure_ref *smbios_index_get_structure_with_handle(
+		const struct smbios_table_index *p_index, const COMMON_UINT16 handle);
+
+/*
+ * Returns the number of structures of a given type in an indexed table and
+ * points pp_entries at the first of them.
+ */
+NVM_COMMON_API int smbios_index_get_structures_of_type(const struct smbios_table_index *p_index,
+		const enum smbios_structure_type type, const struct smbios_index_entry **pp_entries);
+
 #endif /* SRC_COMMON_SMBIOS_H_ */
@@ -36,6 +36,9 @@
 #include <ctype.h>
 #include "time_utilities.h"
 #include <string/s_str.h>
+#ifdef __WINDOWS__
+#include <windows.h>
+#endif
 
 #define	TEMP_TIMESTR_LEN 15
 
@@ -49,6 +52,20 @@ void get_current_time_msec(unsigned long long *nvm_time)
 	*nvm_time *= 1000;
 }
 
+/*
+ * Gets a monotonic time in msecs
+ */
+void get_monotonic_time_msec(unsigned long long *nvm_time)
+{
+#ifdef __WINDOWS__
+	*nvm_time = GetTickCount64();
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	*nvm_time = (unsigned long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+#endif
+}
+
 /*
  * Get the current time as a formatted datetime string
  */
@@ -80,6 +80,14 @@ enum datetime_type
  */
 NVM_COMMON_API extern void get_current_time_msec(unsigned long long *nvm_time);
 
+/*!
+ * Gets a monotonic time in ms, unaffected by changes to the system clock.
+ * Only differences between two readings are meaningful.
+ * @param[out] nvm_time
+ *		A pointer to the time
+ */
+NVM_COMMON_API extern void get_monotonic_time_msec(unsigned long long *nvm_time);
+
 /*!
  * Get the current time string formatted as @b yyyyMMddHHmmss.mmmmmmsutc
  * @remarks
@@ -141,6 +141,13 @@ int LibWrapper::getDeviceStatus(const NVM_UID deviceUid, struct device_status *p
 	return nvm_get_device_status(deviceUid, pStatus);
 }
 
+int LibWrapper::getAllDeviceStatuses(struct device_status_entry *pStatuses,
+	const NVM_UINT8 count) const
+{
+	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+	return nvm_get_all_device_statuses(pStatuses, count);
+}
+
 int LibWrapper::getDeviceSettings(const NVM_UID deviceUid,
 	struct device_settings *pSettings) const
 {
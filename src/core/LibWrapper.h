@@ -70,6 +70,9 @@ public:
 
 	virtual int getDeviceStatus(const NVM_UID deviceUid, struct device_status *pStatus) const;
 
+	virtual int getAllDeviceStatuses(struct device_status_entry *pStatuses,
+		const NVM_UINT8 count) const;
+
 	virtual int getDeviceSettings(const NVM_UID deviceUid,
 		struct device_settings *pSettings) const;
 
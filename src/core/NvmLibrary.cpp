@@ -336,6 +336,35 @@ struct device_status NvmLibrary::getDeviceStatus(const std::string &deviceUid)
 
 }
 
+std::vector<struct device_status_entry> NvmLibrary::getAllDeviceStatuses()
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	int rc;
+
+	std::vector<struct device_status_entry> result;
+	rc = m_lib.getDeviceCount();
+	if (rc < 0)
+	{
+		throw core::LibraryException(rc);
+	}
+	int count = rc;
+	std::unique_ptr<struct device_status_entry[]> fromLib(new device_status_entry[count]);
+	memset(fromLib.get(), 0, sizeof (struct device_status_entry) * count);
+
+	rc = m_lib.getAllDeviceStatuses(fromLib.get(), count);
+	if (rc < 0)
+	{
+		throw core::LibraryException(rc);
+	}
+
+	for (int i = 0; i < rc; i++)
+	{
+		result.push_back(fromLib[i]);
+	}
+	return result;
+
+}
+
 struct device_settings NvmLibrary::getDeviceSettings(const std::string &deviceUid)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
@@ -61,6 +61,7 @@ public:
 	virtual struct device_discovery getDeviceDiscovery(const std::string &uid);
 	virtual std::vector<struct device_discovery> getDevices();
 	virtual struct device_status getDeviceStatus(const std::string &deviceUid);
+	virtual std::vector<struct device_status_entry> getAllDeviceStatuses();
 	virtual struct device_settings getDeviceSettings(const std::string &deviceUid);
 	virtual void modifyDeviceSettings(const std::string &deviceUid,
 		const struct device_settings &settings);
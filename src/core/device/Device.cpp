@@ -37,6 +37,7 @@ Device::Device() :
 	m_lib(NvmLibrary::getNvmLibrary()),
 	m_discovery(device_discovery()),
 	m_pDetails(NULL),
+	m_pStatus(NULL),
 	m_pActionRequiredEvents(NULL)
 {
 
@@ -45,6 +46,7 @@ Device::Device() :
 Device::Device(NvmLibrary &lib, const device_discovery &discovery) :
 	m_lib(lib),
 	m_pDetails(NULL),
+	m_pStatus(NULL),
 	m_pActionRequiredEvents(NULL)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
@@ -55,6 +57,7 @@ Device::Device(NvmLibrary &lib, const device_discovery &discovery) :
 Device::Device(const Device &other) :
 	m_lib(other.m_lib),
 	m_pDetails(NULL),
+	m_pStatus(NULL),
 	m_pActionRequiredEvents(NULL)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
@@ -84,6 +87,12 @@ void Device::copy(const Device &other)
 		memmove(this->m_pDetails, other.m_pDetails, sizeof(device_details));
 	}
 
+	if (other.m_pStatus)
+	{
+		this->m_pStatus = new device_status();
+		memmove(this->m_pStatus, other.m_pStatus, sizeof(device_status));
+	}
+
 	if (other.m_pActionRequiredEvents)
 	{
 		this->m_pActionRequiredEvents = new std::vector<event>();
@@ -101,6 +110,10 @@ Device::~Device()
 	{
 		delete m_pDetails;
 	}
+	if (m_pStatus)
+	{
+		delete m_pStatus;
+	}
 	if (m_pActionRequiredEvents)
 	{
 		delete m_pActionRequiredEvents;
@@ -153,7 +166,7 @@ NVM_UINT32 Device::getDeviceHandle()
 enum device_health Device::getDeviceStatusHealth()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.health;
+	return getStatus().health;
 }
 
 NVM_UINT32 Device::getChannelPosition()
@@ -165,19 +178,19 @@ NVM_UINT32 Device::getChannelPosition()
 enum config_status Device::getConfigStatus()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.config_status;
+	return getStatus().config_status;
 }
 
 enum device_ars_status Device::getArsStatus()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.ars_status;
+	return getStatus().ars_status;
 }
 
 enum device_sanitize_status Device::getSanitizeStatus()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.sanitize_status;
+	return getStatus().sanitize_status;
 }
 
 NVM_UINT32 Device::getChannelId()
@@ -471,19 +484,19 @@ NVM_UINT16 Device::getHealthState()
 bool Device::isNew()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.is_new;
+	return getStatus().is_new;
 }
 
 bool Device::getIsMissing()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.is_missing;
+	return getStatus().is_missing;
 }
 
 NVM_UINT8 Device::getDieSparesAvailable()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.die_spares_available;
+	return getStatus().die_spares_available;
 }
 
 std::vector<NVM_UINT16> Device::getLastShutdownStatus()
@@ -491,7 +504,7 @@ std::vector<NVM_UINT16> Device::getLastShutdownStatus()
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 	std::vector<NVM_UINT16> result;
 
-	NVM_UINT8 lastShutdownState = getDetails().status.last_shutdown_status;
+	NVM_UINT8 lastShutdownState = getStatus().last_shutdown_status;
 
 	if (lastShutdownState == SHUTDOWN_STATUS_UNKNOWN)
 	{
@@ -543,9 +556,9 @@ std::vector<NVM_UINT16> Device::getLastShutdownStatusExtended()
 	std::vector<NVM_UINT16> result;
 
 	NVM_UINT8 lastShutDownStateExtended[3];
-	lastShutDownStateExtended[0] = getDetails().status.last_shutdown_status_extended[0];
-	lastShutDownStateExtended[1] = getDetails().status.last_shutdown_status_extended[1];
-	lastShutDownStateExtended[2] = getDetails().status.last_shutdown_status_extended[2];
+	lastShutDownStateExtended[0] = getStatus().last_shutdown_status_extended[0];
+	lastShutDownStateExtended[1] = getStatus().last_shutdown_status_extended[1];
+	lastShutDownStateExtended[2] = getStatus().last_shutdown_status_extended[2];
 
 	if (lastShutDownStateExtended[0] == SHUTDOWN_STATUS_UNKNOWN )
 
@@ -578,19 +591,19 @@ std::vector<NVM_UINT16> Device::getLastShutdownStatusExtended()
 NVM_UINT64 Device::getLastShutdownTime()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.last_shutdown_time;
+	return getStatus().last_shutdown_time;
 }
 
 bool Device::isMixedSku()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.mixed_sku;
+	return getStatus().mixed_sku;
 }
 
 bool Device::isSkuViolation()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.sku_violation;
+	return getStatus().sku_violation;
 }
 
 time_t Device::getPerformanceTime()
@@ -757,7 +770,7 @@ bool Device::isViralPolicyEnabled()
 bool Device::getCurrentViralState()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.viral_state;
+	return getStatus().viral_state;
 }
 
 bool Device::isActionRequired()
@@ -780,7 +793,7 @@ enum fw_update_status Device::getFwUpdateStatus()
 bool Device::isAitDramEnabled()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.ait_dram_enabled;
+	return getStatus().ait_dram_enabled;
 }
 
 std::vector<NVM_UINT16> Device::getBootStatus()
@@ -788,7 +801,7 @@ std::vector<NVM_UINT16> Device::getBootStatus()
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
 	std::vector<NVM_UINT16> result;
-	NVM_UINT64 bootStatus = getDetails().status.boot_status;
+	NVM_UINT64 bootStatus = getStatus().boot_status;
 
 
 	if (BSR_IS_INVALID(bootStatus))
@@ -829,13 +842,13 @@ std::vector<NVM_UINT16> Device::getBootStatus()
 NVM_UINT32 Device::getInjectedMediaErrors()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.injected_media_errors;
+	return getStatus().injected_media_errors;
 }
 
 NVM_UINT32 Device::getInjectedNonMediaErrors()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	return getDetails().status.injected_non_media_errors;
+	return getStatus().injected_non_media_errors;
 }
 
 // Temporary placeholder for existing CLI to handle some parts of IXP
@@ -851,6 +864,23 @@ const device_discovery &Device::getDiscovery()
 	return m_discovery;
 }
 
+void Device::setStatus(const device_status &status)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	if (m_pStatus == NULL)
+	{
+		m_pStatus = new device_status();
+	}
+	memmove(m_pStatus, &status, sizeof(status));
+}
+
+const device_status &Device::getStatus()
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	// use the status read for all DIMMs at once if there is one
+	return m_pStatus ? *m_pStatus : getDetails().status;
+}
+
 const device_details &Device::getDetails()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
@@ -91,6 +91,9 @@ public:
 
 	virtual Device *clone() const;
 
+	// use a status that was read for many DIMMs at once instead of the one in the details
+	virtual void setStatus(const device_status &status);
+
 	virtual std::string getUid();
 	virtual enum manageability_state getManageabilityState();
 	virtual bool isManageable();
@@ -186,11 +189,13 @@ private:
 	NvmLibrary &m_lib;
 	device_discovery m_discovery;
 	device_details *m_pDetails;
+	device_status *m_pStatus;
 	std::vector<event> *m_pActionRequiredEvents;
 	std::string m_deviceUid;
 
 	const device_discovery &getDiscovery();
 	const device_details &getDetails();
+	const device_status &getStatus();
 	const std::vector<event> &getEvents();
 	void copy(const Device &other);
 };
@@ -89,6 +89,28 @@ core::device::DeviceCollection core::device::DeviceService::getAllDevices()
 	return result;
 }
 
+/*
+ * Read the status of every DIMM in one call and give it to the devices in the collection
+ */
+void core::device::DeviceService::loadDeviceStatuses(DeviceCollection &devices)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	const std::vector<struct device_status_entry> &statuses = m_lib.getAllDeviceStatuses();
+	for (size_t i = 0; i < devices.size(); i++)
+	{
+		std::string uid = devices[i].getUid();
+		for (size_t j = 0; j < statuses.size(); j++)
+		{
+			if (uid == Helper::uidToString(statuses[j].uid))
+			{
+				devices[i].setStatus(statuses[j].status);
+				break;
+			}
+		}
+	}
+}
+
 core::Result<core::device::Device> core::device::DeviceService::getDevice(std::string uid)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
@@ -50,6 +50,7 @@ public:
 	virtual std::vector<std::string> getManageableUids();
 	virtual std::vector<std::string> getUidsForDeviceIds(const std::vector<std::string> &deviceIds);
 	virtual DeviceCollection getAllDevices();
+	virtual void loadDeviceStatuses(DeviceCollection &devices);
 	virtual Result<Device> getDevice(std::string uid);
 	virtual std::string getFirmwareApiVersionByUid(const std::string &deviceUid);
 	virtual NVM_UINT32 getHandleByUid(const std::string &deviceUid);
@@ -27,6 +27,7 @@
 
 #include "FwCommandsWrapper.h"
 #include <LogEnterExit.h>
+#include <lib/nvm_context.h>
 
 namespace core
 {
@@ -43,6 +44,9 @@ FwCommandsWrapper &FwCommandsWrapper::getFwWrapper()
 FwCommandsWrapper::FwCommandsWrapper()
 {
 	LogEnterExit(__FUNCTION__, __FILE__, __LINE__);
+
+	// keep the library's cached FW results in sync with commands sent from here
+	fwcmd_set_modified_callback(invalidate_fw_results_for_cmd);
 }
 
 FwCommandsWrapper::~FwCommandsWrapper()
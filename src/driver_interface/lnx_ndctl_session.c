@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file implements the long-lived ndctl session used by the Linux passthrough paths.
+ */
+
+#include "ndctl_session.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define	SESSION_INDEX_MIN_SIZE	32
+
+struct session_index_entry
+{
+	unsigned int handle;
+	struct ndctl_dimm *p_dimm;
+};
+
+struct ndctl_session
+{
+	struct ndctl_ctx *p_ctx;
+	int refs; // outstanding caller references plus one while this is the thread's session
+	unsigned int generation; // g_session_generation when the session was created
+	unsigned int index_size; // always a power of two
+	struct session_index_entry *p_index;
+	struct ndctl_session *p_next; // next retired session still in use
+};
+
+// an ndctl context isn't safe to share between threads so each thread has its own session,
+// the device executor's long-lived workers keep theirs across calls
+static pthread_once_t g_session_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_session_key;
+static pthread_mutex_t g_session_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int g_session_generation = 0;
+static struct ndctl_session *g_p_retired = NULL;
+
+static unsigned int hash_handle(unsigned int handle, unsigned int index_size)
+{
+	return (handle * 2654435761u) & (index_size - 1);
+}
+
+static void free_session(struct ndctl_session *p_session)
+{
+	ndctl_unref(p_session->p_ctx);
+	free(p_session->p_index);
+	free(p_session);
+}
+
+/*
+ * Build an open addressing index of every DIMM on every bus
+ */
+static int build_session_index(struct ndctl_session *p_session)
+{
+	int rc = 0;
+	unsigned int dimm_count = 0;
+	struct ndctl_bus *p_bus;
+	struct ndctl_dimm *p_dimm;
+
+	ndctl_bus_foreach(p_session->p_ctx, p_bus)
+	{
+		ndctl_dimm_foreach(p_bus, p_dimm)
+		{
+			dimm_count++;
+		}
+	}
+
+	p_session->index_size = SESSION_INDEX_MIN_SIZE;
+	while (p_session->index_size < (dimm_count * 2))
+	{
+		p_session->index_size <<= 1;
+	}
+
+	p_session->p_index = calloc(p_session->index_size, sizeof (struct session_index_entry));
+	if (!p_session->p_index)
+	{
+		rc = -ENOMEM;
+	}
+	else
+	{
+		ndctl_bus_foreach(p_session->p_ctx, p_bus)
+		{
+			ndctl_dimm_foreach(p_bus, p_dimm)
+			{
+				unsigned int handle = ndctl_dimm_get_handle(p_dimm);
+				unsigned int slot = hash_handle(handle, p_session->index_size);
+				while (p_session->p_index[slot].p_dimm &&
+					p_session->p_index[slot].handle != handle)
+				{
+					slot = (slot + 1) & (p_session->index_size - 1);
+				}
+				// keep the first DIMM found like the bus walk this replaces
+				if (!p_session->p_index[slot].p_dimm)
+				{
+					p_session->p_index[slot].handle = handle;
+					p_session->p_index[slot].p_dimm = p_dimm;
+				}
+			}
+		}
+	}
+
+	return rc;
+}
+
+static struct ndctl_dimm *find_session_dimm(struct ndctl_session *p_session,
+	unsigned int handle)
+{
+	struct ndctl_dimm *p_dimm = NULL;
+	unsigned int slot = hash_handle(handle, p_session->index_size);
+	while (p_session->p_index[slot].p_dimm)
+	{
+		if (p_session->p_index[slot].handle == handle)
+		{
+			p_dimm = p_session->p_index[slot].p_dimm;
+			break;
+		}
+		slot = (slot + 1) & (p_session->index_size - 1);
+	}
+	return p_dimm;
+}
+
+/*
+ * Drop the session's own reference, keeping it on the retired list until the callers
+ * still using it release it
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+static void retire_session(struct ndctl_session *p_session)
+{
+	if (--p_session->refs == 0)
+	{
+		free_session(p_session);
+	}
+	else
+	{
+		p_session->p_next = g_p_retired;
+		g_p_retired = p_session;
+	}
+}
+
+static void retire_thread_session(void *p_session)
+{
+	pthread_mutex_lock(&g_session_lock);
+	retire_session((struct ndctl_session *)p_session);
+	pthread_mutex_unlock(&g_session_lock);
+}
+
+static void create_session_key()
+{
+	pthread_key_create(&g_session_key, retire_thread_session);
+}
+
+/*
+ * Retire the calling thread's session
+ */
+static void retire_current_session()
+{
+	struct ndctl_session *p_session = pthread_getspecific(g_session_key);
+	if (p_session)
+	{
+		pthread_setspecific(g_session_key, NULL);
+		pthread_mutex_lock(&g_session_lock);
+		retire_session(p_session);
+		pthread_mutex_unlock(&g_session_lock);
+	}
+}
+
+/*
+ * Get the calling thread's session, creating it if there is none or it was invalidated.
+ * Only the calling thread uses its session so the sysfs walk is done without the lock.
+ */
+static int get_current_session(struct ndctl_session **pp_session)
+{
+	int rc = 0;
+	struct ndctl_session *p_session = pthread_getspecific(g_session_key);
+
+	pthread_mutex_lock(&g_session_lock);
+	unsigned int generation = g_session_generation;
+	pthread_mutex_unlock(&g_session_lock);
+
+	if (p_session && p_session->generation != generation)
+	{
+		retire_current_session();
+		p_session = NULL;
+	}
+
+	if (!p_session)
+	{
+		p_session = calloc(1, sizeof (struct ndctl_session));
+		if (!p_session)
+		{
+			rc = -ENOMEM;
+		}
+		else if ((rc = ndctl_new(&p_session->p_ctx)) < 0)
+		{
+			free(p_session);
+			p_session = NULL;
+		}
+		else if ((rc = build_session_index(p_session)) < 0)
+		{
+			free_session(p_session);
+			p_session = NULL;
+		}
+		else
+		{
+			// an invalidation during the walk leaves this generation stale for the next call
+			p_session->refs = 1;
+			p_session->generation = generation;
+			pthread_setspecific(g_session_key, p_session);
+		}
+	}
+	*pp_session = p_session;
+	return rc;
+}
+
+int pt_ndctl_session_get_dimm(unsigned int handle,
+	struct ndctl_ctx **pp_ctx, struct ndctl_dimm **pp_dimm)
+{
+	int rc = 0;
+	struct ndctl_session *p_session = NULL;
+	*pp_ctx = NULL;
+	*pp_dimm = NULL;
+
+	pthread_once(&g_session_key_once, create_session_key);
+	if ((rc = get_current_session(&p_session)) == 0)
+	{
+		struct ndctl_dimm *p_dimm = find_session_dimm(p_session, handle);
+		if (!p_dimm)
+		{
+			// the topology may have changed, rescan once before giving up
+			retire_current_session();
+			if ((rc = get_current_session(&p_session)) == 0)
+			{
+				p_dimm = find_session_dimm(p_session, handle);
+			}
+		}
+
+		if (rc == 0)
+		{
+			if (p_dimm)
+			{
+				pthread_mutex_lock(&g_session_lock);
+				p_session->refs++;
+				pthread_mutex_unlock(&g_session_lock);
+				*pp_ctx = p_session->p_ctx;
+				*pp_dimm = p_dimm;
+			}
+			else
+			{
+				rc = PT_NDCTL_SESSION_NOT_FOUND;
+			}
+		}
+	}
+
+	return rc;
+}
+
+void pt_ndctl_session_release(struct ndctl_ctx *p_ctx)
+{
+	pthread_mutex_lock(&g_session_lock);
+	struct ndctl_session *p_session = pthread_getspecific(g_session_key);
+	if (p_session && p_session->p_ctx == p_ctx)
+	{
+		p_session->refs--;
+	}
+	else
+	{
+		struct ndctl_session **pp_session = &g_p_retired;
+		while (*pp_session && (*pp_session)->p_ctx != p_ctx)
+		{
+			pp_session = &(*pp_session)->p_next;
+		}
+		if (*pp_session && --(*pp_session)->refs == 0)
+		{
+			struct ndctl_session *p_retired = *pp_session;
+			*pp_session = p_retired->p_next;
+			free_session(p_retired);
+		}
+	}
+	pthread_mutex_unlock(&g_session_lock);
+}
+
+void pt_ndctl_session_invalidate()
+{
+	pthread_mutex_lock(&g_session_lock);
+	// every thread rebuilds its session on its next command
+	g_session_generation++;
+	pthread_mutex_unlock(&g_session_lock);
+}
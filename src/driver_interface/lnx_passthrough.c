@@ -30,6 +30,8 @@
  * passthrough commands.
  */
 #include "passthrough.h"
+#include "ndctl_session.h"
+#include <errno.h>
 #include <string.h>
 #include <stdlib.h>
 #include <ndctl/libndctl.h>
@@ -290,28 +292,6 @@ pt_result pt_read_large_payload(struct ndctl_dimm *p_dimm, struct pt_fw_cmd *p_f
 	return result;
 }
 
-int pt_get_dimm_by_handle(struct ndctl_ctx *ctx, unsigned int handle, struct ndctl_dimm **dimm)
-{
-	int found = 0;
-	struct ndctl_dimm *target_dimm;
-	*dimm = NULL;
-
-	struct ndctl_bus *bus;
-	ndctl_bus_foreach(ctx, bus)
-	{
-		target_dimm = ndctl_dimm_get_by_handle(bus, handle);
-
-		if (target_dimm)
-		{
-			*dimm = target_dimm;
-			found = 1;
-			break;
-		}
-	}
-
-	return found;
-}
-
 /*
  * Execute a passthrough IOCTL
  */
@@ -319,68 +299,71 @@ int adapter_pt_ioctl_cmd(struct pt_fw_cmd *p_fw_cmd)
 {
 	pt_result result = {0};
 	struct ndctl_ctx *ctx;
-	int new_rc;
-	if ((new_rc = ndctl_new(&ctx)) >= 0)
+	struct ndctl_dimm *p_dimm = NULL;
+	int session_rc = pt_ndctl_session_get_dimm(p_fw_cmd->device_handle, &ctx, &p_dimm);
+	if (session_rc == 0)
 	{
-		struct ndctl_dimm *p_dimm = NULL;
-		if (pt_get_dimm_by_handle(ctx, p_fw_cmd->device_handle, &p_dimm))
+		unsigned int opcode = PT_BUILD_DSM_OPCODE(p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
+		struct ndctl_cmd *p_vendor_cmd = NULL;
+		if ((p_vendor_cmd = ndctl_dimm_cmd_new_vendor_specific(p_dimm, opcode,
+			PT_DEV_SMALL_PAYLOAD_SIZE, PT_DEV_SMALL_PAYLOAD_SIZE)) == NULL)
 		{
-			unsigned int opcode = PT_BUILD_DSM_OPCODE(p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
-			struct ndctl_cmd *p_vendor_cmd = NULL;
-			if ((p_vendor_cmd = ndctl_dimm_cmd_new_vendor_specific(p_dimm, opcode,
-				PT_DEV_SMALL_PAYLOAD_SIZE, PT_DEV_SMALL_PAYLOAD_SIZE)) == NULL)
-			{
-				result.func = PT_ERR_DRIVERFAILED;
-			}
-			else
+			result.func = PT_ERR_DRIVERFAILED;
+		}
+		else
+		{
+			if (p_fw_cmd->input_payload_size > 0)
 			{
-				if (p_fw_cmd->input_payload_size > 0)
-				{
-					ssize_t bytes_written = ndctl_cmd_vendor_set_input(p_vendor_cmd,
-						p_fw_cmd->input_payload, p_fw_cmd->input_payload_size);
+				ssize_t bytes_written = ndctl_cmd_vendor_set_input(p_vendor_cmd,
+					p_fw_cmd->input_payload, p_fw_cmd->input_payload_size);
 
-					if (bytes_written != p_fw_cmd->input_payload_size)
-					{
-						result.func = PT_ERR_DRIVERFAILED;
-					}
-				}
-
-				if (PT_IS_SUCCESS(result) && p_fw_cmd->large_input_payload_size > 0)
+				if (bytes_written != p_fw_cmd->input_payload_size)
 				{
-					result = pt_write_large_payload(p_dimm, p_fw_cmd);
+					result.func = PT_ERR_DRIVERFAILED;
 				}
+			}
+
+			if (PT_IS_SUCCESS(result) && p_fw_cmd->large_input_payload_size > 0)
+			{
+				result = pt_write_large_payload(p_dimm, p_fw_cmd);
+			}
+
+			if (PT_IS_SUCCESS(result))
+			{
+				result = pt_cmd_submit(p_vendor_cmd);
 
 				if (PT_IS_SUCCESS(result))
 				{
-					result = pt_cmd_submit(p_vendor_cmd);
-
-					if (PT_IS_SUCCESS(result))
+					if (p_fw_cmd->output_payload_size > 0)
 					{
-						if (p_fw_cmd->output_payload_size > 0)
-						{
-							ndctl_cmd_vendor_get_output(p_vendor_cmd,
-								p_fw_cmd->output_payload,
-								p_fw_cmd->output_payload_size);
-						}
+						ndctl_cmd_vendor_get_output(p_vendor_cmd,
+							p_fw_cmd->output_payload,
+							p_fw_cmd->output_payload_size);
+					}
 
-						if (p_fw_cmd->large_output_payload_size > 0)
-						{
-							result = pt_read_large_payload(p_dimm, p_fw_cmd);
-						}
+					if (p_fw_cmd->large_output_payload_size > 0)
+					{
+						result = pt_read_large_payload(p_dimm, p_fw_cmd);
 					}
 				}
-				ndctl_cmd_unref(p_vendor_cmd);
 			}
+			ndctl_cmd_unref(p_vendor_cmd);
 		}
-		else
+		pt_ndctl_session_release(ctx);
+
+		// the DIMM has gone away, rebuild the session on the next command
+		if (result.driver == ENXIO || result.driver == ENODEV)
 		{
-			result.func = PT_ERR_BADDEVICEHANDLE;
+			pt_ndctl_session_invalidate();
 		}
-		ndctl_unref(ctx);
+	}
+	else if (session_rc == PT_NDCTL_SESSION_NOT_FOUND)
+	{
+		result.func = PT_ERR_BADDEVICEHANDLE;
 	}
 	else
 	{
-		result.driver = (unsigned char)-new_rc;
+		result.driver = (unsigned char)-session_rc;
 	}
 
 	int rc;
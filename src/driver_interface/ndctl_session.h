@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file declares the long-lived ndctl session shared by the Linux passthrough paths.
+ * Rather than creating an ndctl context and walking every bus for each firmware command,
+ * callers borrow a reference to a long-lived context along with a DIMM handle index.
+ * An ndctl context isn't thread safe, so each thread gets its own session.
+ */
+
+#ifndef NDCTL_SESSION_H
+#define NDCTL_SESSION_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <ndctl/libndctl.h>
+
+/*
+ * Returned by pt_ndctl_session_get_dimm when no DIMM with the handle exists
+ */
+#define	PT_NDCTL_SESSION_NOT_FOUND	1
+
+/*
+ * Borrow a reference to the shared ndctl context and look up the DIMM with the
+ * NFIT device handle. On a handle miss the DIMM index is rebuilt once in case the
+ * topology has changed since the session was created.
+ * Returns 0 on success, PT_NDCTL_SESSION_NOT_FOUND if the handle is unknown (no
+ * reference is held) or a negative errno if the ndctl context could not be created.
+ * Each successful call must be paired with pt_ndctl_session_release.
+ */
+int pt_ndctl_session_get_dimm(unsigned int handle,
+	struct ndctl_ctx **pp_ctx, struct ndctl_dimm **pp_dimm);
+
+/*
+ * Return a reference obtained from pt_ndctl_session_get_dimm
+ */
+void pt_ndctl_session_release(struct ndctl_ctx *p_ctx);
+
+/*
+ * Drop the cached sessions of every thread. Each ndctl context is freed once all
+ * its outstanding references are released and each thread builds a fresh one on its
+ * next call.
+ */
+void pt_ndctl_session_invalidate();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NDCTL_SESSION_H
@@ -38,6 +38,20 @@ extern "C"
 #define OP_GET_ADMIN_FEATURES 0x06
 #define SUBOP_PLATFORM_DATA 0x01
 
+/*
+ * The commands that change DIMM state, reported through fwcmd_set_modified_callback
+ */
+#define OP_SET_SEC_INFO 0x03
+#define SUBOP_SEC_SET_PASSPHRASE 0xF1
+#define SUBOP_SEC_DISABLE_PASSPHRASE 0xF2
+#define SUBOP_SEC_UNLOCK 0xF3
+#define SUBOP_SEC_ERASE 0xF5
+#define SUBOP_SEC_FREEZE 0xF6
+#define OP_SET_FEATURES 0x05
+#define SUBOP_SET_ALARM_THRESHOLD 0x01
+#define OP_FORMAT 0xF1
+#define SUBOP_FORMAT_MEDIA 0x00
+
 enum fis_error_codes
 {
 	FIS_ERR_SUCCESS = 0x0,
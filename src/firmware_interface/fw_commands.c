@@ -35,6 +35,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+static fwcmd_modified_callback g_modified_callback = NULL;
+
+void fwcmd_set_modified_callback(fwcmd_modified_callback callback)
+{
+	g_modified_callback = callback;
+}
+
+static void fwcmd_notify_modified(unsigned int handle,
+	unsigned char opcode, unsigned char sub_opcode)
+{
+	if (g_modified_callback)
+	{
+		g_modified_callback(handle, opcode, sub_opcode);
+	}
+}
+
 /* BEGIN identify_dimm */
 struct fwcmd_identify_dimm_result fwcmd_alloc_identify_dimm(unsigned int handle)
 {
@@ -206,6 +222,9 @@ struct fwcmd_set_passphrase_result fwcmd_call_set_passphrase(unsigned int handle
 	rc = fis_set_passphrase(handle,
 		&input_payload);
 
+	// give cached copies of the DIMM data a chance to be invalidated
+	fwcmd_notify_modified(handle, OP_SET_SEC_INFO, SUBOP_SEC_SET_PASSPHRASE);
+
 	if (PT_IS_SUCCESS(rc))
 	{
 		result.success = 1;
@@ -232,6 +251,9 @@ struct fwcmd_disable_passphrase_result fwcmd_call_disable_passphrase(unsigned in
 	rc = fis_disable_passphrase(handle,
 		&input_payload);
 
+	// give cached copies of the DIMM data a chance to be invalidated
+	fwcmd_notify_modified(handle, OP_SET_SEC_INFO, SUBOP_SEC_DISABLE_PASSPHRASE);
+
 	if (PT_IS_SUCCESS(rc))
 	{
 		result.success = 1;
@@ -258,6 +280,9 @@ struct fwcmd_unlock_unit_result fwcmd_call_unlock_unit(unsigned int handle,
 	rc = fis_unlock_unit(handle,
 		&input_payload);
 
+	// give cached copies of the DIMM data a chance to be invalidated
+	fwcmd_notify_modified(handle, OP_SET_SEC_INFO, SUBOP_SEC_UNLOCK);
+
 	if (PT_IS_SUCCESS(rc))
 	{
 		result.success = 1;
@@ -284,6 +309,9 @@ struct fwcmd_secure_erase_result fwcmd_call_secure_erase(unsigned int handle,
 	rc = fis_secure_erase(handle,
 		&input_payload);
 
+	// give cached copies of the DIMM data a chance to be invalidated
+	fwcmd_notify_modified(handle, OP_SET_SEC_INFO, SUBOP_SEC_ERASE);
+
 	if (PT_IS_SUCCESS(rc))
 	{
 		result.success = 1;
@@ -306,6 +334,9 @@ struct fwcmd_freeze_lock_result fwcmd_call_freeze_lock(unsigned int handle)
 
 	rc = fis_freeze_lock(handle);
 
+	// give cached copies of the DIMM data a chance to be invalidated
+	fwcmd_notify_modified(handle, OP_SET_SEC_INFO, SUBOP_SEC_FREEZE);
+
 	if (PT_IS_SUCCESS(rc))
 	{
 		result.success = 1;
@@ -652,6 +683,9 @@ struct fwcmd_set_alarm_threshold_result fwcmd_call_set_alarm_threshold(unsigned
 	rc = fis_set_alarm_threshold(handle,
 		&input_payload);
 
+	// give cached copies of the DIMM data a chance to be invalidated
+	fwcmd_notify_modified(handle, OP_SET_FEATURES, SUBOP_SET_ALARM_THRESHOLD);
+
 	if (PT_IS_SUCCESS(rc))
 	{
 		result.success = 1;
@@ -1784,6 +1818,9 @@ struct fwcmd_format_result fwcmd_call_format(unsigned int handle,
 	rc = fis_format(handle,
 		&input_payload);
 
+	// give cached copies of the DIMM data a chance to be invalidated
+	fwcmd_notify_modified(handle, OP_FORMAT, SUBOP_FORMAT_MEDIA);
+
 	if (PT_IS_SUCCESS(rc))
 	{
 		result.success = 1;
@@ -1187,6 +1187,15 @@ struct fwcmd_format_result fwcmd_call_format(unsigned int handle,
 	const unsigned char fill_pattern,
 	const unsigned char preserve_pdas_write_count);
 
+/*
+ * Called after a command that can modify a DIMM is sent, so cached copies of
+ * the DIMM data can be invalidated
+ */
+typedef void (*fwcmd_modified_callback)(const unsigned int handle,
+	const unsigned char opcode, const unsigned char sub_opcode);
+
+void fwcmd_set_modified_callback(fwcmd_modified_callback callback);
+
 int fwcmd_is_command_name(const char * cmd_name);
 
 int fwcmd_is_output_command_name(const char * cmd_name);
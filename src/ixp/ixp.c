@@ -43,6 +43,7 @@ int ixp_create_ctx_nfit_handle(struct ixp_context **ctx, const NVM_NFIT_DEVICE_H
 	struct ixp_context *pctx = (struct ixp_context*)*ctx;
 	pctx->handle = handle;
 	pctx->user_data = user_data;
+	pctx->p_cmd_cache = NULL;
 	return IXP_SUCCESS;
 }
 
@@ -73,8 +74,49 @@ int ixp_free_ctx(struct ixp_context *ctx)
 	}
 	else
 	{
+		ixp_free_cmd_cache(ctx->p_cmd_cache);
 		free(ctx);
 	}
 	return IXP_SUCCESS;
 }
 
+void *ixp_cmd_cache_alloc(struct ixp_cmd_cache *p_cache, size_t size)
+{
+	// keep allocations pointer aligned
+	size = (size + sizeof (void *) - 1) & ~(sizeof (void *) - 1);
+
+	struct ixp_arena_block *p_block = p_cache->p_arena;
+	if (NULL == p_block || p_block->size - p_block->used < size)
+	{
+		size_t block_size = size > IXP_ARENA_BLOCK_SZ ? size : IXP_ARENA_BLOCK_SZ;
+		if (NULL == (p_block = (struct ixp_arena_block *)malloc(
+			sizeof (struct ixp_arena_block) + block_size)))
+		{
+			return NULL;
+		}
+		p_block->p_data = (char *)(p_block + 1);
+		p_block->size = block_size;
+		p_block->used = 0;
+		p_block->p_next = p_cache->p_arena;
+		p_cache->p_arena = p_block;
+	}
+
+	void *p_alloc = p_block->p_data + p_block->used;
+	p_block->used += size;
+	return p_alloc;
+}
+
+void ixp_free_cmd_cache(struct ixp_cmd_cache *p_cache)
+{
+	if (p_cache)
+	{
+		while (p_cache->p_arena)
+		{
+			struct ixp_arena_block *p_next = p_cache->p_arena->p_next;
+			free(p_cache->p_arena);
+			p_cache->p_arena = p_next;
+		}
+		free(p_cache);
+	}
+}
+
@@ -38,6 +38,7 @@ extern "C"
 #endif
 
 struct ixp_context;
+struct ixp_cmd_cache;
 
 #define IXP_PROP_KEY  unsigned int
 
@@ -49,6 +50,8 @@ struct ixp_prop_info
 	char prop_name[IXP_MAX_PROPERTY_NAME_SZ];
 	void *prop_value;
 	int prop_value_size;
+	// prop_value points into a firmware payload owned by the context
+	int prop_value_is_view;
 };
 
 
@@ -62,8 +65,12 @@ int ixp_get_prop_name(struct ixp_prop_info *prop, char **prop_name);
 int ixp_get_prop(struct ixp_context *ctx, struct ixp_prop_info *prop);
 int ixp_free_prop(struct ixp_prop_info *prop);
 int ixp_get_props(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned int num_props);
+// Like ixp_get_props, but each firmware command is issued at most once per context
+// and the property values are views into the payloads the context keeps. From the
+// first batched call on, every read through the context is served from those
+// payloads, so the values stay valid until ixp_free_ctx.
+int ixp_get_props_batched(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned int num_props);
 int ixp_free_props(struct ixp_prop_info *props, unsigned int num_props);
-int ixp_get_props(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned int num_props);
 int ixp_get_prop_key_by_name(char * name, unsigned int length, IXP_PROP_KEY * key);
 
 #ifdef __cplusplus
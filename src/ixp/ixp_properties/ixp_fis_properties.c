@@ -30,6 +30,7 @@
 #include "ixp_fis_properties.h"
 #include <fw_commands.h>
 #include <ixp.h>
+#include <ixp_prv.h>
 
 
 
@@ -260,59 +261,138 @@ static const struct ixp_fw_lookup_t g_ixp_fw_lookup[] = {
 };
 
 
-// Get result from lower-level fwcmd and then populate any relevant properties
-// in the props array
-int get_fw_cmd(struct fwcmd_result (* fwcmd)(unsigned int),
+// Point a property at its bytes in a firmware payload and set its name
+static int set_prop(struct ixp_prop_info *prop, char *p_payload, int is_view,
+const struct ixp_fw_lookup_t ixp_fw_lookup[])
+{
+	const struct ixp_fw_lookup_t *p_lookup = &(ixp_fw_lookup[prop->prop_key]);
+	size_t name_len = strnlen(p_lookup->name, IXP_MAX_PROPERTY_NAME_SZ);
+	if (name_len >= IXP_MAX_PROPERTY_NAME_SZ)
+	{
+		// Pretty print string name is >= IXP_MAX_PROPERTY_NAME_SZ
+		return IXP_INTERNAL_ERROR;
+	}
+
+	prop->prop_value_size = p_lookup->size;
+	prop->prop_value_is_view = is_view;
+	if (is_view)
+	{
+		prop->prop_value = p_payload + p_lookup->struct_offset;
+	}
+	else
+	{
+		prop->prop_value = malloc(p_lookup->size);
+		if (NULL == prop->prop_value)
+		{
+			return IXP_NO_MEM_RESOURCES;
+		}
+		memcpy(prop->prop_value, p_payload + p_lookup->struct_offset, p_lookup->size);
+	}
+	memcpy(prop->prop_name, p_lookup->name, name_len + 1);
+	return IXP_SUCCESS;
+}
+
+// Get the payload of a firmware command from the cache, issuing the command
+// and keeping the bytes its properties use in the cache arena the first time
+static int get_cached_fw_payload(struct fwcmd_result (* fwcmd)(unsigned int),
 void (* fwcmd_free)(struct fwcmd_result *),
 unsigned int prop_key_first, unsigned int prop_key_length, unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props, const struct ixp_fw_lookup_t ixp_fw_lookup[])
+struct ixp_cmd_cache *p_cache, const struct ixp_fw_lookup_t ixp_fw_lookup[],
+char **pp_payload)
 {
-	struct fwcmd_result result = (*fwcmd)(handle);
-	if (!result.success)
+	struct ixp_cmd_cache_entry *p_entry = p_cache->p_entries;
+	while (p_entry && p_entry->fwcmd != fwcmd)
 	{
-		// TODO: Convert fw error code into IXP error code
-		return IXP_INTERNAL_ERROR;
+		p_entry = p_entry->p_next;
 	}
 
-	struct ixp_prop_info * prop;
-	for (int props_index = 0; props_index < num_props; props_index++)
+	if (NULL == p_entry)
 	{
-		prop = &(props[props_index]);
+		struct fwcmd_result result = (*fwcmd)(handle);
+		if (!result.success)
+		{
+			// TODO: Convert fw error code into IXP error code
+			return IXP_INTERNAL_ERROR;
+		}
 
-		if (prop->prop_key < prop_key_first ||
-		prop->prop_key >= prop_key_first + prop_key_length)
+		size_t payload_size = 0;
+		for (unsigned int key = prop_key_first; key < prop_key_first + prop_key_length; key++)
 		{
-			continue;
+			size_t end = ixp_fw_lookup[key].struct_offset + ixp_fw_lookup[key].size;
+			if (end > payload_size)
+			{
+				payload_size = end;
+			}
 		}
 
-		prop->prop_value_size = ixp_fw_lookup[prop->prop_key].size;
-		prop->prop_value = malloc(ixp_fw_lookup[prop->prop_key].size);
-		if (NULL == prop->prop_value)
+		p_entry = ixp_cmd_cache_alloc(p_cache, sizeof (struct ixp_cmd_cache_entry));
+		char *p_payload = ixp_cmd_cache_alloc(p_cache, payload_size);
+		if (NULL == p_entry || NULL == p_payload)
 		{
+			fwcmd_free(&result);
 			return IXP_NO_MEM_RESOURCES;
 		}
+		memcpy(p_payload, result.p_data, payload_size);
+		fwcmd_free(&result);
+		p_entry->fwcmd = fwcmd;
+		p_entry->p_payload = p_payload;
+		p_entry->p_next = p_cache->p_entries;
+		p_cache->p_entries = p_entry;
+	}
+	*pp_payload = p_entry->p_payload;
+	return IXP_SUCCESS;
+}
 
-		// TODO: Linux doesn't have memcpy_s??
-		// Copy property data
-		// dest, src, size
-		memcpy(prop->prop_value,
-		(char *)result.p_data + ixp_fw_lookup[prop->prop_key].struct_offset,
-		ixp_fw_lookup[prop->prop_key].size);
-
-		// Copy name string
-		// TODO: Verify with Kelly/Dan this is the proper implementation
-		// Use strcat?? https://stackoverflow.com/questions/1258550/why-should-you-use-strncpy-instead-of-strcpy
-		if (snprintf(prop->prop_name, IXP_MAX_PROPERTY_NAME_SZ,
-		"%s", ixp_fw_lookup[prop->prop_key].name) >= IXP_MAX_PROPERTY_NAME_SZ)
+// Get result from lower-level fwcmd and then populate any relevant properties
+// in the props array. With a cache the command is issued once per cache and the
+// property values are views into the cached payload, otherwise each is a copy.
+int get_fw_cmd(struct fwcmd_result (* fwcmd)(unsigned int),
+void (* fwcmd_free)(struct fwcmd_result *),
+unsigned int prop_key_first, unsigned int prop_key_length, unsigned int handle,
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props,
+const struct ixp_fw_lookup_t ixp_fw_lookup[])
+{
+	int status = IXP_SUCCESS;
+	struct fwcmd_result result;
+	char *p_payload = NULL;
+	if (p_cache)
+	{
+		if (IXP_SUCCESS != (status = get_cached_fw_payload(fwcmd, fwcmd_free,
+			prop_key_first, prop_key_length, handle, p_cache, ixp_fw_lookup, &p_payload)))
 		{
-			fwcmd_free(&result);
-			// Pretty print string name is >= IXP_MAX_PROPERTY_NAME_SZ
+			return status;
+		}
+	}
+	else
+	{
+		result = (*fwcmd)(handle);
+		if (!result.success)
+		{
+			// TODO: Convert fw error code into IXP error code
 			return IXP_INTERNAL_ERROR;
 		}
+		p_payload = (char *)result.p_data;
 	}
 
-	fwcmd_free(&result);
-	return IXP_SUCCESS;
+	struct ixp_prop_info * prop;
+	for (int props_index = 0; props_index < num_props && IXP_SUCCESS == status; props_index++)
+	{
+		prop = &(props[props_index]);
+
+		if (prop->prop_key < prop_key_first ||
+		prop->prop_key >= prop_key_first + prop_key_length)
+		{
+			continue;
+		}
+
+		status = set_prop(prop, p_payload, p_cache != NULL, ixp_fw_lookup);
+	}
+
+	if (!p_cache)
+	{
+		fwcmd_free(&result);
+	}
+	return status;
 }
 
 void free_fw_cmd(unsigned int prop_key_first, unsigned int prop_key_length,
@@ -331,253 +411,258 @@ struct ixp_prop_info props[], unsigned int num_props)
 			continue;
 		}
 
-		free(prop->prop_value);
+		// views are owned by the context's command cache
+		if (!prop->prop_value_is_view)
+		{
+			free(prop->prop_value);
+		}
 		prop->prop_value = NULL;
 		prop->prop_value_size = 0;
+		prop->prop_value_is_view = 0;
 	}
 }
 
 int get_fis_identify_dimm_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_identify_dimm,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_identify_dimm,
-	0, 24, handle, props, num_props, g_ixp_fw_lookup);
+	0, 24, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_identify_dimm_characteristics_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_identify_dimm_characteristics,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_identify_dimm_characteristics,
-	24, 4, handle, props, num_props, g_ixp_fw_lookup);
+	24, 4, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_get_security_state_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_get_security_state,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_get_security_state,
-	28, 6, handle, props, num_props, g_ixp_fw_lookup);
+	28, 6, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_get_alarm_threshold_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_get_alarm_threshold,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_get_alarm_threshold,
-	34, 7, handle, props, num_props, g_ixp_fw_lookup);
+	34, 7, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_power_management_policy_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_power_management_policy,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_power_management_policy,
-	41, 4, handle, props, num_props, g_ixp_fw_lookup);
+	41, 4, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_die_sparing_policy_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_die_sparing_policy,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_die_sparing_policy,
-	45, 7, handle, props, num_props, g_ixp_fw_lookup);
+	45, 7, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_address_range_scrub_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_address_range_scrub,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_address_range_scrub,
-	52, 4, handle, props, num_props, g_ixp_fw_lookup);
+	52, 4, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_optional_configuration_data_policy_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_optional_configuration_data_policy,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_optional_configuration_data_policy,
-	56, 3, handle, props, num_props, g_ixp_fw_lookup);
+	56, 3, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_pmon_registers_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_pmon_registers,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_pmon_registers,
-	59, 27, handle, props, num_props, g_ixp_fw_lookup);
+	59, 27, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_system_time_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_system_time,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_system_time,
-	86, 1, handle, props, num_props, g_ixp_fw_lookup);
+	86, 1, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_platform_config_data_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_platform_config_data,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_platform_config_data,
-	87, 15, handle, props, num_props, g_ixp_fw_lookup);
+	87, 15, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_namespace_labels_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_namespace_labels,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_namespace_labels,
-	102, 0, handle, props, num_props, g_ixp_fw_lookup);
+	102, 0, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_dimm_partition_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_dimm_partition_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_dimm_partition_info,
-	102, 6, handle, props, num_props, g_ixp_fw_lookup);
+	102, 6, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_fw_debug_log_level_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_fw_debug_log_level,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_fw_debug_log_level,
-	108, 2, handle, props, num_props, g_ixp_fw_lookup);
+	108, 2, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_fw_load_flag_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_fw_load_flag,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_fw_load_flag,
-	110, 1, handle, props, num_props, g_ixp_fw_lookup);
+	110, 1, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_config_lockdown_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_config_lockdown,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_config_lockdown,
-	111, 1, handle, props, num_props, g_ixp_fw_lookup);
+	111, 1, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_ddrt_io_init_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_ddrt_io_init_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_ddrt_io_init_info,
-	112, 2, handle, props, num_props, g_ixp_fw_lookup);
+	112, 2, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_get_supported_sku_features_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_get_supported_sku_features,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_get_supported_sku_features,
-	114, 1, handle, props, num_props, g_ixp_fw_lookup);
+	114, 1, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_enable_dimm_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_enable_dimm,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_enable_dimm,
-	115, 1, handle, props, num_props, g_ixp_fw_lookup);
+	115, 1, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_smart_health_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_smart_health_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_smart_health_info,
-	116, 48, handle, props, num_props, g_ixp_fw_lookup);
+	116, 48, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_firmware_image_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_firmware_image_info,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_firmware_image_info,
-	164, 6, handle, props, num_props, g_ixp_fw_lookup);
+	164, 6, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_firmware_debug_log_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_firmware_debug_log,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_firmware_debug_log,
-	170, 1, handle, props, num_props, g_ixp_fw_lookup);
+	170, 1, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_memory_info_page_0_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_memory_info_page_0,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_memory_info_page_0,
-	171, 6, handle, props, num_props, g_ixp_fw_lookup);
+	171, 6, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_memory_info_page_1_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_memory_info_page_1,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_memory_info_page_1,
-	177, 6, handle, props, num_props, g_ixp_fw_lookup);
+	177, 6, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_memory_info_page_3_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_memory_info_page_3,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_memory_info_page_3,
-	183, 8, handle, props, num_props, g_ixp_fw_lookup);
+	183, 8, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_long_operation_status_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_long_operation_status,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_long_operation_status,
-	191, 5, handle, props, num_props, g_ixp_fw_lookup);
+	191, 5, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 int get_fis_bsr_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props)
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props)
 {
 	return get_fw_cmd(
 	(struct fwcmd_result (*)(unsigned int))&fwcmd_alloc_bsr,
 	(void (*)(struct fwcmd_result*))&fwcmd_free_bsr,
-	196, 18, handle, props, num_props, g_ixp_fw_lookup);
+	196, 18, handle, p_cache, props, num_props, g_ixp_fw_lookup);
 }
 
 void free_fis_identify_dimm_properties(
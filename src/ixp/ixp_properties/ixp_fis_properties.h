@@ -37,85 +37,85 @@ extern "C"
 #endif
 
 int get_fis_identify_dimm_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_identify_dimm_characteristics_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_get_security_state_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_get_alarm_threshold_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_power_management_policy_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_die_sparing_policy_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_address_range_scrub_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_optional_configuration_data_policy_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_pmon_registers_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_system_time_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_platform_config_data_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_namespace_labels_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_dimm_partition_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_fw_debug_log_level_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_fw_load_flag_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_config_lockdown_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_ddrt_io_init_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_get_supported_sku_features_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_enable_dimm_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_smart_health_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_firmware_image_info_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_firmware_debug_log_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_memory_info_page_0_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_memory_info_page_1_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_memory_info_page_3_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_long_operation_status_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 int get_fis_bsr_properties(unsigned int handle,
-struct ixp_prop_info props[], unsigned int num_props);
+struct ixp_cmd_cache *p_cache, struct ixp_prop_info props[], unsigned int num_props);
 
 void free_fis_identify_dimm_properties(
 struct ixp_prop_info props[], unsigned int num_props);
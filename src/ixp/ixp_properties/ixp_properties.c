@@ -25,12 +25,29 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <ixp.h>
 #include <ixp_prv.h>
 #include "ixp_fis_properties.h"
 #include "ixp_properties.h"
 
+#ifdef __WINDOWS__
+#include <Windows.h>
+static SRWLOCK g_prop_name_lock = SRWLOCK_INIT;
+#define	PROP_NAME_READ_LOCK()	AcquireSRWLockShared(&g_prop_name_lock)
+#define	PROP_NAME_READ_UNLOCK()	ReleaseSRWLockShared(&g_prop_name_lock)
+#define	PROP_NAME_WRITE_LOCK()	AcquireSRWLockExclusive(&g_prop_name_lock)
+#define	PROP_NAME_WRITE_UNLOCK()	ReleaseSRWLockExclusive(&g_prop_name_lock)
+#else
+#include <pthread.h>
+static pthread_rwlock_t g_prop_name_lock = PTHREAD_RWLOCK_INITIALIZER;
+#define	PROP_NAME_READ_LOCK()	pthread_rwlock_rdlock(&g_prop_name_lock)
+#define	PROP_NAME_READ_UNLOCK()	pthread_rwlock_unlock(&g_prop_name_lock)
+#define	PROP_NAME_WRITE_LOCK()	pthread_rwlock_wrlock(&g_prop_name_lock)
+#define	PROP_NAME_WRITE_UNLOCK()	pthread_rwlock_unlock(&g_prop_name_lock)
+#endif
+
 // TODO: Add more types of entries in here, not just fw
 // TODO: Change passing a handle to passing ... something else (not context)
 //       Will probably require a conversion function
@@ -253,6 +270,488 @@ static struct ixp_lookup_t g_ixp_lookup[] = {
 	{get_fis_bsr_properties, free_fis_bsr_properties, "Rest2"},
 };
 
+// Every property by its command-qualified name ("<Command>.<Field>") and, when
+// no other command uses it, by its plain name. Sorted by name in byte order for
+// ixp_get_prop_key_by_name. Plain entries follow ixp_set_g_ixp_lookup_entry.
+static struct ixp_prop_name_index_t g_ixp_prop_name_index[] = {
+	{"AddressRangeScrub.DpaCurrentAddress", FIS_ADDRESS_RANGE_SCRUB_DPA_CURRENT_ADDRESS},
+	{"AddressRangeScrub.DpaEndAddress", FIS_ADDRESS_RANGE_SCRUB_DPA_END_ADDRESS},
+	{"AddressRangeScrub.DpaStartAddress", FIS_ADDRESS_RANGE_SCRUB_DPA_START_ADDRESS},
+	{"AddressRangeScrub.Enable", FIS_ADDRESS_RANGE_SCRUB_ENABLE},
+	{"Aggressiveness", FIS_DIE_SPARING_POLICY_AGGRESSIVENESS},
+	{"AitDramReady", FIS_BSR_REST1_AIT_DRAM_READY},
+	{"ApiVer", FIS_IDENTIFY_DIMM_API_VER},
+	{"AppDirectModeEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_APP_DIRECT_MODE_ENABLED},
+	{"Assertion", FIS_BSR_REST1_ASSERTION},
+	{"AveragePowerBudget", FIS_POWER_MANAGEMENT_POLICY_AVERAGE_POWER_BUDGET},
+	{"BlockReadRequests", FIS_MEMORY_INFO_PAGE_0_BLOCK_READ_REQUESTS},
+	{"BlockWriteRequests", FIS_MEMORY_INFO_PAGE_0_BLOCK_WRITE_REQUESTS},
+	{"Bsr.MajorCheckpoint", FIS_BSR_MAJOR_CHECKPOINT},
+	{"Bsr.MinorCheckpoint", FIS_BSR_MINOR_CHECKPOINT},
+	{"Bsr.Rest1", FIS_BSR_REST1},
+	{"Bsr.Rest1AitDramReady", FIS_BSR_REST1_AIT_DRAM_READY},
+	{"Bsr.Rest1Assertion", FIS_BSR_REST1_ASSERTION},
+	{"Bsr.Rest1CreditReady", FIS_BSR_REST1_CREDIT_READY},
+	{"Bsr.Rest1DdrtIoInitComplete", FIS_BSR_REST1_DDRT_IO_INIT_COMPLETE},
+	{"Bsr.Rest1FirstFastRefreshComplete", FIS_BSR_REST1_FIRST_FAST_REFRESH_COMPLETE},
+	{"Bsr.Rest1MailboxReady", FIS_BSR_REST1_MAILBOX_READY},
+	{"Bsr.Rest1MediaDisabled", FIS_BSR_REST1_MEDIA_DISABLED},
+	{"Bsr.Rest1MediaReady1", FIS_BSR_REST1_MEDIA_READY_1},
+	{"Bsr.Rest1MediaReady2", FIS_BSR_REST1_MEDIA_READY_2},
+	{"Bsr.Rest1MiStall", FIS_BSR_REST1_MI_STALL},
+	{"Bsr.Rest1OptInEnabled", FIS_BSR_REST1_OPT_IN_ENABLED},
+	{"Bsr.Rest1OptInWasEnabled", FIS_BSR_REST1_OPT_IN_WAS_ENABLED},
+	{"Bsr.Rest1PcrLock", FIS_BSR_REST1_PCR_LOCK},
+	{"Bsr.Rest1WatchDogStatus", FIS_BSR_REST1_WATCH_DOG_STATUS},
+	{"Bsr.Rest2", FIS_BSR_REST2},
+	{"BuildConfiguration", FIS_FIRMWARE_IMAGE_INFO_BUILD_CONFIGURATION},
+	{"Checksum", FIS_PLATFORM_CONFIG_DATA_CHECKSUM},
+	{"Command", FIS_LONG_OPERATION_STATUS_COMMAND},
+	{"CommandSpecificReturnData", FIS_LONG_OPERATION_STATUS_COMMAND_SPECIFIC_RETURN_DATA},
+	{"CommitId", FIS_FIRMWARE_IMAGE_INFO_COMMIT_ID},
+	{"ConfigLockdown.Locked", FIS_CONFIG_LOCKDOWN_LOCKED},
+	{"ControllerTempShutdownThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_CONTROLLER_TEMP_SHUTDOWN_THRESHOLD},
+	{"ControllerTempThreshold", FIS_GET_ALARM_THRESHOLD_CONTROLLER_TEMP_THRESHOLD},
+	{"ControllerTemperatureTrip", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_CONTROLLER_TEMPERATURE_TRIP},
+	{"CountExpired", FIS_GET_SECURITY_STATE_SECURITY_STATE_COUNT_EXPIRED},
+	{"CreatorId", FIS_PLATFORM_CONFIG_DATA_CREATOR_ID},
+	{"CreatorRevision", FIS_PLATFORM_CONFIG_DATA_CREATOR_REVISION},
+	{"CreditReady", FIS_BSR_REST1_CREDIT_READY},
+	{"Critical", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_CRITICAL},
+	{"CurrentConfigOffset", FIS_PLATFORM_CONFIG_DATA_CURRENT_CONFIG_OFFSET},
+	{"CurrentConfigSize", FIS_PLATFORM_CONFIG_DATA_CURRENT_CONFIG_SIZE},
+	{"DdrtIoInfo", FIS_DDRT_IO_INIT_INFO_DDRT_IO_INFO},
+	{"DdrtIoInitComplete", FIS_BSR_REST1_DDRT_IO_INIT_COMPLETE},
+	{"DdrtIoInitInfo.DdrtIoInfo", FIS_DDRT_IO_INIT_INFO_DDRT_IO_INFO},
+	{"DdrtIoInitInfo.DdrtTrainingStatus", FIS_DDRT_IO_INIT_INFO_DDRT_TRAINING_STATUS},
+	{"DdrtPowerFailCommandReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_DDRT_POWER_FAIL_COMMAND_RECEIVED},
+	{"DdrtTrainingStatus", FIS_DDRT_IO_INIT_INFO_DDRT_TRAINING_STATUS},
+	{"DeviceId", FIS_IDENTIFY_DIMM_DEVICE_ID},
+	{"DieSparingCapable", FIS_IDENTIFY_DIMM_DIMM_SKU_DIE_SPARING_CAPABLE},
+	{"DieSparingPolicy.Aggressiveness", FIS_DIE_SPARING_POLICY_AGGRESSIVENESS},
+	{"DieSparingPolicy.Enable", FIS_DIE_SPARING_POLICY_ENABLE},
+	{"DieSparingPolicy.Supported", FIS_DIE_SPARING_POLICY_SUPPORTED},
+	{"DieSparingPolicy.SupportedRank0", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_0},
+	{"DieSparingPolicy.SupportedRank1", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_1},
+	{"DieSparingPolicy.SupportedRank2", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_2},
+	{"DieSparingPolicy.SupportedRank3", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_3},
+	{"DimmPartitionInfo.EnabledCapacity", FIS_DIMM_PARTITION_INFO_ENABLED_CAPACITY},
+	{"DimmPartitionInfo.PmCapacity", FIS_DIMM_PARTITION_INFO_PM_CAPACITY},
+	{"DimmPartitionInfo.PmStart", FIS_DIMM_PARTITION_INFO_PM_START},
+	{"DimmPartitionInfo.RawCapacity", FIS_DIMM_PARTITION_INFO_RAW_CAPACITY},
+	{"DimmPartitionInfo.VolatileCapacity", FIS_DIMM_PARTITION_INFO_VOLATILE_CAPACITY},
+	{"DimmPartitionInfo.VolatileStart", FIS_DIMM_PARTITION_INFO_VOLATILE_START},
+	{"DpaCurrentAddress", FIS_ADDRESS_RANGE_SCRUB_DPA_CURRENT_ADDRESS},
+	{"DpaEndAddress", FIS_ADDRESS_RANGE_SCRUB_DPA_END_ADDRESS},
+	{"DpaStartAddress", FIS_ADDRESS_RANGE_SCRUB_DPA_START_ADDRESS},
+	{"EnableDimm.Enable", FIS_ENABLE_DIMM_ENABLE},
+	{"Enabled", FIS_GET_SECURITY_STATE_SECURITY_STATE_ENABLED},
+	{"EnabledCapacity", FIS_DIMM_PARTITION_INFO_ENABLED_CAPACITY},
+	{"EncryptionEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_ENCRYPTION_ENABLED},
+	{"ErrorInjectionEnabled", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_ERROR_INJECTION_ENABLED},
+	{"ErrorInjectionStatus", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS},
+	{"EstimateTimeToCompletion", FIS_LONG_OPERATION_STATUS_ESTIMATE_TIME_TO_COMPLETION},
+	{"Fatal", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_FATAL},
+	{"FeatureSwRequiredMask", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK},
+	{"FirmwareDebugLog.LogSize", FIS_FIRMWARE_DEBUG_LOG_LOG_SIZE},
+	{"FirmwareImageInfo.BuildConfiguration", FIS_FIRMWARE_IMAGE_INFO_BUILD_CONFIGURATION},
+	{"FirmwareImageInfo.CommitId", FIS_FIRMWARE_IMAGE_INFO_COMMIT_ID},
+	{"FirmwareImageInfo.FirmwareRevision", FIS_FIRMWARE_IMAGE_INFO_FIRMWARE_REVISION},
+	{"FirmwareImageInfo.FirmwareType", FIS_FIRMWARE_IMAGE_INFO_FIRMWARE_TYPE},
+	{"FirmwareImageInfo.LastFwUpdateStatus", FIS_FIRMWARE_IMAGE_INFO_LAST_FW_UPDATE_STATUS},
+	{"FirmwareImageInfo.StagedFwRevision", FIS_FIRMWARE_IMAGE_INFO_STAGED_FW_REVISION},
+	{"FirmwareType", FIS_FIRMWARE_IMAGE_INFO_FIRMWARE_TYPE},
+	{"FirstFastRefresh", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_FIRST_FAST_REFRESH},
+	{"FirstFastRefreshComplete", FIS_BSR_REST1_FIRST_FAST_REFRESH_COMPLETE},
+	{"FlushComplete", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_FLUSH_COMPLETE},
+	{"Frozen", FIS_GET_SECURITY_STATE_SECURITY_STATE_FROZEN},
+	{"FwDebugLogLevel.LogLevel", FIS_FW_DEBUG_LOG_LEVEL_LOG_LEVEL},
+	{"FwDebugLogLevel.Logs", FIS_FW_DEBUG_LOG_LEVEL_LOGS},
+	{"FwLoadFlag.LoadFlag", FIS_FW_LOAD_FLAG_LOAD_FLAG},
+	{"GetAlarmThreshold.ControllerTempThreshold", FIS_GET_ALARM_THRESHOLD_CONTROLLER_TEMP_THRESHOLD},
+	{"GetAlarmThreshold.Enable", FIS_GET_ALARM_THRESHOLD_ENABLE},
+	{"GetAlarmThreshold.EnableControllerTemp", FIS_GET_ALARM_THRESHOLD_ENABLE_CONTROLLER_TEMP},
+	{"GetAlarmThreshold.EnableMediaTemp", FIS_GET_ALARM_THRESHOLD_ENABLE_MEDIA_TEMP},
+	{"GetAlarmThreshold.EnableSpareBlock", FIS_GET_ALARM_THRESHOLD_ENABLE_SPARE_BLOCK},
+	{"GetAlarmThreshold.MediaTempThreshold", FIS_GET_ALARM_THRESHOLD_MEDIA_TEMP_THRESHOLD},
+	{"GetAlarmThreshold.SpareBlockThreshold", FIS_GET_ALARM_THRESHOLD_SPARE_BLOCK_THRESHOLD},
+	{"GetSecurityState.SecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE},
+	{"GetSecurityState.SecurityStateCountExpired", FIS_GET_SECURITY_STATE_SECURITY_STATE_COUNT_EXPIRED},
+	{"GetSecurityState.SecurityStateEnabled", FIS_GET_SECURITY_STATE_SECURITY_STATE_ENABLED},
+	{"GetSecurityState.SecurityStateFrozen", FIS_GET_SECURITY_STATE_SECURITY_STATE_FROZEN},
+	{"GetSecurityState.SecurityStateLocked", FIS_GET_SECURITY_STATE_SECURITY_STATE_LOCKED},
+	{"GetSecurityState.SecurityStateNotSupported", FIS_GET_SECURITY_STATE_SECURITY_STATE_NOT_SUPPORTED},
+	{"GetSupportedSkuFeatures.DimmSku", FIS_GET_SUPPORTED_SKU_FEATURES_DIMM_SKU},
+	{"IdentifyDimm.ApiVer", FIS_IDENTIFY_DIMM_API_VER},
+	{"IdentifyDimm.DeviceId", FIS_IDENTIFY_DIMM_DEVICE_ID},
+	{"IdentifyDimm.DimmSku", FIS_IDENTIFY_DIMM_DIMM_SKU},
+	{"IdentifyDimm.DimmSkuAppDirectModeEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_APP_DIRECT_MODE_ENABLED},
+	{"IdentifyDimm.DimmSkuDieSparingCapable", FIS_IDENTIFY_DIMM_DIMM_SKU_DIE_SPARING_CAPABLE},
+	{"IdentifyDimm.DimmSkuEncryptionEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_ENCRYPTION_ENABLED},
+	{"IdentifyDimm.DimmSkuMemoryModeEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_MEMORY_MODE_ENABLED},
+	{"IdentifyDimm.DimmSkuSoftProgrammableSku", FIS_IDENTIFY_DIMM_DIMM_SKU_SOFT_PROGRAMMABLE_SKU},
+	{"IdentifyDimm.DimmSkuStorageModeEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_STORAGE_MODE_ENABLED},
+	{"IdentifyDimm.FeatureSwRequiredMask", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK},
+	{"IdentifyDimm.FeatureSwRequiredMaskInvalidateBeforeBlockRead", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK_INVALIDATE_BEFORE_BLOCK_READ},
+	{"IdentifyDimm.FeatureSwRequiredMaskReadbackOfBwAddressRegisterRequiredBeforeUse", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK_READBACK_OF_BW_ADDRESS_REGISTER_REQUIRED_BEFORE_USE},
+	{"IdentifyDimm.FirmwareRevision", FIS_IDENTIFY_DIMM_FIRMWARE_REVISION},
+	{"IdentifyDimm.InterfaceFormatCode", FIS_IDENTIFY_DIMM_INTERFACE_FORMAT_CODE},
+	{"IdentifyDimm.InterfaceFormatCodeExtra", FIS_IDENTIFY_DIMM_INTERFACE_FORMAT_CODE_EXTRA},
+	{"IdentifyDimm.Manufacturer", FIS_IDENTIFY_DIMM_MANUFACTURER},
+	{"IdentifyDimm.NumberOfBlockWindows", FIS_IDENTIFY_DIMM_NUMBER_OF_BLOCK_WINDOWS},
+	{"IdentifyDimm.OffsetOfBlockModeControlRegion", FIS_IDENTIFY_DIMM_OFFSET_OF_BLOCK_MODE_CONTROL_REGION},
+	{"IdentifyDimm.PartNumber", FIS_IDENTIFY_DIMM_PART_NUMBER},
+	{"IdentifyDimm.RawCapacity", FIS_IDENTIFY_DIMM_RAW_CAPACITY},
+	{"IdentifyDimm.ReservedOldApi", FIS_IDENTIFY_DIMM_RESERVED_OLD_API},
+	{"IdentifyDimm.RevisionId", FIS_IDENTIFY_DIMM_REVISION_ID},
+	{"IdentifyDimm.SerialNumber", FIS_IDENTIFY_DIMM_SERIAL_NUMBER},
+	{"IdentifyDimm.VendorId", FIS_IDENTIFY_DIMM_VENDOR_ID},
+	{"IdentifyDimmCharacteristics.ControllerTempShutdownThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_CONTROLLER_TEMP_SHUTDOWN_THRESHOLD},
+	{"IdentifyDimmCharacteristics.MediaTempShutdownThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_MEDIA_TEMP_SHUTDOWN_THRESHOLD},
+	{"IdentifyDimmCharacteristics.ThrottlingStartThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_THROTTLING_START_THRESHOLD},
+	{"IdentifyDimmCharacteristics.ThrottlingStopThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_THROTTLING_STOP_THRESHOLD},
+	{"InputConfigOffset", FIS_PLATFORM_CONFIG_DATA_INPUT_CONFIG_OFFSET},
+	{"InputConfigSize", FIS_PLATFORM_CONFIG_DATA_INPUT_CONFIG_SIZE},
+	{"InterfaceFormatCode", FIS_IDENTIFY_DIMM_INTERFACE_FORMAT_CODE},
+	{"InterfaceFormatCodeExtra", FIS_IDENTIFY_DIMM_INTERFACE_FORMAT_CODE_EXTRA},
+	{"InvalidateBeforeBlockRead", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK_INVALIDATE_BEFORE_BLOCK_READ},
+	{"LastFwUpdateStatus", FIS_FIRMWARE_IMAGE_INFO_LAST_FW_UPDATE_STATUS},
+	{"LastShutdownStatusDetails", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS},
+	{"LastShutdownStatusExtendedDetails", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS},
+	{"LastShutdownTime", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_TIME},
+	{"Length", FIS_PLATFORM_CONFIG_DATA_LENGTH},
+	{"LoadFlag", FIS_FW_LOAD_FLAG_LOAD_FLAG},
+	{"LogLevel", FIS_FW_DEBUG_LOG_LEVEL_LOG_LEVEL},
+	{"LogSize", FIS_FIRMWARE_DEBUG_LOG_LOG_SIZE},
+	{"Logs", FIS_FW_DEBUG_LOG_LEVEL_LOGS},
+	{"LongOperationStatus.Command", FIS_LONG_OPERATION_STATUS_COMMAND},
+	{"LongOperationStatus.CommandSpecificReturnData", FIS_LONG_OPERATION_STATUS_COMMAND_SPECIFIC_RETURN_DATA},
+	{"LongOperationStatus.EstimateTimeToCompletion", FIS_LONG_OPERATION_STATUS_ESTIMATE_TIME_TO_COMPLETION},
+	{"LongOperationStatus.PercentComplete", FIS_LONG_OPERATION_STATUS_PERCENT_COMPLETE},
+	{"LongOperationStatus.StatusCode", FIS_LONG_OPERATION_STATUS_STATUS_CODE},
+	{"MailboxReady", FIS_BSR_REST1_MAILBOX_READY},
+	{"MajorCheckpoint", FIS_BSR_MAJOR_CHECKPOINT},
+	{"Manufacturer", FIS_IDENTIFY_DIMM_MANUFACTURER},
+	{"MaxPower", FIS_POWER_MANAGEMENT_POLICY_MAX_POWER},
+	{"MediaDisabled", FIS_BSR_REST1_MEDIA_DISABLED},
+	{"MediaErrorInjections", FIS_SMART_HEALTH_INFO_MEDIA_ERROR_INJECTIONS},
+	{"MediaReads", FIS_MEMORY_INFO_PAGE_0_MEDIA_READS},
+	{"MediaReady1", FIS_BSR_REST1_MEDIA_READY_1},
+	{"MediaReady2", FIS_BSR_REST1_MEDIA_READY_2},
+	{"MediaTempShutdownThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_MEDIA_TEMP_SHUTDOWN_THRESHOLD},
+	{"MediaTempThreshold", FIS_GET_ALARM_THRESHOLD_MEDIA_TEMP_THRESHOLD},
+	{"MediaTemperatureInjectionEnabled", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_MEDIA_TEMPERATURE_INJECTION_ENABLED},
+	{"MediaTemperatureInjectionsCounter", FIS_MEMORY_INFO_PAGE_3_MEDIA_TEMPERATURE_INJECTIONS_COUNTER},
+	{"MediaTemperatureTrip", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_MEDIA_TEMPERATURE_TRIP},
+	{"MediaWrites", FIS_MEMORY_INFO_PAGE_0_MEDIA_WRITES},
+	{"MemoryInfoPage0.BlockReadRequests", FIS_MEMORY_INFO_PAGE_0_BLOCK_READ_REQUESTS},
+	{"MemoryInfoPage0.BlockWriteRequests", FIS_MEMORY_INFO_PAGE_0_BLOCK_WRITE_REQUESTS},
+	{"MemoryInfoPage0.MediaReads", FIS_MEMORY_INFO_PAGE_0_MEDIA_READS},
+	{"MemoryInfoPage0.MediaWrites", FIS_MEMORY_INFO_PAGE_0_MEDIA_WRITES},
+	{"MemoryInfoPage0.ReadRequests", FIS_MEMORY_INFO_PAGE_0_READ_REQUESTS},
+	{"MemoryInfoPage0.WriteRequests", FIS_MEMORY_INFO_PAGE_0_WRITE_REQUESTS},
+	{"MemoryInfoPage1.TotalBlockReadRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_BLOCK_READ_REQUESTS},
+	{"MemoryInfoPage1.TotalBlockWriteRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_BLOCK_WRITE_REQUESTS},
+	{"MemoryInfoPage1.TotalMediaReads", FIS_MEMORY_INFO_PAGE_1_TOTAL_MEDIA_READS},
+	{"MemoryInfoPage1.TotalMediaWrites", FIS_MEMORY_INFO_PAGE_1_TOTAL_MEDIA_WRITES},
+	{"MemoryInfoPage1.TotalReadRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_READ_REQUESTS},
+	{"MemoryInfoPage1.TotalWriteRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_WRITE_REQUESTS},
+	{"MemoryInfoPage3.ErrorInjectionStatus", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS},
+	{"MemoryInfoPage3.ErrorInjectionStatusErrorInjectionEnabled", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_ERROR_INJECTION_ENABLED},
+	{"MemoryInfoPage3.ErrorInjectionStatusMediaTemperatureInjectionEnabled", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_MEDIA_TEMPERATURE_INJECTION_ENABLED},
+	{"MemoryInfoPage3.ErrorInjectionStatusSoftwareTriggersEnabled", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_SOFTWARE_TRIGGERS_ENABLED},
+	{"MemoryInfoPage3.MediaTemperatureInjectionsCounter", FIS_MEMORY_INFO_PAGE_3_MEDIA_TEMPERATURE_INJECTIONS_COUNTER},
+	{"MemoryInfoPage3.PoisonErrorClearCounter", FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_CLEAR_COUNTER},
+	{"MemoryInfoPage3.PoisonErrorInjectionsCounter", FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_INJECTIONS_COUNTER},
+	{"MemoryInfoPage3.SoftwareTriggersCounter", FIS_MEMORY_INFO_PAGE_3_SOFTWARE_TRIGGERS_COUNTER},
+	{"MemoryModeEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_MEMORY_MODE_ENABLED},
+	{"MiStall", FIS_BSR_REST1_MI_STALL},
+	{"MinorCheckpoint", FIS_BSR_MINOR_CHECKPOINT},
+	{"NonMediaErrorInjections", FIS_SMART_HEALTH_INFO_NON_MEDIA_ERROR_INJECTIONS},
+	{"Noncritical", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_NONCRITICAL},
+	{"NotSupported", FIS_GET_SECURITY_STATE_SECURITY_STATE_NOT_SUPPORTED},
+	{"NumberOfBlockWindows", FIS_IDENTIFY_DIMM_NUMBER_OF_BLOCK_WINDOWS},
+	{"OemId", FIS_PLATFORM_CONFIG_DATA_OEM_ID},
+	{"OemRevision", FIS_PLATFORM_CONFIG_DATA_OEM_REVISION},
+	{"OemTableId", FIS_PLATFORM_CONFIG_DATA_OEM_TABLE_ID},
+	{"OffsetOfBlockModeControlRegion", FIS_IDENTIFY_DIMM_OFFSET_OF_BLOCK_MODE_CONTROL_REGION},
+	{"OptInEnabled", FIS_BSR_REST1_OPT_IN_ENABLED},
+	{"OptInWasEnabled", FIS_BSR_REST1_OPT_IN_WAS_ENABLED},
+	{"OptionalConfigurationDataPolicy.FirstFastRefresh", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_FIRST_FAST_REFRESH},
+	{"OptionalConfigurationDataPolicy.ViralPolicyEnabled", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_VIRAL_POLICY_ENABLED},
+	{"OptionalConfigurationDataPolicy.ViralStatus", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_VIRAL_STATUS},
+	{"OutputConfigOffset", FIS_PLATFORM_CONFIG_DATA_OUTPUT_CONFIG_OFFSET},
+	{"OutputConfigSize", FIS_PLATFORM_CONFIG_DATA_OUTPUT_CONFIG_SIZE},
+	{"PartNumber", FIS_IDENTIFY_DIMM_PART_NUMBER},
+	{"PcrLock", FIS_BSR_REST1_PCR_LOCK},
+	{"PeakPowerBudget", FIS_POWER_MANAGEMENT_POLICY_PEAK_POWER_BUDGET},
+	{"PercentComplete", FIS_LONG_OPERATION_STATUS_PERCENT_COMPLETE},
+	{"PlatformConfigData.Checksum", FIS_PLATFORM_CONFIG_DATA_CHECKSUM},
+	{"PlatformConfigData.CreatorId", FIS_PLATFORM_CONFIG_DATA_CREATOR_ID},
+	{"PlatformConfigData.CreatorRevision", FIS_PLATFORM_CONFIG_DATA_CREATOR_REVISION},
+	{"PlatformConfigData.CurrentConfigOffset", FIS_PLATFORM_CONFIG_DATA_CURRENT_CONFIG_OFFSET},
+	{"PlatformConfigData.CurrentConfigSize", FIS_PLATFORM_CONFIG_DATA_CURRENT_CONFIG_SIZE},
+	{"PlatformConfigData.InputConfigOffset", FIS_PLATFORM_CONFIG_DATA_INPUT_CONFIG_OFFSET},
+	{"PlatformConfigData.InputConfigSize", FIS_PLATFORM_CONFIG_DATA_INPUT_CONFIG_SIZE},
+	{"PlatformConfigData.Length", FIS_PLATFORM_CONFIG_DATA_LENGTH},
+	{"PlatformConfigData.OemId", FIS_PLATFORM_CONFIG_DATA_OEM_ID},
+	{"PlatformConfigData.OemRevision", FIS_PLATFORM_CONFIG_DATA_OEM_REVISION},
+	{"PlatformConfigData.OemTableId", FIS_PLATFORM_CONFIG_DATA_OEM_TABLE_ID},
+	{"PlatformConfigData.OutputConfigOffset", FIS_PLATFORM_CONFIG_DATA_OUTPUT_CONFIG_OFFSET},
+	{"PlatformConfigData.OutputConfigSize", FIS_PLATFORM_CONFIG_DATA_OUTPUT_CONFIG_SIZE},
+	{"PlatformConfigData.Revision", FIS_PLATFORM_CONFIG_DATA_REVISION},
+	{"PlatformConfigData.Signature", FIS_PLATFORM_CONFIG_DATA_SIGNATURE},
+	{"PmAdrCommandReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_ADR_COMMAND_RECEIVED},
+	{"PmCapacity", FIS_DIMM_PARTITION_INFO_PM_CAPACITY},
+	{"PmS3Received", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_S3_RECEIVED},
+	{"PmS5Received", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_S5_RECEIVED},
+	{"PmStart", FIS_DIMM_PARTITION_INFO_PM_START},
+	{"PmWarmResetReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_WARM_RESET_RECEIVED},
+	{"Pmic12vPowerFail", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PMIC_12V_POWER_FAIL},
+	{"Pmon0Control", FIS_PMON_REGISTERS_PMON_0_CONTROL},
+	{"Pmon0Counter", FIS_PMON_REGISTERS_PMON_0_COUNTER},
+	{"Pmon10Control", FIS_PMON_REGISTERS_PMON_10_CONTROL},
+	{"Pmon10Counter", FIS_PMON_REGISTERS_PMON_10_COUNTER},
+	{"Pmon11Control", FIS_PMON_REGISTERS_PMON_11_CONTROL},
+	{"Pmon11Counter", FIS_PMON_REGISTERS_PMON_11_COUNTER},
+	{"Pmon14Control", FIS_PMON_REGISTERS_PMON_14_CONTROL},
+	{"Pmon14Counter", FIS_PMON_REGISTERS_PMON_14_COUNTER},
+	{"Pmon1Control", FIS_PMON_REGISTERS_PMON_1_CONTROL},
+	{"Pmon1Counter", FIS_PMON_REGISTERS_PMON_1_COUNTER},
+	{"Pmon2Control", FIS_PMON_REGISTERS_PMON_2_CONTROL},
+	{"Pmon2Counter", FIS_PMON_REGISTERS_PMON_2_COUNTER},
+	{"Pmon3Control", FIS_PMON_REGISTERS_PMON_3_CONTROL},
+	{"Pmon3Counter", FIS_PMON_REGISTERS_PMON_3_COUNTER},
+	{"Pmon4Control", FIS_PMON_REGISTERS_PMON_4_CONTROL},
+	{"Pmon4Counter", FIS_PMON_REGISTERS_PMON_4_COUNTER},
+	{"Pmon5Control", FIS_PMON_REGISTERS_PMON_5_CONTROL},
+	{"Pmon5Counter", FIS_PMON_REGISTERS_PMON_5_COUNTER},
+	{"Pmon6Control", FIS_PMON_REGISTERS_PMON_6_CONTROL},
+	{"Pmon6Counter", FIS_PMON_REGISTERS_PMON_6_COUNTER},
+	{"Pmon7Control", FIS_PMON_REGISTERS_PMON_7_CONTROL},
+	{"Pmon7Counter", FIS_PMON_REGISTERS_PMON_7_COUNTER},
+	{"Pmon8Control", FIS_PMON_REGISTERS_PMON_8_CONTROL},
+	{"Pmon8Counter", FIS_PMON_REGISTERS_PMON_8_COUNTER},
+	{"Pmon9Control", FIS_PMON_REGISTERS_PMON_9_CONTROL},
+	{"Pmon9Counter", FIS_PMON_REGISTERS_PMON_9_COUNTER},
+	{"PmonRegisters.Pmon0Control", FIS_PMON_REGISTERS_PMON_0_CONTROL},
+	{"PmonRegisters.Pmon0Counter", FIS_PMON_REGISTERS_PMON_0_COUNTER},
+	{"PmonRegisters.Pmon10Control", FIS_PMON_REGISTERS_PMON_10_CONTROL},
+	{"PmonRegisters.Pmon10Counter", FIS_PMON_REGISTERS_PMON_10_COUNTER},
+	{"PmonRegisters.Pmon11Control", FIS_PMON_REGISTERS_PMON_11_CONTROL},
+	{"PmonRegisters.Pmon11Counter", FIS_PMON_REGISTERS_PMON_11_COUNTER},
+	{"PmonRegisters.Pmon14Control", FIS_PMON_REGISTERS_PMON_14_CONTROL},
+	{"PmonRegisters.Pmon14Counter", FIS_PMON_REGISTERS_PMON_14_COUNTER},
+	{"PmonRegisters.Pmon1Control", FIS_PMON_REGISTERS_PMON_1_CONTROL},
+	{"PmonRegisters.Pmon1Counter", FIS_PMON_REGISTERS_PMON_1_COUNTER},
+	{"PmonRegisters.Pmon2Control", FIS_PMON_REGISTERS_PMON_2_CONTROL},
+	{"PmonRegisters.Pmon2Counter", FIS_PMON_REGISTERS_PMON_2_COUNTER},
+	{"PmonRegisters.Pmon3Control", FIS_PMON_REGISTERS_PMON_3_CONTROL},
+	{"PmonRegisters.Pmon3Counter", FIS_PMON_REGISTERS_PMON_3_COUNTER},
+	{"PmonRegisters.Pmon4Control", FIS_PMON_REGISTERS_PMON_4_CONTROL},
+	{"PmonRegisters.Pmon4Counter", FIS_PMON_REGISTERS_PMON_4_COUNTER},
+	{"PmonRegisters.Pmon5Control", FIS_PMON_REGISTERS_PMON_5_CONTROL},
+	{"PmonRegisters.Pmon5Counter", FIS_PMON_REGISTERS_PMON_5_COUNTER},
+	{"PmonRegisters.Pmon6Control", FIS_PMON_REGISTERS_PMON_6_CONTROL},
+	{"PmonRegisters.Pmon6Counter", FIS_PMON_REGISTERS_PMON_6_COUNTER},
+	{"PmonRegisters.Pmon7Control", FIS_PMON_REGISTERS_PMON_7_CONTROL},
+	{"PmonRegisters.Pmon7Counter", FIS_PMON_REGISTERS_PMON_7_COUNTER},
+	{"PmonRegisters.Pmon8Control", FIS_PMON_REGISTERS_PMON_8_CONTROL},
+	{"PmonRegisters.Pmon8Counter", FIS_PMON_REGISTERS_PMON_8_COUNTER},
+	{"PmonRegisters.Pmon9Control", FIS_PMON_REGISTERS_PMON_9_CONTROL},
+	{"PmonRegisters.Pmon9Counter", FIS_PMON_REGISTERS_PMON_9_COUNTER},
+	{"PmonRegisters.PmonRetreiveMask", FIS_PMON_REGISTERS_PMON_RETREIVE_MASK},
+	{"PmonRetreiveMask", FIS_PMON_REGISTERS_PMON_RETREIVE_MASK},
+	{"PoisonErrorClearCounter", FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_CLEAR_COUNTER},
+	{"PoisonErrorInjectionsCounter", FIS_MEMORY_INFO_PAGE_3_POISON_ERROR_INJECTIONS_COUNTER},
+	{"PowerCycles", FIS_SMART_HEALTH_INFO_POWER_CYCLES},
+	{"PowerManagementPolicy.AveragePowerBudget", FIS_POWER_MANAGEMENT_POLICY_AVERAGE_POWER_BUDGET},
+	{"PowerManagementPolicy.Enable", FIS_POWER_MANAGEMENT_POLICY_ENABLE},
+	{"PowerManagementPolicy.MaxPower", FIS_POWER_MANAGEMENT_POLICY_MAX_POWER},
+	{"PowerManagementPolicy.PeakPowerBudget", FIS_POWER_MANAGEMENT_POLICY_PEAK_POWER_BUDGET},
+	{"PowerOnTime", FIS_SMART_HEALTH_INFO_POWER_ON_TIME},
+	{"Rank0", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_0},
+	{"Rank1", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_1},
+	{"Rank2", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_2},
+	{"Rank3", FIS_DIE_SPARING_POLICY_SUPPORTED_RANK_3},
+	{"ReadRequests", FIS_MEMORY_INFO_PAGE_0_READ_REQUESTS},
+	{"ReadbackOfBwAddressRegisterRequiredBeforeUse", FIS_IDENTIFY_DIMM_FEATURE_SW_REQUIRED_MASK_READBACK_OF_BW_ADDRESS_REGISTER_REQUIRED_BEFORE_USE},
+	{"ReservedOldApi", FIS_IDENTIFY_DIMM_RESERVED_OLD_API},
+	{"Rest1", FIS_BSR_REST1},
+	{"Rest2", FIS_BSR_REST2},
+	{"Revision", FIS_PLATFORM_CONFIG_DATA_REVISION},
+	{"RevisionId", FIS_IDENTIFY_DIMM_REVISION_ID},
+	{"S4PowerStateReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_S4_POWER_STATE_RECEIVED},
+	{"SecurityState", FIS_GET_SECURITY_STATE_SECURITY_STATE},
+	{"SerialNumber", FIS_IDENTIFY_DIMM_SERIAL_NUMBER},
+	{"Signature", FIS_PLATFORM_CONFIG_DATA_SIGNATURE},
+	{"SmartHealthInfo.AitDramStatus", FIS_SMART_HEALTH_INFO_AIT_DRAM_STATUS},
+	{"SmartHealthInfo.AlarmTrips", FIS_SMART_HEALTH_INFO_ALARM_TRIPS},
+	{"SmartHealthInfo.AlarmTripsControllerTemperatureTrip", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_CONTROLLER_TEMPERATURE_TRIP},
+	{"SmartHealthInfo.AlarmTripsMediaTemperatureTrip", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_MEDIA_TEMPERATURE_TRIP},
+	{"SmartHealthInfo.AlarmTripsSpareBlockTrip", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_SPARE_BLOCK_TRIP},
+	{"SmartHealthInfo.ControllerTemp", FIS_SMART_HEALTH_INFO_CONTROLLER_TEMP},
+	{"SmartHealthInfo.HealthStatus", FIS_SMART_HEALTH_INFO_HEALTH_STATUS},
+	{"SmartHealthInfo.HealthStatusCritical", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_CRITICAL},
+	{"SmartHealthInfo.HealthStatusFatal", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_FATAL},
+	{"SmartHealthInfo.HealthStatusNoncritical", FIS_SMART_HEALTH_INFO_HEALTH_STATUS_NONCRITICAL},
+	{"SmartHealthInfo.LastShutdownStatus", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS},
+	{"SmartHealthInfo.LastShutdownStatusDetails", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS},
+	{"SmartHealthInfo.LastShutdownStatusDetailsDdrtPowerFailCommandReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_DDRT_POWER_FAIL_COMMAND_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusDetailsFlushComplete", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_FLUSH_COMPLETE},
+	{"SmartHealthInfo.LastShutdownStatusDetailsPmAdrCommandReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_ADR_COMMAND_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusDetailsPmS3Received", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_S3_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusDetailsPmS5Received", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_S5_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusDetailsPmWarmResetReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PM_WARM_RESET_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusDetailsPmic12vPowerFail", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_PMIC_12V_POWER_FAIL},
+	{"SmartHealthInfo.LastShutdownStatusDetailsThermalShutdownReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_THERMAL_SHUTDOWN_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusExtendedDetails", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS},
+	{"SmartHealthInfo.LastShutdownStatusExtendedDetailsS4PowerStateReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_S4_POWER_STATE_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusExtendedDetailsSurpriseClockStopInterruptReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_SURPRISE_CLOCK_STOP_INTERRUPT_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusExtendedDetailsViralInterruptReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_VIRAL_INTERRUPT_RECEIVED},
+	{"SmartHealthInfo.LastShutdownStatusExtendedDetailsWriteDataFlushComplete", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_WRITE_DATA_FLUSH_COMPLETE},
+	{"SmartHealthInfo.LastShutdownTime", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_TIME},
+	{"SmartHealthInfo.MediaErrorInjections", FIS_SMART_HEALTH_INFO_MEDIA_ERROR_INJECTIONS},
+	{"SmartHealthInfo.MediaTemp", FIS_SMART_HEALTH_INFO_MEDIA_TEMP},
+	{"SmartHealthInfo.NonMediaErrorInjections", FIS_SMART_HEALTH_INFO_NON_MEDIA_ERROR_INJECTIONS},
+	{"SmartHealthInfo.PercentUsed", FIS_SMART_HEALTH_INFO_PERCENT_USED},
+	{"SmartHealthInfo.PowerCycles", FIS_SMART_HEALTH_INFO_POWER_CYCLES},
+	{"SmartHealthInfo.PowerOnTime", FIS_SMART_HEALTH_INFO_POWER_ON_TIME},
+	{"SmartHealthInfo.SpareBlocks", FIS_SMART_HEALTH_INFO_SPARE_BLOCKS},
+	{"SmartHealthInfo.UnsafeShutdownCount", FIS_SMART_HEALTH_INFO_UNSAFE_SHUTDOWN_COUNT},
+	{"SmartHealthInfo.UnsafeShutdowns", FIS_SMART_HEALTH_INFO_UNSAFE_SHUTDOWNS},
+	{"SmartHealthInfo.Uptime", FIS_SMART_HEALTH_INFO_UPTIME},
+	{"SmartHealthInfo.ValidationFlags", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS},
+	{"SmartHealthInfo.ValidationFlagsAitDramStatus", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_AIT_DRAM_STATUS},
+	{"SmartHealthInfo.ValidationFlagsAlarmTrips", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_ALARM_TRIPS},
+	{"SmartHealthInfo.ValidationFlagsControllerTemp", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_CONTROLLER_TEMP},
+	{"SmartHealthInfo.ValidationFlagsHealthStatus", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_HEALTH_STATUS},
+	{"SmartHealthInfo.ValidationFlagsLastShutdownStatus", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_LAST_SHUTDOWN_STATUS},
+	{"SmartHealthInfo.ValidationFlagsMediaTemp", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_MEDIA_TEMP},
+	{"SmartHealthInfo.ValidationFlagsPercentUsed", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_PERCENT_USED},
+	{"SmartHealthInfo.ValidationFlagsSpareBlocks", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_SPARE_BLOCKS},
+	{"SmartHealthInfo.ValidationFlagsUnsafeShutdownCounter", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_UNSAFE_SHUTDOWN_COUNTER},
+	{"SmartHealthInfo.ValidationFlagsVendorSpecificDataSize", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_VENDOR_SPECIFIC_DATA_SIZE},
+	{"SmartHealthInfo.VendorSpecificDataSize", FIS_SMART_HEALTH_INFO_VENDOR_SPECIFIC_DATA_SIZE},
+	{"SoftProgrammableSku", FIS_IDENTIFY_DIMM_DIMM_SKU_SOFT_PROGRAMMABLE_SKU},
+	{"SoftwareTriggersCounter", FIS_MEMORY_INFO_PAGE_3_SOFTWARE_TRIGGERS_COUNTER},
+	{"SoftwareTriggersEnabled", FIS_MEMORY_INFO_PAGE_3_ERROR_INJECTION_STATUS_SOFTWARE_TRIGGERS_ENABLED},
+	{"SpareBlock", FIS_GET_ALARM_THRESHOLD_ENABLE_SPARE_BLOCK},
+	{"SpareBlockThreshold", FIS_GET_ALARM_THRESHOLD_SPARE_BLOCK_THRESHOLD},
+	{"SpareBlockTrip", FIS_SMART_HEALTH_INFO_ALARM_TRIPS_SPARE_BLOCK_TRIP},
+	{"StagedFwRevision", FIS_FIRMWARE_IMAGE_INFO_STAGED_FW_REVISION},
+	{"StatusCode", FIS_LONG_OPERATION_STATUS_STATUS_CODE},
+	{"StorageModeEnabled", FIS_IDENTIFY_DIMM_DIMM_SKU_STORAGE_MODE_ENABLED},
+	{"Supported", FIS_DIE_SPARING_POLICY_SUPPORTED},
+	{"SurpriseClockStopInterruptReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_SURPRISE_CLOCK_STOP_INTERRUPT_RECEIVED},
+	{"SystemTime.UnixTime", FIS_SYSTEM_TIME_UNIX_TIME},
+	{"ThermalShutdownReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_DETAILS_THERMAL_SHUTDOWN_RECEIVED},
+	{"ThrottlingStartThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_THROTTLING_START_THRESHOLD},
+	{"ThrottlingStopThreshold", FIS_IDENTIFY_DIMM_CHARACTERISTICS_THROTTLING_STOP_THRESHOLD},
+	{"TotalBlockReadRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_BLOCK_READ_REQUESTS},
+	{"TotalBlockWriteRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_BLOCK_WRITE_REQUESTS},
+	{"TotalMediaReads", FIS_MEMORY_INFO_PAGE_1_TOTAL_MEDIA_READS},
+	{"TotalMediaWrites", FIS_MEMORY_INFO_PAGE_1_TOTAL_MEDIA_WRITES},
+	{"TotalReadRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_READ_REQUESTS},
+	{"TotalWriteRequests", FIS_MEMORY_INFO_PAGE_1_TOTAL_WRITE_REQUESTS},
+	{"UnixTime", FIS_SYSTEM_TIME_UNIX_TIME},
+	{"UnsafeShutdownCount", FIS_SMART_HEALTH_INFO_UNSAFE_SHUTDOWN_COUNT},
+	{"UnsafeShutdownCounter", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS_UNSAFE_SHUTDOWN_COUNTER},
+	{"UnsafeShutdowns", FIS_SMART_HEALTH_INFO_UNSAFE_SHUTDOWNS},
+	{"Uptime", FIS_SMART_HEALTH_INFO_UPTIME},
+	{"ValidationFlags", FIS_SMART_HEALTH_INFO_VALIDATION_FLAGS},
+	{"VendorId", FIS_IDENTIFY_DIMM_VENDOR_ID},
+	{"ViralInterruptReceived", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_VIRAL_INTERRUPT_RECEIVED},
+	{"ViralPolicyEnabled", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_VIRAL_POLICY_ENABLED},
+	{"ViralStatus", FIS_OPTIONAL_CONFIGURATION_DATA_POLICY_VIRAL_STATUS},
+	{"VolatileCapacity", FIS_DIMM_PARTITION_INFO_VOLATILE_CAPACITY},
+	{"VolatileStart", FIS_DIMM_PARTITION_INFO_VOLATILE_START},
+	{"WatchDogStatus", FIS_BSR_REST1_WATCH_DOG_STATUS},
+	{"WriteDataFlushComplete", FIS_SMART_HEALTH_INFO_LAST_SHUTDOWN_STATUS_EXTENDED_DETAILS_WRITE_DATA_FLUSH_COMPLETE},
+	{"WriteRequests", FIS_MEMORY_INFO_PAGE_0_WRITE_REQUESTS},
+};
+
+#define IXP_PROP_NAME_INDEX_COUNT \
+	(sizeof (g_ixp_prop_name_index) / sizeof (g_ixp_prop_name_index[0]))
+
+static int compare_prop_name_index(const void *p_a, const void *p_b)
+{
+	return strcmp(((const struct ixp_prop_name_index_t *)p_a)->name,
+		((const struct ixp_prop_name_index_t *)p_b)->name);
+}
+
+// The name the index knows each key by, filled from the index on first use.
+// It, the index and the lookup entries are guarded by g_prop_name_lock.
+static const char *g_ixp_prop_key_names[IXP_PROP_KEY_MAX];
+static int g_ixp_prop_key_names_built = 0;
+
+// Refill the key names from the index: a key's plain name when that is unique,
+// otherwise its command-qualified name. Call with the write lock held.
+static void build_prop_key_names()
+{
+	memset(g_ixp_prop_key_names, 0, sizeof (g_ixp_prop_key_names));
+	for (size_t i = 0; i < IXP_PROP_NAME_INDEX_COUNT; i++)
+	{
+		IXP_PROP_KEY key = g_ixp_prop_name_index[i].key;
+		if (NULL == g_ixp_prop_key_names[key] ||
+			NULL == strchr(g_ixp_prop_name_index[i].name, '.'))
+		{
+			g_ixp_prop_key_names[key] = g_ixp_prop_name_index[i].name;
+		}
+	}
+	g_ixp_prop_key_names_built = 1;
+}
+
+// Take the read lock, once the key names are built
+static void read_lock_prop_names()
+{
+	PROP_NAME_READ_LOCK();
+	while (!g_ixp_prop_key_names_built)
+	{
+		PROP_NAME_READ_UNLOCK();
+		PROP_NAME_WRITE_LOCK();
+		if (!g_ixp_prop_key_names_built)
+		{
+			build_prop_key_names();
+		}
+		PROP_NAME_WRITE_UNLOCK();
+		PROP_NAME_READ_LOCK();
+	}
+}
+
+// Binary search of the index. Call with the lock held.
+static int find_prop_key(const char *name, unsigned int length, IXP_PROP_KEY *key)
+{
+	int low = 0;
+	int high = (int)IXP_PROP_NAME_INDEX_COUNT - 1;
+	while (low <= high)
+	{
+		int mid = low + (high - low) / 2;
+		const char *entry_name = g_ixp_prop_name_index[mid].name;
+		size_t entry_length = strlen(entry_name);
+		int cmp = memcmp(entry_name, name, entry_length < length ? entry_length : length);
+		if (cmp == 0 && entry_length != length)
+		{
+			cmp = entry_length < length ? -1 : 1;
+		}
+
+		if (cmp == 0)
+		{
+			*key = g_ixp_prop_name_index[mid].key;
+			return IXP_SUCCESS;
+		}
+		else if (cmp < 0)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+	return IXP_INVALID_PROP_KEY;
+}
+
 int ixp_init_prop(struct ixp_prop_info *prop, IXP_PROP_KEY prop_key)
 {
 	if (!prop)
@@ -262,6 +761,7 @@ int ixp_init_prop(struct ixp_prop_info *prop, IXP_PROP_KEY prop_key)
 	prop->prop_key = prop_key;
 	prop->prop_value = NULL;
 	prop->prop_value_size = 0;
+	prop->prop_value_is_view = 0;
 	//todo: pprop_info->prop_name
 	return IXP_SUCCESS;
 }
@@ -282,9 +782,32 @@ int ixp_get_prop_name(struct ixp_prop_info *prop, char **prop_name)
 	{
 		return IXP_NULL_INPUT_PARAM;
 	}
+	if (!PROP_KEY_VALID(prop->prop_key))
+	{
+		return IXP_INVALID_PROP_KEY;
+	}
 
-	*prop_name = prop->prop_name;
-	return IXP_SUCCESS;
+	// Plain names shared by several commands only resolve qualified
+	int status = IXP_SUCCESS;
+	read_lock_prop_names();
+	const char *p_index_name = g_ixp_prop_key_names[prop->prop_key];
+	size_t name_len = 0;
+	if (NULL == p_index_name)
+	{
+		status = IXP_INVALID_PROP_KEY;
+	}
+	else if ((name_len = strnlen(p_index_name, IXP_MAX_PROPERTY_NAME_SZ)) >=
+		IXP_MAX_PROPERTY_NAME_SZ)
+	{
+		status = IXP_INTERNAL_ERROR;
+	}
+	else
+	{
+		memcpy(prop->prop_name, p_index_name, name_len + 1);
+		*prop_name = prop->prop_name;
+	}
+	PROP_NAME_READ_UNLOCK();
+	return status;
 }
 
 int ixp_get_prop(struct ixp_context *ctx, struct ixp_prop_info *prop)
@@ -335,7 +858,7 @@ int ixp_get_props(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned
 		// If property value is uninitialized, call the associated function to populate it
 		// NOTE: The callee will populate all possible properties in props
 		if (IXP_SUCCESS != (status = (g_ixp_lookup[props[index].prop_key].f_populate)(
-			(unsigned int)ctx->handle.handle, props, num_props)))
+			(unsigned int)ctx->handle.handle, ctx->p_cmd_cache, props, num_props)))
 		{
 			// TODO: How should we deal with errors? Continue on? Free all and return?
 			ixp_free_props(props, num_props);
@@ -345,6 +868,26 @@ int ixp_get_props(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned
 	return IXP_SUCCESS;
 }
 
+int ixp_get_props_batched(struct ixp_context *ctx, struct ixp_prop_info *props, unsigned int num_props)
+{
+	if (!ctx || !props)
+	{
+		return IXP_NULL_INPUT_PARAM;
+	}
+
+	// Each populate call fills every requested property of its firmware command,
+	// so with the cache in place a command is issued once per context
+	if (NULL == ctx->p_cmd_cache)
+	{
+		ctx->p_cmd_cache = (struct ixp_cmd_cache *)calloc(1, sizeof (struct ixp_cmd_cache));
+		if (NULL == ctx->p_cmd_cache)
+		{
+			return IXP_NO_MEM_RESOURCES;
+		}
+	}
+	return ixp_get_props(ctx, props, num_props);
+}
+
 int ixp_free_props(struct ixp_prop_info *props, unsigned int num_props)
 {
 	if (!props)
@@ -368,23 +911,15 @@ int ixp_free_props(struct ixp_prop_info *props, unsigned int num_props)
 
 int ixp_get_prop_key_by_name(char * name, unsigned int length, IXP_PROP_KEY * key)
 {
-	// TODO: Can optimize by making large string of all props and running
-	//       strstr on it
-	// TODO: There are duplicate key user string names still. Need to make
-	//       them appropriately unique
-	// TODO: Currently only doing mem info page keys to avoid duplicating
-	//       properties already done by normal C++ show dimm flow
-	for (int i = FIS_MEMORY_INFO_PAGE_0_MEDIA_READS;
-		i < FIS_MEMORY_INFO_PAGE_3_SOFTWARE_TRIGGERS_COUNTER; i++)
+	if (!name || !key)
 	{
-		if (length == strlen(g_ixp_lookup[i].prop_name) &&
-		strncmp(g_ixp_lookup[i].prop_name, name, length) == 0)
-		{
-			*key = i;
-			return IXP_SUCCESS;
-		}
+		return IXP_NULL_INPUT_PARAM;
 	}
-	return IXP_INVALID_PROP_KEY;
+
+	PROP_NAME_READ_LOCK();
+	int status = find_prop_key(name, length, key);
+	PROP_NAME_READ_UNLOCK();
+	return status;
 }
 
 int ixp_get_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t * entry)
@@ -393,12 +928,54 @@ int ixp_get_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t * entry)
 	{
 		return IXP_INVALID_PROP_KEY;
 	}
+	PROP_NAME_READ_LOCK();
 	*entry = g_ixp_lookup[key];
+	PROP_NAME_READ_UNLOCK();
 	return IXP_SUCCESS;
 }
 
 int ixp_set_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t entry)
 {
+	if (!PROP_KEY_VALID(key))
+	{
+		return IXP_INVALID_PROP_KEY;
+	}
+	size_t name_len = strnlen(entry.prop_name, IXP_MAX_PROPERTY_NAME_SZ);
+	if (name_len >= IXP_MAX_PROPERTY_NAME_SZ)
+	{
+		return IXP_INTERNAL_ERROR;
+	}
+
+	// The new name must not already look up another property
+	PROP_NAME_WRITE_LOCK();
+	IXP_PROP_KEY existing_key;
+	if (IXP_SUCCESS == find_prop_key(entry.prop_name,
+		(unsigned int)name_len, &existing_key) && existing_key != key)
+	{
+		PROP_NAME_WRITE_UNLOCK();
+		return IXP_INVALID_PROP_KEY;
+	}
+
 	g_ixp_lookup[key] = entry;
+
+	// Move the key's plain index entry to the new name and re-sort. Keys whose
+	// plain name is shared have no plain entry and keep their qualified name.
+	int renamed = 0;
+	for (size_t i = 0; i < IXP_PROP_NAME_INDEX_COUNT; i++)
+	{
+		if (g_ixp_prop_name_index[i].key == key &&
+			NULL == strchr(g_ixp_prop_name_index[i].name, '.'))
+		{
+			g_ixp_prop_name_index[i].name = g_ixp_lookup[key].prop_name;
+			renamed = 1;
+		}
+	}
+	if (renamed)
+	{
+		qsort(g_ixp_prop_name_index, IXP_PROP_NAME_INDEX_COUNT,
+			sizeof (g_ixp_prop_name_index[0]), compare_prop_name_index);
+	}
+	build_prop_key_names();
+	PROP_NAME_WRITE_UNLOCK();
 	return IXP_SUCCESS;
 }
\ No newline at end of file
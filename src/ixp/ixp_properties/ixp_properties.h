@@ -42,14 +42,21 @@ extern "C"
 struct ixp_lookup_t
 {
 	// For the fis call associated with this ixp_prop_key, populate all
-	// relevant properties in props
-	int (* f_populate)(unsigned int handle, struct ixp_prop_info props[], unsigned int num_props);
+	// relevant properties in props, from p_cache when it is not NULL
+	int (* f_populate)(unsigned int handle, struct ixp_cmd_cache *p_cache,
+		struct ixp_prop_info props[], unsigned int num_props);
 	// For the fis call associated with this ixp_prop_key, free all
 	// relevant properties in props
 	void (* f_free)(struct ixp_prop_info props[], unsigned int num_props);
 	char prop_name[IXP_MAX_PROPERTY_NAME_SZ];
 };
 
+struct ixp_prop_name_index_t
+{
+	const char *name;
+	IXP_PROP_KEY key;
+};
+
 int ixp_set_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t entry);
 int ixp_get_g_ixp_lookup_entry(IXP_PROP_KEY key, struct ixp_lookup_t * entry);
 
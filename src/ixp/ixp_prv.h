@@ -30,18 +30,53 @@
 #define	SRC_IXP_PRV_H_
 #include <nvm_types.h>
 #include <ixp_types.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+#define	IXP_ARENA_BLOCK_SZ	4096
+
+// A block of the arena the firmware payloads of a command cache are kept in
+struct ixp_arena_block
+{
+	struct ixp_arena_block *p_next;
+	size_t size;
+	size_t used;
+	char *p_data;
+};
+
+struct fwcmd_result;
+
+// The payload of one firmware command, kept in the arena
+struct ixp_cmd_cache_entry
+{
+	struct ixp_cmd_cache_entry *p_next;
+	struct fwcmd_result (*fwcmd)(unsigned int);
+	char *p_payload;
+};
+
+// The firmware payloads issued through a context, keyed by the command since
+// several commands can share the same first property key
+struct ixp_cmd_cache
+{
+	struct ixp_cmd_cache_entry *p_entries;
+	struct ixp_arena_block *p_arena;
+};
+
 struct ixp_context
 {
 	NVM_NFIT_DEVICE_HANDLE handle;
 	void * user_data;
+	// NULL until the first batched read
+	struct ixp_cmd_cache *p_cmd_cache;
 };
 
+void *ixp_cmd_cache_alloc(struct ixp_cmd_cache *p_cache, size_t size);
+void ixp_free_cmd_cache(struct ixp_cmd_cache *p_cache);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,7 @@
 
 #include "nvm_management.h"
 #include <common_types.h>
+#include <checksum/checksum.h>
 #include <persistence/logging.h>
 #include <persistence/lib_persistence.h>
 #include "utility.h"
@@ -46,6 +47,7 @@
 #include "namespace_labels.h"
 #include "config_goal.h"
 #include "device_adapter.h"
+#include "nvm_context.h"
 
 #define	DEFAULT_PCD_TABLE_REVISION	2
 
@@ -709,7 +711,7 @@ int update_config_goal(const struct device_discovery *p_discovery,
 			if (rc == NVM_SUCCESS)
 			{
 				// Generate a checksum for our newly-generated input table
-				generate_checksum((NVM_UINT8*)p_input_table,
+				set_byte_sum8(p_input_table,
 						p_input_table->header.length,
 						CHECKSUM_OFFSET);
 			}
@@ -807,6 +809,9 @@ int nvm_create_config_goal(const NVM_UID device_uid,
 			rc = update_config_goal(&discovery, p_goal, &capabilities);
 			if (rc == NVM_SUCCESS)
 			{
+				// pool health shows the pending goal
+				invalidate_pool_data(POOL_DATA_GOALS);
+
 				// Log an event indicating we successfully applied the goal
 				NVM_EVENT_ARG uid_arg;
 				uid_to_event_arg(device_uid, uid_arg);
@@ -1170,6 +1175,8 @@ int nvm_delete_config_goal(const NVM_UID device_uid)
 			rc = update_config_goal(&discovery, NULL, NULL);
 			if (rc == NVM_SUCCESS)
 			{
+				invalidate_pool_data(POOL_DATA_GOALS);
+
 				// Log an event indicating we successfully removed the goal
 				NVM_EVENT_ARG uid_arg;
 				uid_to_event_arg(device_uid, uid_arg);
@@ -41,11 +41,13 @@
 #include <firmware_interface/fw_commands.h>
 #include "platform_config_data.h"
 #include "device_utilities.h"
+#include "device_executor.h"
 #include "config_goal.h"
 #include "capabilities.h"
 #include "nvm_context.h"
 #include "system.h"
 #include "nvm_types.h"
+#include "smbios_utilities.h"
 
 #define	NFIT_DIMM_STATE_IS_DISABLED(flag) ((flag >> 6) & 1)
 
@@ -290,6 +292,12 @@ int add_firmware_properties_to_device(struct device_discovery *p_device)
 	return rc;
 }
 
+static int add_firmware_properties_task(void *p_arg, const int index)
+{
+	struct device_discovery *p_devices = (struct device_discovery *)p_arg;
+	return add_firmware_properties_to_device(&(p_devices[index]));
+}
+
 int add_firmware_properties_to_populated_devices(struct device_discovery *p_devices,
 		const NVM_UINT8 dev_count)
 {
@@ -297,13 +305,23 @@ int add_firmware_properties_to_populated_devices(struct device_discovery *p_devi
 
 	int rc = NVM_SUCCESS;
 
-	for (NVM_UINT8 i = 0; i < dev_count; i++)
+	NVM_UINT32 *p_device_handles = calloc(dev_count + 1, sizeof (NVM_UINT32));
+	if (!p_device_handles)
 	{
-		rc = add_firmware_properties_to_device(&(p_devices[i]));
-		if (rc != NVM_SUCCESS)
+		COMMON_LOG_ERROR("No memory to collect device handles");
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		for (NVM_UINT8 i = 0; i < dev_count; i++)
 		{
-			break;
+			p_device_handles[i] = p_devices[i].device_handle.handle;
 		}
+
+		// identify and security state are independent per DIMM so fan them out
+		rc = run_device_tasks(p_device_handles, dev_count,
+				add_firmware_properties_task, p_devices);
+		free(p_device_handles);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -319,7 +337,8 @@ void add_smbios_properties_to_populated_devices(struct device_discovery *p_devic
 	{
 		struct nvm_details smbios_details;
 		memset(&smbios_details, 0, sizeof (smbios_details));
-		int rc = get_dimm_details(p_devices[i].device_handle, &smbios_details);
+		// the topology already gave the SMBIOS handle, look it up in the cached table
+		int rc = get_dimm_details_for_physical_id(p_devices[i].physical_id, &smbios_details);
 		if (rc == NVM_SUCCESS)
 		{
 			p_devices[i].capacity = smbios_details.size;
@@ -687,7 +706,7 @@ int get_fw_die_spare_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 	fw_cmd.sub_opcode = SUBOP_POLICY_DIE_SPARING;
 	fw_cmd.output_payload_size = sizeof (*payload);
 	fw_cmd.output_payload = payload;
-	rc = ioctl_passthrough_cmd(&fw_cmd);
+	rc = cached_ioctl_passthrough_cmd(&fw_cmd, FW_RESULT_LIFETIME_SETTING);
 	return rc;
 }
 
@@ -748,197 +767,162 @@ int fill_device_config_status(const NVM_NFIT_DEVICE_HANDLE device_handle,
  *  Helper function to set health,last_shutdown_status, last_shutdown_time and
  *  ait_dram_enabled in device_status struct
  */
-int fill_device_status_from_smart_health(unsigned int device_handle,
+void fill_device_status_from_smart_health(const struct pt_payload_smart_health *p_dimm_smart,
 		struct device_status *p_status)
 {
-	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
-
-	struct pt_payload_smart_health dimm_smart;
-	rc = fw_get_smart_health(device_handle, &dimm_smart);
-	if (rc != NVM_SUCCESS)
+	if (p_dimm_smart->validation_flags.parts.health_status_field)
 	{
-		COMMON_LOG_ERROR_F("Failed to retrieve the DIMM smart data with error %d", rc);
+		p_status->health = smart_health_status_to_device_health(p_dimm_smart->health_status);
 	}
 	else
 	{
-			if (dimm_smart.validation_flags.parts.health_status_field)
-		{
-			p_status->health = smart_health_status_to_device_health(dimm_smart.health_status);
-		}
-		else
-		{
-			p_status->health = DEVICE_HEALTH_UNKNOWN;
-		}
-
-		if (dimm_smart.validation_flags.parts.sizeof_vendor_data_field)
-		{
-			p_status->last_shutdown_status = dimm_smart.vendor_data.lss_details;
-			memcpy(p_status->last_shutdown_status_extended, &dimm_smart.vendor_data.lss_extended_details, sizeof(dimm_smart.vendor_data.lss_extended_details));
-			p_status->last_shutdown_time = dimm_smart.vendor_data.last_shutdown_time;
-		}
-
-		if (dimm_smart.validation_flags.parts.ait_dram_status_field)
-		{
-			p_status->ait_dram_enabled = dimm_smart.ait_dram_status;
-		}
+		p_status->health = DEVICE_HEALTH_UNKNOWN;
+	}
 
-		p_status->injected_media_errors = dimm_smart.vendor_data.injected_media_errors;
-		p_status->injected_non_media_errors = dimm_smart.vendor_data.injected_non_media_errors;
+	if (p_dimm_smart->validation_flags.parts.sizeof_vendor_data_field)
+	{
+		p_status->last_shutdown_status = p_dimm_smart->vendor_data.lss_details;
+		memcpy(p_status->last_shutdown_status_extended,
+				&p_dimm_smart->vendor_data.lss_extended_details,
+				sizeof (p_dimm_smart->vendor_data.lss_extended_details));
+		p_status->last_shutdown_time = p_dimm_smart->vendor_data.last_shutdown_time;
+	}
 
+	if (p_dimm_smart->validation_flags.parts.ait_dram_status_field)
+	{
+		p_status->ait_dram_enabled = p_dimm_smart->ait_dram_status;
 	}
 
-	COMMON_LOG_EXIT_RETURN_I(rc);
-	return rc;
+	p_status->injected_media_errors = p_dimm_smart->vendor_data.injected_media_errors;
+	p_status->injected_non_media_errors = p_dimm_smart->vendor_data.injected_non_media_errors;
 }
 
-
 /*
- * Helper function to read fw error info for a single type and level
+ * Helper function to set the fw error info for a single type and level
  */
-int update_status_fw_error_log_info_by_type_and_level(const NVM_NFIT_DEVICE_HANDLE device_handle,
-		unsigned char log_type, unsigned char log_level, struct device_status *p_status)
+void update_status_fw_error_log_info(const unsigned char log_type,
+		const unsigned char log_level,
+		const struct pt_payload_fw_log_info_data *p_log_info_data,
+		struct device_status *p_status)
 {
-	int rc = NVM_SUCCESS;
-	struct pt_payload_fw_log_info_data p_log_info_data;
-	memset(&p_log_info_data, 0, sizeof (p_log_info_data));
-	KEEP_ERROR(rc, fw_get_fw_error_log_info_data(
-		device_handle.handle, log_level, log_type, &p_log_info_data));
 	p_status->new_error_count +=
-			(p_log_info_data.current_sequence_number - p_log_info_data.oldest_sequence_number);
-	if (p_log_info_data.newest_log_entry_timestamp > p_status->newest_error_log_timestamp)
+			(p_log_info_data->current_sequence_number - p_log_info_data->oldest_sequence_number);
+	if (p_log_info_data->newest_log_entry_timestamp > p_status->newest_error_log_timestamp)
 	{
-		p_status->newest_error_log_timestamp = p_log_info_data.newest_log_entry_timestamp;
+		p_status->newest_error_log_timestamp = p_log_info_data->newest_log_entry_timestamp;
 	}
 
 	if ((DEV_FW_ERR_LOG_MEDIA == log_type) && (DEV_FW_ERR_LOG_LOW == log_level))
 	{
-		p_status->media_low.oldest = p_log_info_data.oldest_sequence_number;
-		p_status->media_low.current = p_log_info_data.current_sequence_number;
+		p_status->media_low.oldest = p_log_info_data->oldest_sequence_number;
+		p_status->media_low.current = p_log_info_data->current_sequence_number;
 	}
 	else if ((DEV_FW_ERR_LOG_MEDIA == log_type) && (DEV_FW_ERR_LOG_HIGH == log_level))
 	{
-		p_status->media_high.oldest = p_log_info_data.oldest_sequence_number;
-		p_status->media_high.current = p_log_info_data.current_sequence_number;
+		p_status->media_high.oldest = p_log_info_data->oldest_sequence_number;
+		p_status->media_high.current = p_log_info_data->current_sequence_number;
 	}
 	else if ((DEV_FW_ERR_LOG_THERMAL == log_type) && (DEV_FW_ERR_LOG_LOW == log_level))
 	{
-		p_status->therm_low.oldest = p_log_info_data.oldest_sequence_number;
-		p_status->therm_low.current = p_log_info_data.current_sequence_number;
+		p_status->therm_low.oldest = p_log_info_data->oldest_sequence_number;
+		p_status->therm_low.current = p_log_info_data->current_sequence_number;
 	}
 	else if ((DEV_FW_ERR_LOG_THERMAL == log_type) && (DEV_FW_ERR_LOG_HIGH == log_level))
 	{
-		p_status->therm_high.oldest = p_log_info_data.oldest_sequence_number;
-		p_status->therm_high.current = p_log_info_data.current_sequence_number;
+		p_status->therm_high.oldest = p_log_info_data->oldest_sequence_number;
+		p_status->therm_high.current = p_log_info_data->current_sequence_number;
 	}
-
-	return rc;
 }
 
 /*
- * Helper function to set fw error info in device_status struct
+ * The FW commands that are sent on every device status read, in one batch per DIMM
  */
-int fill_fw_error_log_status(const NVM_NFIT_DEVICE_HANDLE device_handle,
-		struct device_status *p_status)
+enum device_status_cmd
 {
-	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
-
-	p_status->new_error_count = 0;
-	p_status->newest_error_log_timestamp = 0;
-
-	KEEP_ERROR(rc, update_status_fw_error_log_info_by_type_and_level(device_handle,
-		DEV_FW_ERR_LOG_MEDIA, DEV_FW_ERR_LOG_LOW, p_status));
-	KEEP_ERROR(rc, update_status_fw_error_log_info_by_type_and_level(device_handle,
-		DEV_FW_ERR_LOG_MEDIA, DEV_FW_ERR_LOG_HIGH, p_status));
-	KEEP_ERROR(rc, update_status_fw_error_log_info_by_type_and_level(device_handle,
-		DEV_FW_ERR_LOG_THERMAL, DEV_FW_ERR_LOG_LOW, p_status));
-	KEEP_ERROR(rc, update_status_fw_error_log_info_by_type_and_level(device_handle,
-		DEV_FW_ERR_LOG_THERMAL, DEV_FW_ERR_LOG_HIGH, p_status));
-
-	COMMON_LOG_EXIT_RETURN_I(rc);
-	return rc;
+	STATUS_CMD_LONG_OP = 0,
+	STATUS_CMD_SMART_HEALTH,
+	STATUS_CMD_BSR,
+	STATUS_CMD_ERROR_LOG_INFO, // one per error log type and level
+	STATUS_CMD_COUNT = STATUS_CMD_ERROR_LOG_INFO + 4
+};
+
+static const unsigned char status_error_log_types[] = {
+	DEV_FW_ERR_LOG_MEDIA, DEV_FW_ERR_LOG_MEDIA,
+	DEV_FW_ERR_LOG_THERMAL, DEV_FW_ERR_LOG_THERMAL
+};
+static const unsigned char status_error_log_levels[] = {
+	DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_HIGH,
+	DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_HIGH
+};
+
+struct device_status_fw_data
+{
+	struct fw_cmd cmds[STATUS_CMD_COUNT];
+	int results[STATUS_CMD_COUNT];
+	struct pt_payload_long_op_stat long_op;
+	struct pt_payload_smart_health smart;
+	unsigned long long bsr;
+	struct pt_input_payload_fw_error_log log_input[4];
+	struct pt_payload_fw_log_info_data log_info[4];
+};
+
+static void init_status_fw_cmd(struct fw_cmd *p_cmd, const NVM_UINT32 device_handle,
+		const unsigned char opcode, const unsigned char sub_opcode,
+		void *p_input, const unsigned int input_size, void *p_output, const unsigned int output_size)
+{
+	p_cmd->device_handle = device_handle;
+	p_cmd->opcode = opcode;
+	p_cmd->sub_opcode = sub_opcode;
+	p_cmd->input_payload_size = input_size;
+	p_cmd->input_payload = p_input;
+	p_cmd->output_payload_size = output_size;
+	p_cmd->output_payload = p_output;
 }
 
 /*
- * Helper to get the device sku violation status
+ * Read the FW data for a device status that can't be cached, in one batch
  */
-int get_sku_violation_state_for_device(NVM_NFIT_DEVICE_HANDLE dimm_handle,
-		NVM_BOOL *p_sku_violation)
+static void read_device_status_fw_data(const NVM_UINT32 device_handle,
+		struct device_status_fw_data *p_data)
 {
-	COMMON_LOG_ENTRY();
-
-	int rc = NVM_SUCCESS;
-
-	rc = nvm_get_device_count();
-
-	if (rc > 0)
-	{
-		int dev_count = rc;
-		struct device_discovery *devices =  malloc(dev_count * sizeof(struct device_discovery));
-        if (NULL == devices)
-        {
-            rc = NVM_ERR_NOMEMORY;
-        }
-        else
-        {
-            rc = nvm_get_devices(devices, dev_count);
-            if (rc == dev_count)
-            {
-                rc = NVM_SUCCESS;
-
-                for (int dimmIdx = 0; dimmIdx < dev_count; dimmIdx++)
-                {
-                    if (devices[dimmIdx].device_handle.handle == dimm_handle.handle)
-                    {
-                        KEEP_ERROR(rc, device_in_sku_violation(&devices[dimmIdx],
-                            p_sku_violation));
-                    }
-                }
-            }
-            else
-            {
-                COMMON_LOG_ERROR_F(
-                    "Failed to get the correct number of devices with error %d", rc);
-            }
-
-            free(devices);
-        }
-	}
-	else
-	{
-		COMMON_LOG_ERROR_F(
-			"Failed to get the correct number of devices with error %d", rc);
-	}
-	return rc;
-}
-
-NVM_BOOL is_fw_version_greater_than_1_3(NVM_NFIT_DEVICE_HANDLE dimm_handle)
-{
-	COMMON_LOG_ENTRY();
-
-	NVM_BOOL result = 0;
-	struct device_discovery discovery;
-
-	if ((lookup_dev_handle(dimm_handle, &discovery) == NVM_SUCCESS) &&
-			atof(discovery.fw_api_version) > 1.3)
-	{
-		result = 1;
-	}
-	return result;
+	memset(p_data, 0, sizeof (*p_data));
+	init_status_fw_cmd(&p_data->cmds[STATUS_CMD_LONG_OP], device_handle,
+			PT_GET_LOG, SUBOP_LONG_OPERATION_STATUS, NULL, 0,
+			&p_data->long_op, sizeof (p_data->long_op));
+	init_status_fw_cmd(&p_data->cmds[STATUS_CMD_SMART_HEALTH], device_handle,
+			PT_GET_LOG, SUBOP_SMART_HEALTH, NULL, 0,
+			&p_data->smart, sizeof (p_data->smart));
+	init_status_fw_cmd(&p_data->cmds[STATUS_CMD_BSR], device_handle,
+			BIOS_EMULATED_COMMAND, SUBOP_GET_BOOT_STATUS, NULL, 0,
+			&p_data->bsr, sizeof (p_data->bsr));
+	for (int i = 0; i < 4; i++)
+	{
+		p_data->log_input[i].params = status_error_log_levels[i] | status_error_log_types[i]
+			| DEV_FW_ERR_LOG_RETRIEVE_INFO_DATA | DEV_FW_ERR_LOG_SMALL_PAYLOAD;
+		init_status_fw_cmd(&p_data->cmds[STATUS_CMD_ERROR_LOG_INFO + i], device_handle,
+				PT_GET_LOG, SUBOP_ERROR_LOG,
+				&p_data->log_input[i], sizeof (p_data->log_input[i]),
+				&p_data->log_info[i], sizeof (p_data->log_info[i]));
+	}
+
+	ioctl_passthrough_cmds(p_data->cmds, STATUS_CMD_COUNT, p_data->results);
 }
 
 /*
- * Retrieve the status of the device specified
+ * Retrieve the status of a device whose discovery information is already known
  */
-void get_device_status_by_handle(NVM_NFIT_DEVICE_HANDLE dimm_handle,
-		struct device_status *p_status, struct nvm_capabilities *p_capabilities)
+void fill_device_status(struct device_discovery *p_discovery,
+		const struct nvm_capabilities *p_capabilities, struct device_status *p_status)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
+	NVM_NFIT_DEVICE_HANDLE dimm_handle = p_discovery->device_handle;
 
 	memset(p_status, 0, sizeof (*p_status));
 
+	struct device_status_fw_data fw_data;
+	read_device_status_fw_data(dimm_handle.handle, &fw_data);
+
 	// TODO: implement these
 	p_status->is_missing = 0;
 
@@ -958,7 +942,7 @@ void get_device_status_by_handle(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 	else
 	{
 		// ensures backward compatibility with FIS 1.3
-		if (is_fw_version_greater_than_1_3(dimm_handle))
+		if (atof(p_discovery->fw_api_version) > 1.3)
 		{
 			p_status->die_spares_available = spare_payload.supported;
 		}
@@ -973,16 +957,20 @@ void get_device_status_by_handle(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 	}
 
 	// get ARS and sanitize status
-	if ((rc = get_long_status(dimm_handle, &p_status->ars_status, &p_status->sanitize_status))
-			!= NVM_SUCCESS)
+	if ((rc = translate_long_status(fw_data.results[STATUS_CMD_LONG_OP], &fw_data.long_op,
+			&p_status->ars_status, &p_status->sanitize_status)) != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Failed to get the DIMM ARS and sanitize status, rc=%d", rc);
 	}
 
-	if ((rc = fill_device_status_from_smart_health(dimm_handle.handle, p_status)) != NVM_SUCCESS)
+	if ((rc = fw_data.results[STATUS_CMD_SMART_HEALTH]) != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Failed to get the DIMM SMART health status, rc=%d", rc);
 	}
+	else
+	{
+		fill_device_status_from_smart_health(&fw_data.smart, p_status);
+	}
 
 	// fill the last config status and is new flag
 	if ((rc = fill_device_config_status(dimm_handle, p_capabilities, p_status)) != NVM_SUCCESS)
@@ -993,7 +981,7 @@ void get_device_status_by_handle(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 	// System-level mixed SKU
 	p_status->mixed_sku = p_capabilities->sku_capabilities.mixed_sku;
 
-	if ((rc = get_sku_violation_state_for_device(dimm_handle, &p_status->sku_violation))
+	if ((rc = device_in_sku_violation(p_discovery, &p_status->sku_violation))
 			!= NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Failed to get the DIMM SKU violation state, rc=%d", rc);
@@ -1010,17 +998,83 @@ void get_device_status_by_handle(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 		p_status->viral_state = config_data.viral_status;
 	}
 
-	if ((rc = fill_fw_error_log_status(dimm_handle, p_status)) != NVM_SUCCESS)
+	rc = NVM_SUCCESS;
+	for (int i = 0; i < 4; i++)
+	{
+		KEEP_ERROR(rc, fw_data.results[STATUS_CMD_ERROR_LOG_INFO + i]);
+		update_status_fw_error_log_info(status_error_log_types[i], status_error_log_levels[i],
+				&fw_data.log_info[i], p_status);
+	}
+	if (rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Failed to retrieve DIMM FW error log status, error %d",
 				rc);
 	}
 
-	if ((rc = fw_get_bsr(dimm_handle, &(p_status->boot_status))) != NVM_SUCCESS)
+	if ((rc = fw_data.results[STATUS_CMD_BSR]) != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Failed to retrieve DIMM BSR with error %d",
 				rc);
 	}
+	else
+	{
+		p_status->boot_status = fw_data.bsr;
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Arguments shared by the per-DIMM status tasks
+ */
+struct device_status_task_arg
+{
+	struct device_discovery *p_devices;
+	const struct nvm_capabilities *p_capabilities;
+	struct device_status *p_statuses;
+};
+
+static int fill_device_status_task(void *p_arg, const int index)
+{
+	struct device_status_task_arg *p_task_arg = (struct device_status_task_arg *)p_arg;
+	fill_device_status(&p_task_arg->p_devices[index], p_task_arg->p_capabilities,
+			&p_task_arg->p_statuses[index]);
+	return NVM_SUCCESS;
+}
+
+/*
+ * Retrieve the status of each of the devices specified, one worker per DIMM.
+ * Failures to read individual fields are logged and leave the field unknown,
+ * the same as for a single device.
+ */
+int get_device_statuses(struct device_discovery *p_devices, const int count,
+		const struct nvm_capabilities *p_capabilities, struct device_status *p_statuses)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	NVM_UINT32 *p_device_handles = calloc(count + 1, sizeof (NVM_UINT32));
+	if (!p_device_handles)
+	{
+		COMMON_LOG_ERROR("No memory to collect device statuses");
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+		{
+			p_device_handles[i] = p_devices[i].device_handle.handle;
+		}
+
+		struct device_status_task_arg task_arg;
+		task_arg.p_devices = p_devices;
+		task_arg.p_capabilities = p_capabilities;
+		task_arg.p_statuses = p_statuses;
+		rc = run_device_tasks(p_device_handles, count, fill_device_status_task, &task_arg);
+		free(p_device_handles);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
 }
 
 /*
@@ -1063,7 +1117,88 @@ int nvm_get_device_status(const NVM_UID device_uid,
 	}
 	else if ((rc = exists_and_manageable(device_uid, &discovery, 1)) == NVM_SUCCESS)
 	{
-		get_device_status_by_handle(discovery.device_handle, p_status, &capabilities);
+		fill_device_status(&discovery, &capabilities, p_status);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Retrieve the status of every manageable device in one call
+ */
+int nvm_get_all_device_statuses(struct device_status_entry *p_statuses, const NVM_UINT8 count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	struct nvm_capabilities capabilities;
+
+	if (check_caller_permissions() != NVM_SUCCESS)
+	{
+		rc = NVM_ERR_INVALIDPERMISSIONS;
+	}
+	else if (!is_supported_driver_available())
+	{
+		rc = NVM_ERR_BADDRIVER;
+	}
+	else if (p_statuses == NULL)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, p_statuses is NULL");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if ((rc = nvm_get_nvm_capabilities(&capabilities)) != NVM_SUCCESS)
+	{
+		COMMON_LOG_ERROR("Failed to retrieve the system capabilities.");
+	}
+	else if (!capabilities.nvm_features.get_device_health) // also confirms pass through
+	{
+		COMMON_LOG_ERROR("Retrieving device status is not supported.");
+		rc = NVM_ERR_NOTSUPPORTED;
+	}
+	else if ((rc = nvm_get_device_count()) > 0)
+	{
+		int dev_count = rc;
+		struct device_discovery *p_devices = calloc(dev_count, sizeof (struct device_discovery));
+		struct device_status *p_device_statuses =
+				calloc(dev_count, sizeof (struct device_status));
+		if (!p_devices || !p_device_statuses)
+		{
+			COMMON_LOG_ERROR("No memory to collect device statuses");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else if ((rc = nvm_get_devices(p_devices, dev_count)) > 0)
+		{
+			// only manageable devices report status
+			int manageable_count = 0;
+			for (int i = 0; i < rc; i++)
+			{
+				if (IS_DEVICE_MANAGEABLE(&p_devices[i]))
+				{
+					memmove(&p_devices[manageable_count++], &p_devices[i],
+							sizeof (struct device_discovery));
+				}
+			}
+
+			if (manageable_count > count)
+			{
+				COMMON_LOG_ERROR("Invalid parameter, count is smaller than the number of devices");
+				rc = NVM_ERR_ARRAYTOOSMALL;
+			}
+			else if ((rc = get_device_statuses(p_devices, manageable_count,
+					&capabilities, p_device_statuses)) == NVM_SUCCESS)
+			{
+				memset(p_statuses, 0, sizeof (struct device_status_entry) * count);
+				for (int i = 0; i < manageable_count; i++)
+				{
+					uid_copy(p_devices[i].uid, p_statuses[i].uid);
+					memmove(&p_statuses[i].status, &p_device_statuses[i],
+							sizeof (struct device_status));
+				}
+				rc = manageable_count;
+			}
+		}
+		free(p_devices);
+		free(p_device_statuses);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -1079,7 +1214,7 @@ int get_details(const NVM_UID device_uid,
 
 	struct nvm_details dimm_details;
 	if (NVM_SUCCESS
-			== (rc = get_dimm_details(p_discovery->device_handle, &dimm_details)))
+			== (rc = get_dimm_details_for_physical_id(p_discovery->physical_id, &dimm_details)))
 	{
 		p_details->form_factor =
 				get_device_form_factor_from_smbios_form_factor(dimm_details.form_factor);
@@ -1108,7 +1243,7 @@ int get_fw_power_mgmt_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
 	fw_cmd.sub_opcode = SUBOP_POLICY_POW_MGMT;
 	fw_cmd.output_payload_size = sizeof (*payload);
 	fw_cmd.output_payload = payload;
-	rc = ioctl_passthrough_cmd(&fw_cmd);
+	rc = cached_ioctl_passthrough_cmd(&fw_cmd, FW_RESULT_LIFETIME_SETTING);
 	return rc;
 }
 
@@ -268,6 +268,18 @@ NVM_API int get_driver_capabilities(struct nvm_driver_capabilities *p_capabiliti
  */
 NVM_API int ioctl_passthrough_cmd(struct fw_cmd *p_cmd);
 
+/*
+ * Execute a batch of passthrough IOCTLs for a single DIMM back to back
+ * @param[in,out] p_cmds
+ * 		The commands, all for the same device handle
+ * @param[in] count
+ * 		The number of commands
+ * @param[out] p_results
+ * 		The return code of each command
+ * @return NVM_SUCCESS if the DIMM was found, otherwise the error that every command failed with
+ */
+NVM_API int ioctl_passthrough_cmds(struct fw_cmd *p_cmds, const int count, int *p_results);
+
 NVM_API int get_job_count();
 
 /*
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file contains the implementation of the device task executor.
+ */
+
+#include "device_executor.h"
+#include <os/os_adapter.h>
+#include <persistence/logging.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __WINDOWS__
+#include <Windows.h>
+static SRWLOCK g_pool_lock = SRWLOCK_INIT;
+static CONDITION_VARIABLE g_work_ready = CONDITION_VARIABLE_INIT;
+static CONDITION_VARIABLE g_work_done = CONDITION_VARIABLE_INIT;
+#define	POOL_LOCK()	AcquireSRWLockExclusive(&g_pool_lock)
+#define	POOL_UNLOCK()	ReleaseSRWLockExclusive(&g_pool_lock)
+#define	POOL_WAIT(cond)	SleepConditionVariableSRW(&(cond), &g_pool_lock, INFINITE, 0)
+#define	POOL_WAKE_ALL(cond)	WakeAllConditionVariable(&(cond))
+#else
+#include <pthread.h>
+static pthread_mutex_t g_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_work_ready = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_work_done = PTHREAD_COND_INITIALIZER;
+#define	POOL_LOCK()	pthread_mutex_lock(&g_pool_lock)
+#define	POOL_UNLOCK()	pthread_mutex_unlock(&g_pool_lock)
+#define	POOL_WAIT(cond)	pthread_cond_wait(&(cond), &g_pool_lock)
+#define	POOL_WAKE_ALL(cond)	pthread_cond_broadcast(&(cond))
+#endif
+
+/*
+ * One call to run_device_tasks, queued until all of its groups are claimed
+ */
+struct executor_state
+{
+	device_task task;
+	void *p_arg;
+	int group_count;
+	int next_group;
+	int done_groups;
+	int *p_group_heads; // first index of each group of identical handles
+	int *p_next_in_group; // next index with the same handle or -1
+	int *p_results;
+	struct executor_state *p_next; // next queued call
+};
+
+// everything below is guarded by g_pool_lock
+static struct executor_state *g_p_queue = NULL;
+static int g_worker_count = 0;
+static NVM_BOOL g_stopping = 0;
+
+/*
+ * Claim the next group of a call, removing the call from the queue once
+ * every group is claimed
+ * NOTE: This function assumes the caller has obtained the pool lock
+ */
+static int claim_group(struct executor_state *p_state)
+{
+	int group = p_state->next_group++;
+	if (p_state->next_group == p_state->group_count)
+	{
+		struct executor_state **pp_state = &g_p_queue;
+		while (*pp_state && *pp_state != p_state)
+		{
+			pp_state = &(*pp_state)->p_next;
+		}
+		if (*pp_state)
+		{
+			*pp_state = p_state->p_next;
+		}
+	}
+	return group;
+}
+
+/*
+ * Run every index of a claimed group without the pool lock
+ * NOTE: This function assumes the caller has obtained the pool lock
+ */
+static void run_group(struct executor_state *p_state, const int group)
+{
+	POOL_UNLOCK();
+	for (int i = p_state->p_group_heads[group]; i >= 0; i = p_state->p_next_in_group[i])
+	{
+		p_state->p_results[i] = p_state->task(p_state->p_arg, i);
+	}
+	POOL_LOCK();
+	if (++p_state->done_groups == p_state->group_count)
+	{
+		POOL_WAKE_ALL(g_work_done);
+	}
+}
+
+static void *executor_worker(void *p_worker_arg)
+{
+	POOL_LOCK();
+	while (!g_stopping)
+	{
+		if (g_p_queue)
+		{
+			struct executor_state *p_state = g_p_queue;
+			run_group(p_state, claim_group(p_state));
+		}
+		else
+		{
+			POOL_WAIT(g_work_ready);
+		}
+	}
+	g_worker_count--;
+	POOL_WAKE_ALL(g_work_done);
+	POOL_UNLOCK();
+	return NULL;
+}
+
+/*
+ * Start workers until there are enough to help with a call of group_count groups
+ * NOTE: This function assumes the caller has obtained the pool lock
+ */
+static void start_workers(const int group_count)
+{
+	// the calling thread is one of the workers
+	int needed = group_count - 1;
+	if (needed > DEVICE_EXECUTOR_MAX_WORKERS - 1)
+	{
+		needed = DEVICE_EXECUTOR_MAX_WORKERS - 1;
+	}
+	while (g_worker_count < needed)
+	{
+		COMMON_UINT64 thread_id = 0;
+		create_thread(&thread_id, executor_worker, NULL);
+		if (!thread_id)
+		{
+			// the calling thread still runs every group itself
+			COMMON_LOG_WARN("Failed to start a device executor worker");
+			break;
+		}
+		detach_thread(thread_id);
+		g_worker_count++;
+	}
+}
+
+struct handle_index
+{
+	NVM_UINT32 handle;
+	int index;
+};
+
+static int compare_handle_index(const void *p_a, const void *p_b)
+{
+	const struct handle_index *p_left = (const struct handle_index *)p_a;
+	const struct handle_index *p_right = (const struct handle_index *)p_b;
+	int rc = 0;
+	if (p_left->handle != p_right->handle)
+	{
+		rc = (p_left->handle < p_right->handle) ? -1 : 1;
+	}
+	else
+	{
+		rc = p_left->index - p_right->index;
+	}
+	return rc;
+}
+
+/*
+ * Chain together indices sharing a device handle, in index order within each group
+ */
+static int group_device_handles(struct executor_state *p_state,
+		const NVM_UINT32 *p_device_handles, const int count)
+{
+	int rc = NVM_SUCCESS;
+	struct handle_index *p_sorted = calloc(count, sizeof (struct handle_index));
+	if (!p_sorted)
+	{
+		rc = NVM_ERR_NOMEMORY;
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+		{
+			p_sorted[i].handle = p_device_handles[i];
+			p_sorted[i].index = i;
+		}
+		qsort(p_sorted, count, sizeof (struct handle_index), compare_handle_index);
+
+		p_state->group_count = 0;
+		for (int i = 0; i < count; i++)
+		{
+			p_state->p_next_in_group[p_sorted[i].index] = -1;
+			if (i == 0 || p_sorted[i].handle != p_sorted[i - 1].handle)
+			{
+				p_state->p_group_heads[p_state->group_count++] = p_sorted[i].index;
+			}
+			else
+			{
+				p_state->p_next_in_group[p_sorted[i - 1].index] = p_sorted[i].index;
+			}
+		}
+		free(p_sorted);
+	}
+	return rc;
+}
+
+int run_device_tasks(const NVM_UINT32 *p_device_handles, const int count,
+		device_task task, void *p_arg)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	struct executor_state state;
+	memset(&state, 0, sizeof (state));
+
+	if (p_device_handles == NULL || task == NULL || count < 0)
+	{
+		COMMON_LOG_ERROR("Invalid parameter");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (count > 0)
+	{
+		state.task = task;
+		state.p_arg = p_arg;
+		state.p_group_heads = calloc(count, sizeof (int));
+		state.p_next_in_group = calloc(count, sizeof (int));
+		state.p_results = calloc(count, sizeof (int));
+		if (!state.p_group_heads || !state.p_next_in_group || !state.p_results)
+		{
+			COMMON_LOG_ERROR("Failed to allocate memory for the device executor");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else if ((rc = group_device_handles(&state, p_device_handles, count)) != NVM_SUCCESS)
+		{
+			COMMON_LOG_ERROR("Failed to allocate memory for the device executor");
+		}
+		else
+		{
+			POOL_LOCK();
+			if (state.group_count > 1 && !g_stopping)
+			{
+				start_workers(state.group_count);
+				state.p_next = g_p_queue;
+				g_p_queue = &state;
+				POOL_WAKE_ALL(g_work_ready);
+			}
+
+			// run this call's own groups so a task that fans out again can't wait on
+			// workers that are all busy with its parent
+			while (state.next_group < state.group_count)
+			{
+				run_group(&state, claim_group(&state));
+			}
+			while (state.done_groups < state.group_count)
+			{
+				POOL_WAIT(g_work_done);
+			}
+			POOL_UNLOCK();
+
+			for (int i = 0; i < count; i++)
+			{
+				if (state.p_results[i] != NVM_SUCCESS)
+				{
+					rc = state.p_results[i];
+					break;
+				}
+			}
+		}
+		free(state.p_group_heads);
+		free(state.p_next_in_group);
+		free(state.p_results);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+void stop_device_executor()
+{
+	COMMON_LOG_ENTRY();
+	POOL_LOCK();
+	g_stopping = 1;
+	POOL_WAKE_ALL(g_work_ready);
+	while (g_worker_count > 0)
+	{
+		POOL_WAIT(g_work_done);
+	}
+	POOL_UNLOCK();
+	COMMON_LOG_EXIT();
+}
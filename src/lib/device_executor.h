@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * This file declares a bounded worker pool for running firmware commands against
+ * many NVM-DIMMs concurrently.
+ */
+
+#ifndef	DEVICE_EXECUTOR_H_
+#define	DEVICE_EXECUTOR_H_
+
+#include "nvm_types.h"
+#include "export_api.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Upper bound on the number of threads used to run device tasks
+ */
+#define	DEVICE_EXECUTOR_MAX_WORKERS	8
+
+/*
+ * A unit of per-DIMM work. The index identifies the entry in the caller's
+ * device array to operate on. Returns an NVM return code.
+ */
+typedef int (*device_task)(void *p_arg, const int index);
+
+/*
+ * Run the task once for each of the device handles on a pool of up to
+ * DEVICE_EXECUTOR_MAX_WORKERS threads. The calling thread participates as a worker,
+ * the others are started when first needed and kept for later calls so their
+ * per-thread state (such as the ndctl session) is reused.
+ * All indices that share a device handle run one after another on the same worker
+ * so a DIMM never has more than one firmware command outstanding from this call.
+ * Every index is run even if an earlier one fails.
+ * Returns NVM_SUCCESS or the error from the lowest failing index.
+ */
+NVM_API int run_device_tasks(const NVM_UINT32 *p_device_handles, const int count,
+		device_task task, void *p_arg);
+
+/*
+ * Stop the pool's worker threads, waiting for them to exit.
+ * Called when the library is unloaded, no tasks may be running.
+ */
+NVM_API void stop_device_executor();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEVICE_EXECUTOR_H_ */
@@ -104,6 +104,38 @@ NVM_BOOL is_fw_api_version_downgraded(const unsigned int current_major_version,
 	return is_downgraded;
 }
 
+/*
+ * Serve the output of a read-only command from the context cache while it is fresh,
+ * otherwise send it to the FW and cache the result
+ */
+int cached_ioctl_passthrough_cmd(struct fw_cmd *p_cmd,
+		const enum fw_result_lifetime lifetime)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	// only the opcode identifies the result, commands with input can't be cached
+	NVM_BOOL cacheable = !p_cmd->input_payload_size && !p_cmd->large_input_payload_size &&
+			!p_cmd->large_output_payload_size;
+	NVM_UINT32 generation = 0;
+	if (!cacheable ||
+			get_nvm_context_fw_result(p_cmd->device_handle, p_cmd->opcode,
+				p_cmd->sub_opcode, p_cmd->output_payload,
+				p_cmd->output_payload_size, &generation) != NVM_SUCCESS)
+	{
+		rc = ioctl_passthrough_cmd(p_cmd);
+		if (rc == NVM_SUCCESS && cacheable)
+		{
+			set_nvm_context_fw_result(p_cmd->device_handle, p_cmd->opcode,
+					p_cmd->sub_opcode, p_cmd->output_payload,
+					p_cmd->output_payload_size, lifetime, generation);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 int fw_get_bsr(const NVM_NFIT_DEVICE_HANDLE device_handle, unsigned long long *p_bsr)
 {
 	COMMON_LOG_ENTRY();
@@ -122,6 +154,24 @@ int fw_get_bsr(const NVM_NFIT_DEVICE_HANDLE device_handle, unsigned long long *p
 	return rc;
 }
 
+int fw_get_bios_payload_size(const NVM_UINT32 device_handle,
+		struct pt_bios_get_size *p_size)
+{
+	COMMON_LOG_ENTRY();
+
+	struct fw_cmd cmd;
+	memset(&cmd, 0, sizeof (struct fw_cmd));
+	cmd.device_handle = device_handle;
+	cmd.opcode = BIOS_EMULATED_COMMAND;
+	cmd.sub_opcode = SUBOP_GET_PAYLOAD_SIZE;
+	cmd.output_payload_size = sizeof (struct pt_bios_get_size);
+	cmd.output_payload = p_size;
+	int rc = cached_ioctl_passthrough_cmd(&cmd, FW_RESULT_LIFETIME_STATIC);
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 int fw_get_identify_dimm(const NVM_UINT32 device_handle,
 		struct pt_payload_identify_dimm *p_id_dimm)
 {
@@ -135,7 +185,7 @@ int fw_get_identify_dimm(const NVM_UINT32 device_handle,
 	cmd.output_payload_size = sizeof (struct pt_payload_identify_dimm);
 	cmd.output_payload = p_id_dimm;
 
-	int rc = ioctl_passthrough_cmd(&cmd);
+	int rc = cached_ioctl_passthrough_cmd(&cmd, FW_RESULT_LIFETIME_STATIC);
 	if (rc == NVM_SUCCESS)
 	{
 		// ensure backwards compatibility with FIS 1.2
@@ -190,7 +240,7 @@ int fw_get_alarm_thresholds(NVM_UINT32 const device_handle,
 	cmd.output_payload_size = sizeof (*p_thresholds);
 	cmd.output_payload = p_thresholds;
 
-	int rc = ioctl_passthrough_cmd(&cmd);
+	int rc = cached_ioctl_passthrough_cmd(&cmd, FW_RESULT_LIFETIME_SETTING);
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
@@ -467,7 +517,7 @@ int fw_get_fw_image_info(const NVM_UINT32 device_handle,
 	cmd.sub_opcode = SUBOP_FW_IMAGE_INFO;
 	cmd.output_payload_size = sizeof (*p_fw_image_info);
 	cmd.output_payload = p_fw_image_info;
-	int rc = ioctl_passthrough_cmd(&cmd);
+	int rc = cached_ioctl_passthrough_cmd(&cmd, FW_RESULT_LIFETIME_STATIC);
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
@@ -489,7 +539,7 @@ int fw_get_config_data_policy(unsigned int device_handle,
 	fw_cmd.output_payload_size = sizeof (*p_config_data);
 	fw_cmd.output_payload = p_config_data;
 
-	int rc = ioctl_passthrough_cmd(&fw_cmd);
+	int rc = cached_ioctl_passthrough_cmd(&fw_cmd, FW_RESULT_LIFETIME_SETTING);
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
@@ -36,11 +36,24 @@
 #include "nvm_types.h"
 #include "fis_types.h"
 #include "export_api.h"
+#include "nvm_context.h"
 
 NVM_API int fw_mb_err_to_nvm_lib_err(int status);
 
+/*
+ * Send a read-only pass-through command, using the context cache when possible
+ */
+NVM_API int cached_ioctl_passthrough_cmd(struct fw_cmd *p_cmd,
+		const enum fw_result_lifetime lifetime);
+
 NVM_API int fw_get_bsr(const NVM_NFIT_DEVICE_HANDLE device_handle, unsigned long long *p_bsr);
 
+/*
+ * Get the sizes of the BIOS large input and output mailboxes
+ */
+NVM_API int fw_get_bios_payload_size(const NVM_UINT32 device_handle,
+		struct pt_bios_get_size *p_size);
+
 NVM_API int dsm_err_to_nvm_lib_err(unsigned int status);
 
 NVM_API void set_ioctl_passthrough_function(int (*f)(struct fw_cmd *p_cmd));
@@ -547,15 +547,15 @@ enum device_sanitize_status translate_to_sanitize_status(
 	return sanitize_status;
 }
 
-int get_long_status(const NVM_NFIT_DEVICE_HANDLE dimm_handle, enum device_ars_status *p_ars_status,
+/*
+ * Translate the result of a long operation status command into ARS and sanitize status
+ */
+int translate_long_status(const int cmd_rc,
+		struct pt_payload_long_op_stat *p_long_op_payload,
+		enum device_ars_status *p_ars_status,
 		enum device_sanitize_status *p_sanitize_status)
 {
-	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
-
-	struct pt_payload_long_op_stat long_op_payload;
-	memset(&long_op_payload, 0, sizeof (long_op_payload));
-	rc = fw_get_status_for_long_op(dimm_handle, &long_op_payload);
+	int rc = cmd_rc;
 	if (rc == NVM_ERR_DEVICEERROR)
 	{
 		*p_ars_status = DEVICE_ARS_STATUS_NOTSTARTED;
@@ -569,10 +569,23 @@ int get_long_status(const NVM_NFIT_DEVICE_HANDLE dimm_handle, enum device_ars_st
 	}
 	else
 	{
-		*p_ars_status = translate_to_ars_status(&long_op_payload);
+		*p_ars_status = translate_to_ars_status(p_long_op_payload);
 
-		*p_sanitize_status = translate_to_sanitize_status(&long_op_payload);
+		*p_sanitize_status = translate_to_sanitize_status(p_long_op_payload);
 	}
+	return rc;
+}
+
+int get_long_status(const NVM_NFIT_DEVICE_HANDLE dimm_handle, enum device_ars_status *p_ars_status,
+		enum device_sanitize_status *p_sanitize_status)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct pt_payload_long_op_stat long_op_payload;
+	memset(&long_op_payload, 0, sizeof (long_op_payload));
+	rc = fw_get_status_for_long_op(dimm_handle, &long_op_payload);
+	rc = translate_long_status(rc, &long_op_payload, p_ars_status, p_sanitize_status);
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
@@ -784,7 +797,7 @@ int get_partition_info(const NVM_NFIT_DEVICE_HANDLE device_handle,
 	partition_cmd.sub_opcode = SUBOP_DIMM_PARTITION_INFO;
 	partition_cmd.output_payload_size = sizeof (struct pt_payload_get_dimm_partition_info);
 	partition_cmd.output_payload = p_pi;
-	rc = ioctl_passthrough_cmd(&partition_cmd);
+	rc = cached_ioctl_passthrough_cmd(&partition_cmd, FW_RESULT_LIFETIME_STATIC);
 	if (rc == NVM_SUCCESS)
 	{
 		COMMON_LOG_DEBUG_F(
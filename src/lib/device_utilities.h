@@ -99,6 +99,10 @@ int init_dev_table(COMMON_BOOL obtain_lock, struct nvm_topology *p_dimm_topo, NV
  */
 NVM_API int get_long_status(const NVM_NFIT_DEVICE_HANDLE dimm_handle, enum device_ars_status *p_ars_status,
 		enum device_sanitize_status *p_sanitize_status);
+NVM_API int translate_long_status(const int cmd_rc,
+		struct pt_payload_long_op_stat *p_long_op_payload,
+		enum device_ars_status *p_ars_status,
+		enum device_sanitize_status *p_sanitize_status);
 
 NVM_API enum device_ars_status translate_to_ars_status(struct pt_payload_long_op_stat *p_long_op_payload);
 
@@ -161,6 +161,7 @@
 #define	TRANSFER_TYPE_INITIATE	0b00
 #define	TRANSFER_TYPE_CONTINUE	0b01
 #define	TRANSFER_TYPE_END	0b10
+#define	TRANSFER_TYPE_ABORT	0b11
 #define TRANSFER_HEADER(type, packet)	((packet << 2) | type)
 #define	TRANSFER_SIZE	64
 #define	TRANSFER_VIA_LARGE_PAYLOAD	0
@@ -481,6 +482,8 @@ enum passthrough_opcode {
 		PT_GET_DBG_FEATURES = 0xE2,
 	/* Debug only command to set debug features */
 		PT_SET_DBG_FEATURES = 0xE3,
+	/* Vendor specific command to format the media */
+		PT_FORMAT = 0xF1,
 };
 
 /*
@@ -592,6 +595,13 @@ enum update_fw_subop {
 	SUBOP_EXECUTE_FW = 0x01
 };
 
+/*
+ * Defines the Sub-Opcodes for PT_FORMAT
+ */
+enum format_subop {
+	SUBOP_FORMAT = 0x00
+};
+
 /*
  * Determines what type of Failure Analysis operation to perform
  */
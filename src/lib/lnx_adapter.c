@@ -328,21 +328,7 @@ int get_dimm_details(NVM_NFIT_DEVICE_HANDLE device_handle, struct nvm_details *p
 int get_smbios_inventory_count()
 {
 	COMMON_LOG_ENTRY();
-	int rc = 0;
-
-	NVM_UINT8 *p_smbios_table = NULL;
-	size_t smbios_table_size = 0;
-	rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
-	if (rc == NVM_SUCCESS)
-	{
-		rc = smbios_get_populated_memory_device_count(p_smbios_table, smbios_table_size);
-	}
-
-	if (p_smbios_table)
-	{
-		free(p_smbios_table);
-	}
-
+	int rc = get_cached_smbios_memory_devices(NULL, 0);
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
@@ -361,20 +347,7 @@ int get_smbios_inventory(const NVM_UINT8 count, struct nvm_details *p_smbios_inv
 	else
 	{
 		memset(p_smbios_inventory, 0, sizeof (struct nvm_details) * count);
-
-		NVM_UINT8 *p_smbios_table = NULL;
-		size_t smbios_table_size = 0;
-		rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
-		if (rc == NVM_SUCCESS)
-		{
-			rc = smbios_table_to_nvm_details_array(
-					p_smbios_table, smbios_table_size, p_smbios_inventory, count);
-		}
-
-		if (p_smbios_table)
-		{
-			free(p_smbios_table);
-		}
+		rc = get_cached_smbios_memory_devices(p_smbios_inventory, count);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -32,7 +32,10 @@
 
 #include "device_adapter.h"
 #include "lnx_adapter.h"
+#include "nvm_context.h"
+#include <driver_interface/ndctl_session.h>
 #include <os/os_adapter.h>
+#include <errno.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -386,14 +389,11 @@ int get_dimm_by_handle(struct ndctl_ctx *ctx, unsigned int handle, struct ndctl_
 }
 
 /*
- * Execute a passthrough IOCTL
+ * Check a passthrough command before it is sent
  */
-int ioctl_passthrough_cmd(struct fw_cmd *p_fw_cmd)
+static int validate_passthrough_cmd(const struct fw_cmd *p_fw_cmd)
 {
-	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
-	struct ndctl_ctx *ctx;
-	// check input parameters
 	if (p_fw_cmd == NULL)
 	{
 		COMMON_LOG_ERROR("Invalid parameter, cmd struct is null");
@@ -421,109 +421,208 @@ int ioctl_passthrough_cmd(struct fw_cmd *p_fw_cmd)
 		rc = NVM_ERR_NOTSUPPORTED;
 	}
 #endif
-	else if ((rc = ndctl_new(&ctx)) < 0)
+
+	return rc;
+}
+
+/*
+ * Send a validated passthrough command to a DIMM from the ndctl session
+ */
+static int submit_passthrough_cmd(struct ndctl_dimm *p_dimm, struct fw_cmd *p_fw_cmd)
+{
+	int rc = NVM_SUCCESS;
+	unsigned int opcode = BUILD_DSM_OPCODE(p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
+	struct ndctl_cmd *p_vendor_cmd = NULL;
+	if ((p_vendor_cmd = ndctl_dimm_cmd_new_vendor_specific(
+			p_dimm, opcode, DEV_SMALL_PAYLOAD_SIZE,
+			DEV_SMALL_PAYLOAD_SIZE)) == NULL)
 	{
-		COMMON_LOG_ERROR("Failed to retrieve ctx");
-		rc = linux_err_to_nvm_lib_err(rc);
+		rc = NVM_ERR_DRIVERFAILED;
+		COMMON_LOG_ERROR("Failed to get vendor command from driver");
 	}
 	else
 	{
-		struct ndctl_dimm *p_dimm = NULL;
-		if ((rc = get_dimm_by_handle(ctx, p_fw_cmd->device_handle, &p_dimm)) == NVM_SUCCESS)
+		int lnx_err_status = 0;
+		unsigned int dsm_vendor_err_status = 0;
+
+		if (p_fw_cmd->input_payload_size > 0)
 		{
-			unsigned int opcode = BUILD_DSM_OPCODE(p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
-			struct ndctl_cmd *p_vendor_cmd = NULL;
-			if ((p_vendor_cmd = ndctl_dimm_cmd_new_vendor_specific(
-					p_dimm, opcode, DEV_SMALL_PAYLOAD_SIZE,
-					DEV_SMALL_PAYLOAD_SIZE)) == NULL)
+			NVM_SIZE bytes_written = ndctl_cmd_vendor_set_input(p_vendor_cmd,
+				p_fw_cmd->input_payload, p_fw_cmd->input_payload_size);
+
+			if (bytes_written != p_fw_cmd->input_payload_size)
 			{
+				COMMON_LOG_ERROR("Failed to write input payload");
 				rc = NVM_ERR_DRIVERFAILED;
-				COMMON_LOG_ERROR("Failed to get vendor command from driver");
 			}
-			else
-			{
-				int lnx_err_status = 0;
-				unsigned int dsm_vendor_err_status = 0;
-
-				if (p_fw_cmd->input_payload_size > 0)
-				{
-					NVM_SIZE bytes_written = ndctl_cmd_vendor_set_input(p_vendor_cmd,
-						p_fw_cmd->input_payload, p_fw_cmd->input_payload_size);
+		}
 
-					if (bytes_written != p_fw_cmd->input_payload_size)
-					{
-						COMMON_LOG_ERROR("Failed to write input payload");
-						rc = NVM_ERR_DRIVERFAILED;
-					}
-				}
+		if (rc == NVM_SUCCESS && p_fw_cmd->large_input_payload_size > 0)
+		{
+			rc = bios_write_large_payload(p_dimm, p_fw_cmd);
+		}
 
-				if (rc == NVM_SUCCESS && p_fw_cmd->large_input_payload_size > 0)
+		COMMON_LOG_HANDOFF_F("Passthrough IOCTL. Opcode: 0x%x, SubOpcode: 0x%x",
+			p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
+		if (p_fw_cmd->input_payload_size)
+		{
+			// Print one DWORD at a time starting from LSB of input_payload
+			for (int i = 0; i < p_fw_cmd->input_payload_size / sizeof(NVM_UINT32); i++)
+			{
+				// Make sure entire DWORD gets printed
+				COMMON_LOG_HANDOFF_F("Input[%d]: 0x%.8x",
+					i, ((NVM_UINT32 *) (p_fw_cmd->input_payload))[i]);
+			}
+		}
+		if (rc == NVM_SUCCESS)
+		{
+			if ((lnx_err_status = ndctl_cmd_submit(p_vendor_cmd)) >= 0)
+			{
+				// BSR returns 0x78, but everything else seems to indicate the
+				// command was a success. Going
+				// to ignore the result for now. If there was a real error,
+				// the fw_status should have it.
+				if ((dsm_vendor_err_status =
+						ndctl_cmd_get_firmware_status(p_vendor_cmd)) != DSM_VENDOR_SUCCESS)
 				{
-					rc = bios_write_large_payload(p_dimm, p_fw_cmd);
+					rc = dsm_err_to_nvm_lib_err(dsm_vendor_err_status);
+					COMMON_LOG_ERROR_F("IOCTL passthrough failed: "
+						"DSM returned error %d for command with "
+								"Opcode - 0x%x SubOpcode - 0x%x ", dsm_vendor_err_status,
+									p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
 				}
-
-				COMMON_LOG_HANDOFF_F("Passthrough IOCTL. Opcode: 0x%x, SubOpcode: 0x%x",
-					p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
-				if (p_fw_cmd->input_payload_size)
+				else
 				{
-					// Print one DWORD at a time starting from LSB of input_payload
-					for (int i = 0; i < p_fw_cmd->input_payload_size / sizeof(NVM_UINT32); i++)
+					if (p_fw_cmd->output_payload_size > 0)
 					{
-						// Make sure entire DWORD gets printed
-						COMMON_LOG_HANDOFF_F("Input[%d]: 0x%.8x",
-							i, ((NVM_UINT32 *) (p_fw_cmd->input_payload))[i]);
+						ndctl_cmd_vendor_get_output(p_vendor_cmd,
+									p_fw_cmd->output_payload,
+										p_fw_cmd->output_payload_size);
 					}
-				}
-				if (rc == NVM_SUCCESS)
-				{
-					if ((lnx_err_status = ndctl_cmd_submit(p_vendor_cmd)) >= 0)
-					{
-						// BSR returns 0x78, but everything else seems to indicate the
-						// command was a success. Going
-						// to ignore the result for now. If there was a real error,
-						// the fw_status should have it.
-						if ((dsm_vendor_err_status =
-								ndctl_cmd_get_firmware_status(p_vendor_cmd)) != DSM_VENDOR_SUCCESS)
-						{
-							rc = dsm_err_to_nvm_lib_err(dsm_vendor_err_status);
-							COMMON_LOG_ERROR_F("IOCTL passthrough failed: "
-								"DSM returned error %d for command with "
-										"Opcode - 0x%x SubOpcode - 0x%x ", dsm_vendor_err_status,
-											p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
-						}
-						else
-						{
-							if (p_fw_cmd->output_payload_size > 0)
-							{
-								ndctl_cmd_vendor_get_output(p_vendor_cmd,
-											p_fw_cmd->output_payload,
-												p_fw_cmd->output_payload_size);
-							}
-
-							if (p_fw_cmd->large_output_payload_size > 0)
-							{
 
-								rc = bios_read_large_payload(p_dimm, p_fw_cmd);
-							}
-						}
-					}
-					else
+					if (p_fw_cmd->large_output_payload_size > 0)
 					{
-						rc = linux_err_to_nvm_lib_err(lnx_err_status);
-						COMMON_LOG_ERROR_F("IOCTL passthrough failed "
-								"Linux driver returned error %d for command with "
-								"Opcode- 0x%x SubOpcode- 0x%x ", lnx_err_status,
-								p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
+
+						rc = bios_read_large_payload(p_dimm, p_fw_cmd);
 					}
 				}
-
-				ndctl_cmd_unref(p_vendor_cmd);
+			}
+			else
+			{
+				rc = linux_err_to_nvm_lib_err(lnx_err_status);
+				COMMON_LOG_ERROR_F("IOCTL passthrough failed "
+						"Linux driver returned error %d for command with "
+						"Opcode- 0x%x SubOpcode- 0x%x ", lnx_err_status,
+						p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
+				// the DIMM has gone away, rebuild the session on the next command
+				if (lnx_err_status == -ENXIO || lnx_err_status == -ENODEV)
+				{
+					pt_ndctl_session_invalidate();
+				}
 			}
 		}
-		ndctl_unref(ctx);
+
+		ndctl_cmd_unref(p_vendor_cmd);
+	}
+
+	return rc;
+}
+
+/*
+ * Execute a passthrough IOCTL
+ */
+int ioctl_passthrough_cmd(struct fw_cmd *p_fw_cmd)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	struct ndctl_ctx *ctx;
+	struct ndctl_dimm *p_dimm = NULL;
+
+	if ((rc = validate_passthrough_cmd(p_fw_cmd)) != NVM_SUCCESS)
+	{
+		COMMON_LOG_ERROR("Invalid passthrough command");
+	}
+	else if ((rc = pt_ndctl_session_get_dimm(p_fw_cmd->device_handle, &ctx, &p_dimm)) < 0)
+	{
+		COMMON_LOG_ERROR("Failed to retrieve ctx");
+		rc = linux_err_to_nvm_lib_err(rc);
+	}
+	else if (rc == PT_NDCTL_SESSION_NOT_FOUND)
+	{
+		COMMON_LOG_ERROR("Failed to get DIMM from driver");
+		rc = NVM_ERR_DRIVERFAILED;
+	}
+	else
+	{
+		rc = submit_passthrough_cmd(p_dimm, p_fw_cmd);
+		pt_ndctl_session_release(ctx);
+
+		// the command may have changed what is cached for the DIMM
+		invalidate_fw_results_for_cmd(p_fw_cmd->device_handle,
+				p_fw_cmd->opcode, p_fw_cmd->sub_opcode);
 	}
 
 	s_memset(&p_fw_cmd, sizeof (p_fw_cmd));
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
+
+/*
+ * Execute a batch of passthrough IOCTLs for one DIMM, looking the DIMM up once
+ */
+int ioctl_passthrough_cmds(struct fw_cmd *p_fw_cmds, const int count, int *p_results)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	struct ndctl_ctx *ctx;
+	struct ndctl_dimm *p_dimm = NULL;
+
+	if (p_fw_cmds == NULL || p_results == NULL || count <= 0)
+	{
+		COMMON_LOG_ERROR("Invalid parameter");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if ((rc = pt_ndctl_session_get_dimm(p_fw_cmds[0].device_handle, &ctx, &p_dimm)) < 0)
+	{
+		COMMON_LOG_ERROR("Failed to retrieve ctx");
+		rc = linux_err_to_nvm_lib_err(rc);
+	}
+	else if (rc == PT_NDCTL_SESSION_NOT_FOUND)
+	{
+		COMMON_LOG_ERROR("Failed to get DIMM from driver");
+		rc = NVM_ERR_DRIVERFAILED;
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+		{
+			if (p_fw_cmds[i].device_handle != p_fw_cmds[0].device_handle)
+			{
+				COMMON_LOG_ERROR("Batched commands must all be for the same DIMM");
+				p_results[i] = NVM_ERR_INVALIDPARAMETER;
+			}
+			else if ((p_results[i] = validate_passthrough_cmd(&p_fw_cmds[i])) == NVM_SUCCESS)
+			{
+				p_results[i] = submit_passthrough_cmd(p_dimm, &p_fw_cmds[i]);
+			}
+		}
+		pt_ndctl_session_release(ctx);
+
+		for (int i = 0; i < count; i++)
+		{
+			invalidate_fw_results_for_cmd(p_fw_cmds[i].device_handle,
+					p_fw_cmds[i].opcode, p_fw_cmds[i].sub_opcode);
+		}
+	}
+
+	if (rc != NVM_SUCCESS && p_results != NULL)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			p_results[i] = rc;
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
@@ -39,8 +39,10 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <fcntl.h>
+#include <sys/stat.h>
 
 #define	EFI_SYSTAB "/sys/firmware/efi/systab"
+#define	SYSFS_DMI_TABLE "/sys/firmware/dmi/tables/DMI"
 
 // Helper function declarations
 int get_numa_nodes(NVM_UINT16 *p_node_id, NVM_UINT16 count);
@@ -700,11 +702,64 @@ int copy_smbios_table_from_mem_alloc(int mem_fd, size_t address, size_t size_to_
 	return rc;
 }
 
+/*
+ * Copy the SMBIOS structure table the kernel exports in sysfs, which
+ * doesn't need /dev/mem or an entry point scan.
+ */
+int copy_smbios_table_from_sysfs_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size)
+{
+	int rc = NVM_ERR_UNKNOWN;
+
+	int fd = open(SYSFS_DMI_TABLE, O_RDONLY|O_CLOEXEC);
+	if (fd >= 0)
+	{
+		struct stat table_stat;
+		if (fstat(fd, &table_stat) == 0 && table_stat.st_size > 0)
+		{
+			size_t table_size = (size_t)table_stat.st_size;
+			NVM_UINT8 *p_smbios_table = calloc(1, table_size);
+			if (!p_smbios_table)
+			{
+				COMMON_LOG_ERROR("couldn't allocate memory for SMBIOS table copy");
+				rc = NVM_ERR_NOMEMORY;
+			}
+			else
+			{
+				size_t total_read = 0;
+				ssize_t bytes_read = 1;
+				while (total_read < table_size && bytes_read > 0)
+				{
+					bytes_read = read(fd, p_smbios_table + total_read,
+							table_size - total_read);
+					if (bytes_read > 0)
+					{
+						total_read += bytes_read;
+					}
+				}
+
+				if (total_read == table_size)
+				{
+					*pp_smbios_table = p_smbios_table;
+					*p_allocated_size = table_size;
+					rc = NVM_SUCCESS;
+				}
+				else
+				{
+					free(p_smbios_table);
+				}
+			}
+		}
+		close(fd);
+	}
+
+	return rc;
+}
+
 /*
  * Harvest the raw SMBIOS table data from memory and allocate a copy
  * to parse.
  */
-int get_smbios_table_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size)
+int get_smbios_table_from_mem_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
@@ -746,6 +801,23 @@ int get_smbios_table_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size
 	return rc;
 }
 
+/*
+ * Harvest the raw SMBIOS table data from sysfs, or from memory on kernels
+ * that don't export it, and allocate a copy to parse.
+ */
+int get_smbios_table_alloc(NVM_UINT8 **pp_smbios_table, size_t *p_allocated_size)
+{
+	COMMON_LOG_ENTRY();
+	int rc = copy_smbios_table_from_sysfs_alloc(pp_smbios_table, p_allocated_size);
+	if (rc == NVM_ERR_UNKNOWN)
+	{
+		rc = get_smbios_table_from_mem_alloc(pp_smbios_table, p_allocated_size);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Determine if the caller has permission to make changes to the system
  */
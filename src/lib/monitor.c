@@ -66,6 +66,8 @@ static int g_is_polling = 0;
 static struct event_notify_callback g_event_callback_list[MAX_EVENT_SUBSCRIBERS];
 static int g_current_event_id = 0; // When polling this stores the most recent event id
 static NVM_UINT32 g_poll_interval_sec = 60; // Default poll interval. Overridden in config database
+// Wakes the polling thread when an event is stored, created once and kept for the process
+static OS_NOTIFIER *g_p_event_notifier = NULL;
 
 /*
  * Helper functions
@@ -73,6 +75,7 @@ static NVM_UINT32 g_poll_interval_sec = 60; // Default poll interval. Overridden
 static void *poll_events(void *arg); // run in a seperate thread for polling the event table
 static int timeToQuit(unsigned long timeoutSeconds); // helps polling to know when to stop
 static int get_nvm_event_id(); // get most recent id from event table
+static void wake_poll_events(); // wake the polling thread early
 
 
 /*
@@ -207,6 +210,15 @@ int init_event_notify()
 				g_poll_interval_sec = (NVM_UINT32)poll_interval * SECONDSPERMINUTE;
 			}
 
+			if (!g_p_event_notifier)
+			{
+				COMMON_PATH notify_path;
+				g_p_event_notifier = notifier_create(
+						get_event_notify_path(notify_path) == COMMON_SUCCESS ?
+						notify_path : NULL);
+				set_event_stored_callback(wake_poll_events);
+			}
+
 			g_is_polling = 1;
 
 			mutex_unlock(&g_eventmonitor_lock);
@@ -214,6 +226,7 @@ int init_event_notify()
 			// start polling
 			NVM_UINT64 thread_id;
 			create_thread(&thread_id, poll_events, NULL);
+			detach_thread(thread_id);
 		}
 		else
 		{
@@ -240,6 +253,7 @@ int remove_event_notify()
 		{
 			// trigger we are done polling
 			g_is_polling = 0;
+			wake_poll_events();
 		}
 		mutex_unlock(&g_eventmonitor_lock);
 	}
@@ -426,32 +440,50 @@ static int get_nvm_event_id()
 }
 
 /*
- * hold until it's time to stop polling or the wait time expires
+ * Wake the polling thread to look for new events or to stop
+ */
+static void wake_poll_events()
+{
+	if (g_p_event_notifier)
+	{
+		notifier_signal(g_p_event_notifier);
+	}
+}
+
+/*
+ * hold until it's time to stop polling, an event is stored or the wait time expires
  */
 static int timeToQuit(unsigned long timeoutSeconds)
 {
 	COMMON_LOG_ENTRY();
 	int time_to_quit = 0;
-	time_t beg = time(NULL);
-	time_t cur;
-	unsigned long elapsedSeconds = 0;
-	do
+
+	if (g_p_event_notifier)
 	{
+		notifier_wait(g_p_event_notifier, timeoutSeconds * 1000);
 		if (mutex_lock(&g_eventmonitor_lock))
 		{
 			time_to_quit = !g_is_polling;
 			mutex_unlock(&g_eventmonitor_lock);
 		}
-		if (time_to_quit)
+	}
+	else
+	{
+		// no notifier, check for a stop once a second until the interval expires
+		for (unsigned long elapsedSeconds = 0;
+				!time_to_quit && elapsedSeconds <= timeoutSeconds; elapsedSeconds++)
 		{
-			break;
+			if (mutex_lock(&g_eventmonitor_lock))
+			{
+				time_to_quit = !g_is_polling;
+				mutex_unlock(&g_eventmonitor_lock);
+			}
+			if (!time_to_quit && elapsedSeconds < timeoutSeconds)
+			{
+				nvm_sleep(1000);
+			}
 		}
-		// sleep
-		cur = time(NULL);
-		elapsedSeconds = (unsigned long)difftime(cur, beg);
-		nvm_sleep(1000); // sleep for 1 second between checks
 	}
-	while (elapsedSeconds < timeoutSeconds);
 
 	COMMON_LOG_EXIT_RETURN_I(time_to_quit);
 	return time_to_quit;
@@ -475,7 +507,9 @@ static void *poll_events(void *arg)
 			int next_event_id = get_nvm_event_id();
 			if (g_current_event_id < next_event_id)
 			{
-				int event_count = process_events_matching_filter(&filter, NULL, 0, 0);
+				// only the events added since the last poll are read
+				int event_count = process_events_in_id_range(&filter,
+						g_current_event_id, next_event_id, NULL, 0);
 				if (event_count < 0)
 				{
 					COMMON_LOG_ERROR_F("Error polling events while getting event count. Error: %d",
@@ -484,7 +518,8 @@ static void *poll_events(void *arg)
 				else
 				{
 					struct event *events = malloc(event_count * sizeof(struct event));
-					event_count = process_events_matching_filter(&filter, events, event_count, 0);
+					event_count = process_events_in_id_range(&filter,
+							g_current_event_id, next_event_id, events, event_count);
 					if (event_count < 0)
 					{
 						COMMON_LOG_ERROR_F("Error polling events while getting events. Error: %d",
@@ -527,6 +562,7 @@ static void *poll_events(void *arg)
 				g_current_event_id = next_event_id;
 			}
 			db_end_transaction(get_lib_store());
+			notify_pending_events();
 
 			mutex_unlock(&g_eventmonitor_lock);
 		}
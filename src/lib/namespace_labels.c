@@ -28,9 +28,11 @@
 #include "common.h"
 #include "namespace_labels.h"
 #include "device_utilities.h"
+#include "device_executor.h"
 #include "nvm_context.h"
 #include <firmware_interface/fis_commands.h>
 #include <common_types.h>
+#include <checksum/checksum.h>
 #include <persistence/logging.h>
 #include <uid/uid.h>
 #include <guid/guid.h>
@@ -46,6 +48,7 @@
 #define	NS_INDEX_LEN	256
 #define	NS_INDEX_FREEMAP_LEN	128	// Map for 1024 labels
 #define	NS_INDEX_PADDING	56	// Alignment to 256B boundary
+#define	NS_LSA_INDEX_BLOCKS_LEN	(2 * NS_INDEX_LEN)	// Both index blocks lead the LSA
 #define	NS_INDEX_MAJOR	1
 #define	NS_INDEX_MINOR	2 // Used for windows only
 #define	MAX_NS_LABELS	1020
@@ -102,10 +105,6 @@ struct v1_2_cookie_data
 NVM_BOOL checksum_fletcher64(void *p_data, NVM_UINT32 length,
 		NVM_UINT64 *p_checksum, NVM_BOOL update)
 {
-	NVM_UINT32 *p_start = p_data;
-	NVM_UINT32 *p_end = (NVM_UINT32 *)((NVM_UINT8 *)p_start + length);
-	NVM_UINT32 lo32 = 0;
-	NVM_UINT32 hi32 = 0;
 	NVM_UINT64 checksum = 0;
 	NVM_BOOL checksum_match = 0;
 
@@ -118,32 +117,16 @@ NVM_BOOL checksum_fletcher64(void *p_data, NVM_UINT32 length,
 		COMMON_LOG_INFO("The size specified for the checksum is not properly aligned");
 	}
 	else if (((uintptr_t)p_data % sizeof (NVM_UINT32)) !=
-			((uintptr_t)checksum % sizeof (NVM_UINT32)))
+			((uintptr_t)p_checksum % sizeof (NVM_UINT32)))
 	{
 		COMMON_LOG_INFO("The address and the checksum address are not aligned together");
 	}
 	else
 	{
-		while (p_start < p_end)
-		{
-			if (p_start == (NVM_UINT32 *) p_checksum)
-			{
-				/* Lo32 += 0; treat first 32-bits as zero */
-				p_start++;
-				hi32 += lo32;
-				/* Lo32 += 0; treat second 32-bits as zero */
-				p_start++;
-				hi32 += lo32;
-			}
-			else
-			{
-				lo32 += *p_start;
-				++p_start;
-				hi32 += lo32;
-			}
-		}
-
-		checksum = (NVM_UINT64) hi32 << 32 | lo32;
+		// a checksum outside the data gives an offset >= length, so nothing is skipped
+		uintptr_t skip_offset = (uintptr_t)p_checksum - (uintptr_t)p_data;
+		checksum = fletcher64(p_data, length,
+				skip_offset < length ? (NVM_UINT32)skip_offset : length);
 		if (update)
 		{
 			*p_checksum = checksum;
@@ -208,6 +191,122 @@ int collect_ns_data_manageable_dimms(struct ns_data **pp_ns_data)
 	return rc;
 }
 
+/*
+ * Read part of the namespace label storage area through small payload commands
+ */
+static int read_nslsa_small_payload(const NVM_UINT32 device_handle, void *p_buf,
+		const NVM_UINT32 start, const NVM_SIZE size)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct pt_input_namespace_labels input_payload;
+	memset(&input_payload, 0, sizeof (input_payload));
+	input_payload.partition_id = NS_LABEL_PCDPARTITION;
+	input_payload.command_option = DEV_PLT_CFG_OPT_SMALL_DATA;
+
+	char out_buf[DEV_SMALL_PAYLOAD_SIZE];
+	struct fw_cmd cfg_cmd;
+	memset(&cfg_cmd, 0, sizeof (cfg_cmd));
+	cfg_cmd.device_handle = device_handle;
+	cfg_cmd.opcode = PT_GET_ADMIN_FEATURES;
+	cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
+	cfg_cmd.input_payload_size = sizeof (input_payload);
+	cfg_cmd.input_payload = &input_payload;
+	cfg_cmd.output_payload_size = DEV_SMALL_PAYLOAD_SIZE;
+	cfg_cmd.output_payload = &out_buf;
+
+	NVM_UINT32 offset = 0;
+	while (offset < size && rc == NVM_SUCCESS)
+	{
+		memset(&out_buf, 0, DEV_SMALL_PAYLOAD_SIZE);
+		input_payload.offset = start + offset;
+		if ((rc = ioctl_passthrough_cmd(&cfg_cmd)) == NVM_SUCCESS)
+		{
+			NVM_SIZE transfer_size = DEV_SMALL_PAYLOAD_SIZE;
+			if ((offset + DEV_SMALL_PAYLOAD_SIZE) > size)
+			{
+				transfer_size = size - offset;
+			}
+			memmove((NVM_UINT8 *)p_buf + offset, out_buf, transfer_size);
+			offset += DEV_SMALL_PAYLOAD_SIZE;
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Read the whole namespace label storage area from a DIMM
+ */
+static int read_full_nslsa(const NVM_UINT32 device_handle, struct pt_output_namespace_labels *p_lsa)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+#if __GET_LARGE_PCD_NS_LABEL__
+	struct pt_input_namespace_labels input_payload;
+	memset(&input_payload, 0, sizeof (input_payload));
+	input_payload.partition_id = NS_LABEL_PCDPARTITION;
+
+	struct fw_cmd cfg_cmd;
+	memset(&cfg_cmd, 0, sizeof (cfg_cmd));
+	cfg_cmd.device_handle = device_handle;
+	cfg_cmd.opcode = PT_GET_ADMIN_FEATURES;
+	cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
+	cfg_cmd.input_payload_size = sizeof (input_payload);
+	cfg_cmd.input_payload = &input_payload;
+	cfg_cmd.large_output_payload_size = sizeof (struct pt_output_namespace_labels);
+	cfg_cmd.large_output_payload = p_lsa;
+	rc = ioctl_passthrough_cmd(&cfg_cmd);
+#else
+	rc = read_nslsa_small_payload(device_handle, p_lsa, 0,
+			sizeof (struct pt_output_namespace_labels));
+#endif
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Retrieve the namespace label storage area from a single DIMM.
+ * Every label update rewrites an index block with a new sequence number, so a
+ * cached copy is reused while both index blocks on the DIMM still match it.
+ */
+static int read_dimm_nslsa(void *p_arg, const int index)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+	struct ns_data *p_ns_data = (struct ns_data *)p_arg;
+	NVM_UINT32 device_handle = p_ns_data->dimm_list[index].device_handle.handle;
+	struct pt_output_namespace_labels *p_lsa = &p_ns_data->dimm_nslsa_list[index];
+
+	NVM_BOOL current = 0;
+	NVM_UINT32 generation = 0;
+	if (get_nvm_context_device_lsa(device_handle, p_lsa, sizeof (*p_lsa),
+			&generation) == NVM_SUCCESS)
+	{
+		NVM_UINT8 index_blocks[NS_LSA_INDEX_BLOCKS_LEN];
+		if ((rc = read_nslsa_small_payload(device_handle, index_blocks, 0,
+				sizeof (index_blocks))) == NVM_SUCCESS)
+		{
+			current = (memcmp(index_blocks, p_lsa, sizeof (index_blocks)) == 0);
+		}
+	}
+
+	if (rc == NVM_SUCCESS && !current)
+	{
+		if ((rc = read_full_nslsa(device_handle, p_lsa)) == NVM_SUCCESS)
+		{
+			set_nvm_context_device_lsa(device_handle, p_lsa, sizeof (*p_lsa), generation);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Retrieve the namespace label storage area from each manageable DIMM
  */
@@ -218,68 +317,23 @@ int collect_dimm_nslsa_list(struct ns_data **pp_ns_data)
 
 	(*pp_ns_data)->dimm_nslsa_list = calloc((*pp_ns_data)->dimm_count,
 			sizeof (struct pt_output_namespace_labels));
-	if (!(*pp_ns_data)->dimm_nslsa_list)
+	NVM_UINT32 *p_device_handles = calloc((*pp_ns_data)->dimm_count + 1,
+			sizeof (NVM_UINT32));
+	if (!(*pp_ns_data)->dimm_nslsa_list || !p_device_handles)
 	{
 		COMMON_LOG_ERROR("No memory to collect namespace information");
 		rc = NVM_ERR_NOMEMORY;
 	}
 	else
 	{
-		struct pt_input_namespace_labels input_payload;
-		memset(&input_payload, 0, sizeof (input_payload));
-		input_payload.partition_id = NS_LABEL_PCDPARTITION;
-
-		for (int i = 0; i < (*pp_ns_data)->dimm_count; i ++)
+		for (int i = 0; i < (*pp_ns_data)->dimm_count; i++)
 		{
-			struct fw_cmd cfg_cmd;
-			memset(&cfg_cmd, 0, sizeof (cfg_cmd));
-			cfg_cmd.device_handle = (*pp_ns_data)->dimm_list[i].device_handle.handle;
-			cfg_cmd.opcode = PT_GET_ADMIN_FEATURES;
-			cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
-			cfg_cmd.input_payload_size = sizeof (input_payload);
-
-#if __GET_LARGE_PCD_NS_LABEL__
-			cfg_cmd.input_payload = &input_payload;
-			cfg_cmd.large_output_payload_size = sizeof (struct pt_output_namespace_labels);
-			cfg_cmd.large_output_payload = &(*pp_ns_data)->dimm_nslsa_list[i];
-			rc = ioctl_passthrough_cmd(&cfg_cmd);
-			if (rc != NVM_SUCCESS)
-			{
-				break;
-			}
-#else
-			NVM_SIZE lsa_size = sizeof (struct pt_output_namespace_labels);
-			char out_buf[DEV_SMALL_PAYLOAD_SIZE];
-			NVM_UINT32 offset = 0;
-			input_payload.command_option = DEV_PLT_CFG_OPT_SMALL_DATA;
-			input_payload.offset = offset;
-			cfg_cmd.input_payload = &input_payload;
-			cfg_cmd.output_payload_size = DEV_SMALL_PAYLOAD_SIZE;
-			cfg_cmd.output_payload = &out_buf;
-
-			while (offset < lsa_size && rc == NVM_SUCCESS)
-			{
-				memset(&out_buf, 0, DEV_SMALL_PAYLOAD_SIZE);
-				input_payload.offset = offset;
-				if ((rc = ioctl_passthrough_cmd(&cfg_cmd)) == NVM_SUCCESS)
-				{
-					NVM_SIZE transfer_size = DEV_SMALL_PAYLOAD_SIZE;
-					if ((offset + DEV_SMALL_PAYLOAD_SIZE) > lsa_size)
-					{
-						transfer_size = lsa_size - offset;
-					}
-					memmove(((void *)&(*pp_ns_data)->dimm_nslsa_list[i]) + offset,
-							out_buf, transfer_size);
-					offset += DEV_SMALL_PAYLOAD_SIZE;
-				}
-				else
-				{
-					break;
-				}
-			}
-#endif
+			p_device_handles[i] = (*pp_ns_data)->dimm_list[i].device_handle.handle;
 		}
+		rc = run_device_tasks(p_device_handles, (*pp_ns_data)->dimm_count,
+				read_dimm_nslsa, *pp_ns_data);
 	}
+	free(p_device_handles);
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
@@ -787,12 +841,12 @@ int parse_dimm_ns_labels(struct ns_data **pp_ns_data, const int dimm_index)
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
 
-	struct pt_output_namespace_labels dimm_lsa = (*pp_ns_data)->dimm_nslsa_list[dimm_index];
-	int index_to_use = choose_index_block(&dimm_lsa);
+	struct pt_output_namespace_labels *p_dimm_lsa = &(*pp_ns_data)->dimm_nslsa_list[dimm_index];
+	int index_to_use = choose_index_block(p_dimm_lsa);
 	if (index_to_use) // 0 index block = no labels
 	{
 		struct pt_output_ns_index ns_index =
-			index_to_use == 1 ? dimm_lsa.index1 : dimm_lsa.index2;
+			index_to_use == 1 ? p_dimm_lsa->index1 : p_dimm_lsa->index2;
 		for (int i = 0; i < ns_index.nlabel; i++)
 		{
 			if (!is_slot_free(ns_index.free, i))
@@ -802,7 +856,7 @@ int parse_dimm_ns_labels(struct ns_data **pp_ns_data, const int dimm_index)
 				{
 					int offset = i * sizeof (struct pt_output_ns_label_v1_1);
 					struct pt_output_ns_label_v1_1 *p_label =
-							(struct pt_output_ns_label_v1_1 *)(dimm_lsa.labels + offset);
+							(struct pt_output_ns_label_v1_1 *)(p_dimm_lsa->labels + offset);
 
 					// convert to a v1.2 label
 					struct pt_output_ns_label_v1_2 label;
@@ -823,7 +877,7 @@ int parse_dimm_ns_labels(struct ns_data **pp_ns_data, const int dimm_index)
 				{
 					int offset = i * sizeof (struct pt_output_ns_label_v1_2);
 						struct pt_output_ns_label_v1_2 *p_label =
-							(struct pt_output_ns_label_v1_2 *)(dimm_lsa.labels + offset);
+							(struct pt_output_ns_label_v1_2 *)(p_dimm_lsa->labels + offset);
 				    rc = init_namespace_from_label(pp_ns_data, dimm_index, p_label);
 				}
 			}
@@ -85,32 +85,21 @@ int get_parsed_nfit(struct parsed_nfit **pp_parsed_nfit)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_ERR_BADNFIT;
-	int nfit_size = get_nvm_context_nfit_size();
-	if (nfit_size > 0)
+	*pp_parsed_nfit = NULL;
+	if (get_nvm_context_nfit(pp_parsed_nfit) != NVM_SUCCESS)
 	{
-		*pp_parsed_nfit = calloc(1, nfit_size);
-		if (!(*pp_parsed_nfit))
+		rc = nfit_err_to_lib_err(nfit_get_parsed_nfit(pp_parsed_nfit));
+		if (rc == NVM_SUCCESS && *pp_parsed_nfit)
 		{
-			COMMON_LOG_ERROR("Not enough memory to retrieve the NFIT");
-			rc = NVM_ERR_NOMEMORY;
-		}
-		else
-		{
-			rc = get_nvm_context_nfit(nfit_size, *pp_parsed_nfit);
+			// the context keeps its own copy, there may not be a context
+			set_nvm_context_nfit(*pp_parsed_nfit);
 		}
 	}
 	else
 	{
-		nfit_size = nfit_get_parsed_nfit(pp_parsed_nfit);
-		if (nfit_size && *pp_parsed_nfit)
-		{
-			rc = set_nvm_context_nfit(nfit_size, *pp_parsed_nfit);
-		}
-		else
-		{
-			rc = nfit_err_to_lib_err(nfit_size);
-		}
+		rc = NVM_SUCCESS;
 	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
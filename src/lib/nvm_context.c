@@ -32,8 +32,15 @@
 #include "nvm_context.h"
 #include <os/os_adapter.h>
 #include <persistence/logging.h>
+#include <persistence/lib_persistence.h>
+#include <persistence/config_settings.h>
 #include <uid/uid.h>
 #include <acpi/nfit.h>
+#include "fis_types.h"
+
+// used when the config database does not provide a value
+#define	FW_STATIC_CACHE_TTL_SECONDS_DEFAULT	600
+#define	FW_SETTING_CACHE_TTL_SECONDS_DEFAULT	60
 
 #ifdef __WINDOWS__
 #include <Windows.h>
@@ -49,6 +56,24 @@ NVM_API struct nvm_context *p_context = NULL;
 // context ref counter
 int g_ctx_count = 0;
 
+// defined in pool.c
+extern void free_pool_data(struct pool_data *p_pool_data);
+
+/*
+ * Helper function to read the configured time to live of cached firmware results
+ */
+static int read_fw_result_ttl(const char *key, const int default_ttl)
+{
+	COMMON_LOG_ENTRY();
+	int ttl = 0;
+	if (get_config_value_int(key, &ttl) != COMMON_SUCCESS)
+	{
+		ttl = default_ttl;
+	}
+	COMMON_LOG_EXIT_RETURN_I(ttl);
+	return ttl;
+}
+
 /*
  * Initialize the context. This is a lazy context meaning
  * details are added as they are requested rather than up
@@ -88,12 +113,25 @@ int nvm_create_context()
 				p_context->p_devices = NULL;
 				p_context->pool_count = -1;
 				p_context->p_pools = NULL;
+				p_context->p_pool_data = NULL;
+				p_context->pool_data_stale = POOL_DATA_ALL;
 				p_context->namespace_count = -1;
 				p_context->p_namespaces = NULL;
 				p_context->pcd_namespace_count = -1;
 				p_context->p_pcd_namespaces = NULL;
-				p_context->nfit_size = -1;
 				p_context->p_nfit = NULL;
+				p_context->fw_result_count = 0;
+				p_context->p_fw_results = NULL;
+				p_context->fw_result_generation = 0;
+				// the TTLs only change when the config DB is edited, read them once
+				p_context->fw_static_ttl = read_fw_result_ttl(
+						SQL_KEY_FW_STATIC_CACHE_TTL_SECONDS,
+						FW_STATIC_CACHE_TTL_SECONDS_DEFAULT);
+				p_context->fw_setting_ttl = read_fw_result_ttl(
+						SQL_KEY_FW_SETTING_CACHE_TTL_SECONDS,
+						FW_SETTING_CACHE_TTL_SECONDS_DEFAULT);
+				p_context->lsa_count = 0;
+				p_context->p_lsas = NULL;
 			}
 		}
 
@@ -151,16 +189,39 @@ void free_device_list()
 void free_pool_list()
 {
 	COMMON_LOG_ENTRY();
-	// clean up the device list
-	if (p_context && p_context->pool_count > 0 && p_context->p_pools)
+	// clean up the pool list
+	if (p_context)
 	{
-		free(p_context->p_pools);
-		p_context->p_pools = NULL;
+		if (p_context->p_pools)
+		{
+			free(p_context->p_pools);
+			p_context->p_pools = NULL;
+		}
 		p_context->pool_count = -1;
 	}
 	COMMON_LOG_EXIT();
 }
 
+/*
+ * Helper function to mark inputs to the pool model stale, which also drops the pools
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+void mark_pool_data_stale(const NVM_UINT32 stale_data)
+{
+	COMMON_LOG_ENTRY();
+	if (p_context)
+	{
+		p_context->pool_data_stale |= stale_data;
+		if (stale_data == POOL_DATA_ALL && p_context->p_pool_data)
+		{
+			free_pool_data(p_context->p_pool_data);
+			p_context->p_pool_data = NULL;
+		}
+		free_pool_list();
+	}
+	COMMON_LOG_EXIT();
+}
+
 /*
  * Helper function to free the entire namespace list
  * NOTE: This function assumes the caller has obtained the lock
@@ -215,11 +276,50 @@ void free_nfit()
 {
 	COMMON_LOG_ENTRY();
 	// clean up the device list
-	if (p_context && p_context->nfit_size > 0 && p_context->p_nfit)
+	if (p_context && p_context->p_nfit)
 	{
 		free_parsed_nfit(p_context->p_nfit);
 		p_context->p_nfit = NULL;
-		p_context->nfit_size = -1;
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Helper function to free the cached firmware results
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+void free_fw_results()
+{
+	COMMON_LOG_ENTRY();
+	if (p_context && p_context->p_fw_results)
+	{
+		for (int i = 0; i < p_context->fw_result_count; i++)
+		{
+			free(p_context->p_fw_results[i].p_payload);
+		}
+		free(p_context->p_fw_results);
+		p_context->p_fw_results = NULL;
+		p_context->fw_result_count = 0;
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Helper function to free the cached namespace label storage areas
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+void free_device_lsas()
+{
+	COMMON_LOG_ENTRY();
+	if (p_context && p_context->p_lsas)
+	{
+		for (int i = 0; i < p_context->lsa_count; i++)
+		{
+			free(p_context->p_lsas[i].p_lsa);
+		}
+		free(p_context->p_lsas);
+		p_context->p_lsas = NULL;
+		p_context->lsa_count = 0;
 	}
 	COMMON_LOG_EXIT();
 }
@@ -256,10 +356,12 @@ int nvm_free_context(const NVM_BOOL force)
 				}
 
 				free_device_list();
-				free_pool_list();
+				mark_pool_data_stale(POOL_DATA_ALL);
 				free_namespace_list();
 				free_pcd_namespace_list();
 				free_nfit();
+				free_fw_results();
+				free_device_lsas();
 
 				// clean up pointer
 				free(p_context);
@@ -278,6 +380,35 @@ int nvm_free_context(const NVM_BOOL force)
 	return rc;
 }
 
+/*
+ * Drop the parts of the context that a periodic sample must observe fresh: the devices
+ * with their details and PCDs, the namespaces and the pool model. The capabilities,
+ * NFIT, label areas and firmware results stay, they are static or expire themselves.
+ */
+void invalidate_sampled_data()
+{
+	COMMON_LOG_ENTRY();
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+	}
+	else
+	{
+		free_device_list();
+		free_namespace_list();
+		free_pcd_namespace_list();
+		mark_pool_data_stale(POOL_DATA_ALL);
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+		}
+	}
+	COMMON_LOG_EXIT();
+}
+
 int get_nvm_context_capabilities(struct nvm_capabilities *p_capabilities)
 {
 	COMMON_LOG_ENTRY();
@@ -469,6 +600,7 @@ int set_nvm_context_devices(const struct device_discovery *p_devices, const int
 					p_context->p_devices[i].p_device_details = NULL;
 					p_context->p_devices[i].p_pcd = NULL;
 					p_context->p_devices[i].pcd_size = -1;
+					p_context->p_devices[i].pcd_verified = 0;
 					p_context->p_devices[i].p_device_discovery =
 							calloc(1, sizeof (struct device_discovery));
 					if (!p_context->p_devices[i].p_device_discovery)
@@ -513,6 +645,8 @@ void invalidate_devices()
 	else
 	{
 		free_device_list();
+		// pool health follows the state of the DIMMs
+		mark_pool_data_stale(POOL_DATA_ALL);
 
 		// unlock
 		if (!mutex_unlock(&g_context_lock))
@@ -524,7 +658,7 @@ void invalidate_devices()
 }
 
 /*
- * Clear the pcd from a specific device
+ * Mark the pcd of a specific device as possibly changed
  */
 void invalidate_device_pcd(const NVM_UID device_uid)
 {
@@ -542,13 +676,8 @@ void invalidate_device_pcd(const NVM_UID device_uid)
 			{
 				if (uid_cmp(device_uid, p_context->p_devices[i].uid))
 				{
-					// found it
-					if (p_context->p_devices[i].p_pcd)
-					{
-						free(p_context->p_devices[i].p_pcd);
-						p_context->p_devices[i].p_pcd = NULL;
-						p_context->p_devices[i].pcd_size = -1;
-					}
+					// found it, keep the copy so a later read only has to verify it
+					p_context->p_devices[i].pcd_verified = 0;
 					break;
 				}
 			}
@@ -667,7 +796,7 @@ int set_nvm_context_device_details(const NVM_UID device_uid,
 }
 
 int get_nvm_context_device_pcd(const NVM_UID device_uid,
-		struct platform_config_data **pp_pcd, NVM_SIZE *p_pcd_size)
+		struct platform_config_data **pp_pcd, NVM_SIZE *p_pcd_size, NVM_BOOL *p_verified)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_ERR_CONTEXT;
@@ -701,6 +830,7 @@ int get_nvm_context_device_pcd(const NVM_UID device_uid,
 							memmove(*pp_pcd, p_context->p_devices[i].p_pcd,
 									p_context->p_devices[i].pcd_size);
 							*p_pcd_size = p_context->p_devices[i].pcd_size;
+							*p_verified = p_context->p_devices[i].pcd_verified;
 							rc = NVM_SUCCESS;
 						}
 					}
@@ -760,6 +890,7 @@ int set_nvm_context_device_pcd(const NVM_UID device_uid,
 					{
 						// success, do the copy
 						p_context->p_devices[i].pcd_size = pcd_size;
+						p_context->p_devices[i].pcd_verified = 1;
 						memmove(p_context->p_devices[i].p_pcd, p_pcd, pcd_size);
 						rc = NVM_SUCCESS;
 					}
@@ -789,7 +920,7 @@ void invalidate_pools()
 	}
 	else
 	{
-		free_pool_list();
+		mark_pool_data_stale(POOL_DATA_ALL);
 
 		// unlock
 		if (!mutex_unlock(&g_context_lock))
@@ -842,7 +973,7 @@ int get_nvm_context_pools(struct pool *p_pools, const int pool_count)
 	}
 	else
 	{
-		if (p_context && p_context->pool_count > 0 && p_context->p_pools)
+		if (p_context && p_context->pool_count >= 0)
 		{
 			int copy_count = pool_count;
 			rc = pool_count;
@@ -855,8 +986,11 @@ int get_nvm_context_pools(struct pool *p_pools, const int pool_count)
 			{
 				rc = NVM_ERR_ARRAYTOOSMALL;
 			}
-			memset(p_pools, 0, (copy_count * sizeof (struct pool)));
-			memmove(p_pools, p_context->p_pools, (copy_count * sizeof (struct pool)));
+			if (copy_count > 0)
+			{
+				memset(p_pools, 0, (copy_count * sizeof (struct pool)));
+				memmove(p_pools, p_context->p_pools, (copy_count * sizeof (struct pool)));
+			}
 		}
 
 		// unlock
@@ -890,7 +1024,7 @@ int set_nvm_context_pools(const struct pool *p_pools, const int pool_count)
 
 			// create new list
 			p_context->p_pools = calloc(pool_count, sizeof (struct pool));
-			if (!p_context->p_pools)
+			if (pool_count > 0 && !p_context->p_pools)
 			{
 				COMMON_LOG_ERROR("Failed to allocate memory for pool list");
 				rc = NVM_ERR_NOMEMORY;
@@ -928,8 +1062,10 @@ int get_nvm_context_pool(const NVM_UID pool_uid, struct pool *p_pool)
 	}
 	else
 	{
-		if (p_context && p_context->pool_count > 0 && p_context->p_pools)
+		if (p_context && p_context->pool_count >= 0)
 		{
+			// the pool list is complete so a pool that isn't in it doesn't exist
+			rc = NVM_ERR_BADPOOL;
 			for (int i = 0; i < p_context->pool_count; i++)
 			{
 				if (uid_cmp(pool_uid, p_context->p_pools[i].pool_uid))
@@ -954,6 +1090,130 @@ int get_nvm_context_pool(const NVM_UID pool_uid, struct pool *p_pool)
 	return rc;
 }
 
+/*
+ * Drop the pools and mark inputs to the pool model stale so only they are collected again
+ * when the pools are next rebuilt
+ */
+void invalidate_pool_data(const NVM_UINT32 stale_data)
+{
+	COMMON_LOG_ENTRY();
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+	}
+	else
+	{
+		mark_pool_data_stale(stale_data);
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+		}
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Take the pool data out of the context to rebuild the pools from, along with the inputs
+ * that are stale. The caller owns the pool data (which may be NULL) until it is handed
+ * back with set_nvm_context_pool_model.
+ */
+int take_nvm_context_pool_data(struct pool_data **pp_pool_data, NVM_UINT32 *p_stale_data)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+		rc = NVM_ERR_CONTEXT;
+	}
+	else
+	{
+		if (p_context)
+		{
+			*pp_pool_data = p_context->p_pool_data;
+			*p_stale_data = p_context->pool_data_stale;
+			p_context->p_pool_data = NULL;
+			p_context->pool_data_stale = 0;
+			rc = NVM_SUCCESS;
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Hand back the pool data along with the pools built from it. The context takes ownership
+ * of the pool data. The pools are only kept if nothing was invalidated while they were built.
+ */
+int set_nvm_context_pool_model(struct pool_data *p_pool_data,
+		const struct pool *p_pools, const int pool_count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+		free_pool_data(p_pool_data);
+		rc = NVM_ERR_CONTEXT;
+	}
+	else
+	{
+		if (!p_context || p_context->pool_data_stale == POOL_DATA_ALL)
+		{
+			free_pool_data(p_pool_data);
+		}
+		else
+		{
+			// keep the newest pool data if the pools were rebuilt concurrently
+			free_pool_data(p_context->p_pool_data);
+			p_context->p_pool_data = p_pool_data;
+			rc = NVM_SUCCESS;
+
+			if (!p_context->pool_data_stale)
+			{
+				free_pool_list();
+				p_context->p_pools = calloc(pool_count, sizeof (struct pool));
+				if (pool_count > 0 && !p_context->p_pools)
+				{
+					COMMON_LOG_ERROR("Failed to allocate memory for pool list");
+					rc = NVM_ERR_NOMEMORY;
+				}
+				else
+				{
+					p_context->pool_count = pool_count;
+					if (pool_count > 0)
+					{
+						memmove(p_context->p_pools, p_pools, pool_count * sizeof (struct pool));
+					}
+				}
+			}
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 void invalidate_namespaces()
 {
 	COMMON_LOG_ENTRY();
@@ -966,6 +1226,8 @@ void invalidate_namespaces()
 	{
 		free_namespace_list();
 		free_pcd_namespace_list();
+		// pool free capacity depends on the namespaces
+		mark_pool_data_stale(POOL_DATA_NAMESPACES);
 
 		// unlock
 		if (!mutex_unlock(&g_context_lock))
@@ -1376,7 +1638,10 @@ int set_nvm_context_pcd_namespaces(const int pcd_nscount,
 
 
 // NFIT
-int get_nvm_context_nfit_size()
+/*
+ * Copy the cached NFIT, the caller is responsible for freeing the copy
+ */
+int get_nvm_context_nfit(struct parsed_nfit **pp_nfit)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_ERR_CONTEXT;
@@ -1389,9 +1654,19 @@ int get_nvm_context_nfit_size()
 	}
 	else
 	{
-		if (p_context && p_context->nfit_size >= 0)
+		if (p_context && p_context->p_nfit)
 		{
-			rc = p_context->nfit_size;
+			// the lists live in the same allocation, the copy points into its own
+			*pp_nfit = nfit_copy_parsed_nfit(p_context->p_nfit);
+			if (!(*pp_nfit))
+			{
+				COMMON_LOG_ERROR("Not enough memory to copy the NFIT");
+				rc = NVM_ERR_NOMEMORY;
+			}
+			else
+			{
+				rc = NVM_SUCCESS;
+			}
 		}
 
 		// unlock
@@ -1405,12 +1680,15 @@ int get_nvm_context_nfit_size()
 	return rc;
 }
 
-int get_nvm_context_nfit(int nfit_size, struct parsed_nfit *p_nfit)
+/*
+ * Store a copy of the parsed NFIT
+ */
+int set_nvm_context_nfit(const struct parsed_nfit *p_nfit)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_ERR_CONTEXT;
 
-	if (nfit_size && p_nfit)
+	if (p_nfit)
 	{
 		// lock
 		if (!mutex_lock(&g_context_lock))
@@ -1420,15 +1698,22 @@ int get_nvm_context_nfit(int nfit_size, struct parsed_nfit *p_nfit)
 		}
 		else
 		{
-			if (p_context && p_context->nfit_size > 0 && p_context->p_nfit)
+			if (p_context)
 			{
-				if (nfit_size >= p_context->nfit_size)
+				// clean up nfit
+				free_nfit();
+
+				p_context->p_nfit = nfit_copy_parsed_nfit(p_nfit);
+				if (!p_context->p_nfit)
+				{
+					COMMON_LOG_ERROR("Failed to allocate memory for context structure");
+					rc = NVM_ERR_NOMEMORY;
+				}
+				else
 				{
-					memmove(p_nfit, p_context->p_nfit, p_context->nfit_size);
 					rc = NVM_SUCCESS;
 				}
 			}
-
 			// unlock
 			if (!mutex_unlock(&g_context_lock))
 			{
@@ -1441,12 +1726,260 @@ int get_nvm_context_nfit(int nfit_size, struct parsed_nfit *p_nfit)
 	return rc;
 }
 
-int set_nvm_context_nfit(int nfit_size, const struct parsed_nfit *p_nfit)
+/*
+ * Helper function to remove the cached firmware results for a device that match
+ * the opcode and, optionally, the sub-opcode
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+void remove_fw_results(const NVM_UINT32 device_handle, const NVM_BOOL match_opcode,
+		const unsigned char opcode, const NVM_BOOL match_sub_opcode,
+		const unsigned char sub_opcode)
+{
+	COMMON_LOG_ENTRY();
+	if (p_context)
+	{
+		int i = 0;
+		while (i < p_context->fw_result_count)
+		{
+			struct nvm_fw_result_context *p_result = &p_context->p_fw_results[i];
+			if (p_result->device_handle == device_handle &&
+					(!match_opcode || p_result->opcode == opcode) &&
+					(!match_sub_opcode || p_result->sub_opcode == sub_opcode))
+			{
+				// order doesn't matter, move the last entry into the hole
+				free(p_result->p_payload);
+				p_context->fw_result_count--;
+				*p_result = p_context->p_fw_results[p_context->fw_result_count];
+			}
+			else
+			{
+				i++;
+			}
+		}
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Helper function to find the namespace label storage area entry of a device
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+static struct nvm_lsa_context *find_device_lsa(const NVM_UINT32 device_handle)
+{
+	struct nvm_lsa_context *p_entry = NULL;
+	if (p_context)
+	{
+		for (int i = 0; i < p_context->lsa_count; i++)
+		{
+			if (p_context->p_lsas[i].device_handle == device_handle)
+			{
+				p_entry = &p_context->p_lsas[i];
+				break;
+			}
+		}
+	}
+	return p_entry;
+}
+
+/*
+ * Helper function to remove the cached namespace label storage area of a device.
+ * The entry is kept so its generation still rejects reads started before now.
+ * NOTE: This function assumes the caller has obtained the lock
+ */
+void remove_device_lsa(const NVM_UINT32 device_handle)
+{
+	COMMON_LOG_ENTRY();
+	struct nvm_lsa_context *p_entry = find_device_lsa(device_handle);
+	if (p_entry)
+	{
+		free(p_entry->p_lsa);
+		p_entry->p_lsa = NULL;
+		p_entry->lsa_size = 0;
+		p_entry->generation++;
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Clear all cached firmware results for a specific device
+ */
+void invalidate_device_fw_results(const NVM_UINT32 device_handle)
+{
+	COMMON_LOG_ENTRY();
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+	}
+	else
+	{
+		if (p_context)
+		{
+			// results read from the FW before now must not be stored afterwards
+			p_context->fw_result_generation++;
+			remove_fw_results(device_handle, 0, 0, 0, 0);
+			remove_device_lsa(device_handle);
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+		}
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Clear the cached firmware results that a command sent to a device may have changed.
+ * Read-only commands leave the cache untouched, a set command only clears the results
+ * of its matching get command and anything else clears everything for the device.
+ */
+void invalidate_fw_results_for_cmd(const unsigned int device_handle,
+		const unsigned char opcode, const unsigned char sub_opcode)
+{
+	COMMON_LOG_ENTRY();
+
+	NVM_BOOL match_opcode = 0;
+	unsigned char get_opcode = 0;
+	NVM_BOOL match_sub_opcode = 0;
+	NVM_BOOL read_only = 0;
+	switch (opcode)
+	{
+		case PT_NULL_COMMAND:
+		case PT_IDENTIFY_DIMM:
+		case PT_GET_SEC_INFO:
+		case PT_GET_FEATURES:
+		case PT_GET_ADMIN_FEATURES:
+		case PT_GET_LOG:
+		case PT_GET_DBG_FEATURES:
+			read_only = 1;
+			break;
+		case PT_SET_SEC_INFO:
+			// security sub-opcodes don't line up between get and set
+			match_opcode = 1;
+			get_opcode = PT_GET_SEC_INFO;
+			break;
+		case PT_SET_FEATURES:
+			match_opcode = 1;
+			get_opcode = PT_GET_FEATURES;
+			match_sub_opcode = 1;
+			break;
+		case PT_SET_ADMIN_FEATURES:
+			match_opcode = 1;
+			get_opcode = PT_GET_ADMIN_FEATURES;
+			match_sub_opcode = 1;
+			break;
+		case PT_SET_DBG_FEATURES:
+			match_opcode = 1;
+			get_opcode = PT_GET_DBG_FEATURES;
+			match_sub_opcode = 1;
+			break;
+		default:
+			// FW update, error injection, format and other vendor specific commands
+			break;
+	}
+
+	// read-only commands are the common case, don't take the lock for them
+	if (!read_only)
+	{
+		// lock
+		if (!mutex_lock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not obtain the context lock");
+		}
+		else
+		{
+			if (p_context)
+			{
+				// results read from the FW before now must not be stored afterwards
+				p_context->fw_result_generation++;
+				remove_fw_results(device_handle, match_opcode, get_opcode,
+						match_sub_opcode, sub_opcode);
+				// the labels live in a platform config data partition
+				if (!match_opcode || (get_opcode == PT_GET_ADMIN_FEATURES &&
+						sub_opcode == SUBOP_PLATFORM_DATA_INFO))
+				{
+					remove_device_lsa(device_handle);
+				}
+			}
+
+			// unlock
+			if (!mutex_unlock(&g_context_lock))
+			{
+				COMMON_LOG_ERROR("Could not release the context lock.");
+			}
+		}
+	}
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Copy a cached firmware result that has not expired. On a miss the current
+ * generation is returned so the caller can store the result it reads from the FW.
+ */
+int get_nvm_context_fw_result(const NVM_UINT32 device_handle,
+		const unsigned char opcode, const unsigned char sub_opcode,
+		void *p_payload, const size_t payload_size, NVM_UINT32 *p_generation)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+		rc = NVM_ERR_CONTEXT;
+	}
+	else
+	{
+		if (p_context)
+		{
+			*p_generation = p_context->fw_result_generation;
+
+			time_t now = time(NULL);
+			for (int i = 0; i < p_context->fw_result_count; i++)
+			{
+				struct nvm_fw_result_context *p_result = &p_context->p_fw_results[i];
+				if (p_result->device_handle == device_handle &&
+						p_result->opcode == opcode &&
+						p_result->sub_opcode == sub_opcode)
+				{
+					if (p_result->payload_size == payload_size &&
+							p_result->expiration > now)
+					{
+						memmove(p_payload, p_result->p_payload, payload_size);
+						rc = NVM_SUCCESS;
+					}
+					break;
+				}
+			}
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Store the result of a read-only firmware command. The result is dropped if the
+ * cache was invalidated since the generation was obtained from get_nvm_context_fw_result.
+ */
+int set_nvm_context_fw_result(const NVM_UINT32 device_handle,
+		const unsigned char opcode, const unsigned char sub_opcode,
+		const void *p_payload, const size_t payload_size,
+		const enum fw_result_lifetime lifetime, const NVM_UINT32 generation)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_ERR_CONTEXT;
 
-	if (nfit_size && p_nfit)
+	if (p_payload && payload_size)
 	{
 		// lock
 		if (!mutex_lock(&g_context_lock))
@@ -1456,25 +1989,47 @@ int set_nvm_context_nfit(int nfit_size, const struct parsed_nfit *p_nfit)
 		}
 		else
 		{
+			// a time to live of 0 disables caching
+			int ttl = 0;
 			if (p_context)
 			{
-				// clean up nfit
-				free_nfit();
+				ttl = (lifetime == FW_RESULT_LIFETIME_STATIC) ?
+						p_context->fw_static_ttl : p_context->fw_setting_ttl;
+			}
+			if (ttl > 0 && p_context->fw_result_generation == generation)
+			{
+				// drop any stale copy first
+				remove_fw_results(device_handle, 1, opcode, 1, sub_opcode);
 
-				// create new list
-				p_context->p_nfit = calloc(1, nfit_size);
-				if (!p_context->p_nfit)
+				void *p_copy = malloc(payload_size);
+				struct nvm_fw_result_context *p_results = realloc(p_context->p_fw_results,
+						(p_context->fw_result_count + 1) * sizeof (struct nvm_fw_result_context));
+				if (!p_copy || !p_results)
 				{
 					COMMON_LOG_ERROR("Failed to allocate memory for context structure");
+					free(p_copy);
+					if (p_results)
+					{
+						p_context->p_fw_results = p_results;
+					}
 					rc = NVM_ERR_NOMEMORY;
 				}
 				else
 				{
-					p_context->nfit_size = nfit_size;
-					memmove(p_context->p_nfit, p_nfit, nfit_size);
+					memmove(p_copy, p_payload, payload_size);
+					p_context->p_fw_results = p_results;
+					struct nvm_fw_result_context *p_result =
+							&p_results[p_context->fw_result_count++];
+					p_result->device_handle = device_handle;
+					p_result->opcode = opcode;
+					p_result->sub_opcode = sub_opcode;
+					p_result->expiration = time(NULL) + ttl;
+					p_result->payload_size = payload_size;
+					p_result->p_payload = p_copy;
 					rc = NVM_SUCCESS;
 				}
 			}
+
 			// unlock
 			if (!mutex_unlock(&g_context_lock))
 			{
@@ -1486,3 +2041,116 @@ int set_nvm_context_nfit(int nfit_size, const struct parsed_nfit *p_nfit)
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
+
+/*
+ * Copy the cached namespace label storage area of a device. The caller must check
+ * that it is still current. On a miss the current generation is returned so the
+ * caller can store the area it reads from the FW.
+ */
+int get_nvm_context_device_lsa(const NVM_UINT32 device_handle,
+		void *p_lsa, const size_t lsa_size, NVM_UINT32 *p_generation)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+		rc = NVM_ERR_CONTEXT;
+	}
+	else
+	{
+		if (p_context)
+		{
+			struct nvm_lsa_context *p_entry = find_device_lsa(device_handle);
+			if (!p_entry)
+			{
+				// track the device from now on so an invalidation rejects this read
+				struct nvm_lsa_context *p_lsas = realloc(p_context->p_lsas,
+						(p_context->lsa_count + 1) * sizeof (struct nvm_lsa_context));
+				if (!p_lsas)
+				{
+					COMMON_LOG_ERROR("Failed to allocate memory for context structure");
+					rc = NVM_ERR_NOMEMORY;
+				}
+				else
+				{
+					p_context->p_lsas = p_lsas;
+					p_entry = &p_lsas[p_context->lsa_count++];
+					memset(p_entry, 0, sizeof (*p_entry));
+					p_entry->device_handle = device_handle;
+				}
+			}
+
+			if (p_entry)
+			{
+				*p_generation = p_entry->generation;
+				if (p_entry->p_lsa && p_entry->lsa_size == lsa_size)
+				{
+					memmove(p_lsa, p_entry->p_lsa, lsa_size);
+					rc = NVM_SUCCESS;
+				}
+			}
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Store the namespace label storage area read from a device. It is dropped if the
+ * device's area was invalidated since the generation was obtained from
+ * get_nvm_context_device_lsa.
+ */
+int set_nvm_context_device_lsa(const NVM_UINT32 device_handle,
+		const void *p_lsa, const size_t lsa_size, const NVM_UINT32 generation)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_CONTEXT;
+
+	// lock
+	if (!mutex_lock(&g_context_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the context lock");
+		rc = NVM_ERR_CONTEXT;
+	}
+	else
+	{
+		// the entry is created by get_nvm_context_device_lsa
+		struct nvm_lsa_context *p_entry = find_device_lsa(device_handle);
+		if (p_entry && p_entry->generation == generation)
+		{
+			void *p_copy = malloc(lsa_size);
+			if (!p_copy)
+			{
+				COMMON_LOG_ERROR("Failed to allocate memory for context structure");
+				rc = NVM_ERR_NOMEMORY;
+			}
+			else
+			{
+				memmove(p_copy, p_lsa, lsa_size);
+				free(p_entry->p_lsa);
+				p_entry->lsa_size = lsa_size;
+				p_entry->p_lsa = p_copy;
+				rc = NVM_SUCCESS;
+			}
+		}
+
+		// unlock
+		if (!mutex_unlock(&g_context_lock))
+		{
+			COMMON_LOG_ERROR("Could not release the context lock.");
+			rc = NVM_ERR_CONTEXT;
+		}
+	}
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
@@ -36,6 +36,7 @@
 #include "adapter_types.h"
 #include <acpi/nfit_tables.h>
 #include "export_api.h"
+#include <time.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -52,6 +53,8 @@ struct nvm_device_context
 	struct device_details *p_device_details;
 	NVM_SIZE pcd_size;
 	struct platform_config_data *p_pcd;
+	// cleared when the pcd is invalidated, the copy is checked against the DIMM before reuse
+	NVM_BOOL pcd_verified;
 };
 
 /*
@@ -64,6 +67,50 @@ struct nvm_namespace_context
 	struct namespace_details *p_namespace_details;
 };
 
+/*
+ * How long a cached firmware result may be served before it is re-read
+ */
+enum fw_result_lifetime
+{
+	FW_RESULT_LIFETIME_STATIC = 0, // only changes across a reset or FW update
+	FW_RESULT_LIFETIME_SETTING = 1 // a setting that another process may change
+};
+
+/*
+ * The cached output payload of a read-only firmware command
+ */
+struct nvm_fw_result_context
+{
+	NVM_UINT32 device_handle;
+	unsigned char opcode;
+	unsigned char sub_opcode;
+	time_t expiration;
+	size_t payload_size;
+	void *p_payload;
+};
+
+/*
+ * The cached namespace label storage area of an NVM-DIMM
+ */
+struct nvm_lsa_context
+{
+	NVM_UINT32 device_handle;
+	// bumped when the device's area is invalidated, p_lsa is NULL until it is read again
+	NVM_UINT32 generation;
+	size_t lsa_size;
+	void *p_lsa;
+};
+
+/*
+ * Inputs to the pool model that are invalidated separately, see invalidate_pool_data
+ */
+#define	POOL_DATA_NAMESPACES	0x1
+#define	POOL_DATA_GOALS	0x2
+#define	POOL_DATA_ALL	0xFFFFFFFF
+
+// the data the pools are built from, defined in pool.c
+struct pool_data;
+
 /*
  * Overall system context
  */
@@ -74,6 +121,9 @@ struct nvm_context
 	struct nvm_device_context *p_devices;
 	int pool_count;
 	struct pool *p_pools;
+	// the pool model, only the stale inputs are collected again when the pools are rebuilt
+	struct pool_data *p_pool_data;
+	NVM_UINT32 pool_data_stale;
 	int namespace_count;
 	struct nvm_namespace_context *p_namespaces;
 
@@ -82,12 +132,25 @@ struct nvm_context
 	struct nvm_namespace_details *p_pcd_namespaces;
 
 	// avoid unnecessary calls to retrieve ACPI tables
-	int nfit_size;
 	struct parsed_nfit *p_nfit;
+
+	// avoid unnecessary mailbox calls for read-mostly firmware data
+	int fw_result_count;
+	struct nvm_fw_result_context *p_fw_results;
+	NVM_UINT32 fw_result_generation;
+	int fw_static_ttl;
+	int fw_setting_ttl;
+
+	// avoid re-reading namespace labels that haven't changed
+	int lsa_count;
+	struct nvm_lsa_context *p_lsas;
 };
 
 NVM_API extern struct nvm_context *p_context;
 
+// keep a long-lived context between periodic samples
+NVM_API void invalidate_sampled_data();
+
 // capabilities
 NVM_API int get_nvm_context_capabilities(struct nvm_capabilities *p_capabilities);
 NVM_API int set_nvm_context_capabilities(const struct nvm_capabilities *p_capabilities);
@@ -103,7 +166,7 @@ NVM_API int get_nvm_context_device_details(const NVM_UID device_uid,
 NVM_API int set_nvm_context_device_details(const NVM_UID device_uid,
 		const struct device_details *p_details);
 NVM_API int get_nvm_context_device_pcd(const NVM_UID device_uid,
-		struct platform_config_data **pp_pcd, NVM_SIZE *p_pcd_size);
+		struct platform_config_data **pp_pcd, NVM_SIZE *p_pcd_size, NVM_BOOL *p_verified);
 NVM_API int set_nvm_context_device_pcd(const NVM_UID device_uid,
 		const struct platform_config_data *p_pcd, const NVM_SIZE pcd_size);
 
@@ -113,6 +176,10 @@ NVM_API int get_nvm_context_pool_count();
 NVM_API int get_nvm_context_pools(struct pool *p_pools, const int pool_count);
 NVM_API int set_nvm_context_pools(const struct pool *p_pools, const int pool_count);
 NVM_API int get_nvm_context_pool(const NVM_UID pool_uid, struct pool *p_pool);
+NVM_API void invalidate_pool_data(const NVM_UINT32 stale_data);
+NVM_API int take_nvm_context_pool_data(struct pool_data **pp_pool_data, NVM_UINT32 *p_stale_data);
+NVM_API int set_nvm_context_pool_model(struct pool_data *p_pool_data,
+		const struct pool *p_pools, const int pool_count);
 
 // namespaces
 NVM_API void invalidate_namespaces();
@@ -135,9 +202,26 @@ NVM_API int set_nvm_context_pcd_namespaces(const int pcd_nscount,
 	const struct nvm_namespace_details *p_pcd_nslist);
 
 // NFIT
-NVM_API int get_nvm_context_nfit_size();
-NVM_API int get_nvm_context_nfit(int nfit_size, struct parsed_nfit *p_nfit);
-NVM_API int set_nvm_context_nfit(int nfit_size, const struct parsed_nfit *p_nfit);
+NVM_API int get_nvm_context_nfit(struct parsed_nfit **pp_nfit);
+NVM_API int set_nvm_context_nfit(const struct parsed_nfit *p_nfit);
+
+// firmware results
+NVM_API void invalidate_device_fw_results(const NVM_UINT32 device_handle);
+NVM_API void invalidate_fw_results_for_cmd(const unsigned int device_handle,
+		const unsigned char opcode, const unsigned char sub_opcode);
+NVM_API int get_nvm_context_fw_result(const NVM_UINT32 device_handle,
+		const unsigned char opcode, const unsigned char sub_opcode,
+		void *p_payload, const size_t payload_size, NVM_UINT32 *p_generation);
+NVM_API int set_nvm_context_fw_result(const NVM_UINT32 device_handle,
+		const unsigned char opcode, const unsigned char sub_opcode,
+		const void *p_payload, const size_t payload_size,
+		const enum fw_result_lifetime lifetime, const NVM_UINT32 generation);
+
+// namespace label storage areas
+NVM_API int get_nvm_context_device_lsa(const NVM_UINT32 device_handle,
+		void *p_lsa, const size_t lsa_size, NVM_UINT32 *p_generation);
+NVM_API int set_nvm_context_device_lsa(const NVM_UINT32 device_handle,
+		const void *p_lsa, const size_t lsa_size, const NVM_UINT32 generation);
 
 #ifdef __cplusplus
 }
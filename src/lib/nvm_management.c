@@ -36,6 +36,8 @@
 #include <persistence/lib_persistence.h>
 #include <persistence/config_settings.h>
 #include <persistence/logging.h>
+#include "smbios_utilities.h"
+#include "device_executor.h"
 
 
 #ifdef __WINDOWS__
@@ -45,10 +47,12 @@
 #define	APP_REGISTRY_ENTRY	"SOFTWARE\\Intel\\TBD"
 HANDLE g_eventmonitor_lock;
 HANDLE g_context_lock;
+HANDLE g_smbios_lock;
 #else
 #include <assert.h>
 pthread_mutex_t g_eventmonitor_lock;
 pthread_mutex_t g_context_lock;
+pthread_mutex_t g_smbios_lock;
 #endif
 
 /*
@@ -157,6 +161,12 @@ int nvm_open_lib()
 		{
 			rc = NVM_ERR_UNKNOWN;
 		}
+
+		// initialize the lock on the cached SMBIOS table
+		if (!mutex_init((OS_MUTEX*)&g_smbios_lock, NULL))
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
 	}
 	return rc;
 }
@@ -173,6 +183,9 @@ int nvm_close_lib()
 	// not be a simulator loaded
 	nvm_remove_simulator();
 
+	// the executor's workers run library code, stop them before it goes away
+	stop_device_executor();
+
 	// close the database
 	if (close_lib_store() != COMMON_SUCCESS)
 	{
@@ -187,6 +200,11 @@ int nvm_close_lib()
 	{
 		rc = NVM_ERR_UNKNOWN;
 	}
+	free_smbios_table_cache();
+	if (!mutex_delete((OS_MUTEX*)&g_smbios_lock, NULL))
+	{
+		rc = NVM_ERR_UNKNOWN;
+	}
 
 	return rc;
 }
@@ -718,6 +718,15 @@ struct device_status
 	struct fw_error_log_sequence_numbers media_high;
 };
 
+/*
+ * The status of a single device as returned by #nvm_get_all_device_statuses
+ */
+struct device_status_entry
+{
+	NVM_UID uid; // Unique identifier of the device.
+	struct device_status status; // Status of the device.
+};
+
 /*
  * A snapshot of the performance metrics for a specific device.
  * @remarks All data is cumulative over the life the device.
@@ -736,6 +745,89 @@ struct device_performance
 	NVM_UINT64 block_writes; // Lifetime number of BW write requests the DIMM has services.
 };
 
+/*
+ * Average per-second rates between two #device_performance snapshots.
+ */
+struct device_performance_rates
+{
+	NVM_UINT64 timestamp_ms; // Monotonic time of the newer snapshot in ms.
+	NVM_UINT64 interval_ms; // Monotonic time between the snapshots, 0 if there is no older one.
+	// The counters went backwards, e.g. after a reboot or firmware activation.
+	// The rates then only count what was counted since the reset.
+	NVM_BOOL counters_reset;
+	NVM_UINT64 bytes_read_per_sec; // Bytes of data read from the DIMM per second.
+	NVM_UINT64 bytes_written_per_sec; // Bytes of data written to the DIMM per second.
+	NVM_UINT64 host_reads_per_sec; // Read requests serviced per second.
+	NVM_UINT64 host_writes_per_sec; // Write requests serviced per second.
+	NVM_UINT64 block_reads_per_sec; // BW read requests serviced per second.
+	NVM_UINT64 block_writes_per_sec; // BW write requests serviced per second.
+};
+
+/*
+ * The rates of a single device as returned by #nvm_get_device_performance_rates
+ */
+struct device_performance_rate_entry
+{
+	NVM_UID uid; // Unique identifier of the device.
+	NVM_UINT16 socket_id; // The processor socket the device is attached to.
+	// NVM_SUCCESS or the error reading the device. On an error performance holds the
+	// last good snapshot and there are no rates.
+	int status;
+	struct device_performance performance; // The newer snapshot.
+	struct device_performance_rates rates; // Rates since the older snapshot.
+};
+
+/*
+ * What a #performance_rate_aggregate sums over
+ */
+enum performance_aggregate_type
+{
+	PERFORMANCE_AGGREGATE_SOCKET = 0, // The devices on a processor socket.
+	PERFORMANCE_AGGREGATE_INTERLEAVE_SET = 1, // The devices in an interleave set.
+	PERFORMANCE_AGGREGATE_POOL = 2 // The devices in a pool.
+};
+
+/*
+ * Length in seconds of each interval of the stored performance history
+ */
+enum performance_granularity
+{
+	PERFORMANCE_GRANULARITY_SAMPLE = 0, // One interval per sample stored by the monitor.
+	PERFORMANCE_GRANULARITY_MINUTE = 60,
+	PERFORMANCE_GRANULARITY_HOUR = 3600,
+	PERFORMANCE_GRANULARITY_DAY = 86400
+};
+
+/*
+ * Average rates over one interval of the stored performance history
+ */
+struct performance_rate
+{
+	time_t start_time; // Start of the interval.
+	NVM_UINT64 seconds; // Length of the interval the counters were observed over.
+	double bytes_read_per_sec;
+	double bytes_written_per_sec;
+	double host_reads_per_sec;
+	double host_writes_per_sec;
+	double block_reads_per_sec;
+	double block_writes_per_sec;
+};
+
+/*
+ * The summed rates of a group of devices
+ */
+struct performance_rate_aggregate
+{
+	enum performance_aggregate_type type;
+	NVM_UINT32 id; // Socket identifier or interleave set driver identifier.
+	NVM_UID pool_uid; // Unique identifier of the pool, for pools only.
+	NVM_UINT16 dimm_count; // The number of devices summed.
+	// The sums of the device rates, or of their shares for a device in several
+	// interleave sets or pools. timestamp_ms and interval_ms are the latest
+	// and longest of the devices, counters_reset is set if any device was reset.
+	struct device_performance_rates rates;
+};
+
 /*
  * The threshold settings for a particular sensor
  */
@@ -1533,6 +1625,30 @@ extern NVM_API int nvm_get_device_discovery(const NVM_UID device_uid,
 extern NVM_API int nvm_get_device_status(const NVM_UID device_uid,
 		struct device_status *p_status);
 
+/*
+ * Retrieve the #device_status of every manageable device in the system.
+ * The devices are queried concurrently and shared data such as the system
+ * capabilities and device discovery is read once for the whole call.
+ * @param[in,out] p_statuses
+ * 		An array of #device_status_entry structures allocated by the caller.
+ * @param[in] count
+ * 		The size of the array. Use #nvm_get_device_count to size it.
+ * @pre The caller must have administrative privileges.
+ * @return Returns the number of manageable devices populated on success or one of
+ * 		the following @link #return_code return_codes: @endlink @n
+ * 		#NVM_ERR_NOTSUPPORTED @n
+ * 		#NVM_ERR_NOMEMORY @n
+ * 		#NVM_ERR_ARRAYTOOSMALL @n
+ *		#NVM_ERR_INVALIDPARAMETER @n
+ * 		#NVM_ERR_INVALIDPERMISSIONS @n
+ * 		#NVM_ERR_DRIVERFAILED @n
+ * 		#NVM_ERR_UNKNOWN @n
+ * 		#NVM_ERR_BADDRIVER @n
+ * 		#NVM_ERR_NOSIMULATOR (Simulated builds only)
+ */
+extern NVM_API int nvm_get_all_device_statuses(struct device_status_entry *p_statuses,
+		const NVM_UINT8 count);
+
 /*
  * Retrieve #device_settings information about the device specified.
  * @param[in] device_uid
@@ -1645,6 +1761,95 @@ extern NVM_API int nvm_get_device_details(const NVM_UID device_uid,
 extern NVM_API int nvm_get_device_performance(const NVM_UID device_uid,
 		struct device_performance *p_performance);
 
+/*
+ * Read the performance counters of every manageable device and compute the
+ * rates since the snapshots in p_entries, handling counter wraps and resets.
+ * The devices are read concurrently.
+ * @param[in,out] p_entries
+ * 		An array of #device_performance_rate_entry structures allocated by the caller.
+ * 		Zero it before the first call and pass it back unchanged on the next one;
+ * 		each caller's array is its own sampling interval.
+ * @param[in] count
+ * 		The size of the array. Use #nvm_get_device_count to size it.
+ * @pre The caller must have administrative privileges.
+ * @remarks The first read of a device has an interval_ms of 0 and no rates.
+ * @remarks A device that can't be read reports the error in its status and
+ * 		doesn't fail the call.
+ * @return Returns the number of manageable devices populated on success or one of
+ * 		the following @link #return_code return_codes: @endlink @n
+ * 		#NVM_ERR_NOTSUPPORTED @n
+ * 		#NVM_ERR_NOMEMORY @n
+ * 		#NVM_ERR_ARRAYTOOSMALL @n
+ *		#NVM_ERR_INVALIDPARAMETER @n
+ * 		#NVM_ERR_INVALIDPERMISSIONS @n
+ * 		#NVM_ERR_DRIVERFAILED @n
+ * 		#NVM_ERR_UNKNOWN @n
+ * 		#NVM_ERR_BADDRIVER
+ */
+extern NVM_API int nvm_get_device_performance_rates(
+		struct device_performance_rate_entry *p_entries, const NVM_UINT16 count);
+
+/*
+ * Read the performance counters of every manageable device as
+ * #nvm_get_device_performance_rates does and sum the rates per socket,
+ * interleave set or pool.
+ * @param[in] type
+ * 		What to sum over.
+ * @param[in,out] p_entries
+ * 		The device snapshots, as for #nvm_get_device_performance_rates.
+ * @param[in] entry_count
+ * 		The size of the p_entries array.
+ * @param[in,out] p_aggregates
+ * 		An array of #performance_rate_aggregate structures allocated by the caller.
+ * @param[in] count
+ * 		The size of the array.
+ * @pre The caller must have administrative privileges.
+ * @remarks A device in more than one interleave set or pool adds to each a share
+ * 		of its rates in proportion to its capacity there, so the aggregates add up
+ * 		to the device totals. Devices that can't be read aren't counted.
+ * @return Returns the number of aggregates populated on success or one of
+ * 		the following @link #return_code return_codes: @endlink @n
+ * 		#NVM_ERR_NOTSUPPORTED @n
+ * 		#NVM_ERR_NOMEMORY @n
+ * 		#NVM_ERR_ARRAYTOOSMALL @n
+ *		#NVM_ERR_INVALIDPARAMETER @n
+ * 		#NVM_ERR_INVALIDPERMISSIONS @n
+ * 		#NVM_ERR_DRIVERFAILED @n
+ * 		#NVM_ERR_UNKNOWN @n
+ * 		#NVM_ERR_BADDRIVER
+ */
+extern NVM_API int nvm_get_performance_rate_aggregates(const enum performance_aggregate_type type,
+		struct device_performance_rate_entry *p_entries, const NVM_UINT16 entry_count,
+		struct performance_rate_aggregate *p_aggregates, const NVM_UINT16 count);
+
+/*
+ * Retrieve the rates the performance monitor stored for a device over a time range.
+ * @param[in] device_uid
+ * 		The device identifier.
+ * @param[in] granularity
+ * 		The length of each interval.
+ * @param[in] start_time
+ * 		Return the intervals that start at or after this time.
+ * @param[in] end_time
+ * 		Return the intervals that start before this time.
+ * @param[in,out] p_rates
+ * 		An array of #performance_rate structures allocated by the caller.
+ * @param[in] count
+ * 		The size of the array.
+ * @pre The caller must have administrative privileges.
+ * @remarks The intervals are returned oldest first.
+ * @return Returns the number of intervals populated on success or one of
+ * 		the following @link #return_code return_codes: @endlink @n
+ * 		#NVM_ERR_NOMEMORY @n
+ *		#NVM_ERR_INVALIDPARAMETER @n
+ * 		#NVM_ERR_INVALIDPERMISSIONS @n
+ * 		#NVM_ERR_UNKNOWN
+ */
+extern NVM_API int nvm_get_device_performance_history(const NVM_UID device_uid,
+		const enum performance_granularity granularity,
+		const time_t start_time, const time_t end_time,
+		struct performance_rate *p_rates, const NVM_UINT16 count);
+
 /*
  * Retrieve the firmware image log information from the device specified.
  * @param[in] device_uid
@@ -1708,6 +1913,61 @@ extern NVM_API int nvm_get_device_fw_image_info(const NVM_UID device_uid,
 extern NVM_API int nvm_update_device_fw(const NVM_UID device_uid,
 		const NVM_PATH path, const NVM_SIZE path_len, const NVM_BOOL force);
 
+/*
+ * Stages of a FW update reported to a #fw_update_progress_callback
+ */
+enum fw_update_stage
+{
+	FW_UPDATE_STAGE_VALIDATING = 0, // the image is being checked against the device
+	FW_UPDATE_STAGE_TRANSFERRING = 1, // the image is being sent to the device
+	FW_UPDATE_STAGE_COMPLETE = 2 // the update of the device has finished
+};
+
+/*
+ * Called as the FW update of each device progresses. Calls are never concurrent but
+ * may come from different threads. result is only meaningful for
+ * #FW_UPDATE_STAGE_COMPLETE. Return 0 to cancel the update of every device that has
+ * not finished receiving the image.
+ */
+typedef NVM_BOOL (*fw_update_progress_callback)(const NVM_UID device_uid,
+		const enum fw_update_stage stage, const NVM_UINT8 percent_complete,
+		const int result, void *p_context);
+
+/*
+ * Push a new FW image to several devices at once. The image is read once and
+ * checked against every device before any of them is updated, then transferred
+ * to the devices concurrently, through the large payload mailbox when it is
+ * available.
+ * @param[in] p_device_uids
+ * 		The device identifiers.
+ * @param[in] device_count
+ * 		Number of devices in p_device_uids.
+ * @param[in] path
+ * 		Absolute file path to the new firmware image.
+ * @param[in] path_len
+ * 		String length of path, should be < #NVM_PATH_LEN.
+ * @param[in] force
+ * 		If attempting to downgrade the minor version, force must be true.
+ * @param[in] p_callback
+ * 		Optional function to report progress to and cancel through.
+ * @param[in] p_context
+ * 		Passed to p_callback.
+ * @param[out] p_results
+ * 		Optional array of device_count entries, filled with the
+ * 		@link #return_code return_code @endlink of each device once the devices
+ * 		have been validated.
+ * @pre The caller has administrative privileges.
+ * @pre The devices are manageable.
+ * @return Returns #NVM_SUCCESS if every device was updated, otherwise the error of
+ * the first device that failed, #NVM_ERR_CANCELLED for devices skipped after a
+ * cancel, or one of the return codes of #nvm_update_device_fw. If any device
+ * rejects the image, none is updated and the others report #NVM_ERR_CANCELLED.
+ */
+extern NVM_API int nvm_update_devices_fw(const NVM_UID *p_device_uids,
+		const NVM_UINT16 device_count, const NVM_PATH path, const NVM_SIZE path_len,
+		const NVM_BOOL force, fw_update_progress_callback p_callback, void *p_context,
+		int *p_results);
+
 /*
  * Examine the FW image to determine if it is valid for the device specified.
  * @param[in] device_uid
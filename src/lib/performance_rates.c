@@ -0,0 +1,623 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file contains the implementation of the performance rate sampler, which
+ * turns the cumulative device performance counters into per-second rates per
+ * device and per socket, interleave set or pool.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <uid/uid.h>
+#include <os/os_adapter.h>
+#include <time/time_utilities.h>
+
+#include "nvm_management.h"
+#include <persistence/logging.h>
+#include <persistence/lib_persistence.h>
+#include <persistence/performance_store.h>
+#include "device_utilities.h"
+#include "device_executor.h"
+#include "system.h"
+
+/*
+ * Arguments shared by the per-DIMM read tasks
+ */
+struct performance_task_arg
+{
+	struct device_performance_rate_entry *p_entries;
+};
+
+static int read_device_performance_task(void *p_arg, const int index)
+{
+	struct performance_task_arg *p_task_arg = (struct performance_task_arg *)p_arg;
+	struct device_performance_rate_entry *p_entry = &p_task_arg->p_entries[index];
+	p_entry->status = nvm_get_device_performance(p_entry->uid, &p_entry->performance);
+	get_monotonic_time_msec(&p_entry->rates.timestamp_ms);
+	return p_entry->status;
+}
+
+/*
+ * Average per-second rate of a counter that changed by delta over interval_ms
+ */
+static NVM_UINT64 per_second(const NVM_UINT64 delta, const NVM_UINT64 interval_ms)
+{
+	// split so the multiplication can't overflow
+	return interval_ms ?
+			(delta / interval_ms) * 1000 + ((delta % interval_ms) * 1000) / interval_ms : 0;
+}
+
+// a 64 bit counter only wraps from the top quarter of its range into the bottom one
+#define	COUNTER_WRAP_BELOW	(1ULL << 62)
+#define	COUNTER_WRAP_ABOVE	(3ULL << 62)
+
+/*
+ * Change of a cumulative counter. A lower reading means the counter either
+ * wrapped past 2^64, where the modular difference is the change, or was reset,
+ * so everything counted since the reset is the change.
+ */
+static NVM_UINT64 counter_delta(const NVM_UINT64 current, const NVM_UINT64 previous,
+		NVM_BOOL *p_reset)
+{
+	NVM_UINT64 delta = current - previous;
+	if (current < previous &&
+		!(previous >= COUNTER_WRAP_ABOVE && current < COUNTER_WRAP_BELOW))
+	{
+		*p_reset = 1;
+		delta = current;
+	}
+	return delta;
+}
+
+/*
+ * Compute the rates of an entry against the caller's previous snapshot of the
+ * device, if there is one
+ */
+static void update_rates(struct device_performance_rate_entry *p_entry,
+		const struct device_performance_rate_entry *p_previous)
+{
+	struct device_performance_rates *p_rates = &p_entry->rates;
+	if (p_previous && p_rates->timestamp_ms > p_previous->rates.timestamp_ms)
+	{
+		const struct device_performance *p_old = &p_previous->performance;
+		const struct device_performance *p_new = &p_entry->performance;
+		NVM_BOOL reset = 0;
+		NVM_UINT64 bytes_read = counter_delta(p_new->bytes_read, p_old->bytes_read, &reset);
+		NVM_UINT64 bytes_written =
+				counter_delta(p_new->bytes_written, p_old->bytes_written, &reset);
+		NVM_UINT64 host_reads = counter_delta(p_new->host_reads, p_old->host_reads, &reset);
+		NVM_UINT64 host_writes = counter_delta(p_new->host_writes, p_old->host_writes, &reset);
+		NVM_UINT64 block_reads = counter_delta(p_new->block_reads, p_old->block_reads, &reset);
+		NVM_UINT64 block_writes =
+				counter_delta(p_new->block_writes, p_old->block_writes, &reset);
+		if (reset)
+		{
+			// one counter going backwards means they all restarted
+			bytes_read = p_new->bytes_read;
+			bytes_written = p_new->bytes_written;
+			host_reads = p_new->host_reads;
+			host_writes = p_new->host_writes;
+			block_reads = p_new->block_reads;
+			block_writes = p_new->block_writes;
+		}
+
+		p_rates->interval_ms = p_rates->timestamp_ms - p_previous->rates.timestamp_ms;
+		p_rates->counters_reset = reset;
+		p_rates->bytes_read_per_sec = per_second(bytes_read, p_rates->interval_ms);
+		p_rates->bytes_written_per_sec = per_second(bytes_written, p_rates->interval_ms);
+		p_rates->host_reads_per_sec = per_second(host_reads, p_rates->interval_ms);
+		p_rates->host_writes_per_sec = per_second(host_writes, p_rates->interval_ms);
+		p_rates->block_reads_per_sec = per_second(block_reads, p_rates->interval_ms);
+		p_rates->block_writes_per_sec = per_second(block_writes, p_rates->interval_ms);
+	}
+}
+
+/*
+ * Find the caller's previous entry of a device. Entries without a snapshot don't count.
+ */
+static const struct device_performance_rate_entry *find_previous_entry(
+		const struct device_performance_rate_entry *p_entries, const int count,
+		const NVM_UID uid)
+{
+	const struct device_performance_rate_entry *p_previous = NULL;
+	for (int i = 0; i < count && !p_previous; i++)
+	{
+		if (p_entries[i].rates.timestamp_ms && uid_cmp(p_entries[i].uid, uid))
+		{
+			p_previous = &p_entries[i];
+		}
+	}
+	return p_previous;
+}
+
+/*
+ * Read every manageable device concurrently and compute its rates against the
+ * snapshots the caller got from the previous call, which the new entries replace.
+ * A device that can't be read keeps its previous snapshot and reports the error
+ * in its status.
+ * Returns the number of entries or an error code.
+ */
+static int collect_performance_rates(struct device_performance_rate_entry *p_entries,
+		const NVM_UINT16 count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if ((rc = nvm_get_device_count()) > 0)
+	{
+		int dev_count = rc;
+		struct device_discovery *p_devices = calloc(dev_count, sizeof (struct device_discovery));
+		struct device_performance_rate_entry *p_collected =
+				calloc(dev_count, sizeof (struct device_performance_rate_entry));
+		NVM_UINT32 *p_device_handles = calloc(dev_count, sizeof (NVM_UINT32));
+		if (!p_devices || !p_collected || !p_device_handles)
+		{
+			COMMON_LOG_ERROR("No memory to collect device performance");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else if ((rc = nvm_get_devices(p_devices, dev_count)) > 0)
+		{
+			// only manageable devices report performance
+			int manageable_count = 0;
+			for (int i = 0; i < rc; i++)
+			{
+				if (IS_DEVICE_MANAGEABLE(&p_devices[i]))
+				{
+					uid_copy(p_devices[i].uid, p_collected[manageable_count].uid);
+					p_collected[manageable_count].socket_id = p_devices[i].socket_id;
+					// overwritten by the task, unless it never runs
+					p_collected[manageable_count].status = NVM_ERR_UNKNOWN;
+					p_device_handles[manageable_count++] = p_devices[i].device_handle.handle;
+				}
+			}
+
+			if (manageable_count > count)
+			{
+				COMMON_LOG_ERROR("Invalid parameter, count is smaller than the number of devices");
+				rc = NVM_ERR_ARRAYTOOSMALL;
+			}
+			else
+			{
+				// the per-device status tells which reads failed
+				struct performance_task_arg task_arg;
+				task_arg.p_entries = p_collected;
+				run_device_tasks(p_device_handles, manageable_count,
+						read_device_performance_task, &task_arg);
+
+				for (int i = 0; i < manageable_count; i++)
+				{
+					struct device_performance_rate_entry *p_entry = &p_collected[i];
+					const struct device_performance_rate_entry *p_previous =
+							find_previous_entry(p_entries, count, p_entry->uid);
+					if (p_entry->status == NVM_SUCCESS)
+					{
+						update_rates(p_entry, p_previous);
+					}
+					else
+					{
+						// the next successful read is compared against the last good one
+						memset(&p_entry->performance, 0, sizeof (p_entry->performance));
+						memset(&p_entry->rates, 0, sizeof (p_entry->rates));
+						if (p_previous)
+						{
+							p_entry->performance = p_previous->performance;
+							p_entry->rates.timestamp_ms = p_previous->rates.timestamp_ms;
+						}
+					}
+				}
+
+				memset(p_entries, 0, sizeof (struct device_performance_rate_entry) * count);
+				memmove(p_entries, p_collected,
+						sizeof (struct device_performance_rate_entry) * manageable_count);
+				rc = manageable_count;
+			}
+		}
+		free(p_devices);
+		free(p_collected);
+		free(p_device_handles);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Read the performance counters of every manageable device and compute the rates
+ */
+int nvm_get_device_performance_rates(
+		struct device_performance_rate_entry *p_entries, const NVM_UINT16 count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (check_caller_permissions() != NVM_SUCCESS)
+	{
+		rc = NVM_ERR_INVALIDPERMISSIONS;
+	}
+	else if (!is_supported_driver_available())
+	{
+		rc = NVM_ERR_BADDRIVER;
+	}
+	else if (p_entries == NULL)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, p_entries is NULL");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		rc = collect_performance_rates(p_entries, count);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * The part of a rate that belongs to part out of total, split so the product
+ * can't overflow
+ */
+static NVM_UINT64 apportion(const NVM_UINT64 rate, const NVM_UINT64 part, const NVM_UINT64 total)
+{
+	return total ? (rate / total) * part + ((rate % total) * part) / total : rate;
+}
+
+/*
+ * Add the part out of total of the rates of a device to an aggregate. A device
+ * that couldn't be read isn't counted.
+ */
+static void add_rates(struct performance_rate_aggregate *p_aggregate,
+		const struct device_performance_rate_entry *p_entry,
+		const NVM_UINT64 part, const NVM_UINT64 total)
+{
+	if (p_entry->status == NVM_SUCCESS)
+	{
+		const struct device_performance_rates *p_rates = &p_entry->rates;
+		struct device_performance_rates *p_sum = &p_aggregate->rates;
+		p_aggregate->dimm_count++;
+		if (p_rates->timestamp_ms > p_sum->timestamp_ms)
+		{
+			p_sum->timestamp_ms = p_rates->timestamp_ms;
+		}
+		if (p_rates->interval_ms > p_sum->interval_ms)
+		{
+			p_sum->interval_ms = p_rates->interval_ms;
+		}
+		p_sum->counters_reset |= p_rates->counters_reset;
+		p_sum->bytes_read_per_sec += apportion(p_rates->bytes_read_per_sec, part, total);
+		p_sum->bytes_written_per_sec += apportion(p_rates->bytes_written_per_sec, part, total);
+		p_sum->host_reads_per_sec += apportion(p_rates->host_reads_per_sec, part, total);
+		p_sum->host_writes_per_sec += apportion(p_rates->host_writes_per_sec, part, total);
+		p_sum->block_reads_per_sec += apportion(p_rates->block_reads_per_sec, part, total);
+		p_sum->block_writes_per_sec += apportion(p_rates->block_writes_per_sec, part, total);
+	}
+}
+
+/*
+ * A device in several pools or interleave sets splits its rates between them by
+ * its capacity in each, or evenly if none of those capacities are known
+ */
+struct device_share
+{
+	NVM_UINT64 capacity; // The capacity of the device in all the groups.
+	NVM_UINT64 groups; // The number of groups the device is in.
+};
+
+/*
+ * Add the shares of the listed devices to an aggregate, or just add up the
+ * capacities in the shares if there is no aggregate
+ */
+static void add_device_list_rates(struct performance_rate_aggregate *p_aggregate,
+		const NVM_UID *p_uids, const NVM_UINT64 *p_capacities, const int uid_count,
+		const struct device_performance_rate_entry *p_entries,
+		struct device_share *p_shares, const int entry_count)
+{
+	for (int i = 0; i < uid_count; i++)
+	{
+		for (int j = 0; j < entry_count; j++)
+		{
+			if (uid_cmp(p_uids[i], p_entries[j].uid))
+			{
+				if (!p_aggregate)
+				{
+					p_shares[j].capacity += p_capacities[i];
+					p_shares[j].groups++;
+				}
+				else if (p_shares[j].capacity)
+				{
+					add_rates(p_aggregate, &p_entries[j], p_capacities[i], p_shares[j].capacity);
+				}
+				else
+				{
+					add_rates(p_aggregate, &p_entries[j], 1, p_shares[j].groups);
+				}
+				break;
+			}
+		}
+	}
+}
+
+/*
+ * The capacity an interleave set takes on each of its devices
+ */
+static NVM_UINT64 get_set_device_capacity(const struct interleave_set *p_set)
+{
+	return p_set->dimm_count ? p_set->size / p_set->dimm_count : 0;
+}
+
+/*
+ * The capacity of a device in a pool
+ */
+static NVM_UINT64 get_pool_device_capacity(const struct pool *p_pool, const int dimm)
+{
+	NVM_UINT64 capacity = 0;
+	if (p_pool->type == POOL_TYPE_VOLATILE)
+	{
+		capacity = p_pool->memory_capacities[dimm];
+	}
+	else
+	{
+		for (int s = 0; s < p_pool->ilset_count; s++)
+		{
+			const struct interleave_set *p_set = &p_pool->ilsets[s];
+			for (int d = 0; d < p_set->dimm_count; d++)
+			{
+				if (uid_cmp(p_set->dimms[d], p_pool->dimms[dimm]))
+				{
+					capacity += get_set_device_capacity(p_set);
+					break;
+				}
+			}
+		}
+	}
+	return capacity;
+}
+
+/*
+ * Sum the device rates per socket
+ */
+static int aggregate_by_socket(const struct device_performance_rate_entry *p_entries,
+		const int entry_count, struct performance_rate_aggregate *p_aggregates,
+		const NVM_UINT16 count)
+{
+	int rc = 0;
+	for (int i = 0; i < entry_count && rc >= 0; i++)
+	{
+		int index = 0;
+		while (index < rc && p_aggregates[index].id != p_entries[i].socket_id)
+		{
+			index++;
+		}
+		if (index == rc)
+		{
+			if (rc >= count)
+			{
+				rc = NVM_ERR_ARRAYTOOSMALL;
+				break;
+			}
+			p_aggregates[index].type = PERFORMANCE_AGGREGATE_SOCKET;
+			p_aggregates[index].id = p_entries[i].socket_id;
+			rc++;
+		}
+		add_rates(&p_aggregates[index], &p_entries[i], 1, 1);
+	}
+	return rc;
+}
+
+/*
+ * Sum the device shares per pool or per interleave set. Without aggregates only
+ * the capacities in the shares are added up.
+ */
+static int add_pool_rates(const enum performance_aggregate_type type,
+		const struct pool *p_pools, const int pool_count,
+		const struct device_performance_rate_entry *p_entries,
+		struct device_share *p_shares, const int entry_count,
+		struct performance_rate_aggregate *p_aggregates, const NVM_UINT16 count)
+{
+	int rc = 0;
+	NVM_UINT64 capacities[NVM_MAX_DEVICES_PER_POOL];
+	for (int p = 0; p < pool_count && rc >= 0; p++)
+	{
+		if (type == PERFORMANCE_AGGREGATE_POOL)
+		{
+			struct performance_rate_aggregate *p_aggregate = NULL;
+			if (p_aggregates)
+			{
+				if (rc >= count)
+				{
+					rc = NVM_ERR_ARRAYTOOSMALL;
+					break;
+				}
+				p_aggregate = &p_aggregates[rc];
+				p_aggregate->type = PERFORMANCE_AGGREGATE_POOL;
+				uid_copy(p_pools[p].pool_uid, p_aggregate->pool_uid);
+			}
+			for (int d = 0; d < p_pools[p].dimm_count; d++)
+			{
+				capacities[d] = get_pool_device_capacity(&p_pools[p], d);
+			}
+			add_device_list_rates(p_aggregate, p_pools[p].dimms, capacities,
+					p_pools[p].dimm_count, p_entries, p_shares, entry_count);
+			rc++;
+		}
+		else
+		{
+			for (int s = 0; s < p_pools[p].ilset_count; s++)
+			{
+				const struct interleave_set *p_set = &p_pools[p].ilsets[s];
+				struct performance_rate_aggregate *p_aggregate = NULL;
+				if (p_aggregates)
+				{
+					if (rc >= count)
+					{
+						rc = NVM_ERR_ARRAYTOOSMALL;
+						break;
+					}
+					p_aggregate = &p_aggregates[rc];
+					p_aggregate->type = PERFORMANCE_AGGREGATE_INTERLEAVE_SET;
+					p_aggregate->id = p_set->driver_id;
+					uid_copy(p_pools[p].pool_uid, p_aggregate->pool_uid);
+				}
+				for (int d = 0; d < p_set->dimm_count; d++)
+				{
+					capacities[d] = get_set_device_capacity(p_set);
+				}
+				add_device_list_rates(p_aggregate, p_set->dimms, capacities,
+						p_set->dimm_count, p_entries, p_shares, entry_count);
+				rc++;
+			}
+		}
+	}
+	return rc;
+}
+
+/*
+ * Sum the device rates per pool or per interleave set
+ */
+static int aggregate_by_pool(const enum performance_aggregate_type type,
+		const struct device_performance_rate_entry *p_entries, const int entry_count,
+		struct performance_rate_aggregate *p_aggregates, const NVM_UINT16 count)
+{
+	int rc = nvm_get_pool_count();
+	if (rc > 0)
+	{
+		int pool_count = rc;
+		struct pool *p_pools = calloc(pool_count, sizeof (struct pool));
+		struct device_share *p_shares = calloc(entry_count ? entry_count : 1,
+				sizeof (struct device_share));
+		if (!p_pools || !p_shares)
+		{
+			COMMON_LOG_ERROR("No memory to collect pools");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else if ((rc = nvm_get_pools(p_pools, pool_count)) > 0)
+		{
+			pool_count = rc;
+			// first the capacity of each device in all the groups, then the shares
+			add_pool_rates(type, p_pools, pool_count, p_entries, p_shares, entry_count,
+					NULL, 0);
+			rc = add_pool_rates(type, p_pools, pool_count, p_entries, p_shares, entry_count,
+					p_aggregates, count);
+		}
+		free(p_shares);
+		free(p_pools);
+	}
+	return rc;
+}
+
+/*
+ * Read the performance counters of every manageable device and sum the rates
+ * per socket, interleave set or pool
+ */
+int nvm_get_performance_rate_aggregates(const enum performance_aggregate_type type,
+		struct device_performance_rate_entry *p_entries, const NVM_UINT16 entry_count,
+		struct performance_rate_aggregate *p_aggregates, const NVM_UINT16 count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (check_caller_permissions() != NVM_SUCCESS)
+	{
+		rc = NVM_ERR_INVALIDPERMISSIONS;
+	}
+	else if (!is_supported_driver_available())
+	{
+		rc = NVM_ERR_BADDRIVER;
+	}
+	else if (p_entries == NULL || p_aggregates == NULL)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, p_entries or p_aggregates is NULL");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (type != PERFORMANCE_AGGREGATE_SOCKET &&
+			type != PERFORMANCE_AGGREGATE_INTERLEAVE_SET &&
+			type != PERFORMANCE_AGGREGATE_POOL)
+	{
+		COMMON_LOG_ERROR_F("Invalid parameter, unknown aggregate type %d", type);
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		if ((rc = collect_performance_rates(p_entries, entry_count)) >= 0)
+		{
+			int collected = rc;
+			memset(p_aggregates, 0, sizeof (struct performance_rate_aggregate) * count);
+			if (type == PERFORMANCE_AGGREGATE_SOCKET)
+			{
+				rc = aggregate_by_socket(p_entries, collected, p_aggregates, count);
+			}
+			else
+			{
+				rc = aggregate_by_pool(type, p_entries, collected, p_aggregates, count);
+			}
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Retrieve the rates the performance monitor stored for a device over a time range
+ */
+int nvm_get_device_performance_history(const NVM_UID device_uid,
+		const enum performance_granularity granularity,
+		const time_t start_time, const time_t end_time,
+		struct performance_rate *p_rates, const NVM_UINT16 count)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (check_caller_permissions() != NVM_SUCCESS)
+	{
+		rc = NVM_ERR_INVALIDPERMISSIONS;
+	}
+	else if (device_uid == NULL || p_rates == NULL || count == 0)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, device_uid or p_rates is NULL or count is 0");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		PersistentStore *p_store = get_lib_store();
+		if (!p_store)
+		{
+			rc = NVM_ERR_UNKNOWN;
+		}
+		else
+		{
+			NVM_UID uid_str;
+			uid_copy(device_uid, uid_str);
+			rc = get_device_performance_rates(p_store, uid_str, granularity,
+					start_time, end_time, p_rates, count);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
@@ -38,6 +38,7 @@
 #include "platform_capabilities_db.h"
 #include "platform_config_data.h"
 #include <persistence/logging.h>
+#include <checksum/checksum.h>
 
 // Helper macro for database functions to update
 // the platform configuration data.
@@ -618,7 +619,7 @@ int get_pcat_from_db(PersistentStore *p_db,
 						p_capabilities->header.length = offset;
 
 						// generate a valid checksum
-						generate_checksum((NVM_UINT8*)p_capabilities, p_capabilities->header.length,
+						set_byte_sum8(p_capabilities, p_capabilities->header.length,
 								ACPI_CHECKSUM_OFFSET);
 					}
 				}
@@ -36,6 +36,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <string/s_str.h>
+#include <checksum/checksum.h>
 
 #include "nvm_types.h"
 #include "platform_config_data.h"
@@ -327,7 +328,7 @@ NVM_BOOL is_config_data_table_header_valid(struct config_data_table_header *p_he
 		COMMON_LOG_ERROR_F("PCD Table '%.4s' - Header length %u does not match expected "
 				"length %u", table_signature, p_header->length, table_length);
 	}
-	else if (!verify_checksum((NVM_UINT8*)p_header, table_length))
+	else if (byte_sum8(p_header, table_length) != 0)
 	{
 		COMMON_LOG_ERROR_F("PCD Table '%.4s' - Header checksum invalid", table_signature);
 	}
@@ -670,8 +671,7 @@ int build_platform_config_data(const struct current_config_table *p_current_conf
 		if (rc == NVM_SUCCESS)
 		{
 			// Checksum for platform config data
-			generate_checksum((NVM_UINT8*)p_cfg_data, p_cfg_data->header.length,
-					CHECKSUM_OFFSET);
+			set_byte_sum8(p_cfg_data, p_cfg_data->header.length, CHECKSUM_OFFSET);
 
 			// If we are able to pass back what we created...
 			if (pp_config && (*pp_config == NULL))
@@ -701,14 +701,15 @@ int build_platform_config_data(const struct current_config_table *p_current_conf
  * ****************************************************************************
  */
 
-int get_pcd_table_size(const unsigned int handle, NVM_SIZE *pcd_size)
+/*
+ * Read part of the OS partition through small payload commands
+ */
+static int read_pcd_small_payload(const unsigned int handle, void *p_buf,
+		const NVM_UINT32 start, const NVM_SIZE size)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	*pcd_size = 0;
-
-	// All the information for pcd table size is in the first 128B
 	struct fw_cmd cfg_cmd;
 	memset(&cfg_cmd, 0, sizeof (cfg_cmd));
 	cfg_cmd.device_handle = handle;
@@ -718,20 +719,126 @@ int get_pcd_table_size(const unsigned int handle, NVM_SIZE *pcd_size)
 	struct pt_payload_get_platform_cfg_data cfg_input;
 	memset(&cfg_input, 0, sizeof (cfg_input));
 	char out_buf[DEV_SMALL_PAYLOAD_SIZE];
-	NVM_UINT32 offset = 0;
 	cfg_input.partition_id = DEV_OS_PARTITION;
 	cfg_input.options = DEV_PLT_CFG_OPT_SMALL_DATA;
-	cfg_input.offset = offset;
 	cfg_cmd.input_payload_size = sizeof (cfg_input);
 	cfg_cmd.input_payload = &cfg_input;
 	cfg_cmd.output_payload_size = DEV_SMALL_PAYLOAD_SIZE;
 	cfg_cmd.output_payload = out_buf;
-	if ((rc = ioctl_passthrough_cmd(&cfg_cmd)) == NVM_SUCCESS)
+
+	NVM_UINT32 offset = 0;
+	while (offset < size && rc == NVM_SUCCESS)
 	{
-		struct platform_config_data *tmp_pcd = (struct platform_config_data *)out_buf;
+		if (start + offset > (DEV_PLT_CFG_OEM_PARTITION_SIZE - DEV_SMALL_PAYLOAD_SIZE))
+		{
+			rc = NVM_ERR_UNKNOWN;
+			COMMON_LOG_ERROR("Trying to read outside PCD Partition");
+			break;
+		}
+		memset(out_buf, 0, DEV_SMALL_PAYLOAD_SIZE);
+		cfg_input.offset = start + offset;
 
-		*pcd_size = tmp_pcd->header.length + tmp_pcd->config_input_size
-			+ tmp_pcd->current_config_size + tmp_pcd->config_output_size;
+		if ((rc = ioctl_passthrough_cmd(&cfg_cmd)) == NVM_SUCCESS)
+		{
+			NVM_SIZE transfer_size = DEV_SMALL_PAYLOAD_SIZE;
+			if ((offset + DEV_SMALL_PAYLOAD_SIZE) > size)
+			{
+				transfer_size = size - offset;
+			}
+			memmove((NVM_UINT8 *)p_buf + offset, out_buf, transfer_size);
+			offset += DEV_SMALL_PAYLOAD_SIZE;
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Returns the large mailbox transfer size if the BIOS can move size bytes
+ * in one large payload command in the given direction, otherwise 0
+ */
+static NVM_UINT32 get_pcd_large_payload_rw_size(const unsigned int handle, const NVM_SIZE size,
+		const NVM_BOOL input)
+{
+	NVM_UINT32 rw_size = 0;
+	struct pt_bios_get_size mb_size;
+	memset(&mb_size, 0, sizeof (mb_size));
+	if (fw_get_bios_payload_size(handle, &mb_size) == NVM_SUCCESS)
+	{
+		NVM_UINT32 mb_capacity = input ?
+				mb_size.large_input_payload_size : mb_size.large_output_payload_size;
+		if (mb_capacity >= size && mb_size.rw_size > 0)
+		{
+			rw_size = mb_size.rw_size;
+		}
+	}
+	return rw_size;
+}
+
+/*
+ * Read the whole OS partition PCD, through the large payload mailbox when the BIOS
+ * reports one big enough and otherwise in small payload chunks
+ */
+static int read_pcd(const unsigned int handle, void *p_buf, const NVM_SIZE size)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_ERR_NOTSUPPORTED;
+
+	if (get_pcd_large_payload_rw_size(handle, size, 0))
+	{
+		struct fw_cmd cfg_cmd;
+		memset(&cfg_cmd, 0, sizeof (cfg_cmd));
+		cfg_cmd.device_handle = handle;
+		cfg_cmd.opcode = PT_GET_ADMIN_FEATURES;
+		cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
+
+		struct pt_payload_get_platform_cfg_data cfg_input;
+		memset(&cfg_input, 0, sizeof (cfg_input));
+		cfg_input.partition_id = DEV_OS_PARTITION;
+		cfg_input.options = DEV_PLT_CFG_OPT_LARGE_DATA;
+		cfg_cmd.input_payload_size = sizeof (cfg_input);
+		cfg_cmd.input_payload = &cfg_input;
+		cfg_cmd.large_output_payload_size = (unsigned int)size;
+		cfg_cmd.large_output_payload = p_buf;
+		rc = ioctl_passthrough_cmd(&cfg_cmd);
+		if (rc == NVM_ERR_BADSIZE || rc == NVM_ERR_NOTSUPPORTED)
+		{
+			COMMON_LOG_WARN_F("Large payload PCD read from device 0x%x failed with %d, "
+					"falling back to the small payload", handle, rc);
+		}
+	}
+
+	if (rc == NVM_ERR_BADSIZE || rc == NVM_ERR_NOTSUPPORTED)
+	{
+		rc = read_pcd_small_payload(handle, p_buf, 0, size);
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Total size of the PCD described by its header
+ */
+static NVM_SIZE get_pcd_size_from_header(const struct platform_config_data *p_header)
+{
+	return p_header->header.length + p_header->config_input_size
+		+ p_header->current_config_size + p_header->config_output_size;
+}
+
+int get_pcd_table_size(const unsigned int handle, NVM_SIZE *pcd_size)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	*pcd_size = 0;
+
+	// All the information for pcd table size is in the first 128B
+	char out_buf[DEV_SMALL_PAYLOAD_SIZE];
+	if ((rc = read_pcd_small_payload(handle, out_buf, 0, DEV_SMALL_PAYLOAD_SIZE)) == NVM_SUCCESS)
+	{
+		*pcd_size = get_pcd_size_from_header((struct platform_config_data *)out_buf);
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
@@ -771,80 +878,7 @@ int get_hw_dimm_platform_config_alloc(const unsigned int handle, NVM_SIZE *p_pcd
 		if (*pp_config != NULL)
 		{
 			*p_pcd_size = tmp_pcd_size;
-#if	__GET_LARGE_PCD_OS_PARTITION__
-
-			NVM_UINT8 *large_buffer = calloc(1, tmp_pcd_size);
-			if (large_buffer != NULL)
-			{
-				// Use Large Payload to retrieve PCD
-				struct fw_cmd cfg_cmd;
-				memset(&cfg_cmd, 0, sizeof (cfg_cmd));
-				cfg_cmd.device_handle = handle;
-				cfg_cmd.opcode = PT_GET_ADMIN_FEATURES;
-				cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
-
-				struct pt_payload_get_platform_cfg_data cfg_input;
-				memset(&cfg_input, 0, sizeof (cfg_input));
-				cfg_input.partition_id = DEV_OS_PARTITION;
-				cfg_input.options = DEV_PLT_CFG_OPT_LARGE_DATA;
-				cfg_cmd.input_payload_size = sizeof (cfg_input);
-				cfg_cmd.input_payload = &cfg_input;
-				cfg_cmd.large_output_payload_size = (unsigned int) tmp_pcd_size;
-				cfg_cmd.large_output_payload = large_buffer;
-				if ((rc = ioctl_passthrough_cmd(&cfg_cmd)) == NVM_SUCCESS)
-				{
-					memmove(*pp_config, large_buffer, *p_pcd_size);
-				}
-				free(large_buffer);
-			}
-			else
-			{
-				rc = NVM_ERR_NOMEMORY;
-			}
-#else
-			// Use Small Payload to retrieve PCD
-			struct fw_cmd cfg_cmd;
-			memset(&cfg_cmd, 0, sizeof (cfg_cmd));
-			cfg_cmd.device_handle = handle;
-			cfg_cmd.opcode = PT_GET_ADMIN_FEATURES;
-			cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
-
-			struct pt_payload_get_platform_cfg_data cfg_input;
-			memset(&cfg_input, 0, sizeof (cfg_input));
-			char out_buf[DEV_SMALL_PAYLOAD_SIZE];
-			NVM_UINT32 offset = 0;
-			cfg_input.partition_id = DEV_OS_PARTITION;
-			cfg_input.options = DEV_PLT_CFG_OPT_SMALL_DATA;
-			cfg_input.offset = offset;
-			cfg_cmd.input_payload_size = sizeof (cfg_input);
-			cfg_cmd.input_payload = &cfg_input;
-			cfg_cmd.output_payload_size = DEV_SMALL_PAYLOAD_SIZE;
-			cfg_cmd.output_payload = out_buf;
-
-			while (offset < *p_pcd_size && rc == NVM_SUCCESS)
-			{
-				if (offset > (DEV_PLT_CFG_OEM_PARTITION_SIZE - DEV_SMALL_PAYLOAD_SIZE))
-				{
-					rc = NVM_ERR_UNKNOWN;
-					COMMON_LOG_ERROR("Trying to read outside PCD Partition");
-					break;
-				}
-				memset(out_buf, 0, DEV_SMALL_PAYLOAD_SIZE);
-				cfg_input.offset = offset;
-
-				if ((rc = ioctl_passthrough_cmd(&cfg_cmd)) == NVM_SUCCESS)
-				{
-					NVM_SIZE transfer_size = DEV_SMALL_PAYLOAD_SIZE;
-
-					if ((offset + DEV_SMALL_PAYLOAD_SIZE) > *p_pcd_size)
-					{
-						transfer_size = *p_pcd_size - offset;
-					}
-					memmove((char *)*pp_config + offset, out_buf, transfer_size);
-					offset += DEV_SMALL_PAYLOAD_SIZE;
-				}
-			}
-#endif
+			rc = read_pcd(handle, *pp_config, tmp_pcd_size);
 		}
 		else
 		{
@@ -866,32 +900,105 @@ int get_hw_dimm_platform_config_alloc(const unsigned int handle, NVM_SIZE *p_pcd
 }
 
 /*
- * Retrieve a copy of the platform config data from the global device table
- * NOTE: Callers must free the platform_config_data structure by
- * calling free_platform_config!
+ * A cached PCD is current while the partition header, and the header and sequence number
+ * at the start of each table, still match the DIMM. Every table update rewrites its
+ * checksum and every new config request or response carries a new sequence number.
  */
-int get_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
-		struct platform_config_data **pp_config)
+static NVM_BOOL is_cached_pcd_current(const unsigned int handle,
+		const struct platform_config_data *p_cached, const NVM_SIZE cached_size)
+{
+	COMMON_LOG_ENTRY();
+	NVM_BOOL current = 0;
+
+	NVM_UINT8 buf[DEV_SMALL_PAYLOAD_SIZE];
+	if (cached_size >= sizeof (struct platform_config_data) &&
+			read_pcd_small_payload(handle, buf, 0, sizeof (buf)) == NVM_SUCCESS &&
+			memcmp(buf, p_cached, sizeof (struct platform_config_data)) == 0)
+	{
+		const NVM_UINT32 offsets[] = { p_cached->current_config_offset,
+				p_cached->config_input_offset, p_cached->config_output_offset };
+		const NVM_UINT32 sizes[] = { p_cached->current_config_size,
+				p_cached->config_input_size, p_cached->config_output_size };
+		current = 1;
+		for (int i = 0; current && i < 3; i++)
+		{
+			NVM_SIZE len = sizeof (struct config_data_table_header) + sizeof (NVM_UINT32);
+			if (sizes[i] < len)
+			{
+				len = sizes[i];
+			}
+			if (len > 0)
+			{
+				current = (offsets[i] + len <= cached_size) &&
+					read_pcd_small_payload(handle, buf, offsets[i], len) == NVM_SUCCESS &&
+					memcmp(buf, (const NVM_UINT8 *)p_cached + offsets[i], len) == 0;
+			}
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(current);
+	return current;
+}
+
+/*
+ * Retrieve the platform config data from the context, otherwise from the DIMM.
+ * A copy that was invalidated is reused when the DIMM still matches it.
+ */
+static int get_dimm_platform_config_and_size(const NVM_NFIT_DEVICE_HANDLE handle,
+		struct platform_config_data **pp_config, NVM_SIZE *p_pcd_size)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	NVM_SIZE pcd_size = 0;
+	*pp_config = NULL;
+	*p_pcd_size = 0;
 	// get the UID from the handle
 	struct device_discovery discovery;
 	if ((rc = lookup_dev_handle(handle, &discovery)) == NVM_SUCCESS)
 	{
 		// look up pcd in context
-		if (get_nvm_context_device_pcd(discovery.uid, pp_config, &pcd_size) != NVM_SUCCESS)
+		NVM_BOOL verified = 0;
+		if (get_nvm_context_device_pcd(discovery.uid, pp_config, p_pcd_size,
+				&verified) == NVM_SUCCESS && !verified)
+		{
+			if (is_cached_pcd_current(handle.handle, *pp_config, *p_pcd_size))
+			{
+				set_nvm_context_device_pcd(discovery.uid, *pp_config, *p_pcd_size);
+			}
+			else
+			{
+				free(*pp_config);
+				*pp_config = NULL;
+			}
+		}
+
+		if (*pp_config == NULL)
 		{
-			rc = get_hw_dimm_platform_config_alloc(handle.handle, &pcd_size, (void **)pp_config);
+			rc = get_hw_dimm_platform_config_alloc(handle.handle, p_pcd_size,
+					(void **)pp_config);
 			if (rc == NVM_SUCCESS && *pp_config)
 			{
-				set_nvm_context_device_pcd(discovery.uid, *pp_config, pcd_size);
+				set_nvm_context_device_pcd(discovery.uid, *pp_config, *p_pcd_size);
 			}
 		}
 	}
 
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Retrieve a copy of the platform config data from the global device table
+ * NOTE: Callers must free the platform_config_data structure by
+ * calling free_platform_config!
+ */
+int get_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
+		struct platform_config_data **pp_config)
+{
+	COMMON_LOG_ENTRY();
+	NVM_SIZE pcd_size = 0;
+	int rc = get_dimm_platform_config_and_size(handle, pp_config, &pcd_size);
+
 	if (*pp_config == NULL)
 	{
 		COMMON_LOG_ERROR("PCD data is empty");
@@ -901,13 +1008,102 @@ int get_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
+
+/*
+ * Whether a small payload write chunk differs from what was read from the DIMM
+ */
+static inline NVM_BOOL is_pcd_chunk_changed(const struct platform_config_data *p_config,
+		const struct platform_config_data *p_current,
+		const NVM_SIZE offset, const NVM_SIZE len)
+{
+	return !p_current ||
+		memcmp((const NVM_UINT8 *)p_config + offset,
+			(const NVM_UINT8 *)p_current + offset, len) != 0;
+}
+
+/*
+ * Write the whole PCD through the large payload mailbox
+ */
+static int write_pcd_large_payload(const unsigned int handle,
+		const struct platform_config_data *p_config, const NVM_SIZE pcd_size)
+{
+	struct fw_cmd cfg_cmd;
+	memset(&cfg_cmd, 0, sizeof(cfg_cmd));
+	cfg_cmd.device_handle = handle;
+	cfg_cmd.opcode = PT_SET_ADMIN_FEATURES;
+	cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
+
+	struct pt_payload_set_platform_cfg_data cfg_input;
+	memset(&cfg_input, 0, sizeof(cfg_input));
+	cfg_input.partition_id = DEV_OS_PARTITION;
+	cfg_input.payload_type = DEV_PLT_CFG_LARGE_PAY;
+	cfg_cmd.input_payload_size = sizeof(cfg_input);
+	cfg_cmd.input_payload = &cfg_input;
+	cfg_cmd.large_input_payload_size = (unsigned int)pcd_size;
+	cfg_cmd.large_input_payload = (void *)p_config;
+
+	return ioctl_passthrough_cmd(&cfg_cmd);
+}
+
+/*
+ * Write the chunks of the PCD that differ from p_current, pcd_size bytes read from the
+ * DIMM or NULL, through small payload commands
+ */
+static int write_pcd_small_payload(const unsigned int handle,
+		const struct platform_config_data *p_config, const NVM_SIZE pcd_size,
+		const struct platform_config_data *p_current)
+{
+	int rc = NVM_SUCCESS;
+
+	struct fw_cmd cfg_cmd;
+	memset(&cfg_cmd, 0, sizeof(cfg_cmd));
+	cfg_cmd.device_handle = handle;
+	cfg_cmd.opcode = PT_SET_ADMIN_FEATURES;
+	cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
+
+	struct pt_payload_set_platform_cfg_data cfg_input;
+	memset(&cfg_input, 0, sizeof(cfg_input));
+	cfg_input.partition_id = DEV_OS_PARTITION;
+	cfg_input.payload_type = DEV_PLT_CFG_SMALL_PAY;
+	cfg_cmd.input_payload_size = sizeof(cfg_input);
+	cfg_cmd.input_payload = &cfg_input;
+
+	NVM_SIZE offset = 0;
+
+	while (offset < pcd_size && rc == NVM_SUCCESS)
+	{
+		if (offset > (DEV_PLT_CFG_OEM_PARTITION_SIZE - DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE))
+		{
+			rc = NVM_ERR_UNKNOWN;
+			COMMON_LOG_ERROR("Trying to write outside PCD Partition");
+			break;
+		}
+
+		NVM_SIZE len = DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE;
+		if (offset + len > pcd_size)
+		{
+			len = pcd_size - offset;
+		}
+		if (is_pcd_chunk_changed(p_config, p_current, offset, len))
+		{
+			memset(cfg_input.data, 0, sizeof (cfg_input.data));
+			memmove(cfg_input.data, (const NVM_UINT8 *)p_config + offset, len);
+			cfg_input.offset = offset;
+			rc = ioctl_passthrough_cmd(&cfg_cmd);
+		}
+		offset += DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE;
+	}
+
+	return rc;
+}
+
 #ifdef __BUILD_SIM__
 //only here for unit testing
 NVM_SIZE g_pcd_size;
 #endif
 /*
  * Write the platform config data stored in the structure
- * to the dimm
+ * to the dimm. Only the parts that differ from the PCD on the DIMM are sent.
  */
 int set_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
 		const struct platform_config_data *p_config)
@@ -915,59 +1111,64 @@ int set_dimm_platform_config(const NVM_NFIT_DEVICE_HANDLE handle,
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	NVM_SIZE pcd_size = p_config->header.length + p_config->config_input_size
-		+ p_config->config_output_size + p_config->current_config_size;
+	NVM_SIZE pcd_size = get_pcd_size_from_header(p_config);
 #ifdef __BUILD_SIM__
 	g_pcd_size = pcd_size;
 #endif
+	struct device_discovery discovery;
 	if (DEV_PLT_CFG_OEM_PARTITION_SIZE < pcd_size)
 	{
 		rc = NVM_ERR_BADSIZE;
 		COMMON_LOG_ERROR("Trying to write outside PCD Partition");
 	}
-	else
+	else if ((rc = lookup_dev_handle(handle, &discovery)) == NVM_SUCCESS)
 	{
-		struct fw_cmd cfg_cmd;
-		memset(&cfg_cmd, 0, sizeof(cfg_cmd));
-		cfg_cmd.device_handle = handle.handle;
-		cfg_cmd.opcode = PT_SET_ADMIN_FEATURES;
-		cfg_cmd.sub_opcode = SUBOP_PLATFORM_DATA_INFO;
-
-		struct pt_payload_set_platform_cfg_data cfg_input;
-		memset(&cfg_input, 0, sizeof(cfg_input));
-		cfg_input.partition_id = DEV_OS_PARTITION;
-		cfg_input.payload_type = DEV_PLT_CFG_SMALL_PAY;
-		cfg_cmd.input_payload_size = sizeof(cfg_input);
-		cfg_cmd.input_payload = &cfg_input;
-
-		NVM_SIZE offset = 0;
+		// compare against a full read of what is on the DIMM, writing everything if that
+		// can't be read. The cached copy is only verified by its headers and 8-bit
+		// checksums, which could hide a chunk changed by someone else.
+		struct platform_config_data *p_current =
+				(struct platform_config_data *)calloc(1, pcd_size);
+		if (p_current && read_pcd(handle.handle, p_current, pcd_size) != NVM_SUCCESS)
+		{
+			free(p_current);
+			p_current = NULL;
+		}
 
-		while (offset < pcd_size && rc == NVM_SUCCESS)
+		int changed_chunks = 0;
+		for (NVM_SIZE offset = 0; offset < pcd_size;
+				offset += DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE)
 		{
-			if (offset > (DEV_PLT_CFG_OEM_PARTITION_SIZE - DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE))
+			NVM_SIZE len = DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE;
+			if (offset + len > pcd_size)
 			{
-				rc = NVM_ERR_UNKNOWN;
-				COMMON_LOG_ERROR("Trying to write outside PCD Partition");
-				break;
+				len = pcd_size - offset;
 			}
+			changed_chunks += is_pcd_chunk_changed(p_config, p_current, offset, len);
+		}
 
-			memmove(cfg_input.data, (void *)((char*)p_config + offset), DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE);
-			cfg_input.offset = offset;
-
-			if ((rc = ioctl_passthrough_cmd(&cfg_cmd)) == NVM_SUCCESS)
+		// the large mailbox costs a command per rw_size bytes of the whole PCD plus one
+		rc = NVM_ERR_NOTSUPPORTED;
+		NVM_UINT32 rw_size = get_pcd_large_payload_rw_size(handle.handle, pcd_size, 1);
+		if (rw_size && changed_chunks > (int)((pcd_size + rw_size - 1) / rw_size) + 1)
+		{
+			rc = write_pcd_large_payload(handle.handle, p_config, pcd_size);
+			if (rc == NVM_ERR_BADSIZE || rc == NVM_ERR_NOTSUPPORTED)
 			{
-				offset += DEV_PLT_CFG_SMALL_PAYLOAD_WRITE_SIZE;
+				COMMON_LOG_WARN_F("Large payload PCD write to device 0x%x failed with %d, "
+						"falling back to the small payload", handle.handle, rc);
 			}
 		}
+		if (rc == NVM_ERR_BADSIZE || rc == NVM_ERR_NOTSUPPORTED)
+		{
+			rc = write_pcd_small_payload(handle.handle, p_config, pcd_size, p_current);
+		}
+		free(p_current);
 
+		// replace the cached copy with what was written, a failed write leaves it unverified
+		invalidate_device_pcd(discovery.uid);
 		if (rc == NVM_SUCCESS)
 		{
-			// invalidate context
-			struct device_discovery discovery;
-			if ((rc = lookup_dev_handle(handle, &discovery)) == NVM_SUCCESS)
-			{
-				invalidate_device_pcd(discovery.uid);
-			}
+			set_nvm_context_device_pcd(discovery.uid, p_config, pcd_size);
 		}
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
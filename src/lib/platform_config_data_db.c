@@ -32,7 +32,9 @@
 
 #include "platform_config_data_db.h"
 #include "utility.h"
+#include <checksum/checksum.h>
 #include <string/s_str.h>
+#include <persistence/event.h>
 
 // Helper macro for database functions to update
 // the platform configuration data.
@@ -417,6 +419,7 @@ int update_dimm_platform_config_in_db(PersistentStore *p_db,
 			}
 		}
 		db_end_transaction(p_db);
+		notify_pending_events();
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -889,7 +892,7 @@ int get_dimm_config_input_from_db(PersistentStore *p_db,
 				p_data->config_input_size += interleave_tables_size;
 
 				// calculate checksum
-				generate_checksum((NVM_UINT8*)p_data + p_data->config_input_offset,
+				set_byte_sum8((NVM_UINT8*)p_data + p_data->config_input_offset,
 						p_data->config_input_size,
 						CHECKSUM_OFFSET);
 			}
@@ -986,7 +989,7 @@ int get_dimm_config_output_from_db(PersistentStore *p_db,
 				p_data->config_output_size += interleave_tables_size;
 
 				// calculate checksum
-				generate_checksum((NVM_UINT8*)p_data + p_data->config_output_offset,
+				set_byte_sum8((NVM_UINT8*)p_data + p_data->config_output_offset,
 						p_data->config_output_size,
 						CHECKSUM_OFFSET);
 			}
@@ -1073,7 +1076,7 @@ int get_dimm_current_config_from_db(PersistentStore *p_db,
 			p_data->current_config_size += interleave_tables_size;
 
 			// calculate checksum
-			generate_checksum((NVM_UINT8*)p_data + p_data->current_config_offset,
+			set_byte_sum8((NVM_UINT8*)p_data + p_data->current_config_offset,
 					p_data->current_config_size,
 					CHECKSUM_OFFSET);
 		}
@@ -1158,7 +1161,7 @@ int get_dimm_platform_config_data_from_db(PersistentStore *p_db,
 					if (rc == NVM_SUCCESS)
 					{
 						// calculate the platform config table checksum
-						generate_checksum((NVM_UINT8*)p_data,
+						set_byte_sum8(p_data,
 								p_data->header.length, CHECKSUM_OFFSET);
 					}
 				}
@@ -49,8 +49,8 @@
 #include "namespace_utils.h"
 
 // defined in device.c
-extern int get_device_status_by_handle(NVM_NFIT_DEVICE_HANDLE dimm_handle,
-		struct device_status *p_status, struct nvm_capabilities *p_capabilities);
+extern int get_device_statuses(struct device_discovery *p_devices, const int count,
+		const struct nvm_capabilities *p_capabilities, struct device_status *p_statuses);
 
 #define	MAX_POOLS	9
 /*
@@ -315,14 +315,11 @@ int collect_dimm_statuses(struct pool_data **pp_pool_data)
 		}
 		else
 		{
-			for (int i = 0; i < (*pp_pool_data)->dimm_count; i++)
-			{
-				// ignore failures because not all status can be retrieved
-				get_device_status_by_handle(
-					(*pp_pool_data)->dimm_list[i].device_handle,
-					&(*pp_pool_data)->dimm_status_list[i],
-					&(*pp_pool_data)->capabilities);
-			}
+			// ignore failures because not all status can be retrieved
+			get_device_statuses((*pp_pool_data)->dimm_list,
+					(*pp_pool_data)->dimm_count,
+					&(*pp_pool_data)->capabilities,
+					(*pp_pool_data)->dimm_status_list);
 		}
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -991,6 +988,91 @@ int count_pools(struct pool_data *p_pool_data)
 	return pool_count;
 }
 
+/*
+ * Bring pool data up to date, collecting again only the inputs that are stale.
+ * Inputs that aren't tracked separately cause everything to be collected again.
+ */
+int refresh_pool_data(struct pool_data **pp_pool_data, const NVM_UINT32 stale_data)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (!(*pp_pool_data) || (stale_data & ~(POOL_DATA_NAMESPACES | POOL_DATA_GOALS)))
+	{
+		free_pool_data(*pp_pool_data);
+		if ((rc = collect_required_pool_data(pp_pool_data, 0)) != NVM_SUCCESS)
+		{
+			*pp_pool_data = NULL;
+		}
+	}
+	else if ((*pp_pool_data)->dimm_count)
+	{
+		if (stale_data & POOL_DATA_GOALS)
+		{
+			free((*pp_pool_data)->dimm_goal_list);
+			(*pp_pool_data)->dimm_goal_list = NULL;
+			rc = collect_dimm_goals(pp_pool_data);
+		}
+		if (rc == NVM_SUCCESS && (stale_data & POOL_DATA_NAMESPACES))
+		{
+			free((*pp_pool_data)->namespace_list);
+			(*pp_pool_data)->namespace_list = NULL;
+			(*pp_pool_data)->namespace_count = 0;
+			rc = collect_namespaces(pp_pool_data);
+		}
+		if (rc != NVM_SUCCESS)
+		{
+			free_pool_data(*pp_pool_data);
+			*pp_pool_data = NULL;
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Build the pools into p_pools, which must hold MAX_POOLS, from the pool model kept in the
+ * context, and store them in the context for the next caller.
+ * Without a context the pool data is collected for this call only, and when count_only
+ * is set only the data needed to count the pools is collected.
+ *
+ * Returns: Number of pools (integer >= 0) if success, error code otherwise.
+ *          The pools are only filled in if count_only isn't set.
+ */
+int build_pool_model(struct pool *p_pools, const NVM_BOOL count_only)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	struct pool_data *p_pool_data = NULL;
+	NVM_UINT32 stale_data = POOL_DATA_ALL;
+	if (take_nvm_context_pool_data(&p_pool_data, &stale_data) != NVM_SUCCESS)
+	{
+		// no context to keep the model in
+		if ((rc = collect_required_pool_data(&p_pool_data, count_only)) == NVM_SUCCESS)
+		{
+			rc = count_only ? count_pools(p_pool_data) :
+				populate_pools(p_pool_data, p_pools, MAX_POOLS);
+			free_pool_data(p_pool_data);
+		}
+	}
+	else if ((rc = refresh_pool_data(&p_pool_data, stale_data)) == NVM_SUCCESS)
+	{
+		if ((rc = populate_pools(p_pool_data, p_pools, MAX_POOLS)) >= 0)
+		{
+			set_nvm_context_pool_model(p_pool_data, p_pools, rc);
+		}
+		else
+		{
+			free_pool_data(p_pool_data);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Retrieve the number of configured pools of NVM-DIMM capacity in the host server.
  */
@@ -1013,12 +1095,16 @@ int nvm_get_pool_count()
 	}
 	else if ((rc = get_nvm_context_pool_count()) < 0)
 	{
-		struct pool_data *p_pool_data = NULL;
-		rc = collect_required_pool_data(&p_pool_data, 1);
-		if (rc == NVM_SUCCESS && p_pool_data)
+		struct pool *p_model = calloc(MAX_POOLS, sizeof (struct pool));
+		if (!p_model)
 		{
-			rc = count_pools(p_pool_data);
-			free_pool_data(p_pool_data);
+			COMMON_LOG_ERROR("Not enough memory to allocate pool list");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
+		{
+			rc = build_pool_model(p_model, 1);
+			free(p_model);
 		}
 	}
 
@@ -1061,17 +1147,26 @@ int nvm_get_pools(struct pool *p_pools, const NVM_UINT8 count)
 	else if ((rc = get_nvm_context_pools(p_pools, count)) < 0 &&
 			rc != NVM_ERR_ARRAYTOOSMALL)
 	{
-		struct pool_data *p_pool_data = NULL;
-		rc = collect_required_pool_data(&p_pool_data, 0);
-		if (rc == NVM_SUCCESS && p_pool_data)
+		struct pool *p_model = calloc(MAX_POOLS, sizeof (struct pool));
+		if (!p_model)
+		{
+			COMMON_LOG_ERROR("Not enough memory to allocate pool list");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
 		{
-			rc = populate_pools(p_pool_data, p_pools, count);
-			// update the context
-			if (rc > 0)
+			if ((rc = build_pool_model(p_model, 0)) > 0)
 			{
-				set_nvm_context_pools(p_pools, rc);
+				int copy_count = rc;
+				if (count < rc)
+				{
+					copy_count = count;
+					rc = NVM_ERR_ARRAYTOOSMALL;
+				}
+				memset(p_pools, 0, count * sizeof (struct pool));
+				memmove(p_pools, p_model, copy_count * sizeof (struct pool));
 			}
-			free_pool_data(p_pool_data);
+			free(p_model);
 		}
 	}
 
@@ -1109,43 +1204,31 @@ int nvm_get_pool(const NVM_UID pool_uid, struct pool *p_pool)
 		COMMON_LOG_ERROR("Invalid parameter, p_pool is NULL");
 		rc = NVM_ERR_INVALIDPARAMETER;
 	}
-	else if ((rc = get_nvm_context_pool(pool_uid, p_pool)) != NVM_SUCCESS)
+	else if ((rc = get_nvm_context_pool(pool_uid, p_pool)) == NVM_ERR_CONTEXT)
 	{
-		struct pool_data *p_pool_data = NULL;
-		rc = collect_required_pool_data(&p_pool_data, 0);
-		if (rc == NVM_SUCCESS && p_pool_data)
+		struct pool *p_model = calloc(MAX_POOLS, sizeof (struct pool));
+		if (!p_model)
+		{
+			COMMON_LOG_ERROR("Not enough memory to allocate pool list");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
 		{
-			rc = count_pools(p_pool_data);
-			if (rc > 0)
+			if ((rc = build_pool_model(p_model, 0)) >= 0)
 			{
 				int pool_count = rc;
-				struct pool *pools = (struct pool *)calloc(pool_count, sizeof (struct pool));
-				if (!pools)
+				rc = NVM_ERR_BADPOOL;
+				for (int i = 0; i < pool_count; i++)
 				{
-					COMMON_LOG_ERROR("Not enough memory to allocate pool list");
-					rc = NVM_ERR_NOMEMORY;
-				}
-				else
-				{
-					rc = populate_pools(p_pool_data, pools, pool_count);
-					if (rc > 0)
+					if (uid_cmp(p_model[i].pool_uid, pool_uid))
 					{
-						pool_count = rc;
-						rc = NVM_ERR_BADPOOL;
-						for (int i = 0; i < pool_count; i++)
-						{
-							if (uid_cmp(pools[i].pool_uid, pool_uid))
-							{
-								memmove(p_pool, &pools[i], sizeof (struct pool));
-								rc = NVM_SUCCESS;
-								break;
-							}
-						}
+						memmove(p_pool, &p_model[i], sizeof (struct pool));
+						rc = NVM_SUCCESS;
+						break;
 					}
-					free(pools);
 				}
 			}
-			free_pool_data(p_pool_data);
+			free(p_model);
 		}
 	}
 
@@ -35,6 +35,7 @@
 #include <persistence/logging.h>
 #include <persistence/lib_persistence.h>
 #include <persistence/config_settings.h>
+#include <persistence/event.h>
 #include "platform_config_data.h"
 #include <string/s_str.h>
 #include <string/revision.h>
@@ -42,52 +43,162 @@
 #include "device_utilities.h"
 #include "platform_capabilities_db.h"
 #include <system.h>
+#include "device_executor.h"
+
+extern int get_fw_die_spare_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
+		struct pt_get_die_spare_policy *payload);
+extern int get_fw_power_mgmt_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
+		struct pt_payload_power_mgmt_policy *payload);
+
+/*
+ * Number of firmware error logs on a DIMM, one for each combination of
+ * DEV_FW_ERR_LOG_LOW/HIGH and DEV_FW_ERR_LOG_MEDIA/THERMAL
+ */
+#define	FW_ERROR_LOG_COUNT	4
+
+/*
+ * One of a DIMM's firmware error logs, indexed by (log level | log type)
+ */
+struct fw_error_log_state
+{
+	int info_rc;
+	struct pt_payload_fw_log_info_data info;
+	int entries_rc;
+	unsigned int entry_count;
+	NVM_UINT8 *p_entries; // pt_fw_media_log_entry or pt_fw_thermal_log_entry array
+};
+
+/*
+ * Everything a snapshot records about one DIMM. It is read from the firmware by
+ * collect_dimm_state, concurrently for all DIMMs, and then written to the store
+ * by store_dimm_state. Each *_rc is the result of reading the payload that follows it.
+ */
+struct dimm_state
+{
+	struct nvm_topology topology;
+	int identify_rc;
+	struct pt_payload_identify_dimm identify;
+	int characteristics_rc;
+	struct pt_payload_device_characteristics characteristics;
+	int smart_rc;
+	struct pt_payload_smart_health smart;
+	int memory_page0_rc;
+	struct pt_payload_memory_info_page0 memory_page0;
+	int memory_page1_rc;
+	struct pt_payload_memory_info_page1 memory_page1;
+	int fw_image_rc;
+	struct pt_payload_fw_image_info fw_image;
+	int details_rc;
+	struct nvm_details details;
+	int partition_rc;
+	struct pt_payload_get_dimm_partition_info partition;
+	int security_rc;
+	struct pt_payload_get_security_state security;
+	struct fw_error_log_state error_logs[FW_ERROR_LOG_COUNT];
+	int debug_log_rc;
+	NVM_UINT8 debug_log_count;
+	NVM_UINT8 *p_debug_log; // debug_log_count pages of DEV_FW_LOG_PAGE_SIZE bytes
+	int die_sparing_rc;
+	struct pt_get_die_spare_policy die_sparing;
+	int power_management_rc;
+	struct pt_payload_power_mgmt_policy power_management;
+	int alarm_thresholds_rc;
+	struct pt_payload_alarm_thresholds alarm_thresholds;
+	int config_data_policy_rc;
+	struct pt_payload_get_config_data_policy config_data_policy;
+	int platform_config_rc;
+	struct platform_config_data *p_platform_config;
+	int long_op_rc;
+	struct pt_payload_long_op_stat long_op;
+};
+
+/*
+ * A namespace and its details, see system_state
+ */
+struct namespace_state
+{
+	struct namespace_discovery discovery;
+	int details_rc;
+	struct namespace_details details;
+};
+
+/*
+ * Everything a snapshot records about the host and platform. It is read by
+ * collect_system_state before the store transaction is opened. A negative
+ * count is the error from reading it.
+ */
+struct system_state
+{
+	int host_rc;
+	struct host host;
+	int sw_inventory_rc;
+	struct sw_inventory sw_inventory;
+	int socket_count;
+	struct socket *p_sockets;
+	int pcat_rc;
+	struct bios_capabilities *p_pcat;
+	int namespace_count;
+	struct namespace_state *p_namespaces;
+	int driver_capabilities_rc;
+	struct nvm_driver_capabilities driver_capabilities;
+	int interleave_count;
+	struct nvm_interleave_set *p_interleaves;
+};
+
+void collect_system_state(struct system_state *p_system);
+void free_system_state(struct system_state *p_system);
+int support_store_host(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system);
+int support_store_sockets(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system);
+int support_store_platform_capabilities(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system);
+int support_store_interleave_sets(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system);
+int support_store_namespaces(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system);
+int support_store_driver_capabilities(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system);
 
-int support_store_host(PersistentStore *p_store, int history_id);
-int support_store_sockets(PersistentStore *p_store, int history_id);
-int support_store_platform_capabilities(PersistentStore *p_store, int history_id);
-int support_store_interleave_sets(PersistentStore *p_store, int history_id);
 int support_store_dimm_topology(PersistentStore *p_store,
 		int history_id, struct nvm_topology topol);
-int support_store_identify_dimm(PersistentStore *p_store,
-		int history_id, NVM_NFIT_DEVICE_HANDLE device_handle);
-int support_store_device_characteristics(PersistentStore *p_store,
-		int history_id, NVM_NFIT_DEVICE_HANDLE device_handle);
+int support_store_identify_dimm(PersistentStore *p_store, int history_id,
+		const struct dimm_state *p_dimm);
+int support_store_device_characteristics(PersistentStore *p_store, int history_id,
+		const struct dimm_state *p_dimm);
 int support_store_smart(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_memory(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_fw_image(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE uid);
+		const struct dimm_state *p_dimm);
 int support_store_dimm_details(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_dimm_partition_info(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_dimm_security_state(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
-int support_store_namespaces(PersistentStore *p_store, int history_id);
+		const struct dimm_state *p_dimm);
 int support_store_fw_error_logs(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_fw_debug_logs(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
-
-int support_store_driver_capabilities(PersistentStore *p_store, int history_id);
-extern int get_fw_die_spare_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
-		struct pt_get_die_spare_policy *payload);
-extern int get_fw_power_mgmt_policy(NVM_NFIT_DEVICE_HANDLE dimm_handle,
-		struct pt_payload_power_mgmt_policy *payload);
+		const struct dimm_state *p_dimm);
 int support_store_optional_config_data(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_die_sparing(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_power_management(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_alarm_thresholds(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_platform_config_data(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
 int support_store_dimm_long_operation_status(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle);
+		const struct dimm_state *p_dimm);
+
+int collect_dimm_state(void *p_dimms, const int index);
+void free_dimm_state(struct dimm_state *p_dimm);
+int store_dimm_state(PersistentStore *p_store, int history_id,
+		const struct dimm_state *p_dimm);
 
 int db_get_history_count(const PersistentStore *p_ps, int *p_count)
 {
@@ -136,11 +247,59 @@ int nvm_save_state(const char *name, const NVM_SIZE name_len)
 			}
 			else
 			{
+				// read the system and every DIMM's firmware data before opening the transaction
+				struct system_state system;
+				collect_system_state(&system);
+
+				int dev_count = get_topology_count();
+				struct dimm_state *p_dimms = NULL;
+				if (dev_count > 0)
+				{
+					// get topology, aka discovery info
+					struct nvm_topology *topol = malloc(dev_count * sizeof(struct nvm_topology));
+					p_dimms = calloc(dev_count, sizeof (struct dimm_state));
+					NVM_UINT32 *p_handles = calloc(dev_count, sizeof (NVM_UINT32));
+					int temprc = NVM_ERR_NOMEMORY;
+					if (!topol || !p_dimms || !p_handles)
+					{
+						COMMON_LOG_ERROR("Failed to allocate memory for the DIMM snapshots");
+						KEEP_ERROR(rc, temprc);
+						dev_count = 0;
+					}
+					else if ((temprc = get_topology(dev_count, topol)) < NVM_SUCCESS)
+					{
+						COMMON_LOG_ERROR("Failed getting topology information");
+						KEEP_ERROR(rc, temprc);
+						dev_count = 0;
+					}
+					else
+					{
+						dev_count = temprc;
+						for (int i = 0; i < dev_count; i++)
+						{
+							p_dimms[i].topology = topol[i];
+							p_handles[i] = topol[i].device_handle.handle;
+						}
+						run_device_tasks(p_handles, dev_count, collect_dimm_state, p_dimms);
+					}
+
+					free(p_handles);
+                    free(topol);
+				} // if dev count > 0
+
+				// write the whole snapshot in one transaction
+				int in_transaction = (db_begin_transaction(p_store) == DB_SUCCESS);
+				if (!in_transaction)
+				{
+					COMMON_LOG_WARN("Failed to begin the snapshot transaction");
+				}
+
 				// add a new row to the history table
-				int history_id;
-				if ((rc = db_add_history(p_store, name, &history_id)) != DB_SUCCESS)
+				int history_id = 0;
+				if (db_add_history(p_store, name, &history_id) != DB_SUCCESS)
 				{
 					COMMON_LOG_ERROR("Failed creating a history table row.");
+					KEEP_ERROR(rc, NVM_ERR_UNKNOWN);
 				}
 
 				if (history_count++ >= max_no_support_snapshots)
@@ -151,87 +310,40 @@ int nvm_save_state(const char *name, const NVM_SIZE name_len)
 					db_roll_history(p_store, max_no_support_snapshots);
 				}
 
-				KEEP_ERROR(rc, support_store_host(p_store, history_id));
+				KEEP_ERROR(rc, support_store_host(p_store, history_id, &system));
 
 				// clear interleave tables from store file
 				db_delete_all_interleave_set_dimm_info_v1s(p_store);
 				db_delete_all_dimm_interleave_sets(p_store);
 
-				KEEP_ERROR(rc, support_store_sockets(p_store, history_id));
-				KEEP_ERROR(rc, support_store_platform_capabilities(p_store, history_id));
-				KEEP_ERROR(rc, support_store_namespaces(p_store, history_id));
-				KEEP_ERROR(rc, support_store_driver_capabilities(p_store, history_id));
-				KEEP_ERROR(rc, support_store_interleave_sets(p_store, history_id));
+				KEEP_ERROR(rc, support_store_sockets(p_store, history_id, &system));
+				KEEP_ERROR(rc, support_store_platform_capabilities(p_store, history_id, &system));
+				KEEP_ERROR(rc, support_store_namespaces(p_store, history_id, &system));
+				KEEP_ERROR(rc, support_store_driver_capabilities(p_store, history_id, &system));
+				KEEP_ERROR(rc, support_store_interleave_sets(p_store, history_id, &system));
 
-				// iterate through each device (for all adapters)
-				int dev_count = get_topology_count();
-				if (dev_count > 0)
+				for (int i = 0; i < dev_count; i++)
 				{
-					// get topology, aka discovery info
-					struct nvm_topology *topol = malloc(dev_count * sizeof(struct nvm_topology));
-					int temprc = get_topology(dev_count, topol);
-					if (temprc < NVM_SUCCESS)
+					KEEP_ERROR(rc, store_dimm_state(p_store, history_id, &p_dimms[i]));
+				}
+
+				if (in_transaction && db_end_transaction(p_store) != DB_SUCCESS)
+				{
+					COMMON_LOG_ERROR("Failed to commit the snapshot transaction");
+					db_rollback_transaction(p_store);
+					KEEP_ERROR(rc, NVM_ERR_UNKNOWN);
+				}
+				notify_pending_events();
+
+				if (p_dimms)
+				{
+					for (int i = 0; i < dev_count; i++)
 					{
-						COMMON_LOG_ERROR("Failed getting topology information");
-						KEEP_ERROR(rc, temprc);
+						free_dimm_state(&p_dimms[i]);
 					}
-					else
-					{
-						dev_count = temprc;
-						for (int i = 0; i < dev_count; i++)
-						{
-							KEEP_ERROR(rc, support_store_dimm_topology(p_store,
-									history_id, topol[i]));
-							KEEP_ERROR(rc, support_store_identify_dimm(p_store,
-									history_id,
-									topol[i].device_handle));
-							KEEP_ERROR(rc, support_store_device_characteristics(p_store,
-									history_id,
-									topol[i].device_handle));
-							KEEP_ERROR(rc, support_store_smart(p_store,
-									history_id, topol[i].device_handle));
-							KEEP_ERROR(rc, support_store_memory(p_store,
-									history_id, topol[i].device_handle));
-							KEEP_ERROR(rc, support_store_fw_image(p_store,
-									history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_dimm_details(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_dimm_partition_info(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_dimm_security_state(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_fw_error_logs(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_fw_debug_logs(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_die_sparing(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_power_management(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_alarm_thresholds(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_optional_config_data(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_platform_config_data(p_store,
-								history_id, topol[i].device_handle));
-							KEEP_ERROR(rc,
-								support_store_dimm_long_operation_status(p_store,
-								history_id, topol[i].device_handle));
-						} // for each device
-					} // get topology success
-
-                    free(topol);
-				} // if dev count > 0
+					free(p_dimms);
+				}
+				free_system_state(&system);
 			} // added history entry ok
 		}
 	}
@@ -244,43 +356,136 @@ int nvm_save_state(const char *name, const NVM_SIZE name_len)
  * Helper functions
  */
 
+/*
+ * Read the host and platform information a snapshot records. Failures are
+ * recorded in the state and reported when the snapshot is stored.
+ */
+void collect_system_state(struct system_state *p_system)
+{
+	COMMON_LOG_ENTRY();
+	memset(p_system, 0, sizeof (*p_system));
+
+	p_system->host_rc = nvm_get_host(&p_system->host);
+	p_system->sw_inventory_rc = nvm_get_sw_inventory(&p_system->sw_inventory);
+
+	// get numa_nodes
+	p_system->socket_count = nvm_get_socket_count();
+	if (p_system->socket_count > 0)
+	{
+		p_system->p_sockets = malloc(p_system->socket_count * sizeof (struct socket));
+		if (!p_system->p_sockets)
+		{
+			p_system->socket_count = NVM_ERR_NOMEMORY;
+		}
+		else if (p_system->socket_count !=
+				nvm_get_sockets(p_system->p_sockets, p_system->socket_count))
+		{
+			p_system->socket_count = NVM_ERR_UNKNOWN;
+		}
+	}
+
+	// retrieve current pcat table
+	p_system->p_pcat = calloc(1, sizeof (struct bios_capabilities));
+	p_system->pcat_rc = p_system->p_pcat ?
+			get_platform_capabilities(p_system->p_pcat) : NVM_ERR_NOMEMORY;
+
+	// namespace details read the label storage areas, so they are collected here too
+	p_system->namespace_count = nvm_get_namespace_count();
+	if (p_system->namespace_count > 0)
+	{
+		int ns_count = p_system->namespace_count;
+		struct namespace_discovery *p_discovery =
+				calloc(ns_count, sizeof (struct namespace_discovery));
+		p_system->p_namespaces = calloc(ns_count, sizeof (struct namespace_state));
+		if (!p_discovery || !p_system->p_namespaces)
+		{
+			p_system->namespace_count = NVM_ERR_NOMEMORY;
+		}
+		else if ((p_system->namespace_count = nvm_get_namespaces(p_discovery, ns_count)) > 0)
+		{
+			for (int i = 0; i < p_system->namespace_count; i++)
+			{
+				struct namespace_state *p_ns = &p_system->p_namespaces[i];
+				p_ns->discovery = p_discovery[i];
+				p_ns->details_rc = nvm_get_namespace_details(p_discovery[i].namespace_uid,
+						&p_ns->details);
+			}
+		}
+		free(p_discovery);
+	}
+
+	p_system->driver_capabilities_rc = get_driver_capabilities(&p_system->driver_capabilities);
+
+	p_system->interleave_count = get_interleave_set_count();
+	if (p_system->interleave_count > 0)
+	{
+		int interleave_count = p_system->interleave_count;
+		p_system->p_interleaves = calloc(interleave_count, sizeof (struct nvm_interleave_set));
+		if (!p_system->p_interleaves)
+		{
+			p_system->interleave_count = NVM_ERR_NOMEMORY;
+		}
+		else
+		{
+			p_system->interleave_count =
+					get_interleave_sets(interleave_count, p_system->p_interleaves);
+		}
+	}
+
+	COMMON_LOG_EXIT();
+}
+
+/*
+ * Free the buffers collect_system_state allocated
+ */
+void free_system_state(struct system_state *p_system)
+{
+	free(p_system->p_sockets);
+	p_system->p_sockets = NULL;
+	free(p_system->p_pcat);
+	p_system->p_pcat = NULL;
+	free(p_system->p_namespaces);
+	p_system->p_namespaces = NULL;
+	free(p_system->p_interleaves);
+	p_system->p_interleaves = NULL;
+}
+
 /*
  * Store the host server information in the database specified
  */
-int support_store_host(PersistentStore *p_store, int history_id)
+int support_store_host(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	// get the host server information
-	int tmp_rc = NVM_SUCCESS;
-	struct host host_server;
-	if ((tmp_rc = nvm_get_host(&host_server)) == NVM_SUCCESS)
+	const struct host *p_host = &p_system->host;
+	if (p_system->host_rc == NVM_SUCCESS)
 	{
 		// convert host struct to db_host struct
 		struct db_host db_host;
-		db_host.os_type = (int)host_server.os_type;
-		s_strncpy(db_host.name, HOST_NAME_LEN, host_server.name, NVM_COMPUTERNAME_LEN);
-		s_strncpy(db_host.os_name, HOST_OS_NAME_LEN, host_server.os_name, NVM_OSNAME_LEN);
+		db_host.os_type = (int)p_host->os_type;
+		s_strncpy(db_host.name, HOST_NAME_LEN, p_host->name, NVM_COMPUTERNAME_LEN);
+		s_strncpy(db_host.os_name, HOST_OS_NAME_LEN, p_host->os_name, NVM_OSNAME_LEN);
 		s_strncpy(db_host.os_version, HOST_OS_VERSION_LEN,
-				host_server.os_version, NVM_OSVERSION_LEN);
+				p_host->os_version, NVM_OSVERSION_LEN);
 		if (db_save_host_state(p_store, history_id, &db_host) != DB_SUCCESS)
 		{
 			COMMON_LOG_ERROR("Failed storing host %s history information");
 			rc = NVM_ERR_UNKNOWN;
 		}
 
-		struct sw_inventory inventory;
-		if ((tmp_rc = nvm_get_sw_inventory(&inventory)) == NVM_SUCCESS)
+		const struct sw_inventory *p_inventory = &p_system->sw_inventory;
+		if (p_system->sw_inventory_rc == NVM_SUCCESS)
 		{
 			struct db_sw_inventory db_inventory;
-			s_strncpy(db_inventory.name, SW_INVENTORY_NAME_LEN, host_server.name,
+			s_strncpy(db_inventory.name, SW_INVENTORY_NAME_LEN, p_host->name,
 					NVM_COMPUTERNAME_LEN);
 			s_strncpy(db_inventory.mgmt_sw_rev, SW_INVENTORY_MGMT_SW_REV_LEN,
-					inventory.mgmt_sw_revision, NVM_VERSION_LEN);
+					p_inventory->mgmt_sw_revision, NVM_VERSION_LEN);
 			s_strncpy(db_inventory.vendor_driver_rev, SW_INVENTORY_VENDOR_DRIVER_REV_LEN,
-					inventory.vendor_driver_revision, NVM_VERSION_LEN);
-			db_inventory.supported_driver_available = inventory.vendor_driver_compatible;
+					p_inventory->vendor_driver_revision, NVM_VERSION_LEN);
+			db_inventory.supported_driver_available = p_inventory->vendor_driver_compatible;
 			if (db_save_sw_inventory_state(p_store, history_id, &db_inventory) != DB_SUCCESS)
 			{
 				COMMON_LOG_ERROR("Failed storing software inventory history information");
@@ -289,155 +494,122 @@ int support_store_host(PersistentStore *p_store, int history_id)
 		}
 		else
 		{
-			COMMON_LOG_ERROR_F("Failed to get SW inventory, rc=%d", tmp_rc);
+			COMMON_LOG_ERROR_F("Failed to get SW inventory, rc=%d", p_system->sw_inventory_rc);
 		}
 	}
 	else
 	{
-		COMMON_LOG_ERROR_F("Failed to get host, rc=%d", tmp_rc);
+		COMMON_LOG_ERROR_F("Failed to get host, rc=%d", p_system->host_rc);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
-int support_store_sockets(PersistentStore *p_store, int history_id)
+int support_store_sockets(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system)
 {
 	int rc = NVM_SUCCESS;
-	// get numa_nodes
-	int socket_count = nvm_get_socket_count();
-	if (socket_count > 0)
+	if (p_system->socket_count > 0)
 	{
-		struct socket *sockets = malloc(socket_count * sizeof(struct socket));
-		if (socket_count != nvm_get_sockets(sockets, socket_count))
-		{
-			COMMON_LOG_ERROR("Failed getting socket information");
-		}
-		else
-		{
-			struct db_socket db_socket;
+		struct db_socket db_socket;
+		const struct socket *sockets = p_system->p_sockets;
 
-			for (int i = 0; i < socket_count; i++)
+		for (int i = 0; i < p_system->socket_count; i++)
+		{
+			memset(&db_socket, 0, sizeof (struct db_socket));
+
+			db_socket.id = sockets[i].id;
+			db_socket.type = sockets[i].type;
+			db_socket.model = sockets[i].model;
+			db_socket.family = sockets[i].family;
+			db_socket.brand = sockets[i].brand;
+			db_socket.stepping = sockets[i].stepping;
+			db_socket.logical_processor_count = sockets[i].logical_processor_count;
+			s_strncpy(db_socket.manufacturer, SOCKET_MANUFACTURER_LEN, sockets[i].manufacturer,
+					NVM_SOCKET_MANUFACTURER_LEN);
+
+			// save the numa nodes to the history tables
+			if (DB_SUCCESS != db_save_socket_state(p_store, history_id, &db_socket))
 			{
-				memset(&db_socket, 0, sizeof (struct db_socket));
-
-				db_socket.id = sockets[i].id;
-				db_socket.type = sockets[i].type;
-				db_socket.model = sockets[i].model;
-				db_socket.family = sockets[i].family;
-				db_socket.brand = sockets[i].brand;
-				db_socket.stepping = sockets[i].stepping;
-				db_socket.logical_processor_count = sockets[i].logical_processor_count;
-				s_strncpy(db_socket.manufacturer, SOCKET_MANUFACTURER_LEN, sockets[i].manufacturer,
-						NVM_SOCKET_MANUFACTURER_LEN);
-
-				// save the numa nodes to the history tables
-				if (DB_SUCCESS != db_save_socket_state(p_store, history_id, &db_socket))
-				{
-					COMMON_LOG_ERROR("Failed storing socket history information");
-					rc = NVM_ERR_UNKNOWN;
-				}
+				COMMON_LOG_ERROR("Failed storing socket history information");
+				rc = NVM_ERR_UNKNOWN;
 			}
 		}
-
-        free(sockets);
 	}
-	else if (socket_count < 0)
+	else if (p_system->socket_count < 0)
 	{
-		COMMON_LOG_ERROR_F("Getting socket count failed, rc=%d", socket_count);
+		COMMON_LOG_ERROR_F("Getting socket information failed, rc=%d", p_system->socket_count);
 	}
 	return rc;
 }
 
-int support_store_platform_capabilities(PersistentStore *p_store, int history_id)
+int support_store_platform_capabilities(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system)
 {
 	int rc = NVM_SUCCESS;
 
-	// retrieve current pcat table
-	struct bios_capabilities *p_pcat = calloc(1, sizeof (struct bios_capabilities));
-	if (!p_pcat)
+	if (p_system->pcat_rc == NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR("Unable to allocate memory for the PCAT structure");
+		rc = update_pcat_in_db(p_store, p_system->p_pcat, history_id);
 	}
 	else
 	{
-		int tmp_rc = get_platform_capabilities(p_pcat);
-		if (tmp_rc == NVM_SUCCESS)
-		{
-			rc = update_pcat_in_db(p_store, p_pcat, history_id);
-		}
-		else
-		{
-			COMMON_LOG_ERROR_F("get PCAT failed, rc=%d", tmp_rc);
-		}
-		free(p_pcat);
+		COMMON_LOG_ERROR_F("get PCAT failed, rc=%d", p_system->pcat_rc);
 	}
 	return rc;
 }
 
-int support_store_namespaces(PersistentStore *p_store, int history_id)
+int support_store_namespaces(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
-	// get pools
-	int ns_count = nvm_get_namespace_count();
-	if (ns_count > 0)
+	if (p_system->namespace_count > 0)
 	{
-		struct namespace_discovery *namespaces = malloc(ns_count * sizeof(struct namespace_discovery));
-		ns_count = nvm_get_namespaces(namespaces, ns_count);
-		if (ns_count < 0)
+		for (int i = 0; i < p_system->namespace_count; i++)
 		{
-			COMMON_LOG_ERROR_F(
-				"Failed to retrieve namespace list, error %d", ns_count);
-		}
-		else if (ns_count > 0) // at least one namespace
-		{
-			for (int i = 0; i < ns_count; i++)
+			const struct namespace_state *p_ns = &p_system->p_namespaces[i];
+
+			// store as much info as we can get - start with discovery info
+			struct db_namespace db_namespace;
+			memset(&db_namespace, 0, sizeof (db_namespace));
+			uid_copy(p_ns->discovery.namespace_uid, db_namespace.namespace_uid);
+			s_strcpy(db_namespace.friendly_name, p_ns->discovery.friendly_name,
+					NVM_NAMESPACE_NAME_LEN);
+
+			if (p_ns->details_rc != NVM_SUCCESS)
 			{
-				// store as much info as we can get - start with discovery info
-				struct db_namespace db_namespace;
-				memset(&db_namespace, 0, sizeof (db_namespace));
-				uid_copy(namespaces[i].namespace_uid, db_namespace.namespace_uid);
-				s_strcpy(db_namespace.friendly_name, namespaces[i].friendly_name,
-						NVM_NAMESPACE_NAME_LEN);
-
-				// get details
-				struct namespace_details details;
-				int tmp_rc = nvm_get_namespace_details(namespaces[i].namespace_uid, &details);
-				if (tmp_rc != NVM_SUCCESS)
-				{
-					NVM_UID uid_str;
-					uid_copy(namespaces[i].namespace_uid, uid_str);
-					COMMON_LOG_ERROR_F(
-						"Failed to retrieve namespace details for namespace %s", uid_str);
-				}
-				else
-				{
-					db_namespace.block_count = details.block_count;
-					db_namespace.block_size = details.block_size;
-					db_namespace.btt = details.btt;
-					db_namespace.enabled = details.enabled;
-					db_namespace.health = details.health;
-					db_namespace.type = details.type;
-					db_namespace.memory_page_allocation = details.memory_page_allocation;
-				}
+				NVM_UID uid_str;
+				uid_copy(p_ns->discovery.namespace_uid, uid_str);
+				COMMON_LOG_ERROR_F(
+					"Failed to retrieve namespace details for namespace %s", uid_str);
+			}
+			else
+			{
+				db_namespace.block_count = p_ns->details.block_count;
+				db_namespace.block_size = p_ns->details.block_size;
+				db_namespace.btt = p_ns->details.btt;
+				db_namespace.enabled = p_ns->details.enabled;
+				db_namespace.health = p_ns->details.health;
+				db_namespace.type = p_ns->details.type;
+				db_namespace.memory_page_allocation = p_ns->details.memory_page_allocation;
+			}
 
-				// save the namespace to the history table
-				if (db_save_namespace_state(p_store,
-						history_id, &db_namespace) != DB_SUCCESS)
-				{
-					COMMON_LOG_ERROR_F("Failed storing namespace %s history information",
-							db_namespace.friendly_name);
-					rc = NVM_ERR_UNKNOWN;
-				}
+			// save the namespace to the history table
+			if (db_save_namespace_state(p_store,
+					history_id, &db_namespace) != DB_SUCCESS)
+			{
+				COMMON_LOG_ERROR_F("Failed storing namespace %s history information",
+						db_namespace.friendly_name);
+				rc = NVM_ERR_UNKNOWN;
 			}
 		}
-
-        free(namespaces);
 	}
-	else if (ns_count < 0)
+	else if (p_system->namespace_count < 0)
 	{
-		COMMON_LOG_ERROR_F("Get namespace count failed, rc=%d", ns_count);
+		COMMON_LOG_ERROR_F("Failed to retrieve namespace list, rc=%d",
+				p_system->namespace_count);
 	}
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
@@ -491,14 +663,14 @@ int support_store_dimm_topology(PersistentStore *p_store, int history_id,
 }
 
 int support_store_identify_dimm(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
-	struct pt_payload_identify_dimm id_dimm;
-	int temprc = fw_get_identify_dimm(device_handle.handle, &id_dimm);
-	if (NVM_SUCCESS != temprc)
+	const struct pt_payload_identify_dimm *p_id_dimm = &p_dimm->identify;
+	if (NVM_SUCCESS != p_dimm->identify_rc)
 	{
 		COMMON_LOG_ERROR_F("Failed getting identify dimm information for handle %u",
 				device_handle.handle);
@@ -510,28 +682,28 @@ int support_store_identify_dimm(PersistentStore *p_store, int history_id,
 		memset(&db_idimm, 0, sizeof (struct db_identify_dimm));
 
 		db_idimm.device_handle = device_handle.handle;
-		db_idimm.vendor_id = id_dimm.vendor_id;
-		db_idimm.device_id = id_dimm.device_id;
-		db_idimm.revision_id = id_dimm.revision_id;
-		db_idimm.block_control_region_offset = id_dimm.obmcr;
-		db_idimm.dimm_sku = id_dimm.dimm_sku;
-		db_idimm.block_windows = id_dimm.nbw;
-		db_idimm.fw_api_version = id_dimm.api_ver;
-		db_idimm.fw_sw_mask = id_dimm.fswr;
-		db_idimm.interface_format_code = id_dimm.ifc;
-		db_idimm.interface_format_code_extra = id_dimm.ifce;
-		db_idimm.raw_cap = id_dimm.rc; // Store this data as 4KB units
+		db_idimm.vendor_id = p_id_dimm->vendor_id;
+		db_idimm.device_id = p_id_dimm->device_id;
+		db_idimm.revision_id = p_id_dimm->revision_id;
+		db_idimm.block_control_region_offset = p_id_dimm->obmcr;
+		db_idimm.dimm_sku = p_id_dimm->dimm_sku;
+		db_idimm.block_windows = p_id_dimm->nbw;
+		db_idimm.fw_api_version = p_id_dimm->api_ver;
+		db_idimm.fw_sw_mask = p_id_dimm->fswr;
+		db_idimm.interface_format_code = p_id_dimm->ifc;
+		db_idimm.interface_format_code_extra = p_id_dimm->ifce;
+		db_idimm.raw_cap = p_id_dimm->rc; // Store this data as 4KB units
 		// convert fw version to string
 		build_revision(db_idimm.fw_revision, IDENTIFY_DIMM_FW_REVISION_LEN,
-				id_dimm.fwr[4], id_dimm.fwr[3], id_dimm.fwr[2],
-				((id_dimm.fwr[1] * 100) + id_dimm.fwr[0]));
+				p_id_dimm->fwr[4], p_id_dimm->fwr[3], p_id_dimm->fwr[2],
+				((p_id_dimm->fwr[1] * 100) + p_id_dimm->fwr[0]));
 
 		// convert unsigned char array to number for storage in db
-		db_idimm.manufacturer = MANUFACTURER_TO_UINT(id_dimm.mf);
-		db_idimm.serial_num = SERIAL_NUMBER_TO_UINT(id_dimm.sn);
+		db_idimm.manufacturer = MANUFACTURER_TO_UINT(p_id_dimm->mf);
+		db_idimm.serial_num = SERIAL_NUMBER_TO_UINT(p_id_dimm->sn);
 
 		s_strncpy(db_idimm.part_num, IDENTIFY_DIMM_PART_NUM_LEN,
-				(char *)id_dimm.pn, DEV_PARTNUM_LEN);
+				(char *)p_id_dimm->pn, DEV_PARTNUM_LEN);
 
 		if (DB_SUCCESS != db_save_identify_dimm_state(p_store, history_id, &db_idimm))
 		{
@@ -546,73 +718,64 @@ int support_store_identify_dimm(PersistentStore *p_store, int history_id,
 }
 
 int support_store_device_characteristics(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
-	struct pt_payload_device_characteristics *p_dev_characteristics =
-		calloc(1, sizeof (struct pt_payload_device_characteristics));
-	if (!p_dev_characteristics)
+	const struct pt_payload_device_characteristics *p_dev_characteristics =
+		&p_dimm->characteristics;
+	if (NVM_SUCCESS != p_dimm->characteristics_rc)
 	{
-		COMMON_LOG_ERROR("Unable to allocate memory for device characteristics payload");
+		COMMON_LOG_ERROR_F("Failed getting device characteristics information for "
+				"handle %u", device_handle.handle);
 	}
 	else
 	{
-		int temprc = fw_get_id_dimm_device_characteristics(
-			device_handle.handle, p_dev_characteristics);
-		if (NVM_SUCCESS != temprc)
+		struct db_device_characteristics *p_db_device_characteristics =
+			calloc(1, sizeof (struct db_device_characteristics));
+
+		if (p_db_device_characteristics)
 		{
-			COMMON_LOG_ERROR_F("Failed getting device characteristics information for "
-					"handle %u", device_handle.handle);
+			p_db_device_characteristics->device_handle = device_handle.handle;
+			p_db_device_characteristics->controller_temp_shutdown_threshold =
+				(unsigned int)p_dev_characteristics->controller_temp_shutdown_threshold;
+			p_db_device_characteristics->media_temp_shutdown_threshold =
+				(unsigned int)p_dev_characteristics->media_temp_shutdown_threshold;
+			p_db_device_characteristics->throttling_start_threshold =
+				(unsigned int)p_dev_characteristics->throttling_start_threshold;
+			p_db_device_characteristics->throttling_stop_threshold =
+				(unsigned int)p_dev_characteristics->throttling_stop_threshold;
+			if (DB_SUCCESS != db_save_device_characteristics_state(p_store,
+				history_id, p_db_device_characteristics))
+			{
+				COMMON_LOG_ERROR_F("Failed storing device characteristics for "
+						"handle %u", device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
+			}
 		}
 		else
 		{
-			struct db_device_characteristics *p_db_device_characteristics =
-				calloc(1, sizeof (struct db_device_characteristics));
-
-			if (p_db_device_characteristics)
-			{
-				p_db_device_characteristics->device_handle = device_handle.handle;
-				p_db_device_characteristics->controller_temp_shutdown_threshold =
-					(unsigned int)p_dev_characteristics->controller_temp_shutdown_threshold;
-				p_db_device_characteristics->media_temp_shutdown_threshold =
-					(unsigned int)p_dev_characteristics->media_temp_shutdown_threshold;
-				p_db_device_characteristics->throttling_start_threshold =
-					(unsigned int)p_dev_characteristics->throttling_start_threshold;
-				p_db_device_characteristics->throttling_stop_threshold =
-					(unsigned int)p_dev_characteristics->throttling_stop_threshold;
-				if (DB_SUCCESS != db_save_device_characteristics_state(p_store,
-					history_id, p_db_device_characteristics))
-				{
-					COMMON_LOG_ERROR_F("Failed storing device characteristics for "
-							"handle %u", device_handle.handle);
-					rc = NVM_ERR_UNKNOWN;
-				}
-			}
-			else
-			{
-				COMMON_LOG_ERROR(
-					"Unable to allocate memory for device characteristic database info");
-			}
-			free(p_db_device_characteristics);
+			COMMON_LOG_ERROR(
+				"Unable to allocate memory for device characteristic database info");
 		}
+		free(p_db_device_characteristics);
 	}
-	free(p_dev_characteristics);
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
 int support_store_smart(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	// add smart table
-	struct pt_payload_smart_health dimm_smart;
-	int temprc = fw_get_smart_health(device_handle.handle, &dimm_smart);
-	if (NVM_SUCCESS != temprc)
+	const struct pt_payload_smart_health *p_smart = &p_dimm->smart;
+	if (NVM_SUCCESS != p_dimm->smart_rc)
 	{
 		COMMON_LOG_ERROR_F("Failed getting dimm smart information for handle %u",
 				device_handle.handle);
@@ -621,21 +784,21 @@ int support_store_smart(PersistentStore *p_store, int history_id,
 	{
 		struct db_dimm_smart db_smart;
 		db_smart.device_handle = device_handle.handle;
-		db_smart.validation_flags = dimm_smart.validation_flags.flags;
-		db_smart.health_status = dimm_smart.health_status;
-		db_smart.media_temperature = dimm_smart.media_temperature;
-		db_smart.controller_temperature = dimm_smart.controller_temperature;
-		db_smart.spare = dimm_smart.spare;
-		db_smart.alarm_trips = dimm_smart.alarm_trips;
-		db_smart.percentage_used = dimm_smart.percentage_used;
-		db_smart.lss = dimm_smart.lss;
-		db_smart.vendor_specific_data_size = dimm_smart.vendor_specific_data_size;
-		db_smart.power_cycles = dimm_smart.vendor_data.power_cycles;
-		db_smart.power_on_seconds = dimm_smart.vendor_data.power_on_seconds;
-		db_smart.uptime = dimm_smart.vendor_data.uptime;
-		db_smart.unsafe_shutdowns = dimm_smart.vendor_data.unsafe_shutdowns;
-		db_smart.lss_details = dimm_smart.vendor_data.lss_details;
-		db_smart.last_shutdown_time = dimm_smart.vendor_data.last_shutdown_time;
+		db_smart.validation_flags = p_smart->validation_flags.flags;
+		db_smart.health_status = p_smart->health_status;
+		db_smart.media_temperature = p_smart->media_temperature;
+		db_smart.controller_temperature = p_smart->controller_temperature;
+		db_smart.spare = p_smart->spare;
+		db_smart.alarm_trips = p_smart->alarm_trips;
+		db_smart.percentage_used = p_smart->percentage_used;
+		db_smart.lss = p_smart->lss;
+		db_smart.vendor_specific_data_size = p_smart->vendor_specific_data_size;
+		db_smart.power_cycles = p_smart->vendor_data.power_cycles;
+		db_smart.power_on_seconds = p_smart->vendor_data.power_on_seconds;
+		db_smart.uptime = p_smart->vendor_data.uptime;
+		db_smart.unsafe_shutdowns = p_smart->vendor_data.unsafe_shutdowns;
+		db_smart.lss_details = p_smart->vendor_data.lss_details;
+		db_smart.last_shutdown_time = p_smart->vendor_data.last_shutdown_time;
 
 		if (DB_SUCCESS != db_save_dimm_smart_state(p_store, history_id, &db_smart))
 		{
@@ -649,27 +812,25 @@ int support_store_smart(PersistentStore *p_store, int history_id,
 }
 
 int support_store_memory(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
-	int temp_rc;
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	// Page 0
 	{
-		struct pt_payload_memory_info_page0 page;
-		temp_rc = fw_get_memory_info_page(device_handle.handle, 0,
-			&page, sizeof (page));
-		if (temp_rc == NVM_SUCCESS)
+		const struct pt_payload_memory_info_page0 *p_page = &p_dimm->memory_page0;
+		if (p_dimm->memory_page0_rc == NVM_SUCCESS)
 		{
 			struct db_dimm_memory_info_page0 db_page = { 0 };
 			db_page.device_handle = device_handle.handle;
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.bytes_read, db_page.bytes_read);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.bytes_written, db_page.bytes_written);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.read_reqs, db_page.read_reqs);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.write_reqs, db_page.write_reqs);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.block_read_reqs, db_page.block_read_reqs);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.block_write_reqs, db_page.block_write_reqs);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->bytes_read, db_page.bytes_read);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->bytes_written, db_page.bytes_written);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->read_reqs, db_page.read_reqs);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->write_reqs, db_page.write_reqs);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->block_read_reqs, db_page.block_read_reqs);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->block_write_reqs, db_page.block_write_reqs);
 
 			if (db_save_dimm_memory_info_page0_state(p_store, history_id, &db_page) != DB_SUCCESS)
 			{
@@ -687,20 +848,18 @@ int support_store_memory(PersistentStore *p_store, int history_id,
 
 	// Page 1
 	{
-		struct pt_payload_memory_info_page1 page;
-		temp_rc = fw_get_memory_info_page(device_handle.handle, 1,
-			&page, sizeof (page));
-		if (temp_rc == NVM_SUCCESS)
+		const struct pt_payload_memory_info_page1 *p_page = &p_dimm->memory_page1;
+		if (p_dimm->memory_page1_rc == NVM_SUCCESS)
 		{
 			struct db_dimm_memory_info_page1 db_page = { 0 };
 			db_page.device_handle = device_handle.handle;
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.total_bytes_read, db_page.total_bytes_read);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.total_bytes_written, db_page.total_bytes_written);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.total_read_reqs, db_page.total_read_reqs);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.total_write_reqs, db_page.total_write_reqs);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.total_block_read_reqs,
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->total_bytes_read, db_page.total_bytes_read);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->total_bytes_written, db_page.total_bytes_written);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->total_read_reqs, db_page.total_read_reqs);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->total_write_reqs, db_page.total_write_reqs);
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->total_block_read_reqs,
 				db_page.total_block_read_reqs);
-			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(page.total_block_write_reqs,
+			NVM_8_BYTE_ARRAY_TO_64_BIT_VALUE(p_page->total_block_write_reqs,
 				db_page.total_block_write_reqs);
 
 			if (db_save_dimm_memory_info_page1_state(p_store, history_id, &db_page) != DB_SUCCESS)
@@ -722,15 +881,15 @@ int support_store_memory(PersistentStore *p_store, int history_id,
 }
 
 int support_store_fw_image(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	// add fw image table
-	struct pt_payload_fw_image_info fw_image_info;
-	int temprc = fw_get_fw_image_info(device_handle.handle, &fw_image_info);
-	if (NVM_SUCCESS != temprc)
+	const struct pt_payload_fw_image_info *p_fw_image_info = &p_dimm->fw_image;
+	if (NVM_SUCCESS != p_dimm->fw_image_rc)
 	{
 		COMMON_LOG_ERROR_F("Failed getting firmware image information for "
 				"handle %u", device_handle.handle);
@@ -741,13 +900,13 @@ int support_store_fw_image(PersistentStore *p_store, int history_id,
 
 		db_dimm_fw.device_handle = device_handle.handle;
 		// convert fw version to string
-		FW_VER_ARR_TO_STR(fw_image_info.fw_rev, db_dimm_fw.fw_rev, DIMM_FW_IMAGE_FW_REV_LEN);
+		FW_VER_ARR_TO_STR(p_fw_image_info->fw_rev, db_dimm_fw.fw_rev, DIMM_FW_IMAGE_FW_REV_LEN);
 		FW_VER_ARR_TO_STR(
-			fw_image_info.staged_fw_rev, db_dimm_fw.staged_fw_rev, DIMM_FW_IMAGE_FW_REV_LEN);
-		db_dimm_fw.fw_type = fw_image_info.fw_type;
-		db_dimm_fw.fw_update_status = fw_image_info.last_fw_update_status;
-		memmove(db_dimm_fw.commit_id, fw_image_info.commit_id, DEV_FW_COMMIT_ID_LEN);
-		memmove(db_dimm_fw.build_configuration, fw_image_info.build_configuration,
+			p_fw_image_info->staged_fw_rev, db_dimm_fw.staged_fw_rev, DIMM_FW_IMAGE_FW_REV_LEN);
+		db_dimm_fw.fw_type = p_fw_image_info->fw_type;
+		db_dimm_fw.fw_update_status = p_fw_image_info->last_fw_update_status;
+		memmove(db_dimm_fw.commit_id, p_fw_image_info->commit_id, DEV_FW_COMMIT_ID_LEN);
+		memmove(db_dimm_fw.build_configuration, p_fw_image_info->build_configuration,
 			DEV_FW_BUILD_CONFIGURATION_LEN);
 
 		// make sure the string is NULL terminated
@@ -766,15 +925,15 @@ int support_store_fw_image(PersistentStore *p_store, int history_id,
 }
 
 int support_store_dimm_details(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	// add details
-	struct nvm_details dimm_details;
-	int temprc = get_dimm_details(device_handle, &dimm_details);
-	if (NVM_SUCCESS != temprc)
+	const struct nvm_details *p_details = &p_dimm->details;
+	if (NVM_SUCCESS != p_dimm->details_rc)
 	{
 		COMMON_LOG_ERROR_F("Failed getting dimm details information for "
 				"handle %u", device_handle.handle);
@@ -784,20 +943,20 @@ int support_store_dimm_details(PersistentStore *p_store, int history_id,
 		struct db_dimm_details db_details;
 
 		db_details.device_handle = device_handle.handle;
-		db_details.form_factor = dimm_details.form_factor;
-		db_details.data_width = dimm_details.data_width;
-		db_details.total_width = dimm_details.total_width;
-		db_details.speed = dimm_details.speed;
-		db_details.size = dimm_details.size;
-		db_details.type = dimm_details.type;
-		db_details.type_detail = dimm_details.type_detail_bits;
-		db_details.id = dimm_details.id;
+		db_details.form_factor = p_details->form_factor;
+		db_details.data_width = p_details->data_width;
+		db_details.total_width = p_details->total_width;
+		db_details.speed = p_details->speed;
+		db_details.size = p_details->size;
+		db_details.type = p_details->type;
+		db_details.type_detail = p_details->type_detail_bits;
+		db_details.id = p_details->id;
 		s_strncpy(db_details.device_locator, DIMM_DETAILS_DEVICE_LOCATOR_LEN,
-						dimm_details.device_locator, NVM_DEVICE_LOCATOR_LEN);
+						p_details->device_locator, NVM_DEVICE_LOCATOR_LEN);
 		s_strncpy(db_details.bank_label, DIMM_DETAILS_BANK_LABEL_LEN,
-				dimm_details.bank_label, NVM_BANK_LABEL_LEN);
+				p_details->bank_label, NVM_BANK_LABEL_LEN);
 		s_strncpy(db_details.manufacturer, DIMM_DETAILS_MANUFACTURER_LEN,
-				dimm_details.manufacturer, NVM_MANUFACTURERSTR_LEN);
+				p_details->manufacturer, NVM_MANUFACTURERSTR_LEN);
 		if (DB_SUCCESS
 				!= db_save_dimm_details_state(p_store, history_id, &db_details))
 		{
@@ -812,22 +971,15 @@ int support_store_dimm_details(PersistentStore *p_store, int history_id,
 }
 
 int support_store_dimm_partition_info(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	// get total capacities from the dimm partition info
-	struct pt_payload_get_dimm_partition_info pi;
-	memset(&pi, 0, sizeof (pi));
-	struct fw_cmd partition_cmd;
-	memset(&partition_cmd, 0, sizeof (partition_cmd));
-	partition_cmd.device_handle = device_handle.handle;
-	partition_cmd.opcode = PT_GET_ADMIN_FEATURES;
-	partition_cmd.sub_opcode = SUBOP_DIMM_PARTITION_INFO;
-	partition_cmd.output_payload_size = sizeof (pi);
-	partition_cmd.output_payload = &pi;
-	if (ioctl_passthrough_cmd(&partition_cmd) != NVM_SUCCESS)
+	const struct pt_payload_get_dimm_partition_info *p_pi = &p_dimm->partition;
+	if (p_dimm->partition_rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Failed getting dimm %u partition information",
 				device_handle.handle);
@@ -838,11 +990,11 @@ int support_store_dimm_partition_info(PersistentStore *p_store, int history_id,
 		struct db_dimm_partition db_partition;
 		memset(&db_partition, 0, sizeof (db_partition));
 		db_partition.device_handle = device_handle.handle;
-		db_partition.pm_start = pi.start_pmem;
-		db_partition.pmem_capacity = pi.pmem_capacity;
-		db_partition.raw_capacity = pi.raw_capacity;
-		db_partition.volatile_capacity = pi.volatile_capacity;
-		db_partition.volatile_start = pi.start_volatile;
+		db_partition.pm_start = p_pi->start_pmem;
+		db_partition.pmem_capacity = p_pi->pmem_capacity;
+		db_partition.raw_capacity = p_pi->raw_capacity;
+		db_partition.volatile_capacity = p_pi->volatile_capacity;
+		db_partition.volatile_start = p_pi->start_volatile;
 		if (db_save_dimm_partition_state(p_store,
 				history_id, &db_partition) != DB_SUCCESS)
 		{
@@ -857,22 +1009,14 @@ int support_store_dimm_partition_info(PersistentStore *p_store, int history_id,
 }
 
 int support_store_dimm_security_state(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
-	// get the current security state
-	struct pt_payload_get_security_state security_state;
-	struct fw_cmd cmd;
-	memset(&cmd, 0, sizeof (struct fw_cmd));
-	cmd.device_handle = device_handle.handle;
-	cmd.opcode = PT_GET_SEC_INFO;
-	cmd.sub_opcode = 0;
-	cmd.output_payload_size = sizeof (security_state);
-	cmd.output_payload = &security_state;
-	int temprc = ioctl_passthrough_cmd(&cmd);
-	if (temprc != NVM_SUCCESS)
+	// the current security state
+	if (p_dimm->security_rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Failed to get the security state for dimm %d",
 				device_handle.handle);
@@ -881,7 +1025,7 @@ int support_store_dimm_security_state(PersistentStore *p_store, int history_id,
 	{
 		struct db_dimm_security_info db_security;
 		db_security.device_handle = device_handle.handle;
-		db_security.security_state = security_state.security_status;
+		db_security.security_state = p_dimm->security.security_status;
 		if (db_save_dimm_security_info_state(
 				p_store, history_id, &db_security) != DB_SUCCESS)
 		{
@@ -896,61 +1040,43 @@ int support_store_dimm_security_state(PersistentStore *p_store, int history_id,
 }
 
 int get_low_priority_media_logs(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_LOW | DEV_FW_ERR_LOG_MEDIA];
 
-	// get the total number of low priority media log entries
-	unsigned int error_count = fw_get_fw_error_log_count(device_handle.handle,
-			DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_MEDIA);
-	if (error_count < 0)
+	if (p_log->entries_rc != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F("Couldn't get low priority media log count for handle %u",
-				device_handle.handle);
+		COMMON_LOG_ERROR_F(
+		"Failed to get low priority firmware media error logs for dimm %d",
+		device_handle.handle);
 	}
-	else if (error_count > 0)
+	else
 	{
-		// get low priority media error log entries
-		NVM_UINT8 *large_buffer = calloc(1, error_count * sizeof (struct pt_fw_media_log_entry));
-		if (large_buffer != NULL)
+		struct pt_fw_media_log_entry *p_low_media_logs =
+			(struct pt_fw_media_log_entry *)p_log->p_entries;
+		struct db_fw_media_low_log_entry media_low_log;
+		for (int i = 0; i < p_log->entry_count; i++)
 		{
-			int temprc = fw_get_fw_error_logs(device_handle.handle,
-					error_count, large_buffer,
-					DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_MEDIA);
-			if (temprc != NVM_SUCCESS)
-			{
-				COMMON_LOG_ERROR_F(
-				"Failed to get low priority firmware media error logs for dimm %d",
-				device_handle.handle);
-			}
-			else
+			memset(&media_low_log, 0, sizeof (media_low_log));
+			media_low_log.device_handle = device_handle.handle;
+			media_low_log.system_timestamp = p_low_media_logs[i].system_timestamp;
+			media_low_log.dpa = p_low_media_logs[i].dpa;
+			media_low_log.pda = p_low_media_logs[i].pda;
+			media_low_log.transaction_type = p_low_media_logs[i].transaction_type;
+			media_low_log.error_flags = p_low_media_logs[i].error_flags;
+			media_low_log.error_type = p_low_media_logs[i].error_type;
+			media_low_log.range = p_low_media_logs[i].range;
+			if (db_save_fw_media_low_log_entry_state(p_store, history_id, &media_low_log)
+					!= DB_SUCCESS)
 			{
-				struct pt_fw_media_log_entry *p_low_media_logs =
-					(struct pt_fw_media_log_entry *)large_buffer;
-				struct db_fw_media_low_log_entry media_low_log;
-				for (int i = 0; i < error_count; i++)
-				{
-					memset(&media_low_log, 0, sizeof (media_low_log));
-					media_low_log.device_handle = device_handle.handle;
-					media_low_log.system_timestamp = p_low_media_logs[i].system_timestamp;
-					media_low_log.dpa = p_low_media_logs[i].dpa;
-					media_low_log.pda = p_low_media_logs[i].pda;
-					media_low_log.transaction_type = p_low_media_logs[i].transaction_type;
-					media_low_log.error_flags = p_low_media_logs[i].error_flags;
-					media_low_log.error_type = p_low_media_logs[i].error_type;
-					media_low_log.range = p_low_media_logs[i].range;
-					if (db_save_fw_media_low_log_entry_state(p_store, history_id, &media_low_log)
-							!= DB_SUCCESS)
-					{
-						COMMON_LOG_ERROR_F("Could not save low priority media logs for handle %u",
-								device_handle.handle);
-						rc = NVM_ERR_UNKNOWN;
-					}
-				}
+				COMMON_LOG_ERROR_F("Could not save low priority media logs for handle %u",
+						device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
 			}
-			free(large_buffer);
-			large_buffer = NULL;
 		}
 	}
 
@@ -959,61 +1085,43 @@ int get_low_priority_media_logs(PersistentStore *p_store, int history_id,
 }
 
 int get_high_priority_media_logs(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_HIGH | DEV_FW_ERR_LOG_MEDIA];
 
-	// get the total number of high priority media log entries
-	unsigned int error_count = fw_get_fw_error_log_count(device_handle.handle,
-			DEV_FW_ERR_LOG_HIGH, DEV_FW_ERR_LOG_MEDIA);
-	if (error_count < 0)
+	if (p_log->entries_rc != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F("Couldn't get high priority media log count for handle %u",
-				device_handle.handle);
+		COMMON_LOG_ERROR_F(
+		"Failed to get high priority firmware media error logs for dimm %d",
+		device_handle.handle);
 	}
 	else
 	{
-		// get high priority media error log entries
-		NVM_UINT8 *large_buffer = calloc(1, error_count * sizeof (struct pt_fw_media_log_entry));
-		if (large_buffer != NULL)
+		struct pt_fw_media_log_entry *p_high_media_logs =
+			(struct pt_fw_media_log_entry *)p_log->p_entries;
+		struct db_fw_media_high_log_entry media_high_log;
+		for (int i = 0; i < p_log->entry_count; i++)
 		{
-			int temprc = fw_get_fw_error_logs(device_handle.handle,
-								error_count, large_buffer,
-								DEV_FW_ERR_LOG_HIGH, DEV_FW_ERR_LOG_MEDIA);
-			if (temprc != NVM_SUCCESS)
-			{
-				COMMON_LOG_ERROR_F(
-				"Failed to get high priority firmware media error logs for dimm %d",
-				device_handle.handle);
-			}
-			else
+			memset(&media_high_log, 0, sizeof (media_high_log));
+			media_high_log.device_handle = device_handle.handle;
+			media_high_log.system_timestamp = p_high_media_logs[i].system_timestamp;
+			media_high_log.dpa = p_high_media_logs[i].dpa;
+			media_high_log.pda = p_high_media_logs[i].pda;
+			media_high_log.transaction_type = p_high_media_logs[i].transaction_type;
+			media_high_log.error_flags = p_high_media_logs[i].error_flags;
+			media_high_log.error_type = p_high_media_logs[i].error_type;
+			media_high_log.range = p_high_media_logs[i].range;
+			if (db_save_fw_media_high_log_entry_state(p_store, history_id, &media_high_log)
+					!= DB_SUCCESS)
 			{
-				struct pt_fw_media_log_entry *p_high_media_logs =
-					(struct pt_fw_media_log_entry *)large_buffer;
-				struct db_fw_media_high_log_entry media_high_log;
-				for (int i = 0; i < error_count; i++)
-				{
-					memset(&media_high_log, 0, sizeof (media_high_log));
-					media_high_log.device_handle = device_handle.handle;
-					media_high_log.system_timestamp = p_high_media_logs[i].system_timestamp;
-					media_high_log.dpa = p_high_media_logs[i].dpa;
-					media_high_log.pda = p_high_media_logs[i].pda;
-					media_high_log.transaction_type = p_high_media_logs[i].transaction_type;
-					media_high_log.error_flags = p_high_media_logs[i].error_flags;
-					media_high_log.error_type = p_high_media_logs[i].error_type;
-					media_high_log.range = p_high_media_logs[i].range;
-					if (db_save_fw_media_high_log_entry_state(p_store, history_id, &media_high_log)
-							!= DB_SUCCESS)
-					{
-						COMMON_LOG_ERROR_F("Could not save high priority media logs for handle %u",
-								device_handle.handle);
-						rc = NVM_ERR_UNKNOWN;
-					}
-				}
+				COMMON_LOG_ERROR_F("Could not save high priority media logs for handle %u",
+						device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
 			}
-			free(large_buffer);
-			large_buffer = NULL;
 		}
 	}
 
@@ -1022,56 +1130,38 @@ int get_high_priority_media_logs(PersistentStore *p_store, int history_id,
 }
 
 int get_low_priority_thermal_logs(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_LOW | DEV_FW_ERR_LOG_THERMAL];
 
-	// get the total number of low priority thermal log entries
-	unsigned int error_count = fw_get_fw_error_log_count(device_handle.handle,
-			DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_THERMAL);
-	if (error_count < 0)
+	if (p_log->entries_rc != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F("Couldn't get low priority therm log count for handle %u",
-				device_handle.handle);
+		COMMON_LOG_ERROR_F(
+		"Failed to get low priority firmware thermal error logs for dimm %d",
+		device_handle.handle);
 	}
 	else
 	{
-		// get low priority thermal error log entries
-		NVM_UINT8 *large_buffer = calloc(1, error_count * sizeof (struct pt_fw_thermal_log_entry));
-		if (large_buffer != NULL)
+		struct pt_fw_thermal_log_entry *p_thermal_logs =
+			(struct pt_fw_thermal_log_entry *)p_log->p_entries;
+		struct db_fw_thermal_low_log_entry thermal_low_log;
+		for (int i = 0; i < p_log->entry_count; i++)
 		{
-			int temprc = fw_get_fw_error_logs(device_handle.handle,
-							error_count, large_buffer,
-							DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_THERMAL);
-			if (temprc != NVM_SUCCESS)
-			{
-				COMMON_LOG_ERROR_F(
-				"Failed to get low priority firmware thermal error logs for dimm %d",
-				device_handle.handle);
-			}
-			else
+			memset(&thermal_low_log, 0, sizeof (thermal_low_log));
+			thermal_low_log.device_handle = device_handle.handle;
+			thermal_low_log.host_reported_temp_data = p_thermal_logs[i].host_reported_temp_data.data;
+			thermal_low_log.system_timestamp = p_thermal_logs[i].system_timestamp;
+			if (db_save_fw_thermal_low_log_entry_state(p_store, history_id, &thermal_low_log)
+					!= DB_SUCCESS)
 			{
-				struct pt_fw_thermal_log_entry *p_thermal_logs =
-					(struct pt_fw_thermal_log_entry *)large_buffer;
-				struct db_fw_thermal_low_log_entry thermal_low_log;
-				for (int i = 0; i < error_count; i++)
-				{
-					memset(&thermal_low_log, 0, sizeof (thermal_low_log));
-					thermal_low_log.device_handle = device_handle.handle;
-					thermal_low_log.host_reported_temp_data = p_thermal_logs[i].host_reported_temp_data.data;
-					thermal_low_log.system_timestamp = p_thermal_logs[i].system_timestamp;
-					if (db_save_fw_thermal_low_log_entry_state(p_store, history_id, &thermal_low_log)
-							!= DB_SUCCESS)
-					{
-						COMMON_LOG_ERROR_F("Could not save low priority therm logs for handle %u",
-								device_handle.handle);
-						rc = NVM_ERR_UNKNOWN;
-					}
-				}
+				COMMON_LOG_ERROR_F("Could not save low priority therm logs for handle %u",
+						device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
 			}
-			free(large_buffer);
-			large_buffer = NULL;
 		}
 	}
 
@@ -1080,56 +1170,38 @@ int get_low_priority_thermal_logs(PersistentStore *p_store, int history_id,
 }
 
 int get_high_priority_thermal_logs(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_HIGH | DEV_FW_ERR_LOG_THERMAL];
 
-	// get the total number of high priority thermal log entries
-	unsigned int error_count = fw_get_fw_error_log_count(device_handle.handle,
-		DEV_FW_ERR_LOG_HIGH, DEV_FW_ERR_LOG_THERMAL);
-	if (error_count < 0)
+	if (p_log->entries_rc != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F("Couldn't get high priority therm log count for handle %u",
-				device_handle.handle);
+		COMMON_LOG_ERROR_F(
+		"Failed to get high priority firmware thermal error logs for dimm %d",
+		device_handle.handle);
 	}
 	else
 	{
-		// get high priority thermal error log entries
-		NVM_UINT8 *large_buffer = calloc(1, error_count * sizeof (struct pt_fw_thermal_log_entry));
-		if (large_buffer != NULL)
+		struct pt_fw_thermal_log_entry *p_thermal_logs =
+			(struct pt_fw_thermal_log_entry *)p_log->p_entries;
+		struct db_fw_thermal_high_log_entry thermal_high_log;
+		for (int i = 0; i < p_log->entry_count; i++)
 		{
-			int temprc = fw_get_fw_error_logs(device_handle.handle,
-							error_count, large_buffer,
-							DEV_FW_ERR_LOG_HIGH, DEV_FW_ERR_LOG_THERMAL);
-			if (temprc != NVM_SUCCESS)
-			{
-				COMMON_LOG_ERROR_F(
-				"Failed to get high priority firmware thermal error logs for dimm %d",
-				device_handle.handle);
-			}
-			else
+			memset(&thermal_high_log, 0, sizeof (thermal_high_log));
+			thermal_high_log.device_handle = device_handle.handle;
+			thermal_high_log.host_reported_temp_data = p_thermal_logs[i].host_reported_temp_data.data;
+			thermal_high_log.system_timestamp = p_thermal_logs[i].system_timestamp;
+			if (db_save_fw_thermal_high_log_entry_state(p_store, history_id, &thermal_high_log)
+					!= DB_SUCCESS)
 			{
-				struct pt_fw_thermal_log_entry *p_thermal_logs =
-					(struct pt_fw_thermal_log_entry *)large_buffer;
-				struct db_fw_thermal_high_log_entry thermal_high_log;
-				for (int i = 0; i < error_count; i++)
-				{
-					memset(&thermal_high_log, 0, sizeof (thermal_high_log));
-					thermal_high_log.device_handle = device_handle.handle;
-					thermal_high_log.host_reported_temp_data = p_thermal_logs[i].host_reported_temp_data.data;
-					thermal_high_log.system_timestamp = p_thermal_logs[i].system_timestamp;
-					if (db_save_fw_thermal_high_log_entry_state(p_store, history_id, &thermal_high_log)
-							!= DB_SUCCESS)
-					{
-						COMMON_LOG_ERROR_F("Could not save high priority therm logs for handle %u",
-								device_handle.handle);
-						rc = NVM_ERR_UNKNOWN;
-					}
-				}
+				COMMON_LOG_ERROR_F("Could not save high priority therm logs for handle %u",
+						device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
 			}
-			free(large_buffer);
-			large_buffer = NULL;
 		}
 	}
 
@@ -1138,17 +1210,14 @@ int get_high_priority_thermal_logs(PersistentStore *p_store, int history_id,
 }
 
 int get_high_priority_thermal_log_info(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
-
-	struct pt_payload_fw_log_info_data log_info_data;
-	memset(&log_info_data, 0, sizeof (log_info_data));
-	// get the total number of high priority thermal log entries
-	unsigned int temprc = fw_get_fw_error_log_info_data(device_handle.handle,
-		DEV_FW_ERR_LOG_HIGH, DEV_FW_ERR_LOG_THERMAL, &log_info_data);
-	if (temprc != NVM_SUCCESS)
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_HIGH | DEV_FW_ERR_LOG_THERMAL];
+	if (p_log->info_rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F(
 		"Failed to get high priority firmware thermal error log info for dimm %d",
@@ -1159,11 +1228,11 @@ int get_high_priority_thermal_log_info(PersistentStore *p_store, int history_id,
 		struct db_fw_thermal_high_log_info db_log_info;
 		memset(&db_log_info, 0, sizeof (db_log_info));
 		db_log_info.device_handle = device_handle.handle;
-		db_log_info.max_log_entries = log_info_data.max_log_entries;
-		db_log_info.current_sequence_number = log_info_data.current_sequence_number;
-		db_log_info.oldest_sequence_number = log_info_data.oldest_sequence_number;
-		db_log_info.oldest_log_entry_timestamp = log_info_data.oldest_log_entry_timestamp;
-		db_log_info.newest_log_entry_timestamp = log_info_data.newest_log_entry_timestamp;
+		db_log_info.max_log_entries = p_log->info.max_log_entries;
+		db_log_info.current_sequence_number = p_log->info.current_sequence_number;
+		db_log_info.oldest_sequence_number = p_log->info.oldest_sequence_number;
+		db_log_info.oldest_log_entry_timestamp = p_log->info.oldest_log_entry_timestamp;
+		db_log_info.newest_log_entry_timestamp = p_log->info.newest_log_entry_timestamp;
 		if (db_save_fw_thermal_high_log_info_state(p_store, history_id, &db_log_info)
 				!= DB_SUCCESS)
 		{
@@ -1177,17 +1246,14 @@ int get_high_priority_thermal_log_info(PersistentStore *p_store, int history_id,
 }
 
 int get_low_priority_thermal_log_info(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
-
-	struct pt_payload_fw_log_info_data log_info_data;
-	memset(&log_info_data, 0, sizeof (log_info_data));
-	// get the total number of low priority thermal log entries
-	unsigned int temprc = fw_get_fw_error_log_info_data(device_handle.handle,
-		DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_THERMAL, &log_info_data);
-	if (temprc != NVM_SUCCESS)
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_LOW | DEV_FW_ERR_LOG_THERMAL];
+	if (p_log->info_rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F(
 		"Failed to get high priority firmware thermal error log info for dimm %d",
@@ -1198,11 +1264,11 @@ int get_low_priority_thermal_log_info(PersistentStore *p_store, int history_id,
 		struct db_fw_thermal_low_log_info db_log_info;
 		memset(&db_log_info, 0, sizeof (db_log_info));
 		db_log_info.device_handle = device_handle.handle;
-		db_log_info.max_log_entries = log_info_data.max_log_entries;
-		db_log_info.current_sequence_number = log_info_data.current_sequence_number;
-		db_log_info.oldest_sequence_number = log_info_data.oldest_sequence_number;
-		db_log_info.oldest_log_entry_timestamp = log_info_data.oldest_log_entry_timestamp;
-		db_log_info.newest_log_entry_timestamp = log_info_data.newest_log_entry_timestamp;
+		db_log_info.max_log_entries = p_log->info.max_log_entries;
+		db_log_info.current_sequence_number = p_log->info.current_sequence_number;
+		db_log_info.oldest_sequence_number = p_log->info.oldest_sequence_number;
+		db_log_info.oldest_log_entry_timestamp = p_log->info.oldest_log_entry_timestamp;
+		db_log_info.newest_log_entry_timestamp = p_log->info.newest_log_entry_timestamp;
 		if (db_save_fw_thermal_low_log_info_state(p_store, history_id, &db_log_info)
 				!= DB_SUCCESS)
 		{
@@ -1216,17 +1282,14 @@ int get_low_priority_thermal_log_info(PersistentStore *p_store, int history_id,
 }
 
 int get_high_priority_media_log_info(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
-
-	struct pt_payload_fw_log_info_data log_info_data;
-	memset(&log_info_data, 0, sizeof (log_info_data));
-	// get the total number of high priority media log entries
-	unsigned int temprc = fw_get_fw_error_log_info_data(device_handle.handle,
-		DEV_FW_ERR_LOG_HIGH, DEV_FW_ERR_LOG_MEDIA, &log_info_data);
-	if (temprc != NVM_SUCCESS)
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_HIGH | DEV_FW_ERR_LOG_MEDIA];
+	if (p_log->info_rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F(
 		"Failed to get high priority firmware thermal error log info for dimm %d",
@@ -1237,11 +1300,11 @@ int get_high_priority_media_log_info(PersistentStore *p_store, int history_id,
 		struct db_fw_media_high_log_info db_log_info;
 		memset(&db_log_info, 0, sizeof (db_log_info));
 		db_log_info.device_handle = device_handle.handle;
-		db_log_info.max_log_entries = log_info_data.max_log_entries;
-		db_log_info.current_sequence_number = log_info_data.current_sequence_number;
-		db_log_info.oldest_sequence_number = log_info_data.oldest_sequence_number;
-		db_log_info.oldest_log_entry_timestamp = log_info_data.oldest_log_entry_timestamp;
-		db_log_info.newest_log_entry_timestamp = log_info_data.newest_log_entry_timestamp;
+		db_log_info.max_log_entries = p_log->info.max_log_entries;
+		db_log_info.current_sequence_number = p_log->info.current_sequence_number;
+		db_log_info.oldest_sequence_number = p_log->info.oldest_sequence_number;
+		db_log_info.oldest_log_entry_timestamp = p_log->info.oldest_log_entry_timestamp;
+		db_log_info.newest_log_entry_timestamp = p_log->info.newest_log_entry_timestamp;
 		if (db_save_fw_media_high_log_info_state(p_store, history_id, &db_log_info)
 				!= DB_SUCCESS)
 		{
@@ -1255,17 +1318,14 @@ int get_high_priority_media_log_info(PersistentStore *p_store, int history_id,
 }
 
 int get_low_priority_media_log_info(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
-
-	struct pt_payload_fw_log_info_data log_info_data;
-	memset(&log_info_data, 0, sizeof (log_info_data));
-	// get the total number of low priority media log entries
-	unsigned int temprc = fw_get_fw_error_log_info_data(device_handle.handle,
-		DEV_FW_ERR_LOG_LOW, DEV_FW_ERR_LOG_MEDIA, &log_info_data);
-	if (temprc != NVM_SUCCESS)
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct fw_error_log_state *p_log =
+			&p_dimm->error_logs[DEV_FW_ERR_LOG_LOW | DEV_FW_ERR_LOG_MEDIA];
+	if (p_log->info_rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F(
 		"Failed to get high priority firmware thermal error log info for dimm %d",
@@ -1276,11 +1336,11 @@ int get_low_priority_media_log_info(PersistentStore *p_store, int history_id,
 		struct db_fw_media_low_log_info db_log_info;
 		memset(&db_log_info, 0, sizeof (db_log_info));
 		db_log_info.device_handle = device_handle.handle;
-		db_log_info.max_log_entries = log_info_data.max_log_entries;
-		db_log_info.current_sequence_number = log_info_data.current_sequence_number;
-		db_log_info.oldest_sequence_number = log_info_data.oldest_sequence_number;
-		db_log_info.oldest_log_entry_timestamp = log_info_data.oldest_log_entry_timestamp;
-		db_log_info.newest_log_entry_timestamp = log_info_data.newest_log_entry_timestamp;
+		db_log_info.max_log_entries = p_log->info.max_log_entries;
+		db_log_info.current_sequence_number = p_log->info.current_sequence_number;
+		db_log_info.oldest_sequence_number = p_log->info.oldest_sequence_number;
+		db_log_info.oldest_log_entry_timestamp = p_log->info.oldest_log_entry_timestamp;
+		db_log_info.newest_log_entry_timestamp = p_log->info.newest_log_entry_timestamp;
 		if (db_save_fw_media_low_log_info_state(p_store, history_id, &db_log_info)
 				!= DB_SUCCESS)
 		{
@@ -1294,102 +1354,60 @@ int get_low_priority_media_log_info(PersistentStore *p_store, int history_id,
 }
 
 int support_store_fw_error_logs(PersistentStore *p_store, int history_id,
-	NVM_NFIT_DEVICE_HANDLE device_handle)
+	const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
 
 	KEEP_ERROR(rc,
-		get_low_priority_media_log_info(p_store, history_id, device_handle));
+		get_low_priority_media_log_info(p_store, history_id, p_dimm));
 	KEEP_ERROR(rc,
-		get_high_priority_media_log_info(p_store, history_id, device_handle));
+		get_high_priority_media_log_info(p_store, history_id, p_dimm));
 	KEEP_ERROR(rc,
-		get_low_priority_thermal_log_info(p_store, history_id, device_handle));
+		get_low_priority_thermal_log_info(p_store, history_id, p_dimm));
 	KEEP_ERROR(rc,
-		get_high_priority_thermal_log_info(p_store, history_id, device_handle));
+		get_high_priority_thermal_log_info(p_store, history_id, p_dimm));
 
 	KEEP_ERROR(rc,
-		get_low_priority_media_logs(p_store, history_id, device_handle));
+		get_low_priority_media_logs(p_store, history_id, p_dimm));
 	KEEP_ERROR(rc,
-		get_high_priority_media_logs(p_store, history_id, device_handle));
+		get_high_priority_media_logs(p_store, history_id, p_dimm));
 	KEEP_ERROR(rc,
-		get_low_priority_thermal_logs(p_store, history_id, device_handle));
+		get_low_priority_thermal_logs(p_store, history_id, p_dimm));
 	KEEP_ERROR(rc,
-		get_high_priority_thermal_logs(p_store, history_id, device_handle));
+		get_high_priority_thermal_logs(p_store, history_id, p_dimm));
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
 int support_store_fw_debug_logs(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
-	struct fw_cmd cmd;
-	memset(&cmd, 0, sizeof (struct fw_cmd));
-	cmd.device_handle = device_handle.handle;
-	cmd.opcode = PT_GET_LOG;
-	cmd.sub_opcode = SUBOP_FW_DBG_LOG;
-
-	struct pt_payload_input_get_fw_dbg_log input;
-	memset(&input, 0, sizeof (input));
-	struct pt_payload_output_get_fw_dbg_log output;
-	memset(&output, 0, sizeof (output));
-	input.log_action = RETRIEVE_LOG_SIZE;
-	cmd.input_payload_size = sizeof (input);
-	cmd.input_payload = &input;
-	cmd.output_payload = &output;
-	cmd.output_payload_size = sizeof (output);
-	cmd.large_output_payload = NULL;
-	cmd.large_output_payload_size = 0;
-	if (ioctl_passthrough_cmd(&cmd) != NVM_SUCCESS)
+	if (p_dimm->debug_log_rc != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F("Failed to get log size for dimm %d", device_handle.handle);
+		COMMON_LOG_ERROR_F("Failed to get log for dimm %d", device_handle.handle);
 	}
 	else
 	{
-		// if the log size doesn't land on a 1MB page boundary, get the whole page
-		NVM_UINT8 log_count = round(output.log_size);
-		if (log_count)
+		struct db_dimm_fw_debug_log dimm_fw_debug_log;
+		for (int log_index = 0; log_index < p_dimm->debug_log_count; log_index++)
 		{
-			memset(&cmd, 0, sizeof (struct fw_cmd));
-			cmd.device_handle = device_handle.handle;
-			cmd.opcode = PT_GET_LOG;
-			cmd.sub_opcode = SUBOP_FW_DBG_LOG;
-
-			memset(&input, 0, sizeof (input));
-			input.log_action = GET_LOG_PAGE;
-			cmd.input_payload_size = sizeof (input);
-			cmd.input_payload = &input;
-            // FIX ME hack for MSVC, use max size 255
-			char fw_log_data[255][DEV_FW_LOG_PAGE_SIZE];
-			cmd.large_output_payload = fw_log_data;
-			cmd.large_output_payload_size = log_count * DEV_FW_LOG_PAGE_SIZE;
-			cmd.output_payload = NULL;
-			cmd.output_payload_size = 0;
-			if (ioctl_passthrough_cmd(&cmd) != NVM_SUCCESS)
-			{
-				COMMON_LOG_ERROR_F("Failed to get log for dimm %d", device_handle.handle);
-			}
-			else
+			memset(&dimm_fw_debug_log, 0, sizeof (dimm_fw_debug_log));
+			dimm_fw_debug_log.device_handle = device_handle.handle;
+			memmove(dimm_fw_debug_log.fw_log,
+					p_dimm->p_debug_log + (log_index * DEV_FW_LOG_PAGE_SIZE),
+					DIMM_FW_DEBUG_LOG_FW_LOG_LEN);
+			if (db_save_dimm_fw_debug_log_state(p_store,
+					history_id, &dimm_fw_debug_log) != DB_SUCCESS)
 			{
-				struct db_dimm_fw_debug_log dimm_fw_debug_log;
-				for (int log_index = 0; log_index < log_count; log_index++)
-				{
-					memset(&dimm_fw_debug_log, 0, sizeof (dimm_fw_debug_log));
-					dimm_fw_debug_log.device_handle = device_handle.handle;
-					memmove(dimm_fw_debug_log.fw_log, fw_log_data[log_index],
-							DIMM_FW_DEBUG_LOG_FW_LOG_LEN);
-					if (db_save_dimm_fw_debug_log_state(p_store,
-							history_id, &dimm_fw_debug_log) != DB_SUCCESS)
-					{
-						COMMON_LOG_ERROR_F("Couldn't save FW debug log for "
-								"handle %u", device_handle.handle);
-						rc = NVM_ERR_UNKNOWN;
-					}
-				}
+				COMMON_LOG_ERROR_F("Couldn't save FW debug log for "
+						"handle %u", device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
 			}
 		}
 	}
@@ -1398,13 +1416,13 @@ int support_store_fw_debug_logs(PersistentStore *p_store, int history_id,
 	return rc;
 }
 
-int support_store_driver_capabilities(PersistentStore *p_store, int history_id)
+int support_store_driver_capabilities(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system)
 {
 
 	int rc = NVM_SUCCESS;
-	struct nvm_driver_capabilities nvm_caps;
-	memset(&nvm_caps, 0, sizeof (nvm_caps));
-	if (NVM_SUCCESS != get_driver_capabilities(&nvm_caps))
+	const struct nvm_driver_capabilities nvm_caps = p_system->driver_capabilities;
+	if (NVM_SUCCESS != p_system->driver_capabilities_rc)
 	{
 		COMMON_LOG_ERROR("Failed to get driver capabilities information");
 	}
@@ -1467,18 +1485,17 @@ int support_store_driver_capabilities(PersistentStore *p_store, int history_id)
 
 // add power management
 int support_store_power_management(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	struct db_dimm_power_management db_power_management;
 	memset(&db_power_management, 0, sizeof (db_power_management));
 
-	struct pt_payload_power_mgmt_policy power_management;
-	memset(&power_management, 0, sizeof (power_management));
-
-	if (NVM_SUCCESS != get_fw_power_mgmt_policy(device_handle, &power_management))
+	const struct pt_payload_power_mgmt_policy *p_power_management = &p_dimm->power_management;
+	if (NVM_SUCCESS != p_dimm->power_management_rc)
 	{
 		COMMON_LOG_ERROR_F("Unable to get the device die sparing policy "
 				"for handle: [%d]", device_handle.handle);
@@ -1486,10 +1503,10 @@ int support_store_power_management(PersistentStore *p_store, int history_id,
 	else
 	{
 		db_power_management.device_handle = device_handle.handle;
-		db_power_management.enable = power_management.enabled;
-		db_power_management.tdp_power_limit = power_management.tdp;
-		db_power_management.peak_power_budget = power_management.peak_power_budget;
-		db_power_management.avg_power_budget = power_management.average_power_budget;
+		db_power_management.enable = p_power_management->enabled;
+		db_power_management.tdp_power_limit = p_power_management->tdp;
+		db_power_management.peak_power_budget = p_power_management->peak_power_budget;
+		db_power_management.avg_power_budget = p_power_management->average_power_budget;
 
 		if (db_save_dimm_power_management_state(p_store, history_id, &db_power_management)
 				!= DB_SUCCESS)
@@ -1506,18 +1523,17 @@ int support_store_power_management(PersistentStore *p_store, int history_id,
 
 // add alarm thresholds
 int support_store_alarm_thresholds(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	struct db_dimm_alarm_thresholds db_alarm_thresholds;
 	memset(&db_alarm_thresholds, 0, sizeof (db_alarm_thresholds));
 
-	struct pt_payload_alarm_thresholds alarm_thresholds;
-	memset(&alarm_thresholds, 0, sizeof (alarm_thresholds));
-
-	if (NVM_SUCCESS != fw_get_alarm_thresholds(device_handle.handle, &alarm_thresholds))
+	const struct pt_payload_alarm_thresholds *p_alarm_thresholds = &p_dimm->alarm_thresholds;
+	if (NVM_SUCCESS != p_dimm->alarm_thresholds_rc)
 	{
 		COMMON_LOG_ERROR_F("Unable to get the device alarm thresholds "
 				"for handle: [%d]", device_handle.handle);
@@ -1525,11 +1541,11 @@ int support_store_alarm_thresholds(PersistentStore *p_store, int history_id,
 	else
 	{
 		db_alarm_thresholds.device_handle = device_handle.handle;
-		db_alarm_thresholds.enable = alarm_thresholds.enable;
-		db_alarm_thresholds.spare = alarm_thresholds.spare;
-		db_alarm_thresholds.media_temperature = alarm_thresholds.media_temperature;
+		db_alarm_thresholds.enable = p_alarm_thresholds->enable;
+		db_alarm_thresholds.spare = p_alarm_thresholds->spare;
+		db_alarm_thresholds.media_temperature = p_alarm_thresholds->media_temperature;
 		db_alarm_thresholds.controller_temperature =
-			alarm_thresholds.controller_temperature;
+			p_alarm_thresholds->controller_temperature;
 		if (db_save_dimm_alarm_thresholds_state(p_store, history_id, &db_alarm_thresholds)
 				!= DB_SUCCESS)
 		{
@@ -1545,28 +1561,27 @@ int support_store_alarm_thresholds(PersistentStore *p_store, int history_id,
 
 // add die sparing
 int support_store_die_sparing(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
 	struct db_dimm_die_sparing db_die_sparing;
 	memset(&db_die_sparing, 0, sizeof (db_die_sparing));
 
-	struct pt_get_die_spare_policy spare_policy;
-	memset(&spare_policy, 0, sizeof (spare_policy));
-
-	if (NVM_SUCCESS != get_fw_die_spare_policy(device_handle, &spare_policy))
+	const struct pt_get_die_spare_policy *p_spare_policy = &p_dimm->die_sparing;
+	if (NVM_SUCCESS != p_dimm->die_sparing_rc)
 	{
 		COMMON_LOG_ERROR_F("Unable to get the device die sparing policy "
 				"for handle: [%d]", device_handle.handle);
 	}
 	else
 	{
-		db_die_sparing.aggressiveness = spare_policy.aggressiveness;
+		db_die_sparing.aggressiveness = p_spare_policy->aggressiveness;
 		db_die_sparing.device_handle = device_handle.handle;
-		db_die_sparing.enable = spare_policy.enable;
-		db_die_sparing.supported = spare_policy.supported;
+		db_die_sparing.enable = p_spare_policy->enable;
+		db_die_sparing.supported = p_spare_policy->supported;
 
 		if (db_save_dimm_die_sparing_state(p_store, history_id, &db_die_sparing)
 				!= DB_SUCCESS)
@@ -1583,13 +1598,14 @@ int support_store_die_sparing(PersistentStore *p_store, int history_id,
 
 // add optional config data
 int support_store_optional_config_data(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
-	struct pt_payload_get_config_data_policy config_data;
-	if (fw_get_config_data_policy(device_handle.handle, &config_data) != NVM_SUCCESS)
+	const struct pt_payload_get_config_data_policy *p_config_data = &p_dimm->config_data_policy;
+	if (p_dimm->config_data_policy_rc != NVM_SUCCESS)
 	{
 		COMMON_LOG_ERROR_F("Unable to get the optional configuration data policy "
 				"for handle: [%d]", device_handle.handle);
@@ -1600,9 +1616,9 @@ int support_store_optional_config_data(PersistentStore *p_store, int history_id,
 		memset(&db_optional_config_data, 0, sizeof (db_optional_config_data));
 
 		db_optional_config_data.device_handle = device_handle.handle;
-		db_optional_config_data.first_fast_refresh_enable = config_data.first_fast_refresh;
-		db_optional_config_data.viral_policy_enable = config_data.viral_policy_enable;
-		db_optional_config_data.viral_status = config_data.viral_status;
+		db_optional_config_data.first_fast_refresh_enable = p_config_data->first_fast_refresh;
+		db_optional_config_data.viral_policy_enable = p_config_data->viral_policy_enable;
+		db_optional_config_data.viral_status = p_config_data->viral_status;
 
 		if (db_save_dimm_optional_config_data_state(p_store, history_id, &db_optional_config_data)
 				!= DB_SUCCESS)
@@ -1797,18 +1813,19 @@ int support_store_extension_tables_in_db(PersistentStore *p_store,
 }
 
 int support_store_platform_config_data(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
 	COMMON_LOG_ENTRY();
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
 
-	struct platform_config_data *p_config = NULL;
-	int tmp_rc = get_dimm_platform_config(device_handle, &p_config);
+	struct platform_config_data *p_config = p_dimm->p_platform_config;
 
 	// make sure we have good data
-	if (tmp_rc != NVM_SUCCESS)
+	if (p_dimm->platform_config_rc != NVM_SUCCESS)
 	{
-		COMMON_LOG_ERROR_F("get_dimm_platform_config failed with return code = %d", tmp_rc);
+		COMMON_LOG_ERROR_F("get_dimm_platform_config failed with return code = %d",
+				p_dimm->platform_config_rc);
 	}
 	else
 	{
@@ -1988,134 +2005,302 @@ int support_store_platform_config_data(PersistentStore *p_store, int history_id,
 			}
 		}
 	}
-	if (p_config)
-	{
-		free(p_config);
-	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
 int support_store_dimm_long_operation_status(PersistentStore *p_store, int history_id,
-		NVM_NFIT_DEVICE_HANDLE device_handle)
+		const struct dimm_state *p_dimm)
 {
 	int rc = NVM_SUCCESS;
-	struct pt_payload_long_op_stat *p_payload = calloc(1, sizeof (struct pt_payload_long_op_stat));
-	if (!p_payload)
-	{
-		COMMON_LOG_ERROR("Unable to allocate memory for long operation payload");
-	}
-	else
-	{
-		if (fw_get_status_for_long_op(device_handle, p_payload) == NVM_SUCCESS)
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+	const struct pt_payload_long_op_stat *p_payload = &p_dimm->long_op;
+	if (p_dimm->long_op_rc == NVM_SUCCESS)
+	{
+		const struct pt_return_address_range_scrub *p_ars_command_return_data =
+			(const struct pt_return_address_range_scrub *)(p_payload->command_specific_data);
+		struct db_dimm_long_op_status *p_db_lop_status =
+			calloc(1, sizeof (struct db_dimm_long_op_status));
+		struct db_dimm_ars_command_specific_data *p_db_ars_info =
+			calloc(1, sizeof (struct db_dimm_ars_command_specific_data));
+		if (p_db_lop_status && p_db_ars_info)
 		{
-			struct pt_return_address_range_scrub *p_ars_command_return_data =
-				(struct pt_return_address_range_scrub *)(p_payload->command_specific_data);
-			struct db_dimm_long_op_status *p_db_lop_status =
-				calloc(1, sizeof (struct db_dimm_long_op_status));
-			struct db_dimm_ars_command_specific_data *p_db_ars_info =
-				calloc(1, sizeof (struct db_dimm_ars_command_specific_data));
-			if (p_db_lop_status && p_db_ars_info)
+			p_db_lop_status->device_handle = device_handle.handle;
+			p_db_lop_status->opcode = p_payload->command & 0xFF;
+			p_db_lop_status->subopcode = p_payload->command >> 8;
+			p_db_lop_status->percent_complete = p_payload->percent_complete;
+			p_db_lop_status->etc = p_payload->etc;
+			p_db_lop_status->status_code = p_payload->status_code;
+			if (db_save_dimm_long_op_status_state(
+				p_store, history_id, p_db_lop_status) != DB_SUCCESS)
 			{
-				p_db_lop_status->device_handle = device_handle.handle;
-				p_db_lop_status->opcode = p_payload->command & 0xFF;
-				p_db_lop_status->subopcode = p_payload->command >> 8;
-				p_db_lop_status->percent_complete = p_payload->percent_complete;
-				p_db_lop_status->etc = p_payload->etc;
-				p_db_lop_status->status_code = p_payload->status_code;
-				if (db_save_dimm_long_op_status_state(
-					p_store, history_id, p_db_lop_status) != DB_SUCCESS)
-				{
-					COMMON_LOG_ERROR_F("Could not save long operation status "
-							"for handle %u",
-							device_handle.handle);
-					rc = NVM_ERR_UNKNOWN;
-				}
-
-				p_db_ars_info->device_handle = device_handle.handle;
-				p_db_ars_info->num_errors = p_ars_command_return_data->num_errors;
-				p_db_ars_info->ars_state = p_ars_command_return_data->ars_state;
-				memmove(p_db_ars_info->dpa_error_address,
-					p_ars_command_return_data->dpa_error_address,
-					14*(sizeof (unsigned long long)));
-				if (db_save_dimm_ars_command_specific_data_state(
-					p_store, history_id, p_db_ars_info) != DB_SUCCESS)
-				{
-					COMMON_LOG_ERROR_F("Could not save ARS long operation data "
-							"for handle %u",
-							device_handle.handle);
-					rc = NVM_ERR_UNKNOWN;
-				}
+				COMMON_LOG_ERROR_F("Could not save long operation status "
+						"for handle %u",
+						device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
 			}
-			else
+
+			p_db_ars_info->device_handle = device_handle.handle;
+			p_db_ars_info->num_errors = p_ars_command_return_data->num_errors;
+			p_db_ars_info->ars_state = p_ars_command_return_data->ars_state;
+			memmove(p_db_ars_info->dpa_error_address,
+				p_ars_command_return_data->dpa_error_address,
+				14*(sizeof (unsigned long long)));
+			if (db_save_dimm_ars_command_specific_data_state(
+				p_store, history_id, p_db_ars_info) != DB_SUCCESS)
 			{
-				COMMON_LOG_ERROR("Unable to allocate memory for long operation database info");
+				COMMON_LOG_ERROR_F("Could not save ARS long operation data "
+						"for handle %u",
+						device_handle.handle);
+				rc = NVM_ERR_UNKNOWN;
 			}
-			free(p_db_ars_info);
-			free(p_db_lop_status);
 		}
-
+		else
+		{
+			COMMON_LOG_ERROR("Unable to allocate memory for long operation database info");
+		}
+		free(p_db_ars_info);
+		free(p_db_lop_status);
 	}
-	free(p_payload);
 	return rc;
 }
 
-int support_store_interleave_sets(PersistentStore *p_store, int history_id)
+/*
+ * Read one of a DIMM's firmware error logs, log is (log level | log type)
+ */
+void collect_fw_error_log(const NVM_UINT32 device_handle, const unsigned char log,
+		struct fw_error_log_state *p_log)
 {
-	COMMON_LOG_ENTRY();
-	int rc = NVM_SUCCESS;
+	unsigned char log_level = log & DEV_FW_ERR_LOG_HIGH;
+	unsigned char log_type = log & DEV_FW_ERR_LOG_THERMAL;
+
+	p_log->info_rc = fw_get_fw_error_log_info_data(device_handle,
+			log_level, log_type, &p_log->info);
+	p_log->entries_rc = p_log->info_rc;
+	if (p_log->info_rc == NVM_SUCCESS &&
+			p_log->info.current_sequence_number > p_log->info.oldest_sequence_number)
+	{
+		p_log->entry_count = p_log->info.current_sequence_number -
+				p_log->info.oldest_sequence_number;
+		size_t entry_size = (log_type == DEV_FW_ERR_LOG_THERMAL) ?
+				sizeof (struct pt_fw_thermal_log_entry) :
+				sizeof (struct pt_fw_media_log_entry);
+		p_log->p_entries = calloc(p_log->entry_count, entry_size);
+		if (!p_log->p_entries)
+		{
+			p_log->entry_count = 0;
+			p_log->entries_rc = NVM_ERR_NOMEMORY;
+		}
+		else
+		{
+			p_log->entries_rc = fw_get_fw_error_logs(device_handle,
+					p_log->entry_count, p_log->p_entries, log_level, log_type);
+		}
+	}
+}
+
+/*
+ * Read every page of a DIMM's firmware debug log
+ */
+void collect_fw_debug_log(struct dimm_state *p_dimm)
+{
+	struct fw_cmd cmd;
+	memset(&cmd, 0, sizeof (struct fw_cmd));
+	cmd.device_handle = p_dimm->topology.device_handle.handle;
+	cmd.opcode = PT_GET_LOG;
+	cmd.sub_opcode = SUBOP_FW_DBG_LOG;
 
-	int tmprc = 0;
-	if ((tmprc = get_interleave_set_count()) > 0)
+	struct pt_payload_input_get_fw_dbg_log input;
+	memset(&input, 0, sizeof (input));
+	struct pt_payload_output_get_fw_dbg_log output;
+	memset(&output, 0, sizeof (output));
+	input.log_action = RETRIEVE_LOG_SIZE;
+	cmd.input_payload_size = sizeof (input);
+	cmd.input_payload = &input;
+	cmd.output_payload = &output;
+	cmd.output_payload_size = sizeof (output);
+	if ((p_dimm->debug_log_rc = ioctl_passthrough_cmd(&cmd)) == NVM_SUCCESS)
 	{
-		int interleave_count = tmprc;
-		size_t interleaves_len = interleave_count * sizeof(struct nvm_interleave_set);
-		struct nvm_interleave_set *interleaves = malloc(interleaves_len);
-		memset(interleaves, 0, interleaves_len);
-		if ((tmprc = get_interleave_sets(interleave_count, interleaves)) > 0)
+		// if the log size doesn't land on a 1MB page boundary, get the whole page
+		NVM_UINT8 log_count = round(output.log_size);
+		if (log_count)
 		{
-			for (int i = 0; i < interleave_count; i++)
+			p_dimm->p_debug_log = calloc(log_count, DEV_FW_LOG_PAGE_SIZE);
+			if (!p_dimm->p_debug_log)
 			{
-				struct db_interleave_set db_interleave;
-				memset(&db_interleave, 0, sizeof (db_interleave));
-				db_interleave.id = interleaves[i].id;
-				db_interleave.pcd_interleave_index = interleaves[i].set_index;
-				db_interleave.socket_id = interleaves[i].socket_id;
-				db_interleave.attributes = interleaves[i].attributes;
-				db_interleave.size = interleaves[i].size;
-				db_interleave.available_size = interleaves[i].available_size;
-				db_interleave.cookie_v1_1 = interleaves[i].cookie_v1_1;
-				db_interleave.cookie_v1_2 = interleaves[i].cookie_v1_2;
-				db_interleave.dimm_count = interleaves[i].dimm_count;
-				for (unsigned int j = 0; j < db_interleave.dimm_count; j++)
-				{
-					db_interleave.dimm_handles[j] = interleaves[i].dimms[j];
-					db_interleave.dimm_region_offsets[j] =
-							interleaves[i].dimm_region_offsets[j];
-					db_interleave.dimm_region_pdas[j] =
-							interleaves[i].dimm_region_pdas[j];
-					db_interleave.dimm_sizes[j] = interleaves[i].dimm_sizes[j];
-				}
-
-				if (db_save_interleave_set_state(p_store, history_id,
-						&db_interleave) != DB_SUCCESS)
+				p_dimm->debug_log_rc = NVM_ERR_NOMEMORY;
+			}
+			else
+			{
+				memset(&cmd, 0, sizeof (struct fw_cmd));
+				cmd.device_handle = p_dimm->topology.device_handle.handle;
+				cmd.opcode = PT_GET_LOG;
+				cmd.sub_opcode = SUBOP_FW_DBG_LOG;
+
+				memset(&input, 0, sizeof (input));
+				input.log_action = GET_LOG_PAGE;
+				cmd.input_payload_size = sizeof (input);
+				cmd.input_payload = &input;
+				cmd.large_output_payload = p_dimm->p_debug_log;
+				cmd.large_output_payload_size = log_count * DEV_FW_LOG_PAGE_SIZE;
+				if ((p_dimm->debug_log_rc = ioctl_passthrough_cmd(&cmd)) == NVM_SUCCESS)
 				{
-					COMMON_LOG_ERROR("Could not save interleave sets");
-					rc = NVM_ERR_UNKNOWN;
+					p_dimm->debug_log_count = log_count;
 				}
 			}
 		}
-		else if (tmprc < 0)
+	}
+}
+
+/*
+ * Read everything the snapshot records about the DIMM at index from its firmware.
+ * Runs on a device executor worker, so it must not touch the store.
+ */
+int collect_dimm_state(void *p_dimms, const int index)
+{
+	COMMON_LOG_ENTRY();
+	struct dimm_state *p_dimm = &((struct dimm_state *)p_dimms)[index];
+	NVM_NFIT_DEVICE_HANDLE device_handle = p_dimm->topology.device_handle;
+
+	p_dimm->identify_rc = fw_get_identify_dimm(device_handle.handle, &p_dimm->identify);
+	p_dimm->characteristics_rc = fw_get_id_dimm_device_characteristics(
+			device_handle.handle, &p_dimm->characteristics);
+	p_dimm->smart_rc = fw_get_smart_health(device_handle.handle, &p_dimm->smart);
+	p_dimm->memory_page0_rc = fw_get_memory_info_page(device_handle.handle, 0,
+			&p_dimm->memory_page0, sizeof (p_dimm->memory_page0));
+	p_dimm->memory_page1_rc = fw_get_memory_info_page(device_handle.handle, 1,
+			&p_dimm->memory_page1, sizeof (p_dimm->memory_page1));
+	p_dimm->fw_image_rc = fw_get_fw_image_info(device_handle.handle, &p_dimm->fw_image);
+	p_dimm->details_rc = get_dimm_details(device_handle, &p_dimm->details);
+
+	struct fw_cmd cmd;
+	memset(&cmd, 0, sizeof (cmd));
+	cmd.device_handle = device_handle.handle;
+	cmd.opcode = PT_GET_ADMIN_FEATURES;
+	cmd.sub_opcode = SUBOP_DIMM_PARTITION_INFO;
+	cmd.output_payload_size = sizeof (p_dimm->partition);
+	cmd.output_payload = &p_dimm->partition;
+	p_dimm->partition_rc = ioctl_passthrough_cmd(&cmd);
+
+	memset(&cmd, 0, sizeof (cmd));
+	cmd.device_handle = device_handle.handle;
+	cmd.opcode = PT_GET_SEC_INFO;
+	cmd.sub_opcode = 0;
+	cmd.output_payload_size = sizeof (p_dimm->security);
+	cmd.output_payload = &p_dimm->security;
+	p_dimm->security_rc = ioctl_passthrough_cmd(&cmd);
+
+	for (unsigned char log = 0; log < FW_ERROR_LOG_COUNT; log++)
+	{
+		collect_fw_error_log(device_handle.handle, log, &p_dimm->error_logs[log]);
+	}
+	collect_fw_debug_log(p_dimm);
+
+	p_dimm->die_sparing_rc = get_fw_die_spare_policy(device_handle, &p_dimm->die_sparing);
+	p_dimm->power_management_rc = get_fw_power_mgmt_policy(device_handle,
+			&p_dimm->power_management);
+	p_dimm->alarm_thresholds_rc = fw_get_alarm_thresholds(device_handle.handle,
+			&p_dimm->alarm_thresholds);
+	p_dimm->config_data_policy_rc = fw_get_config_data_policy(device_handle.handle,
+			&p_dimm->config_data_policy);
+	p_dimm->platform_config_rc = get_dimm_platform_config(device_handle,
+			&p_dimm->p_platform_config);
+	p_dimm->long_op_rc = fw_get_status_for_long_op(device_handle, &p_dimm->long_op);
+
+	// failures are recorded per payload and reported when the snapshot is stored
+	COMMON_LOG_EXIT_RETURN_I(NVM_SUCCESS);
+	return NVM_SUCCESS;
+}
+
+/*
+ * Free the buffers collect_dimm_state allocated
+ */
+void free_dimm_state(struct dimm_state *p_dimm)
+{
+	for (int i = 0; i < FW_ERROR_LOG_COUNT; i++)
+	{
+		free(p_dimm->error_logs[i].p_entries);
+		p_dimm->error_logs[i].p_entries = NULL;
+	}
+	free(p_dimm->p_debug_log);
+	p_dimm->p_debug_log = NULL;
+	free(p_dimm->p_platform_config);
+	p_dimm->p_platform_config = NULL;
+}
+
+/*
+ * Write everything collected for a DIMM to the history tables
+ */
+int store_dimm_state(PersistentStore *p_store, int history_id,
+		const struct dimm_state *p_dimm)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	KEEP_ERROR(rc, support_store_dimm_topology(p_store, history_id, p_dimm->topology));
+	KEEP_ERROR(rc, support_store_identify_dimm(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_device_characteristics(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_smart(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_memory(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_fw_image(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_dimm_details(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_dimm_partition_info(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_dimm_security_state(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_fw_error_logs(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_fw_debug_logs(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_die_sparing(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_power_management(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_alarm_thresholds(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_optional_config_data(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_platform_config_data(p_store, history_id, p_dimm));
+	KEEP_ERROR(rc, support_store_dimm_long_operation_status(p_store, history_id, p_dimm));
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int support_store_interleave_sets(PersistentStore *p_store, int history_id,
+		const struct system_state *p_system)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	const struct nvm_interleave_set *interleaves = p_system->p_interleaves;
+	for (int i = 0; i < p_system->interleave_count; i++)
+	{
+		struct db_interleave_set db_interleave;
+		memset(&db_interleave, 0, sizeof (db_interleave));
+		db_interleave.id = interleaves[i].id;
+		db_interleave.pcd_interleave_index = interleaves[i].set_index;
+		db_interleave.socket_id = interleaves[i].socket_id;
+		db_interleave.attributes = interleaves[i].attributes;
+		db_interleave.size = interleaves[i].size;
+		db_interleave.available_size = interleaves[i].available_size;
+		db_interleave.cookie_v1_1 = interleaves[i].cookie_v1_1;
+		db_interleave.cookie_v1_2 = interleaves[i].cookie_v1_2;
+		db_interleave.dimm_count = interleaves[i].dimm_count;
+		for (unsigned int j = 0; j < db_interleave.dimm_count; j++)
 		{
-			COMMON_LOG_ERROR_F("Failed to get interleave sets, rc=%d", tmprc);
+			db_interleave.dimm_handles[j] = interleaves[i].dimms[j];
+			db_interleave.dimm_region_offsets[j] =
+					interleaves[i].dimm_region_offsets[j];
+			db_interleave.dimm_region_pdas[j] =
+					interleaves[i].dimm_region_pdas[j];
+			db_interleave.dimm_sizes[j] = interleaves[i].dimm_sizes[j];
 		}
 
-        free(interleaves);
+		if (db_save_interleave_set_state(p_store, history_id,
+				&db_interleave) != DB_SUCCESS)
+		{
+			COMMON_LOG_ERROR("Could not save interleave sets");
+			rc = NVM_ERR_UNKNOWN;
+		}
 	}
-	else if (tmprc < 0)
+	if (p_system->interleave_count < 0)
 	{
-		COMMON_LOG_ERROR_F("Failed to get interleave set count, rc=%d", tmprc);
+		COMMON_LOG_ERROR_F("Failed to get interleave sets, rc=%d",
+				p_system->interleave_count);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -36,6 +36,74 @@
 #include <persistence/logging.h>
 #include <smbios/smbios.h>
 #include <string/s_str.h>
+#include <os/os_adapter.h>
+
+#ifdef __WINDOWS__
+#include <windows.h>
+	extern HANDLE g_smbios_lock;
+#else
+	extern pthread_mutex_t g_smbios_lock;
+#endif
+
+/*
+ * The SMBIOS table only changes across a reboot, so it is read and
+ * indexed once per process. Protected by g_smbios_lock.
+ */
+static NVM_UINT8 *g_p_smbios_table = NULL;
+static size_t g_smbios_table_size = 0;
+static struct smbios_table_index g_smbios_index;
+
+/*
+ * Read and index the SMBIOS table if it isn't cached yet
+ * NOTE: caller must hold g_smbios_lock
+ */
+static int load_smbios_table_cache()
+{
+	int rc = NVM_SUCCESS;
+
+	if (!g_p_smbios_table)
+	{
+		NVM_UINT8 *p_smbios_table = NULL;
+		size_t smbios_table_size = 0;
+		rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
+		if (rc == NVM_SUCCESS)
+		{
+			if (smbios_index_table((struct smbios_structure_header *)p_smbios_table,
+					smbios_table_size, &g_smbios_index) != COMMON_SUCCESS)
+			{
+				COMMON_LOG_ERROR("Failed to index the SMBIOS table");
+				rc = NVM_ERR_NOMEMORY;
+			}
+			else
+			{
+				g_p_smbios_table = p_smbios_table;
+				g_smbios_table_size = smbios_table_size;
+				p_smbios_table = NULL;
+			}
+		}
+
+		if (p_smbios_table)
+		{
+			free(p_smbios_table);
+		}
+	}
+
+	return rc;
+}
+
+void free_smbios_table_cache()
+{
+	COMMON_LOG_ENTRY();
+	if (mutex_lock(&g_smbios_lock))
+	{
+		smbios_free_table_index(&g_smbios_index);
+		free(g_p_smbios_table);
+		g_p_smbios_table = NULL;
+		g_smbios_table_size = 0;
+		mutex_unlock(&g_smbios_lock);
+	}
+	COMMON_LOG_EXIT();
+}
 
 int get_dimm_physical_id_from_handle(const NVM_NFIT_DEVICE_HANDLE device_handle)
 {
@@ -84,18 +152,91 @@ int get_dimm_details_for_physical_id(const NVM_UINT16 physical_id,
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-	NVM_UINT8 *p_smbios_table = NULL;
-	size_t smbios_table_size = 0;
-	rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
-	if (rc == NVM_SUCCESS)
+	if (!mutex_lock(&g_smbios_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the SMBIOS lock");
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else
 	{
-		rc = get_dimm_details_from_smbios_table(p_smbios_table, smbios_table_size,
-				physical_id, p_dimm_details);
+		rc = load_smbios_table_cache();
+		if (rc == NVM_SUCCESS)
+		{
+			const struct smbios_structure_ref *p_ref =
+					smbios_index_get_structure_with_handle(&g_smbios_index, physical_id);
+			if (p_ref && p_ref->p_structure->type == SMBIOS_STRUCT_TYPE_MEMORY_DEVICE)
+			{
+				smbios_memory_device_to_nvm_details(
+						(const struct smbios_memory_device *)p_ref->p_structure,
+						p_ref->remaining_length, p_dimm_details);
+			}
+			else
+			{
+				COMMON_LOG_ERROR_F("Memory Device with SMBIOS handle %hu not found",
+						physical_id);
+				rc = NVM_ERR_BADDEVICE;
+			}
+		}
+		mutex_unlock(&g_smbios_lock);
 	}
 
-	if (p_smbios_table)
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+int get_cached_smbios_memory_devices(struct nvm_details *p_details, const size_t num_details)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (!mutex_lock(&g_smbios_lock))
+	{
+		COMMON_LOG_ERROR("Could not obtain the SMBIOS lock");
+		rc = NVM_ERR_UNKNOWN;
+	}
+	else
 	{
-		free(p_smbios_table);
+		rc = load_smbios_table_cache();
+		if (rc == NVM_SUCCESS)
+		{
+			const struct smbios_index_entry *p_entries = NULL;
+			int device_count = smbios_index_get_structures_of_type(&g_smbios_index,
+					SMBIOS_STRUCT_TYPE_MEMORY_DEVICE, &p_entries);
+			for (int i = 0; i < device_count; i++)
+			{
+				const struct smbios_structure_ref *p_ref =
+						&g_smbios_index.p_structures[p_entries[i].position];
+				const struct smbios_memory_device *p_device =
+						(const struct smbios_memory_device *)p_ref->p_structure;
+				if (p_ref->remaining_length < sizeof (struct smbios_memory_device))
+				{
+					break;
+				}
+				else if (p_device->size != SMBIOS_SIZE_EMPTY)
+				{
+					// a NULL array just counts the populated devices
+					if (p_details == NULL)
+					{
+						rc++;
+					}
+					else if (rc < num_details)
+					{
+						smbios_memory_device_to_nvm_details(p_device,
+								p_ref->remaining_length, &(p_details[rc]));
+						rc++;
+					}
+					else
+					{
+						COMMON_LOG_ERROR_F(
+							"Too many SMBIOS type 17 devices for nvm_details array size = %llu",
+							num_details);
+						rc = NVM_ERR_ARRAYTOOSMALL;
+						break;
+					}
+				}
+			}
+		}
+		mutex_unlock(&g_smbios_lock);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -45,10 +45,24 @@ NVM_API int get_dimm_physical_id_from_handle(const NVM_NFIT_DEVICE_HANDLE device
 
 /*
  * Get DIMM details for a specific DIMM physical ID from the SMBIOS table.
+ * The table is read and indexed on first use and cached for the process.
  */
 NVM_API int get_dimm_details_for_physical_id(const NVM_UINT16 physical_id,
 		struct nvm_details *p_dimm_details);
 
+/*
+ * Copy the populated Memory Devices in the cached SMBIOS table to an nvm_details array.
+ * Pass a NULL array to get the count.
+ * Returns count if successful, NVM error code if not.
+ */
+NVM_API int get_cached_smbios_memory_devices(struct nvm_details *p_details,
+		const size_t num_details);
+
+/*
+ * Release the cached SMBIOS table
+ */
+NVM_API void free_smbios_table_cache();
+
 /*
  * Get DIMM details for a specific DIMM physical ID from the SMBIOS table.
  */
@@ -36,6 +36,7 @@
 #include <persistence/lib_persistence.h>
 #include <persistence/config_settings.h>
 #include <persistence/event.h>
+#include <persistence/history_dedup.h>
 #include <string/s_str.h>
 #include <uid/uid.h>
 #include "device_adapter.h"
@@ -130,12 +131,11 @@ int nvm_gather_support(const NVM_PATH support_file, const NVM_SIZE support_file_
 			unlink(support_file);
 		}
 
-		// Copy the database to the path specified in p_support_file
-		COMMON_PATH config_file;
-		if (get_lib_store_path(config_file) != COMMON_SUCCESS ||
-				!copy_file(config_file, COMMON_PATH_LEN, support_file, support_file_len))
+		// Copy a consistent image of the database to the path specified in p_support_file
+		if (backup_PersistentStore(p_store, support_file) != DB_SUCCESS)
 		{
 			COMMON_LOG_ERROR_F("Unable to copy %s to: %s", CONFIG_FILE, support_file);
+			delete_file(support_file, support_file_len);
 			rc = NVM_ERR_BADFILE;
 		}
 		else
@@ -177,24 +177,15 @@ int nvm_gather_support(const NVM_PATH support_file, const NVM_SIZE support_file_
 
 				if (encrypt)
 				{
-					COMMON_PATH compressed_file;
 					COMMON_PATH encrypted_file;
 
-					// This entire process adds a CRYPTO_FILE_EXT file extension to the filename
-					if ((temp_rc = compress_file(support_file, compressed_file)) != COMMON_SUCCESS)
-					{
-						// should never get in here
-						COMMON_LOG_ERROR_F("Support file compression failed. rc=%d", temp_rc);
-						rc = NVM_ERR_BADFILE;
-					}
-					else if ((temp_rc = rsa_encrypt(compressed_file, encrypted_file))
+					// Compresses and encrypts in one pass, adding a CRYPTO_FILE_EXT file extension
+					if ((temp_rc = compress_encrypt_file(support_file, encrypted_file))
 							!= NVM_SUCCESS)
 					{
-
 						// should never get in here
 						COMMON_LOG_ERROR_F("Support file encryption failed. rc=%d", temp_rc);
 						rc = NVM_ERR_BADFILE;
-
 					}
 				}
 			}
@@ -892,6 +883,11 @@ int support_filter_data(const NVM_PATH support_file, NVM_UINT16 filter_mask)
 		// TODO: filter performance data
 		// TODO: filter events
 
+		// plain history tables, without the unfiltered content left behind
+		// by the changes above, so any build or sqlite tool can read the copy
+		db_tbl_rc = db_restore_history_tables(p_support);
+		KEEP_ERROR(db_rc, db_tbl_rc);
+
 		// releases the db
 		free_PersistentStore(&p_support);
 	}
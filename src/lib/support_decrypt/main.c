@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * A small tool to decrypt and decompress a support file created by nvm_gather_support.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <common_types.h>
+#include <encrypt/encrypt.h>
+#include <file_ops/file_ops_adapter.h>
+
+/*
+ * Decrypt a support file written before compress_encrypt_file, which was RSA encrypted
+ * block by block after being compressed to an intermediate file.
+ */
+int decrypt_legacy_support_file(const COMMON_PATH key_file, const COMMON_PATH encrypted_file,
+		const COMMON_PATH decrypted_file)
+{
+	int rc = NVM_ERR_BADFILE;
+	COMMON_PATH compressed_file;
+	COMMON_PATH decompressed_file;
+	snprintf(compressed_file, COMMON_PATH_LEN, "%s%s", decrypted_file, COMPRESS_FILE_EXT);
+	if (rsa_decrypt(key_file, encrypted_file, compressed_file) == NVM_SUCCESS)
+	{
+		if (decompress_file(compressed_file, decompressed_file) == 1)
+		{
+			rc = NVM_SUCCESS;
+		}
+		delete_file(compressed_file, COMMON_PATH_LEN);
+	}
+	return rc;
+}
+
+/*
+ * Entry point for the support file decryption tool.
+ * @param arg_count
+ * 		Implicitly defined
+ * @param args
+ * 		The RSA private key file, the encrypted support file and the path of the
+ * 		database to write.
+ * @return 0 on success
+ */
+int main(int arg_count, char **args)
+{
+	int rc = 1;
+	if (arg_count != 4)
+	{
+		printf("Usage: %s <private key file> <support file> <output file>\n", args[0]);
+	}
+	else
+	{
+		COMMON_PATH key_file;
+		COMMON_PATH encrypted_file;
+		COMMON_PATH decrypted_file;
+		snprintf(key_file, COMMON_PATH_LEN, "%s", args[1]);
+		snprintf(encrypted_file, COMMON_PATH_LEN, "%s", args[2]);
+		snprintf(decrypted_file, COMMON_PATH_LEN, "%s", args[3]);
+
+		char magic[SEALED_FILE_MAGIC_LEN];
+		FILE *p_file = fopen(encrypted_file, "rb");
+		int sealed = 0;
+		if (p_file)
+		{
+			sealed = (fread(magic, 1, SEALED_FILE_MAGIC_LEN, p_file) == SEALED_FILE_MAGIC_LEN &&
+					memcmp(magic, SEALED_FILE_MAGIC, SEALED_FILE_MAGIC_LEN) == 0);
+			fclose(p_file);
+		}
+
+		int decrypt_rc;
+		if (!p_file)
+		{
+			printf("Unable to open %s\n", encrypted_file);
+		}
+		else if ((decrypt_rc = sealed ?
+				decrypt_decompress_file(key_file, encrypted_file, decrypted_file) :
+				decrypt_legacy_support_file(key_file, encrypted_file, decrypted_file))
+				!= NVM_SUCCESS)
+		{
+			printf("Failed to decrypt %s, error %d\n", encrypted_file, decrypt_rc);
+		}
+		else
+		{
+			printf("Created %s\n", decrypted_file);
+			rc = 0;
+		}
+	}
+	return rc;
+}
@@ -38,6 +38,13 @@
 #include <persistence/logging.h>
 #include <file_ops/file_ops_adapter.h>
 #include <os/os_adapter.h>
+#include "device_executor.h"
+
+#ifdef __WINDOWS__
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 
 /*
  * Retrieve the firmware image log information from the device specified.
@@ -130,24 +137,21 @@ int read_file_bytes(const NVM_PATH path, const NVM_SIZE path_len,
 	return rc;
 }
 
-int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
-		unsigned char *p_fw_image, const unsigned int fw_image_size)
+/*
+ * Reports the percent of the image transferred, returns 0 to stop the transfer
+ */
+typedef NVM_BOOL (*fw_transfer_progress)(void *p_arg, const NVM_UINT8 percent_complete);
+
+/*
+ * Send the image through the small payload mailbox, one TRANSFER_SIZE packet at a time
+ */
+static int send_fw_small_payload(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		unsigned char *p_fw_image, const unsigned int fw_image_size,
+		fw_transfer_progress progress, void *p_progress_arg)
 {
 	COMMON_LOG_ENTRY();
 	int rc = NVM_SUCCESS;
 
-#if __SET_LARGE_FW_UPDATE__
-	// send a pass through command to update the fw
-	struct fw_cmd cmd;
-	memset(&cmd, 0, sizeof (cmd));
-	cmd.device_handle = device_handle.handle;
-	cmd.opcode = PT_UPDATE_FW;
-	cmd.sub_opcode = SUBOP_UPDATE_FW;
-	cmd.large_input_payload_size = fw_image_size;
-	cmd.large_input_payload = p_fw_image;
-
-	rc = ioctl_passthrough_cmd(&cmd);
-#else
 	struct fw_cmd cmd;
 	memset(&cmd, 0, sizeof (cmd));
 	cmd.device_handle = device_handle.handle;
@@ -159,13 +163,9 @@ int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
 	input_payload.payload_selector = TRANSFER_VIA_SMALL_PAYLOAD;
 	NVM_UINT16 packet_number = 0;
 	unsigned int offset = 0;
-	printf("Transferring the firmware to DIMM %u...\n",
-		device_handle.handle);
-	float num_packets = fw_image_size / TRANSFER_SIZE;
-	int old_percent_complete = 0; // print status
+	NVM_UINT8 old_percent_complete = 0;
 	while (offset < fw_image_size)
 	{
-		// status
 		int size = TRANSFER_SIZE;
 		if (offset == 0)
 		{
@@ -188,7 +188,7 @@ int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
 			input_payload.transfer_header =
 				TRANSFER_HEADER(TRANSFER_TYPE_END, packet_number);
 		}
-		memmove(input_payload.data, (void *)p_fw_image + offset, size);
+		memmove(input_payload.data, p_fw_image + offset, size);
 		cmd.input_payload = &input_payload;
 		cmd.input_payload_size = sizeof (input_payload);
 		rc = ioctl_passthrough_cmd(&cmd);
@@ -201,21 +201,106 @@ int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
 		offset += size;
 		packet_number++;
 
-		// update status
-		int percent_complete = (int)(((float)packet_number / num_packets) * 100);
-		if (percent_complete > old_percent_complete)
+		NVM_UINT8 percent_complete = (NVM_UINT8)(((NVM_UINT64)offset * 100) / fw_image_size);
+		if (progress && percent_complete > old_percent_complete)
 		{
-			printf(".");
 			old_percent_complete = percent_complete;
+			// Once the END packet is sent the device has the whole image
+			if (!progress(p_progress_arg, percent_complete) && offset < fw_image_size)
+			{
+				COMMON_LOG_INFO_F("FW transfer to device 0x%x cancelled at packet_number %u",
+						device_handle.handle, packet_number);
+				rc = NVM_ERR_CANCELLED;
+				break;
+			}
+		}
+	}
+
+	// Don't leave the device waiting on a partial transfer
+	if (rc == NVM_ERR_CANCELLED)
+	{
+		memset(input_payload.data, 0, sizeof (input_payload.data));
+		input_payload.transfer_header =
+			TRANSFER_HEADER(TRANSFER_TYPE_ABORT, packet_number);
+		if (ioctl_passthrough_cmd(&cmd) != NVM_SUCCESS)
+		{
+			COMMON_LOG_WARN_F("Failed to abort the FW transfer to device 0x%x",
+					device_handle.handle);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+#if __SET_LARGE_FW_UPDATE__
+/*
+ * Send the whole image in one command through the large payload mailbox
+ */
+static int send_fw_large_payload(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		unsigned char *p_fw_image, const unsigned int fw_image_size)
+{
+	struct fw_cmd cmd;
+	memset(&cmd, 0, sizeof (cmd));
+	cmd.device_handle = device_handle.handle;
+	cmd.opcode = PT_UPDATE_FW;
+	cmd.sub_opcode = SUBOP_UPDATE_FW;
+	cmd.large_input_payload_size = fw_image_size;
+	cmd.large_input_payload = p_fw_image;
+
+	return ioctl_passthrough_cmd(&cmd);
+}
+#endif
+
+/*
+ * Send an image to a device, through the large payload mailbox when the build and
+ * the device support it and otherwise in small payload packets
+ */
+static int send_fw_image(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		unsigned char *p_fw_image, const unsigned int fw_image_size,
+		fw_transfer_progress progress, void *p_progress_arg)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+#if __SET_LARGE_FW_UPDATE__
+	// The large payload goes in one command, so it can only be cancelled before it starts
+	if (progress && !progress(p_progress_arg, 0))
+	{
+		COMMON_LOG_INFO_F("FW transfer to device 0x%x cancelled before it started",
+				device_handle.handle);
+		rc = NVM_ERR_CANCELLED;
+	}
+	else
+	{
+		rc = send_fw_large_payload(device_handle, p_fw_image, fw_image_size);
+		if (rc == NVM_ERR_BADSIZE || rc == NVM_ERR_NOTSUPPORTED)
+		{
+			COMMON_LOG_WARN_F("Large payload FW transfer to device 0x%x failed with %d, "
+					"falling back to the small payload", device_handle.handle, rc);
+			rc = send_fw_small_payload(device_handle, p_fw_image, fw_image_size,
+					progress, p_progress_arg);
+		}
+		else if (rc == NVM_SUCCESS && progress)
+		{
+			progress(p_progress_arg, 100);
 		}
 	}
-	printf("\n");
+#else
+	rc = send_fw_small_payload(device_handle, p_fw_image, fw_image_size,
+			progress, p_progress_arg);
 #endif
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
 
+int send_new_firmware_to_device(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		unsigned char *p_fw_image, const unsigned int fw_image_size)
+{
+	return send_fw_image(device_handle, p_fw_image, fw_image_size, NULL, NULL);
+}
+
 NVM_BOOL is_fw_update_operation(struct pt_payload_long_op_stat *p_long_op_status)
 {
 	union long_op_command
@@ -264,6 +349,27 @@ int get_firmware_update_status(const NVM_NFIT_DEVICE_HANDLE device_handle)
 	return rc;
 }
 
+/*
+ * Send an image to a device and wait for the device to finish processing it
+ */
+static int apply_firmware(const NVM_NFIT_DEVICE_HANDLE device_handle,
+		unsigned char *p_fw, const unsigned int fw_size,
+		fw_transfer_progress progress, void *p_progress_arg)
+{
+	COMMON_LOG_ENTRY();
+	int rc = send_fw_image(device_handle, p_fw, fw_size, progress, p_progress_arg);
+	if (rc == NVM_SUCCESS)
+	{
+		while ((rc = get_firmware_update_status(device_handle)) == NVM_ERR_DEVICEBUSY)
+		{
+			nvm_sleep(1000); // 1 second
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 int update_firmware(const NVM_NFIT_DEVICE_HANDLE device_handle, const NVM_PATH path,
 		const NVM_SIZE path_len)
 {
@@ -275,16 +381,9 @@ int update_firmware(const NVM_NFIT_DEVICE_HANDLE device_handle, const NVM_PATH p
 	unsigned char *p_fw = NULL;
 	if ((rc = read_file_bytes(path, path_len, &p_fw, &fw_size)) == NVM_SUCCESS)
 	{
-		rc = send_new_firmware_to_device(device_handle, p_fw, fw_size);
-		if (rc == NVM_SUCCESS)
-		{
-			while ((rc = get_firmware_update_status(device_handle)) == NVM_ERR_DEVICEBUSY)
-			{
-				nvm_sleep(1000); // 1 second
-			}
-			// Changing the state invalidates the device cache
-			invalidate_devices();
-		}
+		rc = apply_firmware(device_handle, p_fw, fw_size, NULL, NULL);
+		// Changing the state invalidates the device cache
+		invalidate_devices();
 	}
 
 	free(p_fw);
@@ -374,6 +473,121 @@ int nvm_update_device_fw(const NVM_UID device_uid, const NVM_PATH path,
 	return rc;
 }
 
+/*
+ * Determine if a FW image in memory is valid to load onto a device
+ */
+static int examine_fw_image(const struct device_discovery *p_discovery,
+		const unsigned char *p_buf, const unsigned int buf_len,
+		NVM_VERSION image_version, const NVM_SIZE image_version_len)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	memset(image_version, 0, image_version_len);
+	if (buf_len < sizeof (fwImageHeader))
+	{
+		COMMON_LOG_ERROR("The FW image file is not valid. Image is too small.");
+		rc = NVM_ERR_BADFIRMWARE;
+	}
+	else
+	{
+		const fwImageHeader *p_header = (const fwImageHeader *)p_buf;
+
+		// check some of the header values
+		if (p_header->moduleType != FW_HEADER_MODULETYPE ||
+				p_header->moduleVendor != FW_HEADER_MODULEVENDOR)
+		{
+			COMMON_LOG_ERROR("The FW image file is not valid. ");
+			rc = NVM_ERR_BADFIRMWARE;
+			// no need to continue checking already know the FW is bad
+		}
+		else
+		{
+			unsigned short int current_major;
+			unsigned short int current_minor;
+			unsigned short int current_hotfix;
+			unsigned short int current_build;
+			unsigned short int current_fwAPI_major;
+			unsigned short int current_fwAPI_minor;
+			int image_major = p_header->imageVersion.majorVer.version;
+			int image_minor = p_header->imageVersion.minorVer.version;
+			int image_hotfix = p_header->imageVersion.hotfixVer.version;
+			int image_build = p_header->imageVersion.buildVer.build;
+			unsigned int image_fwAPI_major =
+					get_fw_api_major_version(p_header->fwApiVersion);
+			unsigned int image_fwAPI_minor =
+					get_fw_api_minor_version(p_header->fwApiVersion);
+
+			unsigned long long bsr = 0;
+
+			build_revision(image_version, image_version_len, image_major,
+					image_minor, image_hotfix, image_build);
+
+			parse_main_revision(&current_major, &current_minor, &current_hotfix,
+					&current_build, p_discovery->fw_revision, NVM_VERSION_LEN);
+
+			parse_fw_revision(&current_fwAPI_major, &current_fwAPI_minor,
+					p_discovery->fw_api_version, NVM_VERSION_LEN);
+
+			if (image_major != current_major)
+			{
+				COMMON_LOG_ERROR("The FW image file is not valid. "
+						"Product number cannot be changed.");
+				rc = NVM_ERR_BADFIRMWARE;
+			}
+			else if (image_major == current_major && image_minor < current_minor)
+			{
+				COMMON_LOG_ERROR("The FW image file is not valid. "
+						"Revision number cannot be downgraded.");
+				rc = NVM_ERR_BADFIRMWARE;
+			}
+			else if (is_fw_api_version_downgraded(current_fwAPI_major, current_fwAPI_minor,
+							image_fwAPI_major, image_fwAPI_minor))
+			{
+				if (!is_fw_api_version_supported(image_fwAPI_major, image_fwAPI_minor))
+				{
+					COMMON_LOG_ERROR("The firmware image is not compatible with this "
+							"version of software.");
+					rc = NVM_ERR_INCOMPATIBLEFW;
+				}
+				else
+				{
+					rc = NVM_ERR_REQUIRESFORCE;
+				}
+			}
+			else if (image_hotfix < current_hotfix)
+			{
+				rc = fw_get_bsr(p_discovery->device_handle, &bsr);
+				if (rc == NVM_SUCCESS)
+				{
+					if (!BSR_OPTIN_ENABLED(bsr))
+					{
+						COMMON_LOG_ERROR("The FW image file is not valid. "
+								"Svn Downgrade Opt-In is disabled.");
+						rc = NVM_ERR_BADFIRMWARE;
+					}
+					else
+					{
+						rc = NVM_ERR_REQUIRESFORCE;
+					}
+				}
+				else
+				{
+					COMMON_LOG_ERROR("Could not get the BSR. "
+							"Couldnot determine the Opt-In value");
+				}
+			}
+			else if (image_build < current_build)
+			{
+				rc = NVM_ERR_REQUIRESFORCE;
+			}
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
 /*
  * Determine if the FW image is valid to load onto a device
  */
@@ -438,110 +652,253 @@ int nvm_examine_device_fw(const NVM_UID device_uid, const NVM_PATH path, const N
 		memset(image_version, 0, image_version_len);
 		if ((rc = read_file_bytes(path, path_len, &p_buf, &buf_len)) == NVM_SUCCESS)
 		{
-			if (buf_len < sizeof (fwImageHeader))
+			rc = examine_fw_image(&discovery, p_buf, buf_len, image_version, image_version_len);
+		}
+		if (p_buf != NULL)
+		{
+			free(p_buf);
+		}
+	}
+
+	COMMON_LOG_EXIT_RETURN_I(rc);
+	return rc;
+}
+
+/*
+ * Per-device state of a multi-device FW update
+ */
+struct fw_update_device
+{
+	struct fw_update_job *p_job;
+	struct device_discovery discovery;
+	NVM_VERSION image_version;
+	int result;
+};
+
+/*
+ * Shared state of a multi-device FW update
+ */
+struct fw_update_job
+{
+#ifdef __WINDOWS__
+	HANDLE lock;
+#else
+	pthread_mutex_t lock;
+#endif
+	unsigned char *p_fw;
+	unsigned int fw_size;
+	NVM_BOOL force;
+	fw_update_progress_callback p_callback;
+	void *p_context;
+	NVM_BOOL cancelled; // protected by lock
+	struct fw_update_device *p_devices;
+};
+
+/*
+ * Report progress to the caller, one call at a time. After a cancel only the
+ * completion of each device is reported.
+ * Returns 0 once the caller has cancelled the update.
+ */
+static NVM_BOOL report_fw_update_progress(struct fw_update_device *p_device,
+		const enum fw_update_stage stage, const NVM_UINT8 percent_complete, const int result)
+{
+	struct fw_update_job *p_job = p_device->p_job;
+	NVM_BOOL keep_going = 0;
+	if (mutex_lock((OS_MUTEX*)&p_job->lock))
+	{
+		if (p_job->p_callback &&
+			(!p_job->cancelled || stage == FW_UPDATE_STAGE_COMPLETE) &&
+			!p_job->p_callback(p_device->discovery.uid, stage, percent_complete,
+				result, p_job->p_context))
+		{
+			COMMON_LOG_INFO("FW update cancelled by the caller");
+			p_job->cancelled = 1;
+		}
+		keep_going = !p_job->cancelled;
+		mutex_unlock((OS_MUTEX*)&p_job->lock);
+	}
+	return keep_going;
+}
+
+static NVM_BOOL report_fw_transfer_progress(void *p_arg, const NVM_UINT8 percent_complete)
+{
+	return report_fw_update_progress((struct fw_update_device *)p_arg,
+			FW_UPDATE_STAGE_TRANSFERRING, percent_complete, NVM_SUCCESS);
+}
+
+static int update_device_fw_task(void *p_arg, const int index)
+{
+	struct fw_update_job *p_job = (struct fw_update_job *)p_arg;
+	struct fw_update_device *p_device = &p_job->p_devices[index];
+	int rc = NVM_SUCCESS;
+
+	// the image was already validated against every device
+	if (!report_fw_update_progress(p_device, FW_UPDATE_STAGE_TRANSFERRING, 0, NVM_SUCCESS))
+	{
+		rc = NVM_ERR_CANCELLED;
+	}
+	else
+	{
+		rc = apply_firmware(p_device->discovery.device_handle, p_job->p_fw, p_job->fw_size,
+				report_fw_transfer_progress, p_device);
+	}
+
+	p_device->result = rc;
+	report_fw_update_progress(p_device, FW_UPDATE_STAGE_COMPLETE, 100, rc);
+	return rc;
+}
+
+/*
+ * Push a new FW image to several devices at once.
+ */
+int nvm_update_devices_fw(const NVM_UID *p_device_uids, const NVM_UINT16 device_count,
+		const NVM_PATH path, const NVM_SIZE path_len, const NVM_BOOL force,
+		fw_update_progress_callback p_callback, void *p_context, int *p_results)
+{
+	COMMON_LOG_ENTRY();
+	int rc = NVM_SUCCESS;
+
+	if (check_caller_permissions() != NVM_SUCCESS)
+	{
+		rc = NVM_ERR_INVALIDPERMISSIONS;
+	}
+	else if (!is_supported_driver_available())
+	{
+		rc = NVM_ERR_BADDRIVER;
+	}
+	else if ((rc = IS_NVM_FEATURE_SUPPORTED(modify_device_settings)) != NVM_SUCCESS)
+	{
+		COMMON_LOG_ERROR("Modifying device settings is not supported.");
+	}
+	else if (p_device_uids == NULL || device_count == 0)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, no devices specified");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (path == NULL)
+	{
+		COMMON_LOG_ERROR("File path is NULL");
+		rc = NVM_ERR_BADFILE;
+	}
+	else if (path_len >= NVM_PATH_LEN)
+	{
+		COMMON_LOG_ERROR_F(
+				"Invalid parameter, path length is too big: %d; <= %d",
+				path_len, NVM_PATH_LEN);
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (path_len == 0)
+	{
+		COMMON_LOG_ERROR("Invalid parameter, path length is 0");
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (!file_exists(path, path_len))
+	{
+		COMMON_LOG_ERROR_F("File %s does not exist", path);
+		rc = NVM_ERR_BADFILE;
+	}
+	else
+	{
+		struct fw_update_job job;
+		memset(&job, 0, sizeof (job));
+		job.force = force;
+		job.p_callback = p_callback;
+		job.p_context = p_context;
+		job.p_devices = calloc(device_count, sizeof (struct fw_update_device));
+		NVM_UINT32 *p_device_handles = calloc(device_count, sizeof (NVM_UINT32));
+		if (!job.p_devices || !p_device_handles)
+		{
+			COMMON_LOG_ERROR("Failed to allocate memory for the FW update");
+			rc = NVM_ERR_NOMEMORY;
+		}
+		else
+		{
+			// every device must be manageable before any of them is touched
+			for (int i = 0; i < device_count && rc == NVM_SUCCESS; i++)
 			{
-				COMMON_LOG_ERROR("The FW image file is not valid. Image is too small.");
-				rc = NVM_ERR_BADFIRMWARE;
+				job.p_devices[i].p_job = &job;
+				if ((rc = exists_and_manageable(p_device_uids[i],
+						&job.p_devices[i].discovery, 1)) == NVM_SUCCESS)
+				{
+					p_device_handles[i] = job.p_devices[i].discovery.device_handle.handle;
+				}
+			}
+		}
+
+		// the image is read once and shared by every transfer
+		if (rc == NVM_SUCCESS &&
+			(rc = read_file_bytes(path, path_len, &job.p_fw, &job.fw_size)) == NVM_SUCCESS)
+		{
+			if (!mutex_init((OS_MUTEX*)&job.lock, NULL))
+			{
+				COMMON_LOG_ERROR("Failed to initialize the FW update lock");
+				rc = NVM_ERR_UNKNOWN;
 			}
 			else
 			{
-				fwImageHeader *p_header = (fwImageHeader *)p_buf;
-
-				// check some of the header values
-				if (p_header->moduleType != FW_HEADER_MODULETYPE ||
-						p_header->moduleVendor != FW_HEADER_MODULEVENDOR)
+				// and accept the image
+				for (int i = 0; i < device_count && rc == NVM_SUCCESS; i++)
 				{
-					COMMON_LOG_ERROR("The FW image file is not valid. ");
-					rc = NVM_ERR_BADFIRMWARE;
-					// no need to continue checking already know the FW is bad
-				}
-				else
-				{
-					unsigned short int current_major;
-					unsigned short int current_minor;
-					unsigned short int current_hotfix;
-					unsigned short int current_build;
-					unsigned short int current_fwAPI_major;
-					unsigned short int current_fwAPI_minor;
-					int image_major = p_header->imageVersion.majorVer.version;
-					int image_minor = p_header->imageVersion.minorVer.version;
-					int image_hotfix = p_header->imageVersion.hotfixVer.version;
-					int image_build = p_header->imageVersion.buildVer.build;
-					unsigned int image_fwAPI_major =
-							get_fw_api_major_version(p_header->fwApiVersion);
-					unsigned int image_fwAPI_minor =
-							get_fw_api_minor_version(p_header->fwApiVersion);
-
-					unsigned long long bsr = 0;
-
-					build_revision(image_version, image_version_len, image_major,
-							image_minor, image_hotfix, image_build);
-
-					parse_main_revision(&current_major, &current_minor, &current_hotfix,
-							&current_build, discovery.fw_revision, NVM_VERSION_LEN);
-
-					parse_fw_revision(&current_fwAPI_major, &current_fwAPI_minor,
-							discovery.fw_api_version, NVM_VERSION_LEN);
-
-					if (image_major != current_major)
+					struct fw_update_device *p_device = &job.p_devices[i];
+					if (!report_fw_update_progress(p_device, FW_UPDATE_STAGE_VALIDATING, 0,
+							NVM_SUCCESS))
 					{
-						COMMON_LOG_ERROR("The FW image file is not valid. "
-								"Product number cannot be changed.");
-						rc = NVM_ERR_BADFIRMWARE;
+						rc = NVM_ERR_CANCELLED;
 					}
-					else if (image_major == current_major && image_minor < current_minor)
+					else if ((rc = examine_fw_image(&p_device->discovery, job.p_fw, job.fw_size,
+							p_device->image_version, NVM_VERSION_LEN)) ==
+							NVM_ERR_REQUIRESFORCE && force == 1)
 					{
-						COMMON_LOG_ERROR("The FW image file is not valid. "
-								"Revision number cannot be downgraded.");
-						rc = NVM_ERR_BADFIRMWARE;
+						rc = NVM_SUCCESS;
 					}
-					else if (is_fw_api_version_downgraded(current_fwAPI_major, current_fwAPI_minor,
-									image_fwAPI_major, image_fwAPI_minor))
+
+					if (rc != NVM_SUCCESS)
 					{
-						if (!is_fw_api_version_supported(image_fwAPI_major, image_fwAPI_minor))
-						{
-							COMMON_LOG_ERROR("The firmware image is not compatible with this "
-									"version of software.");
-							rc = NVM_ERR_INCOMPATIBLEFW;
-						}
-						else
+						COMMON_LOG_ERROR_F("The FW image was rejected for device %d, "
+								"no device was updated", i);
+						report_fw_update_progress(p_device, FW_UPDATE_STAGE_COMPLETE, 100, rc);
+						for (int j = 0; j < device_count; j++)
 						{
-							rc = NVM_ERR_REQUIRESFORCE;
+							job.p_devices[j].result = (j == i) ? rc : NVM_ERR_CANCELLED;
 						}
 					}
-					else if (image_hotfix < current_hotfix)
+				}
+
+				if (rc == NVM_SUCCESS)
+				{
+					rc = run_device_tasks(p_device_handles, device_count,
+							update_device_fw_task, &job);
+
+					// Changing the state invalidates the device cache
+					invalidate_devices();
+				}
+				mutex_delete((OS_MUTEX*)&job.lock, NULL);
+
+				for (int i = 0; i < device_count; i++)
+				{
+					if (job.p_devices[i].result == NVM_SUCCESS)
 					{
-						rc = fw_get_bsr(discovery.device_handle, &bsr);
-						if (rc == NVM_SUCCESS)
-						{
-							if (!BSR_OPTIN_ENABLED(bsr))
-							{
-								COMMON_LOG_ERROR("The FW image file is not valid. "
-										"Svn Downgrade Opt-In is disabled.");
-								rc = NVM_ERR_BADFIRMWARE;
-							}
-							else
-							{
-								rc = NVM_ERR_REQUIRESFORCE;
-							}
-						}
-						else
-						{
-							COMMON_LOG_ERROR("Could not get the BSR. "
-									"Couldnot determine the Opt-In value");
-						}
+						// Log an event indicating we successfully updated
+						NVM_EVENT_ARG uid_arg;
+						uid_to_event_arg(p_device_uids[i], uid_arg);
+						NVM_EVENT_ARG version_arg;
+						s_strcpy(version_arg, job.p_devices[i].image_version, NVM_EVENT_ARG_LEN);
+						log_mgmt_event(EVENT_SEVERITY_INFO,
+								EVENT_CODE_MGMT_FIRMWARE_UPDATE,
+								p_device_uids[i],
+								0, // no action required
+								uid_arg, version_arg, NULL);
 					}
-					else if (image_build < current_build)
+					if (p_results)
 					{
-						rc = NVM_ERR_REQUIRESFORCE;
+						p_results[i] = job.p_devices[i].result;
 					}
 				}
 			}
 		}
-		if (p_buf != NULL)
-		{
-			free(p_buf);
-		}
+		free(job.p_fw);
+		free(job.p_devices);
+		free(p_device_handles);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -35,6 +35,7 @@
 #include "nfit_utilities.h"
 #include "smbios_utilities.h"
 #include "system.h"
+#include "nvm_context.h"
 #include "nfit_utilities.h"
 #include "win_leg_adapter.h"
 #include "win_scm2_adapter.h"
@@ -130,21 +131,7 @@ int get_dimm_details(NVM_NFIT_DEVICE_HANDLE device_handle, struct nvm_details *p
 int get_smbios_inventory_count()
 {
 	COMMON_LOG_ENTRY();
-	int rc = 0;
-
-	NVM_UINT8 *p_smbios_table = NULL;
-	size_t smbios_table_size = 0;
-	rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
-	if (rc == NVM_SUCCESS)
-	{
-		rc = smbios_get_populated_memory_device_count(p_smbios_table, smbios_table_size);
-	}
-
-	if (p_smbios_table)
-	{
-		free(p_smbios_table);
-	}
-
+	int rc = get_cached_smbios_memory_devices(NULL, 0);
 	COMMON_LOG_EXIT_RETURN_I(rc);
 	return rc;
 }
@@ -162,20 +149,7 @@ int get_smbios_inventory(const NVM_UINT8 count, struct nvm_details *p_smbios_inv
 	else
 	{
 		memset(p_smbios_inventory, 0, sizeof (struct nvm_details) * count);
-
-		NVM_UINT8 *p_smbios_table = NULL;
-		size_t smbios_table_size = 0;
-		rc = get_smbios_table_alloc(&p_smbios_table, &smbios_table_size);
-		if (rc == NVM_SUCCESS)
-		{
-			rc = smbios_table_to_nvm_details_array(p_smbios_table,
-					smbios_table_size, p_smbios_inventory, count);
-		}
-
-		if (p_smbios_table)
-		{
-			free(p_smbios_table);
-		}
+		rc = get_cached_smbios_memory_devices(p_smbios_inventory, count);
 	}
 
 	COMMON_LOG_EXIT_RETURN_I(rc);
@@ -400,6 +374,33 @@ int ioctl_passthrough_cmd(struct fw_cmd *p_cmd)
 			break;
 	}
 
+	// the command may have changed what is cached for the DIMM
+	if (p_cmd)
+	{
+		invalidate_fw_results_for_cmd(p_cmd->device_handle,
+				p_cmd->opcode, p_cmd->sub_opcode);
+	}
+
+	return rc;
+}
+
+/*
+ * The Windows drivers take one command per IOCTL so a batch is sent a command at a time
+ */
+int ioctl_passthrough_cmds(struct fw_cmd *p_cmds, const int count, int *p_results)
+{
+	int rc = NVM_SUCCESS;
+	if (p_cmds == NULL || p_results == NULL || count <= 0)
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+		{
+			p_results[i] = ioctl_passthrough_cmd(&p_cmds[i]);
+		}
+	}
 	return rc;
 }
 
@@ -78,10 +78,13 @@ monitor::EventMonitor::EventMonitor(core::NvmLibrary &lib) :
 	m_nsMgmtCallbackId(-1),
 	m_lib(lib)
 {
+	// hold a context for the life of the monitor so cached firmware results carry over
+	nvm_create_context();
 }
 
 monitor::EventMonitor::~EventMonitor()
 {
+	nvm_free_context(0);
 }
 
 void monitor::EventMonitor::init(SYSTEM_LOGGER logger)
@@ -112,16 +115,12 @@ void monitor::EventMonitor::startOfDay()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
-	nvm_create_context();
-
 	checkDeviceStartUpStatus();
 	runPlatformConfigDiagnostic();
 
 	// auto-acknowledge action required events for namespaces
 	// that no longer exist
 	acknowledgeDeletedNamespaces();
-
-	nvm_free_context(1);
 }
 
 void monitor::EventMonitor::runPlatformConfigDiagnostic()
@@ -856,8 +855,8 @@ void monitor::EventMonitor::monitor()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
-	nvm_free_context(1);
-	nvm_create_context();
+	// re-read the DIMMs and namespaces, the firmware results expire on their own
+	invalidate_sampled_data();
 
 	monitorDevices();
 
@@ -868,8 +867,10 @@ void monitor::EventMonitor::monitor()
 		monitorNamespaces(pStore);
 	}
 
-	nvm_free_context(1);
 	log_gather();
+
+	// the monitor is the long running writer, so it keeps the WAL from growing
+	checkpoint_lib_store();
 }
 
 void monitor::EventMonitor::monitorDevices()
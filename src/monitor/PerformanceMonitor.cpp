@@ -38,6 +38,8 @@
 #include <string/s_str.h>
 #include <persistence/config_settings.h>
 #include <nvm_context.h>
+#include <device_executor.h>
+#include <persistence/event.h>
 
 monitor::PerformanceMonitor::PerformanceMonitor()
 	: NvmMonitorBase(PERFORMANCE_MONITOR_NAME)
@@ -46,11 +48,35 @@ monitor::PerformanceMonitor::PerformanceMonitor()
 
 	// open a connection to the db
 	m_pStore = get_lib_store();
+
+	// hold a context for the life of the monitor so cached firmware results carry over
+	nvm_create_context();
 }
 
 monitor::PerformanceMonitor::~PerformanceMonitor()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+	nvm_free_context(0);
+}
+
+/*
+ * Per-DIMM performance collection state shared with the device executor
+ */
+struct performanceCollection
+{
+	std::vector<struct device_discovery> *pDimms;
+	std::vector<struct device_performance> *pPerformance;
+	std::vector<int> *pResults;
+};
+
+static int collectDimmPerformance(void *pArg, const int index)
+{
+	struct performanceCollection *pCollection = (struct performanceCollection *)pArg;
+	struct device_performance &devPerformance = (*pCollection->pPerformance)[index];
+	memset(&devPerformance, 0, sizeof (devPerformance));
+	int rc = nvm_get_device_performance((*pCollection->pDimms)[index].uid, &devPerformance);
+	(*pCollection->pResults)[index] = rc;
+	return rc;
 }
 
 /*
@@ -60,54 +86,56 @@ void monitor::PerformanceMonitor::monitor()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
-	// create context
-	nvm_free_context(1);
-	nvm_create_context();
-
-	bool performanceDataAdded = false;
+	// re-read the DIMMs, the firmware results expire on their own
+	invalidate_sampled_data();
 
 	// get list of manageable dimms
-	std::vector<std::string> dimmList = getDimmList();
-	for (std::vector<std::string>::const_iterator dimmUidIter = dimmList.begin();
-			dimmUidIter != dimmList.end(); dimmUidIter++)
+	std::vector<struct device_discovery> dimmList = getDimmList();
+	if (!dimmList.empty())
 	{
-		std::string dimmUidStr = *dimmUidIter;
-		NVM_UID dimmUid;
-		uid_copy(dimmUidStr.c_str(), dimmUid);
-
-		// get performance data for the dimm
-		struct device_performance devPerformance;
-		memset(&devPerformance, 0, sizeof (devPerformance));
-		int rc = nvm_get_device_performance(dimmUid, &devPerformance);
-		if (rc != NVM_SUCCESS)
+		// read the counters from every dimm concurrently
+		std::vector<struct device_performance> performance(dimmList.size());
+		std::vector<int> results(dimmList.size(), NVM_SUCCESS);
+		std::vector<NVM_UINT32> handles;
+		for (size_t i = 0; i < dimmList.size(); i++)
 		{
-			COMMON_LOG_ERROR_F(
-				"Failed to retrieve the performance data for " NVM_DIMM_NAME " %s", dimmUidStr.c_str());
+			handles.push_back(dimmList[i].device_handle.handle);
 		}
-		// store it in the db
-		else if (storeDimmPerformanceData(dimmUidStr, devPerformance))
+		struct performanceCollection collection = {&dimmList, &performance, &results};
+		run_device_tasks(&handles[0], (int)handles.size(), collectDimmPerformance, &collection);
+
+		// then store them serially in one transaction
+		db_begin_transaction(m_pStore);
+		for (size_t i = 0; i < dimmList.size(); i++)
 		{
-			performanceDataAdded = true;
+			NVM_UID uidStr;
+			uid_copy(dimmList[i].uid, uidStr);
+			std::string dimmUidStr(uidStr);
+			if (results[i] != NVM_SUCCESS)
+			{
+				COMMON_LOG_ERROR_F(
+					"Failed to retrieve the performance data for " NVM_DIMM_NAME " %s", dimmUidStr.c_str());
+			}
+			// store it in the db
+			else
+			{
+				storeDimmPerformanceData(dimmUidStr, (int)dimmList.size(), performance[i]);
+			}
 		}
-	}
-
-	// trim the performance data if any new data is added
-	if (performanceDataAdded)
-	{
-		trimPerformanceData();
+		db_end_transaction(m_pStore);
+		notify_pending_events();
 	}
 
 	// clean up
 	dimmList.clear();
-	nvm_free_context(1);
 	log_gather();
 }
 
-std::vector<std::string> monitor::PerformanceMonitor::getDimmList()
+std::vector<struct device_discovery> monitor::PerformanceMonitor::getDimmList()
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
-	std::vector<std::string> dimmList;
+	std::vector<struct device_discovery> dimmList;
 	int dimmCount = nvm_get_device_count();
 	 // error getting dimm count
 	if (dimmCount < 0)
@@ -132,9 +160,7 @@ std::vector<std::string> monitor::PerformanceMonitor::getDimmList()
 				// only looks at manageable NVM-DIMMs
 				if (dimms[i].manageability == MANAGEMENT_VALIDCONFIG)
 				{
-					NVM_UID uidStr;
-					uid_copy(dimms[i].uid, uidStr);
-					dimmList.push_back(std::string(uidStr));
+					dimmList.push_back(dimms[i]);
 				}
 			}
 		}
@@ -145,70 +171,11 @@ std::vector<std::string> monitor::PerformanceMonitor::getDimmList()
 }
 
 bool monitor::PerformanceMonitor::storeDimmPerformanceData(const std::string &dimmUidStr,
-		struct device_performance &performance)
-{
-	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
-	bool dimmPerformanceStored = false;
-
-	struct db_performance performanceRow;
-	memset(&performanceRow, 0, sizeof (performanceRow));
-
-	// db_peformance.id will be auto generated by sqlite
-	s_strcpy(performanceRow.dimm_uid, dimmUidStr.c_str(), NVM_MAX_UID_LEN);
-	performanceRow.time = performance.time;
-	performanceRow.bytes_read = performance.bytes_read;
-	performanceRow.bytes_written = performance.bytes_written;
-	performanceRow.read_reqs = performance.host_reads;
-	performanceRow.host_write_cmds = performance.host_writes;
-	performanceRow.block_reads = performance.block_reads;
-	performanceRow.block_writes = performance.block_writes;
-
-	if (db_add_performance(m_pStore, &performanceRow) != DB_SUCCESS)
-	{
-		COMMON_LOG_ERROR_F(
-				"Failed to store performance metrics for " NVM_DIMM_NAME " %s", dimmUidStr.c_str());
-	}
-	else
-	{
-		dimmPerformanceStored = true;
-	}
-	return dimmPerformanceStored;
-}
-
-void monitor::PerformanceMonitor::trimPerformanceData()
+		const int dimmCount, struct device_performance &performance)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
 
-	// max and trim percent are configurable
-	int maxPerformanceRows = 10000;
-	int defaultTrimPercent = 30;
-	int trimPercent = defaultTrimPercent;
-	get_bounded_config_value_int(SQL_KEY_PERFORMANCE_LOG_MAX, &maxPerformanceRows);
-	get_bounded_config_value_int(SQL_KEY_PERFORMANCE_LOG_TRIM_PERCENT, &trimPercent);
-	if (trimPercent < 0)
-		trimPercent = defaultTrimPercent;
-
-	int currentPerformanceRows = 0;
-	table_row_count(m_pStore, PERFORMANCE_TABLE_NAME.c_str(), &currentPerformanceRows);
-	if (currentPerformanceRows > maxPerformanceRows)
-	{
-		// trim overage and additional % so we're not trimming every time
-		int trimCount = currentPerformanceRows - maxPerformanceRows;
-		trimCount += (((float)trimPercent)/100 * maxPerformanceRows);
-		// make sure it's not greater than all
-		if (trimCount > currentPerformanceRows)
-		{
-			trimCount = currentPerformanceRows;
-		}
-		char sql[1024];
-		s_snprintf(sql, 1024,
-				"DELETE FROM performance "
-				"where id IN "
-				"(SELECT id FROM performance ORDER BY time DESC LIMIT %d)",
-				trimCount);
-		if (db_run_custom_sql(m_pStore, sql) != DB_SUCCESS)
-		{
-			COMMON_LOG_ERROR("Failed to trim the stored performance metrics log");
-		}
-	}
+	// the sample and rollup rings overwrite in place so they never need trimming
+	return store_device_performance(m_pStore, dimmUidStr.c_str(), dimmCount,
+			&performance) == NVM_SUCCESS;
 }
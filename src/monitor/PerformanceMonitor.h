@@ -34,6 +34,7 @@
 #include "NvmMonitorBase.h"
 #include <nvm_management.h>
 #include <persistence/schema.h>
+#include <persistence/performance_store.h>
 
 #ifndef _MONITOR_PERFORMANCEMONITOR_H_
 #define _MONITOR_PERFORMANCEMONITOR_H_
@@ -42,7 +43,6 @@
 namespace monitor
 {
 	static const std::string PERFORMANCE_MONITOR_NAME = "PERFORMANCE";
-	static const std::string PERFORMANCE_TABLE_NAME = "performance";
 
 	/*
 	 * Monitor class to periodically poll and store performance metrics for
@@ -56,9 +56,9 @@ namespace monitor
 			virtual void monitor();
 
 		private:
-			std::vector<std::string> getDimmList();
-			bool storeDimmPerformanceData(const std::string &dimmUidStr, struct device_performance &performance);
-			void trimPerformanceData();
+			std::vector<struct device_discovery> getDimmList();
+			bool storeDimmPerformanceData(const std::string &dimmUidStr, const int dimmCount,
+					struct device_performance &performance);
 			PersistentStore *m_pStore;
 	};
 }
@@ -33,6 +33,7 @@
 
 #include <LogEnterExit.h>
 #include <NvmStrings.h>
+#include <lib_interface/NvmSnapshotApi.h>
 #include "NvmProviderFactory.h"
 
 wbem::framework_interface::NvmInstanceFactory::NvmInstanceFactory(
@@ -61,3 +62,58 @@ std::string wbem::framework_interface::NvmInstanceFactory::getHostName()
 	}
 	return m_hostName;
 }
+
+wbem::framework::instances_t *wbem::framework_interface::NvmInstanceFactory::getInstances(
+		framework::attribute_names_t &attributes)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	// route the factory's library queries through the snapshot for this request only
+	lib_interface::NvmApi *pApi = m_pApi;
+	lib_interface::NvmSnapshotApi snapshot(pApi);
+	m_pApi = &snapshot;
+
+	framework::instances_t *pResult = NULL;
+	try
+	{
+		pResult = getInstancesFromSnapshot(attributes);
+	}
+	catch (...)
+	{
+		// the snapshot goes out of scope, never leave the factory pointing at it
+		m_pApi = pApi;
+		throw;
+	}
+
+	m_pApi = pApi;
+	return pResult;
+}
+
+wbem::framework::instances_t *wbem::framework_interface::NvmInstanceFactory::getInstancesFromSnapshot(
+		framework::attribute_names_t &attributes)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	framework::instances_t *pResult = new framework::instances_t();
+	framework::instance_names_t *pNames = NULL;
+	try
+	{
+		pNames = getInstanceNames();
+		for (framework::instance_names_t::iterator iter = pNames->begin();
+				iter != pNames->end(); iter++)
+		{
+			framework::Instance *pInstance = getInstance(*iter, attributes);
+			pResult->push_back(*pInstance);
+			delete pInstance;
+		}
+		delete pNames;
+	}
+	catch (framework::Exception &)
+	{
+		delete pNames;
+		delete pResult;
+		throw;
+	}
+
+	return pResult;
+}
@@ -61,7 +61,21 @@ public:
 	virtual ~NvmInstanceFactory() {}
 	static framework::InstanceFactory *getInstanceFactory(std::string className);
 
+	/*!
+	 * Enumerate every instance of the class. Library queries made through m_pApi
+	 * while the instances are built are served from one snapshot per call, so each
+	 * DIMM's data is read once however many instances use it.
+	 */
+	virtual framework::instances_t *getInstances(framework::attribute_names_t &attributes);
+
 protected:
+	/*!
+	 * Build every instance while the snapshot is active. The default looks up each
+	 * name from getInstanceNames with getInstance.
+	 */
+	virtual framework::instances_t *getInstancesFromSnapshot(
+			framework::attribute_names_t &attributes);
+
 	wbem::lib_interface::NvmApi *m_pApi;
 	core::system::SystemService &m_systemService;
 	std::string m_hostName;
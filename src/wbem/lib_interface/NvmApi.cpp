@@ -86,7 +86,11 @@ NvmApi::NvmApi()
 
 NvmApi::~NvmApi()
 {
-	m_pSingleton = NULL;
+	// derived APIs such as NvmSnapshotApi are not the singleton
+	if (m_pSingleton == this)
+	{
+		m_pSingleton = NULL;
+	}
 }
 
 NvmApi* NvmApi::getApi()
@@ -660,6 +664,34 @@ void NvmApi::getManageableDimms(std::vector<struct device_discovery>& manageable
 	}
 }
 
+void NvmApi::getAllDeviceStatuses(std::vector<struct device_status_entry> &statuses) const
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int rc = getDeviceCount();
+	if (rc < 0)
+	{
+		throw exception::NvmExceptionLibError(rc);
+	}
+	else if (rc > 0) // don't bother if there's nothing to fetch
+	{
+		int count = rc;
+		std::unique_ptr<struct device_status_entry[]> apiStatuses(new device_status_entry[count]);
+		memset(apiStatuses.get(), 0, count * sizeof (device_status_entry));
+		rc = nvm_get_all_device_statuses(apiStatuses.get(), count);
+		if (rc < 0)
+		{
+			throw exception::NvmExceptionLibError(rc);
+		}
+
+		statuses.clear();
+		for (int i = 0; i < rc; i++)
+		{
+			statuses.push_back(apiStatuses[i]);
+		}
+	}
+}
+
 void NvmApi::setUserPreference(const NVM_PREFERENCE_KEY key, const NVM_PREFERENCE_VALUE value)
 {
 	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
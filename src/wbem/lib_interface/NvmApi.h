@@ -480,6 +480,12 @@ class NVM_CIM_API NvmApi
 		virtual void getManageableDimms(
 				std::vector<struct device_discovery>& manageableDevices) const;
 
+		/*
+		 * Retrieve the current status of all manageable NVM-DIMMs in one call
+		 */
+		virtual void getAllDeviceStatuses(
+				std::vector<struct device_status_entry> &statuses) const;
+
 		/*
 		 * set the user preference
 		 */
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file implements an NvmApi that reads each DIMM's data from the library once
+ * and answers every later query for it from memory.
+ */
+
+#include "NvmSnapshotApi.h"
+
+#include <string.h>
+#include <libinvm-cim/Exception.h>
+#include <uid/uid.h>
+#include <LogEnterExit.h>
+
+namespace wbem
+{
+namespace lib_interface
+{
+
+/*
+ * NVM_UID is a fixed size char array, use its string form as the cache key
+ */
+static std::string uidToKey(const NVM_UID uid)
+{
+	NVM_UID uidStr;
+	uid_copy(uid, uidStr);
+	return std::string(uidStr);
+}
+
+NvmSnapshotApi::NvmSnapshotApi(NvmApi *pSource) :
+	m_pSource(pSource), m_devicesLoaded(false), m_devicesRc(NVM_SUCCESS),
+	m_statusesLoaded(false)
+{
+}
+
+NvmSnapshotApi::~NvmSnapshotApi()
+{
+}
+
+void NvmSnapshotApi::loadDevices() const
+{
+	if (!m_devicesLoaded)
+	{
+		m_devicesLoaded = true;
+		m_devices.clear();
+		m_devicesRc = m_pSource->getDeviceCount();
+		if (m_devicesRc > 0)
+		{
+			m_devices.resize(m_devicesRc);
+			memset(&m_devices[0], 0, m_devices.size() * sizeof (struct device_discovery));
+			m_devicesRc = m_pSource->getDevices(&m_devices[0], m_devices.size());
+			m_devices.resize(m_devicesRc > 0 ? m_devicesRc : 0);
+		}
+	}
+}
+
+int NvmSnapshotApi::getDeviceCount() const
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	loadDevices();
+	return m_devicesRc < 0 ? m_devicesRc : (int)m_devices.size();
+}
+
+int NvmSnapshotApi::getDevices(struct device_discovery *pDevices, const NVM_UINT8 count) const
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int rc = NVM_SUCCESS;
+	loadDevices();
+	if (m_devicesRc < 0)
+	{
+		rc = m_devicesRc;
+	}
+	else if (pDevices == NULL)
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (count < m_devices.size())
+	{
+		rc = NVM_ERR_ARRAYTOOSMALL;
+	}
+	else
+	{
+		for (size_t i = 0; i < m_devices.size(); i++)
+		{
+			pDevices[i] = m_devices[i];
+		}
+		rc = (int)m_devices.size();
+	}
+	return rc;
+}
+
+int NvmSnapshotApi::getDeviceDiscovery(NVM_UID uid, struct device_discovery *pDevice)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int rc = NVM_ERR_BADDEVICE;
+	loadDevices();
+	for (size_t i = 0; i < m_devices.size() && rc == NVM_ERR_BADDEVICE; i++)
+	{
+		if (uid_cmp(uid, m_devices[i].uid))
+		{
+			if (pDevice == NULL)
+			{
+				rc = NVM_ERR_INVALIDPARAMETER;
+			}
+			else
+			{
+				*pDevice = m_devices[i];
+				rc = NVM_SUCCESS;
+			}
+		}
+	}
+
+	// not in the snapshot, let the library report why
+	if (rc == NVM_ERR_BADDEVICE)
+	{
+		rc = m_pSource->getDeviceDiscovery(uid, pDevice);
+	}
+	return rc;
+}
+
+void NvmSnapshotApi::loadStatuses()
+{
+	if (!m_statusesLoaded)
+	{
+		m_statusesLoaded = true;
+		std::vector<struct device_status_entry> statuses;
+		try
+		{
+			m_pSource->getAllDeviceStatuses(statuses);
+		}
+		catch (framework::Exception &)
+		{
+			// fall back to reading each DIMM's status as it is requested
+			statuses.clear();
+		}
+
+		for (size_t i = 0; i < statuses.size(); i++)
+		{
+			m_statuses[uidToKey(statuses[i].uid)] =
+					std::make_pair((int)NVM_SUCCESS, statuses[i].status);
+		}
+	}
+}
+
+int NvmSnapshotApi::getDeviceStatus(const NVM_UID deviceUid, struct device_status *pStatus)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int rc = NVM_SUCCESS;
+	if (deviceUid == NULL || pStatus == NULL)
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		loadStatuses();
+		std::string key = uidToKey(deviceUid);
+		if (m_statuses.find(key) == m_statuses.end())
+		{
+			struct device_status status;
+			memset(&status, 0, sizeof (status));
+			int statusRc = m_pSource->getDeviceStatus(deviceUid, &status);
+			m_statuses[key] = std::make_pair(statusRc, status);
+		}
+
+		rc = m_statuses[key].first;
+		if (rc == NVM_SUCCESS)
+		{
+			*pStatus = m_statuses[key].second;
+		}
+	}
+	return rc;
+}
+
+int NvmSnapshotApi::getDeviceDetails(const NVM_UID deviceUid, struct device_details *pDetails)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int rc = NVM_SUCCESS;
+	if (deviceUid == NULL || pDetails == NULL)
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else
+	{
+		std::string key = uidToKey(deviceUid);
+		if (m_details.find(key) == m_details.end())
+		{
+			struct device_details details;
+			memset(&details, 0, sizeof (details));
+			int detailsRc = m_pSource->getDeviceDetails(deviceUid, &details);
+			m_details[key] = std::make_pair(detailsRc, details);
+		}
+
+		// the library fills in what it can even on failure, so always copy
+		rc = m_details[key].first;
+		*pDetails = m_details[key].second;
+	}
+	return rc;
+}
+
+int NvmSnapshotApi::loadSensors(const NVM_UID deviceUid, const struct sensor **ppSensors)
+{
+	std::string key = uidToKey(deviceUid);
+	if (m_sensors.find(key) == m_sensors.end())
+	{
+		std::vector<struct sensor> sensors(NVM_MAX_DEVICE_SENSORS);
+		memset(&sensors[0], 0, sensors.size() * sizeof (struct sensor));
+		int sensorsRc = m_pSource->getSensors(deviceUid, &sensors[0], sensors.size());
+		m_sensors[key] = std::make_pair(sensorsRc, sensors);
+	}
+
+	*ppSensors = &m_sensors[key].second[0];
+	return m_sensors[key].first;
+}
+
+int NvmSnapshotApi::getSensors(const NVM_UID deviceUid, struct sensor *pSensors,
+		const NVM_UINT16 count)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int rc = NVM_SUCCESS;
+	const struct sensor *pCached = NULL;
+	if (deviceUid == NULL || pSensors == NULL)
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if (count < NVM_MAX_DEVICE_SENSORS)
+	{
+		rc = NVM_ERR_ARRAYTOOSMALL;
+	}
+	else if ((rc = loadSensors(deviceUid, &pCached)) == NVM_SUCCESS)
+	{
+		memmove(pSensors, pCached, NVM_MAX_DEVICE_SENSORS * sizeof (struct sensor));
+	}
+	return rc;
+}
+
+int NvmSnapshotApi::getSensor(const NVM_UID deviceUid, const enum sensor_type type,
+		struct sensor *pSensor)
+{
+	LogEnterExit logging(__FUNCTION__, __FILE__, __LINE__);
+
+	int rc = NVM_SUCCESS;
+	const struct sensor *pCached = NULL;
+	if (deviceUid == NULL || pSensor == NULL ||
+			(type < SENSOR_MEDIA_TEMPERATURE) || (type >= NVM_MAX_DEVICE_SENSORS))
+	{
+		rc = NVM_ERR_INVALIDPARAMETER;
+	}
+	else if ((rc = loadSensors(deviceUid, &pCached)) == NVM_SUCCESS)
+	{
+		memmove(pSensor, &pCached[type], sizeof (struct sensor));
+	}
+	return rc;
+}
+
+} /* namespace lib_interface */
+} /* namespace wbem */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of Intel Corporation nor the names of its contributors
+ *     may be used to endorse or promote products derived from this software
+ *     without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ * This file defines an NvmApi that reads each DIMM's data from the library once
+ * and answers every later query for it from memory.
+ */
+
+#ifndef NVMSNAPSHOTAPI_H_
+#define NVMSNAPSHOTAPI_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include "NvmApi.h"
+
+namespace wbem
+{
+namespace lib_interface
+{
+
+/*
+ * A consistent snapshot of the per-DIMM library data. It is meant to live for a
+ * single CIM request so that building many instances costs one library query per
+ * DIMM instead of one per instance. Anything not cached is passed to the source API.
+ */
+class NVM_CIM_API NvmSnapshotApi : public NvmApi
+{
+	public:
+		NvmSnapshotApi(NvmApi *pSource = NvmApi::getApi());
+
+		virtual ~NvmSnapshotApi();
+
+		virtual int getDeviceCount() const;
+
+		virtual int getDevices(struct device_discovery *pDevices, const NVM_UINT8 count) const;
+
+		virtual int getDeviceDiscovery(NVM_UID uid, struct device_discovery *pDevice);
+
+		virtual int getDeviceStatus(const NVM_UID deviceUid, struct device_status *pStatus);
+
+		virtual int getDeviceDetails(const NVM_UID deviceUid, struct device_details *pDetails);
+
+		virtual int getSensors(const NVM_UID deviceUid, struct sensor *pSensors, const NVM_UINT16 count);
+
+		virtual int getSensor(const NVM_UID deviceUid, const enum sensor_type type, struct sensor *pSensor);
+
+	private:
+		/*
+		 * Read the discovery data for every DIMM on first use
+		 */
+		void loadDevices() const;
+
+		/*
+		 * Read the status of every manageable DIMM on first use
+		 */
+		void loadStatuses();
+
+		/*
+		 * Read the sensors of a DIMM on first use, returns the library return code
+		 */
+		int loadSensors(const NVM_UID deviceUid, const struct sensor **ppSensors);
+
+		NvmApi *m_pSource;
+
+		mutable bool m_devicesLoaded;
+		mutable int m_devicesRc;
+		mutable std::vector<struct device_discovery> m_devices;
+
+		bool m_statusesLoaded;
+		std::map<std::string, std::pair<int, struct device_status> > m_statuses;
+		std::map<std::string, std::pair<int, struct device_details> > m_details;
+		std::map<std::string, std::pair<int, std::vector<struct sensor> > > m_sensors;
+};
+
+} /* namespace lib_interface */
+} /* namespace wbem */
+
+#endif /* NVMSNAPSHOTAPI_H_ */
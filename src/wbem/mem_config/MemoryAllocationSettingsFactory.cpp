@@ -483,7 +483,7 @@ NVM_UINT64 wbem::mem_config::MemoryAllocationSettingsFactory::getMemoryCapacityF
 		struct device_details details;
 		memset(&details, 0, sizeof(struct device_details));
 
-		if ((rc = nvm_get_device_details(pPool->dimms[i], &details)) == NVM_SUCCESS)
+		if ((rc = m_pApi->getDeviceDetails(pPool->dimms[i], &details)) == NVM_SUCCESS)
 		{
 			if (details.discovery.socket_id == socketId)
 			{
@@ -291,20 +291,38 @@ void wbem::mem_config::MemoryConfigurationServiceFactory::getDimmsForMemAllocSet
 
 	std::vector<struct device_discovery> devices;
 	m_pApi->getManageableDimms(devices);
+
+	// only need the status when filtering on new memory
+	std::vector<struct device_status_entry> statuses;
+	if (newMemoryOnly)
+	{
+		m_pApi->getAllDeviceStatuses(statuses);
+	}
+
 	for (size_t i = 0; i < devices.size(); i++)
 	{
 		if (devices[i].socket_id == socketId)
 		{
-			struct device_status status;
-			memset(&status, 0, sizeof(device_status));
-			int rc = NVM_SUCCESS;
-			if ((rc = m_pApi->getDeviceStatus(devices[i].uid, &status)) != NVM_SUCCESS)
+			bool isNew = false;
+			if (newMemoryOnly)
 			{
-				COMMON_LOG_ERROR("Could not get device status");
-				throw exception::NvmExceptionLibError(rc);
+				bool found = false;
+				for (size_t j = 0; j < statuses.size() && !found; j++)
+				{
+					if (uid_cmp(statuses[j].uid, devices[i].uid))
+					{
+						isNew = statuses[j].status.is_new;
+						found = true;
+					}
+				}
+				if (!found)
+				{
+					COMMON_LOG_ERROR("Could not get device status");
+					throw exception::NvmExceptionLibError(NVM_ERR_BADDEVICE);
+				}
 			}
 
-			if (status.is_new || !newMemoryOnly)
+			if (isNew || !newMemoryOnly)
 			{
 				dimms.push_back(core::memory_allocator::MemoryAllocationUtil::deviceDiscoveryToDimm(devices[i]));
 			}
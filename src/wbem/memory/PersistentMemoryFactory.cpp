@@ -720,7 +720,7 @@ NVM_UINT16 wbem::memory::PersistentMemoryFactory::getStorageRegionHealthState(co
 	// Storage region health is based on DIMM health
 	struct device_status status;
 	memset(&status, 0, sizeof (status));
-	int rc = nvm_get_device_status(dimmUid, &status);
+	int rc = m_pApi->getDeviceStatus(dimmUid, &status);
 	if (rc == NVM_SUCCESS)
 	{
 		if (status.is_missing)
@@ -796,7 +796,7 @@ NVM_UINT16 wbem::memory::PersistentMemoryFactory::getStorageRegionOperationalSta
 
 	struct device_status status;
 	memset(&status, 0, sizeof (status));
-	int rc = nvm_get_device_status(dimmUid, &status);
+	int rc = m_pApi->getDeviceStatus(dimmUid, &status);
 	if (rc != NVM_SUCCESS)
 	{
 		NVM_UID uidStr;
@@ -95,7 +95,7 @@ wbem::framework::Instance* wbem::memory::RawMemoryFactory::getInstance(
 
 		// get dimm discovery info
 		struct device_discovery dimmDiscovery;
-		int rc = nvm_get_device_discovery(dimmUid, &dimmDiscovery);
+		int rc = m_pApi->getDeviceDiscovery(dimmUid, &dimmDiscovery);
 
 		if (rc != NVM_SUCCESS)
 		{
@@ -130,7 +130,7 @@ wbem::framework::Instance* wbem::memory::RawMemoryFactory::getInstance(
 		// get dimm details
 		struct device_details dimmDetails;
 		memset(&dimmDetails, 0, sizeof(dimmDetails));
-		int getDeviceDetailsReturnCode = nvm_get_device_details(dimmDiscovery.uid, &dimmDetails);
+		int getDeviceDetailsReturnCode = m_pApi->getDeviceDetails(dimmDiscovery.uid, &dimmDetails);
 
 		// OperationalStatus
 		if (containsAttribute(OPERATIONALSTATUS_KEY, attributes))
@@ -150,6 +150,9 @@ throw (wbem::framework::Exception)
 	{
 		// get device_discovery information of all dimms
 		std::unique_ptr<struct device_discovery[]> dimms(new device_discovery[dev_count]);
+		// and the status of the manageable ones in one pass
+		std::unique_ptr<struct device_status_entry[]> statuses(new device_status_entry[dev_count]);
+		int status_count = nvm_get_all_device_statuses(statuses.get(), dev_count);
 		dev_count = nvm_get_devices(dimms.get(), dev_count);
 		if (dev_count > 0)
 		{
@@ -163,16 +166,21 @@ throw (wbem::framework::Exception)
 					NVM_UINT64 volatileCapacity = getDimmMemoryCapacity(uidStr);
 					if (volatileCapacity > 0)
 					{
-						struct device_status status;
-						int rc = nvm_get_device_status(dimms[device_index].uid, &status);
-						if (rc != NVM_SUCCESS)
+						int status_index = 0;
+						while (status_index < status_count &&
+							!uid_cmp(statuses[status_index].uid, dimms[device_index].uid))
+						{
+							status_index++;
+						}
+						if (status_index >= status_count)
 						{
 							// couldn't retrieve device status
 							currentHealthState = VOLATILEMEMORY_HEALTHSTATE_UNKNOWN;
 						}
 						else
 						{
-							updateHealthStateIncrementally(currentHealthState, status.health);
+							updateHealthStateIncrementally(currentHealthState,
+								statuses[status_index].status.health);
 						}
 					}
 				}
@@ -229,7 +237,7 @@ wbem::framework::UINT64 wbem::memory::VolatileMemoryFactory::getDimmMemoryCapaci
 	uid_copy(uidStr.c_str(), uid);
 
 	struct device_details details;
-	int rc = nvm_get_device_details(uid, &details);
+	int rc = m_pApi->getDeviceDetails(uid, &details);
 	if (rc != NVM_SUCCESS && rc != NVM_ERR_NOTMANAGEABLE)
 	{
 		// couldn't retrieve the capacity info
@@ -279,7 +279,8 @@ throw(wbem::framework::Exception)
 	attributes.push_back(ENABLEDSTATE_KEY);
 }
 
-framework::instances_t *NVDIMMSensorFactory::getInstances(framework::attribute_names_t &attributes)
+framework::instances_t *NVDIMMSensorFactory::getInstancesFromSnapshot(
+	framework::attribute_names_t &attributes)
 {
 	framework::instances_t *pResult = new framework::instances_t();
 
@@ -294,7 +295,7 @@ framework::instances_t *NVDIMMSensorFactory::getInstances(framework::attribute_n
 		NVM_UID uid;
 		uid_copy(uidStr.c_str(), uid);
 
-		int rc = nvm_get_sensors(uid, sensors, NVM_MAX_DEVICE_SENSORS);
+		int rc = m_pApi->getSensors(uid, sensors, NVM_MAX_DEVICE_SENSORS);
 		if (rc != NVM_SUCCESS)
 		{
 			delete pResult;
@@ -363,7 +364,7 @@ throw(framework::Exception)
 
 	int rc;
 	struct sensor sensor;
-	if ((rc = nvm_get_sensor(uid, type, &sensor)) != NVM_SUCCESS)
+	if ((rc = m_pApi->getSensor(uid, type, &sensor)) != NVM_SUCCESS)
 	{
 		throw exception::NvmExceptionLibError(rc);
 	}
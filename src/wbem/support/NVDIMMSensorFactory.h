@@ -86,8 +86,6 @@ public:
 
 	~NVDIMMSensorFactory();
 
-	framework::instances_t *getInstances(framework::attribute_names_t &attributes);
-
 	framework::Instance* getInstance(framework::ObjectPath &path,
 			framework::attribute_names_t &attributes) throw (framework::Exception);
 
@@ -167,6 +165,12 @@ public:
 	static framework::SINT32 nvmTempToCimTemp(const NVM_UINT64 &value);
 	static framework::SINT32 realTempToCimTemp(const framework::REAL32 &temp);
 
+protected:
+	/*!
+	 * Build each DIMM's sensor instances from one sensor read per DIMM
+	 */
+	framework::instances_t *getInstancesFromSnapshot(framework::attribute_names_t &attributes);
+
 private:
 	static const std::string& getCIMSensorDeviceName(int nvm_type) throw (framework::Exception);
 	static const framework::UINT16& getCIMSensorTypeCode(int nvm_type) throw (framework::Exception);